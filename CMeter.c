@@ -4,84 +4,331 @@
  * threshold is reached.  The time value determines the capacitance to an
  * accuracy determined primarily by the accuracy to which the resistance is
  * known.  Requires a calibrated clock for accurate timing.
- * 
- * The user can set a breakpoint with the debugger and view the registers.
+ *
+ * The user can set a breakpoint with the debugger and view the registers,
+ * or read the counts streamed over the (Timer_A) UART.
  *
  * The external circuit is:
  * P1.5 is connected to a resistor. The resistor and capacitor are connected
- * and also connected to P1.1. The other terminal of the capacitor is connected 
+ * and also connected to P1.1. The other terminal of the capacitor is connected
  * to ground.
  *
  * The equation for calculating C is:
  *   C = t / (R * ln(4));
- * An R of 47K is interesting as each overflow ("timerhi") represents:
+ * An R of 47K is interesting as each 2**16 us represents:
  *   C = 2**16 us / (47000 Ohms * ln(4) = ~1 uF
  * At this rate though a 330uF capacitor takes 22s to measure.
- * 
- * NOTE that the jumper for the TXD on the LaunchPad MUST BE REMOVED to use P1.1
- * in this project.
  *
- * The MSP430G2452 has two I/O ports, one "Comparator_A+" (aka Comparator A) and 
+ * NOTE that P1.1 is also wired to the LaunchPad's USB UART. With the jumpers
+ * in HW-UART orientation (as for G2452TimerBasedUART), the jumper carrying
+ * the host's TXD to P1.1 MUST BE REMOVED. The other jumper carries TXD
+ * from P1.2 to the host.
+ *
+ * The MSP430G2452 has two I/O ports, one "Comparator_A+" (aka Comparator A) and
  *  one "Timer_A" (aka Timer0_A3).
  * Port1 will be used for red and green LEDs, sensing the button, charging/discharging
  *  the RC network, sensing the voltage levels, and debugging the comparator.
- * Comparator_A+ is used for sensing analog inputs. It will be used to trigger 
+ * Comparator_A+ is used for sensing analog inputs. It will be used to trigger
  *  an event when the capacitor voltage reaches 1/4 Vcc during discharge.
- * Timer_A counts the duration of the discharge.
- 
+ * Timer_A counts the duration of the discharge. Between discharges it also
+ *  times the recharge (CCR0) and runs a transmit-only software UART (CCR1).
+
  Scheme:
  - Set charge/discharge pin to charge.
- - Wait for button press in LPM.
+ - Wait for button press in LPM (or not, if CONTINUOUS).
  - Set charge/discharge pin to discharge.
  - Set Timer to time and Comparator to compare.
  - Wait for results in LPM.
- - Use debugger to read {timerhi, TAR} and compute capacitance!
- - 
+ - {timerhi, TACCR1} contains the 32-bit count at the selected range.
+ - Recharge, and repeat for SHOTS discharges in all.
+ - Sort the shots, and average all but the TRIM lowest and TRIM highest.
+ - Recharge, and send the average scaled to 62.5ns ticks meanwhile.
+ - Pick the range for the next discharges from this one.
+ -
+ Ranges:
+ SMCLK is the calibrated 16MHz DCO divided by DIVS_x, and Timer_A further
+ divides it by ID_x. Range s is a total prescale of 2**s, s = 0..6, or a tick
+ of 62.5ns to 4us. The discharge time is set by R and C alone, so it is the
+ recharge and the number of overflow interrupts that the range saves:
+ - The range is picked so the next count fits in 15 bits, which leaves room for
+   the part to drift and still not overflow, ie no timerhi wakeups at all.
+ - Small parts get the full 62.5ns resolution.
+ - Recharge lasts 7 times the last discharge (~9.7 RC, to within 5e-5 of Vcc)
+   instead of a worst-case delay, so small parts are measured many times a second.
+   It stops at RECHARGE_MAX (~4.2s), so a saturated shot costs that, not
+   minutes: parts above ~9uF (at 47K) start their next shot short of Vcc.
+ - A discharge that runs past the 32-bit full scale (2**32 ticks of 62.5ns,
+   ~268s, at any range) is ended there by TA0_ISR and counted as saturated,
+   rather than waiting for a comparator that may never trip.
+
+ Shots:
+ A single capture sees the comparator's noise (even with CAF) and whatever the
+ RC pin was doing at that instant. SHOTS back to back discharges, with the
+ trimmed mean reported, reject the odd outlier and average the rest. The
+ spread (highest less lowest of those kept) is reported alongside, so a poor
+ contact or a leaky part shows up as such. The raw shots stay in shots[] for
+ the debugger.
+
+ Output:
+ With TEXT_OUTPUT, C is computed here and printed in pF, nF or uF, with the
+spread, eg:
+   4.702 uF ~ 1.125 nF
+ The computation is all integer: pF = count * K / 2**16, where K is
+ 62500 * 2**16 / (R * ln(4)) computed once at startup from CAL_R. (62500 is
+ the 62.5ns tick in fs, which makes count / (R * ln(4)) come out in pF.)
+ CAL_R lives in info flash, segment B, so a board's measured R can be patched
+ in without touching the code.
+
+ Otherwise each trimmed mean is sent as 'C' followed by the 32-bit count of
+ 62.5ns ticks, least significant byte first. (No spread.) 0xFFFFFFFF means a
+ kept shot saturated: the part is too large to time, and text output prints
+ "over range". (An open socket discharges at once, and reads a few pF.)
+ See serial-logger.py:
+   python3 serial-logger.py cmeter.log --fmt "<I" --sync 43
+
  Notes:
  There are lots of ways to do this. The many choices resulted in settling for
  my favorite: conserving code space and RAM. Letting the comparator interrupt
- (without involving the Timer capture feature) would have been a good choice 
- but then its ISR would have to either turn off the Timer or squirrel away the 
+ (without involving the Timer capture feature) would have been a good choice
+ but then its ISR would have to either turn off the Timer or squirrel away the
  timer values while interrupts were disabled. Letting the Timer ISR deal with the
- Timer interrupts seemed like the better choice. I chose to leave the comparator 
+ Timer interrupts seemed like the better choice. I chose to leave the comparator
  running so I could view the output on P1.7, but one could also turn in off most
  of the time to save power.
  */
- 
+
 #include <msp430.h>
- 
+#include <stdint.h>
+
+#define CONTINUOUS  1   // 1: Measure continuously. 0: Measure on each button press.
+#define TEXT_OUTPUT 1   // 1: Print C in engineering units. 0: Send raw counts.
+#define SHOTS       8   // Discharges per result
+#define TRIM        2   // Shots dropped at each end. SHOTS > 2 * TRIM.
+
 // Pre-defined Launchpad pins
 #define LED1    BIT0    // RED LED out
 #define LED2    BIT6    // GRN LED out
 #define BTN1    BIT3    // Left-Button in
-#define AIN1	BIT1    // For TimerA comparitor in. REMOVE TXD JUMPER on Launchpad.
+#define AIN1	BIT1    // For TimerA comparitor in. REMOVE RXD JUMPER on Launchpad.
+#define TXD     BIT2    // TA0.1 out, software UART to host
 // Free pins
 #define VCTL    BIT5    // For Voltage Control out
 #define CAO     BIT7    // Monitor Comparator
- 
+
+// Software UART, 9600 Baud at SMCLK = 16MHz (see G2452TimerBasedUART)
+#define Bitime80 1333                       // ~ 80% bit length
+#define Bitime99 1650                       // ~ 99% bit length
+
+#define RANGE_MAX   6                       // 2**6 = DIVS_3 * ID_3
+
+#define CAL_R       47000                   // Ohms. Default, until measured.
+
+// Charge 7 discharges' worth, up to range 6's full scale in SMCLK/1 ticks
+#define RECHARGE_MAX (0xFFFFFFFF >> RANGE_MAX)
+#define RECHARGE(t) (((t) > RECHARGE_MAX / 7) ? RECHARGE_MAX : ((t) << 3) - (t))
+
+/*  Calibration, info flash segment B  */
+const uint32_t cal_r __attribute__((section(".infoB"))) = CAL_R;
+
 /*  Global Variables  */
-unsigned int timerhi;
- 
+volatile unsigned int timerhi;              // Discharge overflows
+#define TIMERHI_MAX (0xFFFF >> range)       // Last overflow within the 32-bit full scale
+volatile unsigned int rechi;                // Recharge overflows left
+volatile unsigned char TXData;
+volatile unsigned char TXBitCnt;
+unsigned char range;                        // Prescale is 2**range
+uint32_t count;                             // Trimmed mean, 62.5ns ticks
+uint32_t spread;                            //  and highest less lowest kept
+uint32_t shots[SHOTS];                      // Raw shots, 62.5ns ticks
+uint32_t k_pf;                              // pF per tick, Q16
+
+// Transmit character from TXData Buffer. Timer must be at SMCLK/1.
+void TX_UART (unsigned char c)
+{
+  while ( TACCTL1 & CCIE );                 // Wait for previous TX completion
+  TXData = c;
+  TXBitCnt = 10;                            // Load Bit counter, 8 data + Start + Stop
+  TACCR1 = TAR +14;                         // Current state of TA counter
+                                            // + 14 TA clock cycles till first bit (after next statment)
+  TACCTL1 =  OUTMOD2 + OUTMOD0 + CCIE;      // Reset on Interrupt. E.I. TXD <= '0' (Start Bit)
+}                                           // => CCIE doubles as 'active' flag
+
+// Discharge through R at the current range. Returns the raw 32-bit count,
+// 0xFFFFFFFF if TA0_ISR gave up on it at full scale.
+uint32_t Discharge (void)
+{
+    // SMCLK = DCO / DIVS_x, then Timer_A / ID_x
+    BCSCTL2 = (range > 3) ? (range - 3) << 1 : 0;
+    timerhi = 0;                            // Clear hi-order timer register
+    __disable_interrupt();                  // Capture can't wake us before LPM
+
+    // Start RC network discharge, ie GO!!!!
+    P1OUT &= ~VCTL;
+
+    // Timer A:
+    // Use SMCLK, divide, continuous mode, clear TAR, interrupt on overflow
+    TACTL = TASSEL_2 | ((range > 3) ? ID_3 : range << 6) | MC_2 | TACLR | TAIE;
+    // Timer Capture/Compare Reg 1:
+    // Falling edge, CAOUT for input, synchronize, capture, enable interrupt
+    // OUT keeps TXD idle (HI) while CCR1 is busy capturing
+    TACCTL1 = CM_2 | CCIS_1 | SCS | CAP | CCIE | OUT;
+    _BIS_SR(LPM0_bits + GIE);               // Wait for Comparator interrupt
+
+    BCSCTL2 = 0;                            // SMCLK back to DCO/1 for UART
+    return ((uint32_t) timerhi << 16) | TACCR1;
+}
+
+// Start charging through R for t ticks of SMCLK/1. Settle() waits for the end.
+// The UART can transmit meanwhile, as it also runs from SMCLK/1.
+void Recharge (uint32_t t)
+{
+    P1OUT |= VCTL;                          // Charge again
+    TACTL = TASSEL_2 | MC_2 | TACLR;        // SMCLK/1, continuous
+    rechi = t >> 16;                        // Overflows, then the remainder
+    TACCR0 = t;
+    TACCTL0 = CCIE;
+}
+
+void Settle (void)
+{
+    while (TACCTL1 & CCIE);                 // Wait for the stop bit
+    __disable_interrupt();                  // No wakeup between test and LPM
+    while (TACCTL0 & CCIE) {                // Wait for the charge
+        _BIS_SR(LPM0_bits + GIE);
+        __disable_interrupt();
+    }
+    __enable_interrupt();
+}
+
+// (x * k) >> 16, from 16 x 16 bit products only. No 64-bit math.
+uint32_t mulq16 (uint32_t x, uint32_t k)
+{
+    unsigned xl = x, xh = x >> 16, kl = k, kh = k >> 16;
+
+    return x * kh + (uint32_t) xh * kl + (((uint32_t) xl * kl) >> 16);
+}
+
+// K = 62500 * 2**16 / (R * ln(4)), where ln(4) = 1 + 25316/2**16
+void Calibrate (void)
+{
+    uint32_t r = *(const volatile uint32_t *) &cal_r;   // As patched, not as compiled
+    uint32_t rln4 = r + (r >> 16) * 25316 + (((uint32_t) (unsigned) r * 25316) >> 16);
+
+    k_pf = 4096000000UL / rln4;
+}
+
+// Sort shots[] (insertion sort, SHOTS is small), and reduce to count and spread.
+// A saturated shot kept makes count 0xFFFFFFFF: the part is too large to time.
+void Trim (void)
+{
+    uint32_t t;
+    uint64_t sum = 0;                           // Kept shots can reach 2**32 each
+    unsigned char i, j;
+
+    for (i = 1; i < SHOTS; i++) {
+        t = shots[i];
+        for (j = i; j && shots[j - 1] > t; j--)
+            shots[j] = shots[j - 1];
+        shots[j] = t;
+    }
+    spread = shots[SHOTS - TRIM - 1] - shots[TRIM];
+    if (shots[SHOTS - TRIM - 1] == 0xFFFFFFFF) {
+        count = 0xFFFFFFFF;
+        return;
+    }
+    for (i = TRIM; i < SHOTS - TRIM; i++)
+        sum += shots[i];
+    count = sum / (SHOTS - 2 * TRIM);
+}
+
+#if TEXT_OUTPUT
+// Print routines, after oPossum-printf.c. TX_UART waits, so no putc wait here.
+static inline void putc(const unsigned c) { TX_UART(c); }
+
+// Output string to UART
+void puts(const char *s) { while(*s) putc(*s++); }
+
+// Print x / 10**scale to dp (<= scale) decimals, via DADD (see oPossum-printf.c)
+void print_fixed(uint32_t x, const unsigned scale, const unsigned dp)
+{
+    uint32_t lo = 0; unsigned hi = 0, n = 32, p = 10, d; char lead = 1;
+    if(!(x >> 16)) x <<= 16, n = 16;            // 16-bit values: half the passes
+    while(n && !(x & 0x80000000)) x <<= 1, --n; // Skip leading zeros
+    while(n--) {
+        hi = __bcd_add_short(hi, hi) | (lo >= 0x50000000);
+        lo = __bcd_add_long(lo, lo) | (x >> 31); x <<= 1;
+    }
+    hi = (hi << 8) | (unsigned)(lo >> 24);      // hi: digits 9..6, lo: 5..0 at the top
+    lo <<= 8;
+    do {
+        d = hi >> 12; hi = (hi << 4) | (unsigned)(lo >> 28); lo <<= 4;
+        if(p == scale) putc('.');
+        if(d || p <= scale + 1) lead = 0;       // Units digit and on always print
+        if(!lead) putc('0' + d);
+    } while(--p > scale - dp);
+}
+
+// Print ticks as C: pF up to 9999, then nF and uF to three decimals
+void print_c(uint32_t ticks)
+{
+    uint32_t c = mulq16(ticks, k_pf);
+
+    if (c < 10000)
+        print_fixed(c, 0, 0), puts(" pF");
+    else if (c < 10000000)
+        print_fixed(c, 3, 3), puts(" nF");
+    else
+        print_fixed(c, 6, 3), puts(" uF");
+}
+
+// Print C and its spread
+void Send (void)
+{
+    if (count == 0xFFFFFFFF) {
+        puts("over range\r\n");
+        return;
+    }
+    print_c(count); puts(" ~ "); print_c(spread); puts("\r\n");
+}
+#else
+// Send the count: 'C', then LSB first
+void Send (void)
+{
+    unsigned char *p = (unsigned char *) &count;
+    unsigned char n;
+
+    TX_UART('C');
+    for (n = 4; n; n--)
+        TX_UART(*p++);
+}
+#endif
+
 void main(void) {
+    uint32_t raw;
+    unsigned char n;
+
     WDTCTL = WDTPW + WDTHOLD;   // disable watchdog
 
     /* Eliminate linker warnings for unused port. */
     P2DIR = 0xFF;
     P2OUT = 0x00;
 
-    /* Set DCO to calibrated 1 MHz clock */
-    BCSCTL1 = CALBC1_1MHZ;
-    DCOCTL = CALDCO_1MHZ;
+    /* Set DCO to calibrated 16 MHz clock */
+    DCOCTL = 0;
+    BCSCTL1 = CALBC1_16MHZ;
+    DCOCTL = CALDCO_16MHZ;
 
     /* Port 1 Config */
     // P1.7 CAO, out, connected to CAOUT (Comparator_A+ output) for debug
     // P1.5 VCTL, out, RC voltage control
     // P1.3 BTN1, in, button. (OUT and REN together select pullup on input)
     // P1.3 also interrupts
+    // P1.2 TXD, out, TA0.1 (OUT idles HI)
     // P1.1 AIN1, in, Cap voltage - selected by Comparator module
+    TACCTL1 = OUT;                      // TXD <= '1' for initial idle state
     P1OUT = CAO | LED2 | VCTL | BTN1;   // Observe CAOUT, GRN ON, charge RC network, pull BTN1 HI
     P1DIR = ~(BTN1 | AIN1);             // All outputs except P1.3 and P1.1.
-    P1SEL = CAO;                        // Selects CAOUT to P1.7
+    P1SEL = CAO | TXD;                  // Selects CAOUT to P1.7, TA0.1 to P1.2
     P1SEL2= 0;                          //  cont.
     P1REN = BTN1;                       // BTN1 requires a pullup. R34 not populated.
     P1IES = BTN1;                       // Interrupt Edge Select =< high to low
@@ -90,36 +337,49 @@ void main(void) {
     // The comparator output is used to capture the timer and the timer interrupts
     CACTL1 = CARSEL | CAREF_1 | CAON;   // - pin, 0.25 Vcc, ON, (no interrupt)
     CACTL2 = P2CA4 | CAF;               // Input CA1 on + pin, filter output.
-    
+
+    Calibrate();                        // K from CAL_R
+    __enable_interrupt();               // UART and recharge are interrupt driven
+    range = RANGE_MAX;                  // Unknown part: start coarse
+    Recharge(16000000);                 // ~1s, plenty for anything under ~100uF
+    Settle();
+
     for(;;) {
+#if !CONTINUOUS
         /* Arm Button interrupt and wait */
         P1IFG = 0;                  // Clear Interrupt FlaGs before enabling
         P1IE = BTN1;                // Interrupt Enable for BTN1 only
         _BIS_SR(LPM0_bits + GIE);   // Wait for Button interrupt
-        
-        /* Start discharge, clear timer, and wait */
+#endif
+
+        /* Discharge, and recharge for just as long as this part needs */
         P1OUT ^= (LED2 | LED1);     // GRN OFF; RED toggle - measuring
-        timerhi = 0;                // Clear hi-order timer register
-        
-        // Start RC network discharge, ie GO!!!!
-        P1OUT &= ~VCTL;
-        
-        // Timer A:
-        // Use SMCLK, no division, continuous mode, clear TAR, interrupt on overflow
-        TACTL = TASSEL_2 | ID_0 | MC_2 | TACLR | TAIE;
-        // Timer Capture/Compare Reg 1:
-        // Falling edge, CAOUT for input, synchronize, capture, enable interrupt
-        TACCTL1 = CM_2 | CCIS_1 | SCS | CAP + CCIE;
-        _BIS_SR(LPM0_bits);         // Wait for Comparator interrupt
-        
-        P1OUT |= VCTL | LED2;       // Charge again, signal GRN waiting for button
+        for (n = 0; ; ) {
+            raw = Discharge();
+            shots[n] = (raw > (0xFFFFFFFF >> range)) ? 0xFFFFFFFF : raw << range;
+            if (++n == SHOTS)
+                break;
+            Recharge(RECHARGE(shots[n - 1]));
+            Settle();
+        }
+
         /* Record values - set break here */
-        // {timerhi, TAR} contains 32-bit count
+        // count contains the trimmed mean at SMCLK/1, shots[] the sorted shots
+        Trim();
+        P1OUT |= LED2;              // Signal GRN done
         __no_operation();
         __no_operation();
+
+        /* Next range: largest count of 15 bits, at the best resolution */
+        for (range = 0; range < RANGE_MAX && (count >> range) >= 0x8000; range++);
+
+        /* Charge again, and send the result meanwhile */
+        Recharge(RECHARGE(shots[SHOTS - 1]));
+        Send();
+        Settle();
     }
 } // main
- 
+
 /*  Interrupt Service Routines  */
 // Port1 interrupt is enabled for button push only
 #pragma vector = PORT1_VECTOR
@@ -127,18 +387,60 @@ __interrupt void P1_ISR(void) {
     P1IE = 0;                       // Inhibit future P1 interrupts (until next time)
     __low_power_mode_off_on_exit(); // Button pressed; continue main program
 } // P1_ISR
-    
 
-// Timer_A can interrupt for capture, triggered by the comparator, 
+
+// Timer_A CCR0 times the recharge: rechi overflows, then TACCR0 itself.
+#pragma vector = TIMER0_A0_VECTOR
+__interrupt void TA0_CCR0_ISR(void) {
+    if (rechi)                          // A full 2**16 still to go
+        rechi--;
+    else {
+        TACCTL0 = 0;                    // Done. CCIE doubles as 'active' flag
+        __low_power_mode_off_on_exit(); // Continue main program
+    }
+} // TA0_CCR0_ISR
+
+
+// Timer_A can interrupt for capture, triggered by the comparator,
 //  or if it overflows. Captures disables future interrupts and exits LPM,
 //  whereas Timer overflows just keep counting.
+// Outside of a discharge CCR1 is the UART transmitter instead.
 #pragma vector = TIMER0_A1_VECTOR
-__interrupt void TA0_ISR(void) {        // Reading TAIV clears highest priority int
-    if (TAIV == 2) {                    // If Capture:
-        TACTL = 0;                      //  Turn off Timer A interrupt
-        TACCTL1 = 0;                    //  Turn off Capture interrupt
-        __low_power_mode_off_on_exit(); //  Continue main program
-    } else {                            // Timer A overflow
-        timerhi++;                      //  Record overflow and keep counting
+__interrupt void TA0_ISR(void) {
+    switch (__even_in_range(TAIV, 10)) {    // Reading TAIV clears highest priority int
+    case 2:
+        if (TACCTL1 & CAP) {                // If Capture:
+            // An overflow pending behind a capture taken just after it
+            // belongs to this count. (TAIV reports the capture first.)
+            if ((TACTL & TAIFG) && !(TACCR1 & 0x8000))
+                timerhi++;
+            TACTL = 0;                      //  Turn off Timer A interrupt
+            TACCTL1 = OUT;                  //  Turn off Capture interrupt, TXD idle
+            __low_power_mode_off_on_exit(); //  Continue main program
+        } else if (TXBitCnt == 0)           // All bits TXed?
+            TACCTL1 &= ~CCIE;               //  Yes: disable interrupt, signal completion
+        else {
+            TXBitCnt --;
+            TACCTL1 &= ~ OUTMOD2;           // (Assume) SET, TX <= '1' on next interrupt
+            if (TXBitCnt == 0)              // Stop bit next?
+                TACCR1 += Bitime80;         // Yes, and SET was correct
+            else {
+                TACCR1 += Bitime99;         // Add Offset to CCR1
+                if (!(TXData & 0x01))
+                    TACCTL1 |= OUTMOD2;     // Correct to RESET, TX <= '0' on next interrupt
+            }
+            TXData = TXData >> 1;
+        }
+        break;
+    case 10:                                // Timer A overflow
+        if (timerhi == TIMERHI_MAX) {       // Past full scale: no capture to wait for
+            TACTL = 0;                      //  End the discharge
+            TACCTL1 = OUT;
+            TACCR1 = 0xFFFF;                //  Counts 0xFFFFFFFF, saturated at any range
+            timerhi = 0xFFFF;
+            __low_power_mode_off_on_exit();
+        } else
+            timerhi++;                      //  Record overflow and keep counting
+        break;
     }
 } // TA0_ISR
@@ -2,6 +2,15 @@
 #include <intrinsics.h>
 #include <stdint.h>
 
+// FM25V40 BoosterPack log (see lib/flog.h): each good reading is also appended
+// to F-RAM, 4 bytes (temperature, humidity, as printed x10), for upload later
+// through G2452FRAMloader. Remove the GRN LED jumper: P1.6 is MISO.
+#define FRAM_LOG    0                           // 1: log to F-RAM as well
+#if FRAM_LOG
+#include "lib/fm25v40.h"
+#include "lib/flog.h"
+#endif
+
 /*
    main.c
 
@@ -15,6 +24,7 @@
    SMCLK is sourced from DCO/8 or 1MHz (1 us).
    - Timer1 clock is SMCLK/8 or 125KHz (8 us)
    ACLK not initialized.
+   With FRAM_LOG, readings also go to the FM25V40 BoosterPack over USCI_B0.
 
    Using MSP430G2553, 20-pin DIP.
    P2.4 is primary input to TimerA1.CCI2A.
@@ -70,41 +80,77 @@ const unsigned char DHT = BIT4;
 const unsigned long smclk_freq = 1000000;       // SMCLK frequency in hertz
 const unsigned long bps = 9600;                 // Async serial bit rate
 
+// TX ring buffer, drained by the USCI TX interrupt (see oPossum-printf.c)
+// A whole line of readings fits, so main goes straight back to LPM0.
+#define TX_SIZE     64                          // Power of 2, at most 256
+#define TX_BLOCK    0                           // Full: wait for room
+#define TX_DROP     1                           // Full: discard the char
+#define TX_COUNT    2                           // Full: discard and count in tx_lost
+#define TX_FULL     TX_BLOCK                    // Policy when the buffer is full
+
+static char tx_buf[TX_SIZE];
+static volatile unsigned char tx_head, tx_tail; // Put at head, send from tail
+unsigned tx_lost;                               // Chars discarded (TX_COUNT)
+
 // Output char to UART
-static inline void putc(const unsigned c) { while(UCA0STAT & UCBUSY); UCA0TXBUF = c; }
+void putc(const unsigned c)
+{
+    const unsigned char h = (tx_head + 1) & (TX_SIZE - 1);
+    if(h == tx_tail) {                          // Full?
+#if TX_FULL == TX_BLOCK
+        while(h == tx_tail);                    // ISR makes room
+#else
+#if TX_FULL == TX_COUNT
+        ++tx_lost;
+#endif
+        return;
+#endif
+    }
+    tx_buf[tx_head] = c; tx_head = h;
+    IE2 |= UCA0TXIE;                            // TXIFG is set while idle, so this starts it
+}
 
 // Output string to UART
 void puts(const char *s) { while(*s) putc(*s++); }
 
-// Print unsigned int X 10
-void print_ux10(unsigned x)
+// Print x / 10**scale to dp (<= scale) decimals, via DADD (see oPossum-printf.c)
+void print_fixed(uint32_t x, const unsigned scale, const unsigned dp)
 {
-    static const unsigned dd[] = { 10000, 1000, 100, 10, 1 }; // 10000 degrees is overkill
-    const unsigned *dp = dd; unsigned d;
-    if(x) { while(x < *dp) ++dp;
-        do { d = *dp++; char c = '0'; while(x >= d) ++c, x -= d; putc(c); } while(!(d & 2));
-    } else putc('0');
-    putc('.'); putc('0' + x);
+    uint32_t lo = 0; unsigned hi = 0, n = 32, p = 10, d; char lead = 1;
+    if(!(x >> 16)) x <<= 16, n = 16;            // 16-bit values: half the passes
+    while(n && !(x & 0x80000000)) x <<= 1, --n; // Skip leading zeros
+    while(n--) {
+        hi = __bcd_add_short(hi, hi) | (lo >= 0x50000000);
+        lo = __bcd_add_long(lo, lo) | (x >> 31); x <<= 1;
+    }
+    hi = (hi << 8) | (unsigned)(lo >> 24);      // hi: digits 9..6, lo: 5..0 at the top
+    lo <<= 8;
+    do {
+        d = hi >> 12; hi = (hi << 4) | (unsigned)(lo >> 28); lo <<= 4;
+        if(p == scale) putc('.');
+        if(d || p <= scale + 1) lead = 0;       // Units digit and on always print
+        if(!lead) putc('0' + d);
+    } while(--p > scale - dp);
 }
 
-// Print signed int X 10
-void print_ix10(const int x) { if(x < 0) putc('-'); print_ux10((x < 0) ? -x : x); }
+// Print signed x / 10**scale
+void print_fixed_i(const int32_t x, const unsigned scale, const unsigned dp)
+{ if(x < 0) putc('-'); print_fixed((x < 0) ? -x : x, scale, dp); }
 
 // Print signed c X 10 in degrees F
 void print_fx10(const int x) {
     int f;
-    f = ((x << 3) + x) + 1603;                       // f*10*5 = c*10*9 + 32*10*5 + 0.05*10*5 (for rounding)
+    f = (x << 4) + (x << 1) + 3200;                  // f*100 = c*10*18 + 32*100
     if (f < 0) {putc('-'); f = -f;}
-
-    static const unsigned dd[] = { 50000, 5000, 500, 50, 5 }; // 1000 degrees is overkill
-    const unsigned *dp = dd; unsigned d;
-    if(f) { while(f < *dp) ++dp;
-        do { d = *dp++; char c = '0'; while(f >= d) ++c, f -= d; putc(c); } while(!(d & 2));
-    } else putc('0');
-    putc('.');
-    d = *dp++; char c = '0'; while(f >= d) ++c, f -= d; putc(c);
+    print_fixed(f + 5, 2, 1);                        // Round (+0.05), then cut to 1 decimal
 }
 
+// Compile-time printf (see oPossum-printf.c): no format string to store or parse
+#define PRINT(...)  ((void)(__VA_ARGS__))
+#define F_S(s)      puts(s)                     // %s
+#define F_UF(x, n)  print_fixed((x), (n), (n))  // %.Nu
+#define F_DF(x, n)  print_fixed_i((x), (n), (n)) // %.Nd
+
 
 //// Begin non-UART code
 #define TRIGGER_LO 124                                  // (1ms) 1000us / 8us => 125.
@@ -178,6 +224,11 @@ void main(void) {
 
   puts("\r\nDHT22 Sensor Readings\r\n");
 
+#if FRAM_LOG
+  FM25V40_Init(USIDIV_0);                     // SCK = SMCLK = 1MHz. After P1SEL is set up.
+  FLOG_Open(2 * sizeof(int16_t));             // Carry on from the last reset, if it's ours
+#endif
+
   /// Main loop
   while (1) {
     __low_power_mode_0();                               // Wait 0.524s * 4 all together
@@ -193,15 +244,21 @@ void main(void) {
             temperature ^= 0x7FFF;                      // Make 1's complement
             temperature += 1;                           // And 2's complement
         }
+#if FRAM_LOG
+        {
+            const int16_t rec[2] = { temperature, humidity };
+            FLOG_Append(rec);                           // ~0.2ms at 1MHz SCK
+        }
+#endif
     } else {
         P1OUT |= BIT0;                                  // Red LED ON
     }
     P1OUT ^= BIT6;                                      // Grn LED Toggle (as heartbeat)
 
     // Print results to serial terminal
-    print_ix10(temperature); puts(" C  ");
-    print_fx10(temperature); puts(" F  ");
-    print_ux10(humidity); puts(" %RH\r\n");
+    PRINT(F_DF(temperature, 1), F_S(" C  "),
+          print_fx10(temperature), F_S(" F  "),
+          F_UF(humidity, 1), F_S(" %RH\r\n"));
 
     __low_power_mode_0();                               // Wait
     __low_power_mode_0();                               // Wait
@@ -251,3 +308,13 @@ void main(void) {
       __low_power_mode_off_on_exit();
   }
 }
+
+// Send the next buffered char. Disable when empty; putc re-enables.
+// Doesn't wake main: LPM0 keeps SMCLK, and so the UART, running.
+#pragma vector = USCIAB0TX_VECTOR
+__interrupt void USCI0TX_ISR(void)
+{
+    UCA0TXBUF = tx_buf[tx_tail];
+    tx_tail = (tx_tail + 1) & (TX_SIZE - 1);
+    if(tx_tail == tx_head) IE2 &= ~UCA0TXIE;
+}
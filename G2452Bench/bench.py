@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# Cycle counts of the hot routines, on the instruction set simulator
+# (../sim/iss.py), checked against baseline.txt. A count above its baseline
+# fails, so "make bench" stops on a regression. So does one over its limit in
+# MARKS, a budget the code must meet on the board, which "make baseline" can't
+# move. A count with no baseline is shown as unmeasured until "make baseline".
+#   python3 bench.py            compare
+#   python3 bench.py --update   write the current counts as the baseline
+import os
+import sys
+
+here = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(here, '..', 'sim'))
+import iss
+
+BASELINE = os.path.join(here, 'baseline.txt')
+
+# Benchmark ids of main.c: name, whether to count only the ISR cycles, and
+# the most it may ever take (None: only the baseline), whatever the baseline.
+MARKS = {
+    1: ('tdac_play_sample', False, None),
+    2: ('fm25v40_read_byte', False, None),
+    3: ('suart_rx_isr_byte', True, None),
+    4: ('suart_tx_isr_byte', True, None),
+    5: ('tdac_sd2_period', False, 128),     # One 64-tick PWM period at SMCLK = MCLK / 2
+    6: ('tdac_list_join', False, 512),      # A join's re-address within one 256-tick period
+}
+
+# ISRs of other folders, run as built: name, ELF, vector, cycles to run.
+# The worst case of all calls is the count.
+ISRS = [
+    ('slaa804_sine_isr', '../G2452slaa804/MSP430G2452.out', 0xFFF2, 200000),
+    ('dds_isr', '../G2452PlayDDS/MSP430G2452.out', 0xFFF2, 200000),
+]
+
+
+def marks():
+    """Counts per unit of each BENCH_END in main.c."""
+    m = iss.MSP430()
+    m.load(os.path.join(here, 'MSP430G2452.out'))
+    counts = {}
+    begin = [0, 0]
+
+    def mark(v, start, end):
+        if v == 0:
+            begin[:] = [end, m.isr_cycles]
+            return
+        name, isr_only, limit = MARKS[v & 15]
+        n = m.isr_cycles - begin[1] if isr_only else start - begin[0]
+        counts[name] = n / (v >> 4)
+
+    m.watch[m.symbols['bench']] = mark
+    try:
+        m.run(10000000)
+        sys.exit('bench: main.c did not finish')
+    except iss.Halt:
+        pass
+    return counts
+
+
+def isrs():
+    counts = {}
+    for name, elf, vector, cycles in ISRS:
+        m = iss.MSP430()
+        m.load(os.path.join(here, elf))
+        try:
+            m.run(cycles)
+        except iss.Halt:
+            pass
+        if vector not in m.isr:
+            sys.exit('bench: %s never ran' % name)
+        counts[name] = m.isr[vector][2]
+    return counts
+
+
+def main():
+    counts = marks()
+    counts.update(isrs())
+
+    if '--update' in sys.argv[1:]:
+        with open(BASELINE, 'w') as f:
+            f.write('# Cycles per unit (see bench.py). Rewrite with "make baseline".\n')
+            for name in sorted(counts):
+                f.write('%-24s %g\n' % (name, round(counts[name], 1)))
+        print('bench: wrote', BASELINE)
+        return
+
+    base = {}
+    for line in open(BASELINE):
+        if line.strip() and not line.startswith('#'):
+            name, n = line.split()
+            base[name] = float(n)
+
+    limits = {name: limit for name, isr_only, limit in MARKS.values()}
+    failed = False
+    for name in sorted(counts):
+        n = round(counts[name], 1)
+        b = base.get(name)
+        limit = limits.get(name)
+        if limit is not None and n > limit:
+            note = 'OVER LIMIT %g' % limit
+            failed = True
+        elif b is None:
+            note = 'unmeasured, make baseline'
+        elif n > b:
+            note = 'REGRESSION'
+            failed = True
+        elif n < b:
+            note = 'better, make baseline'
+        else:
+            note = ''
+        print('%-24s %8g %8s  %s' % (name, n, '-' if b is None else '%g' % b, note))
+    if failed:
+        sys.exit('bench: cycle counts went up or over a limit')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,111 @@
+//******************************************************************************
+//  Cycle counts of the hot routines
+//
+//  Not for the board: bench.py runs this on ../sim/iss.py and notes the cycle
+//  count at each write of bench. BENCH_BEGIN() starts a count and
+//  BENCH_END(id, per) ends it, for per units (samples, bytes) of benchmark id.
+//  The count runs from after the BEGIN write to before the END write.
+//
+//  MCLK = SMCLK = 16MHz, so a timer count is a cycle. The waits on the
+//  hardware are kept short:
+//    TDAC_Play      TA0CCR0 = 1 ends a PWM period every 2 cycles, so each
+//    TDAC_PlaySD    sample costs its interpolation plus one pass of the wait.
+//                   TDAC_PlaySD has 128 cycles per period on the board.
+//    FM25V40_Read   USIDIV_0, as G2452PlayFRAM: 8 cycles per byte shifted.
+//    PlayFRAMList   Each stored sample a clip of its own, so every one is a
+//                   join: its re-address, read and interpolation must fit in
+//                   one PWM period, 512 cycles on the board.
+//    UART ISRs      The timer is stopped and CCIFG set by software, once per
+//                   bit, and bench.py counts only the cycles in the ISRs.
+//******************************************************************************
+#include <msp430.h>
+#include "tdac.h"
+#include "fm25v40.h"
+#include "suart.h"
+
+volatile unsigned int bench;
+#define BENCH_BEGIN()       (bench = 0)
+#define BENCH_END(id, per)  (bench = ((per) << 4) | (id))
+
+// Benchmark ids, named in bench.py
+enum { B_TDAC = 1, B_FRAM, B_UART_RX, B_UART_TX, B_TDAC_SD, B_TDAC_JOIN };
+
+// A triangle, so the interpolation steps both ways
+static const char audio[65] = {
+  128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+  255, 248, 240, 232, 224, 216, 208, 200, 192, 184, 176, 168, 160, 152, 144, 136,
+  128, 120, 112, 104,  96,  88,  80,  72,  64,  56,  48,  40,  32,  24,  16,   8,
+    0,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120,
+  128
+};
+
+// One-sample clips
+static tdac_clip joins[32];
+
+void main (void)
+{
+  unsigned char i;
+
+  WDTCTL = WDTPW + WDTHOLD;                 // Stop watchdog timer
+  DCOCTL = CALDCO_16MHZ;                    // DCO = 16MHz calibrated
+  BCSCTL1 = CALBC1_16MHZ;                   // MCLK = SMCLK
+
+  // TDAC_Play: per sample played, 4 per stored
+  TDAC_Init();
+  TA0CCTL0 = 0;                             // Polled, no interrupt
+  TA0CCR0 = 1;
+  BENCH_BEGIN();
+  TDAC_Play(audio, sizeof audio);
+  BENCH_END(B_TDAC, 4 * (sizeof audio - 1) + 1);
+
+  // TDAC_PlaySD, second order: per PWM period, 16 per stored sample
+  TDAC_InitSD();
+  TA0CCTL0 = 0;
+  TA0CCR0 = 1;
+  BENCH_BEGIN();
+  TDAC_PlaySD(audio, sizeof audio, 2);
+  BENCH_END(B_TDAC_SD, 16 * (sizeof audio - 1) + 1);
+
+  // FM25V40_Read: per byte
+  FM25V40_Init(USIDIV_0);
+  FM25V40_Addr(0);
+  BENCH_BEGIN();
+  for (i = 64; i != 0; i--)
+    FM25V40_Read();
+  BENCH_END(B_FRAM, 64);
+  FM25V40_Stop();
+
+  // TDAC_PlayFRAMList: per join
+  for (i = 0; i < 32; i++) {
+    joins[i].addr = 32UL * i;
+    joins[i].size = 1;
+  }
+  TDAC_Init();
+  TA0CCTL0 = 0;
+  TA0CCR0 = 1;
+  BENCH_BEGIN();
+  TDAC_PlayFRAMList(joins, 32);
+  BENCH_END(B_TDAC_JOIN, 31);
+
+  // Software UART ISRs: per byte
+  UART_Init();
+  TACTL = TASSEL_2;                         // Stopped: no compares of its own
+  __enable_interrupt();
+
+  BENCH_BEGIN();
+  TACCTL0 |= CCIFG;                         // Start bit edge (capture)
+  for (i = 8; i != 0; i--)
+    TACCTL0 |= CCIFG;                       // Data bits (compare)
+  BENCH_END(B_UART_RX, 1);
+  RXUARTDataValid = 0;
+
+  TXData = 0x55;
+  BENCH_BEGIN();
+  TX_UART();                                // Start bit armed
+  for (i = 11; i != 0; i--)
+    TACCTL1 |= CCIFG;                       // Start, 8 data, stop, done
+  BENCH_END(B_UART_TX, 1);
+
+  __disable_interrupt();
+  __bis_SR_register(LPM4_bits);             // Done: the simulator stops here
+}
@@ -10,18 +10,29 @@
  * ACLK is routed to P1.0 (LED1) for observation.
  * ACLK interrupts and toggles GRN LED.
  * Waits forever in LPM.
+ *
+ * The VLO is measured against the calibrated 1MHz DCO at startup, so the
+ * blink is 1 sec whatever the VLO happens to be (see ../lib/vlo.h).
  * 
  ******************************************************************************/
   
 #include  "msp430.h"
+#include  "vlo.h"
 
 #define     LED1                  BIT0
 #define     LED2                  BIT6
 
+#define     PERIOD_MS             1000      // Blink period
+
 void main(void)
 {
+  unsigned int aclk_hz;
+
   WDTCTL = WDTPW + WDTHOLD;                 // Stop WDT
 
+  BCSCTL1 = CALBC1_1MHZ;                    // SMCLK = DCO = 1MHz calibrated,
+  DCOCTL = CALDCO_1MHZ;                     //  the reference for the VLO
+
   /* Low-power warnings */
   P2DIR = 0xFF;
   P2OUT = 0x00;
@@ -42,16 +53,17 @@ void main(void)
     */
   BCSCTL1 |= DIVA_3;             // ACLK is 1 / 2**3 the speed of the source (VLO)
   BCSCTL3 |= LFXT1S_2;           // ACLK = VLO
-  
-  /* ((1 / 12000) * 8) * 1500 = 1 sec */
+  aclk_hz = aclk_measure(1000000);  // Nominally 12000 / 8 = 1500
+
+  /* Was ((1 / 12000) * 8) * 1500 = 1 sec, for a 12kHz VLO */
   /* Set up a timer to fire an interrupt periodically. 
      When the timer hits its limit, the interrupt will toggle the lights.
      We're using ACLK as the timer source, since it lets us go into LPM3
      (where SMCLK and MCLK are turned off). */
-  TACCR0 = 1500;                 //  period
+  TACCR0 = ACLK_PERIOD(aclk_hz, PERIOD_MS);  //  period
   TACTL = TASSEL_1 | MC_1;       // TACLK = ACLK, Up mode.  
   TACCTL1 = CCIE + OUTMOD_3;     // TACCTL1 Capture Compare
-  TACCR1 = 750;                  // duty cycle
+  TACCR1 = TACCR0 / 2;           // duty cycle
   __bis_SR_register(LPM3_bits + GIE);   // LPM3 with interrupts enabled
   // in LPM3, MCLCK and SMCLK are off, but ACLK is on.
   
@@ -0,0 +1,118 @@
+'''
+fram.py - The FM25V40 behind one loader (see main.c), over a cmdframe.Link,
+and the clips of clips.json. host.py drives one board with these, multi.py
+several at once.
+
+Every function takes the board's link, so each board can be in its own
+thread: nothing here is shared but the clip files, read-only.
+'''
+
+import os, sys, json, mmap, itertools
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "lib"))
+import cmdframe # frames for the loader's commands
+
+# Loader opcodes. See main.c.
+WRTE = 0x06
+READ = 0x04
+STOP = 0x02
+STAK = 0x08
+
+BATCH = 64                                  # Commands per link.run, between progress calls
+
+'''
+Each txfr is one CS_.
+'wd' is a hex string - possibly a read preamble.
+'rl' is the number of bytes to return - possibly 0.
+The whole transfer goes as few frames as will hold it: one round trip per
+frame, not per byte.
+'''
+def txfr (link, wd, rl):
+    wb = bytes.fromhex(wd)
+    cmds = []
+    step = cmdframe.FRAME_MAX - 2
+    for i in range(0, len(wb), step):
+        cmds.append((WRTE, wb[i:i+step], 0))
+    for i in range(0, rl, cmdframe.REPLY_MAX):
+        n = min(rl - i, cmdframe.REPLY_MAX)
+        cmds.append((READ, bytes((n,)), n))
+    cmds.append((STOP, b'', 0))
+    return (link.run(cmds).hex())
+
+'''
+Density and address bytes from RDID, as ../lib/fm25v40.c: 7F x6, C2, then
+family 001 and density d, 8K bytes << d. Parts of 64K or less take 2 address
+bytes. Returns (size, format for the opcode and address), e.g. "03" + fmt % a.
+'''
+def density (link):
+    id = bytes.fromhex(txfr(link, "9F", 9))
+    if id[0:7] != bytes.fromhex("7F7F7F7F7F7FC2") or id[7] >> 5 != 1:
+        print ("Unknown RDID", id.hex())
+        return (0x80000, "%06X")        # As an FM25V40
+    size = 0x2000 << (id[7] & 0x1F)
+    return (size, "%06X" if size > 0x10000 else "%04X")
+
+# Run the commands cmds yields, BATCH at a time, calling progress(bytes so
+# far) after each. Each batch is built only when it's due.
+def _run (link, cmds, per, total, progress):
+    out = b''
+    done = 0
+    while True:
+        batch = list(itertools.islice(cmds, BATCH))
+        if not batch:
+            return out
+        out += link.run(batch)
+        done += len(batch)
+        if progress:
+            progress(min(total, done * per))
+
+'''
+write puts data at addr as one WRITE, one CS_, in whole frames straight from
+the buffer: no hex string of it all. fmt is from density().
+'''
+def write (link, addr, data, fmt, progress=None):
+    def cmds ():
+        yield (WRTE, bytes.fromhex("02" + fmt % addr), 0)
+        for i in range(0, len(data), step):
+            yield (WRTE, bytes(data[i:i+step]), 0)
+        yield (STOP, b'', 0)
+    step = cmdframe.FRAME_MAX - 2
+    txfr (link, "06", 0)                    # WREN
+    _run (link, cmds(), step, len(data), progress)
+
+# n bytes from addr, as one READ
+def read (link, addr, n, fmt, progress=None):
+    def cmds ():
+        yield (WRTE, bytes.fromhex("03" + fmt % addr), 0)
+        for i in range(0, n, cmdframe.REPLY_MAX):
+            k = min(n - i, cmdframe.REPLY_MAX)
+            yield (READ, bytes((k,)), k)
+        yield (STOP, b'', 0)
+    return _run (link, cmds(), cmdframe.REPLY_MAX, n, progress)
+
+'''
+Clips from clips.json. clip() maps only the named clip's file, read-only, and
+returns its bytes as a memoryview: a .wav's data chunk, or the whole of any
+other file. A name not in clips.json is taken as a file's path.
+'''
+def clips ():
+    with open(os.path.join(HERE, "clips.json")) as f:
+        c = json.load(f)
+    c.pop("_", None)
+    return c
+
+def clip (name):
+    c = clips()
+    path = os.path.join(HERE, c[name]["file"]) if name in c else name
+    with open(path, 'rb') as f:
+        m = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    v = memoryview(m)
+    if v[0:4] != b'RIFF' or v[8:12] != b'WAVE':
+        return v
+    i = 12
+    while i + 8 <= len(v):                  # Chunks: id, 32-bit LE size, data
+        n = int.from_bytes(v[i+4:i+8], 'little')
+        if v[i:i+4] == b'data':
+            return v[i+8:i+8+n]
+        i += 8 + n + (n & 1)
+    raise ValueError(name + ": no data chunk")
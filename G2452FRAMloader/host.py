@@ -1,2315 +1,15 @@
-'''
-# From the Voice Demo .s19 file - Male voice "Welcome" - - Stripped of preample and addresses
-
-audio4 = bytes.fromhex('\
-89970000808080808080807F808080807F80808080807F7F808080808080807F8080807F8080807F80808080807F7F8080807F808080807F808080807F807F80\
-7F80807F8080808080807F807F8080807F808080807F7F7F7F7F7F7E7F7F7E7F7F7F7E7F7F7E7E7D7E7E7D7E7D7E7E7E7F7F7F7E7F7E7E7E7F7E7E7F7F7E7E7E\
-7E7D7E7E7D7E7E7D7C7E7E7C7D7D7D7D7C7D7E7E7C7D7D7C7E7E7D7D7D7C7E7D7D7E7C7D7D7D7D7E7D7E7E7E7F7E7F7F7F7F7F80818080808181828182828182\
-82838382828383828081818080817F7F7D7C7E7D7C7C7C7B7B7A7B797A7A797A7A7B7B7A7B7B7B7B7A7A7A7A7979797A7B7B7C7D7F7F81818282818180818181\
-8181818283838283828282818281828383838585868688898A898A8B8A8989878989878885838381807F807F7E7E7B7878787676767576767475747778787877\
-797A7D80838589898B8A878682807E7D7D7E7F818484868685848483848283838282817F7F7E7E7D7F81848587888887868382817F7E7F7F8182838487898A8C\
-8D8E8E8D8A89868481807F7E818286888B8C8C8B8B8986827F7C7979797A7A7C7C7C7C7A7A79787777777677777877767677787B80848A8D9192928E8985807B\
-7977797B7D81848688878886868687868787868483807D7C7B7B7B7D8183888B8E90929190908C898783817F7E7E80818586898B8B898886827E7B7875727271\
-727373747676777777777575757474787A7D838A8B8F8F8E8B86817C77767674797E7E838685878685848384838183827E7E7D7A7A797B7E7F8486878A898788\
-86858788878889868783838281848385898988898682807C797673737170716F6F6F6E6D6F6D6E6F6F7174737A7F81898E8B8E8C85817A75726E7275777D8484\
-898A868785828280807F7C7D7B767979797D8084878A8B8A8785838383858A8B8D8D88878381818383878A8B8B8785827D7B7977757572706E6C68676867686D\
-6E70747878778084838E908B8B857C746F6E6D6F7A7F838C8B888985838080827D7D7E77757774777E82888B8E8D8784807B8184889091918F8885818084868B\
-8E8E8C8983807C7D7D7B7A78736F6A65656366696B6D6C6C6D6E71788891959E998B82756B666971767C8584828685878B8F8F89847C6F6B6B6D7580888B8C8C\
-888385868686898B86898B84888889898A8D8A8A8E8B898A87868282807B7B7A7474706C67646563656968696D6E74767C9192989E90887B74726B747A757B7E\
-7D848994959395857B76707273797E787E8180898E94938D908C878C8D8B8884837D818C8C9394928C878B89888B847B7671706D70716867666868686B66676E\
-71757B9096929792887E7E7F7474766F6F7682898B96948C8A8886807D7D726F74767A818A8D8A969F9FA1A0968881837E80868785868D8F919795908A88827C\
-7A756C666464666A726E67696C707478777070838F90948E867C848A847E79747278858A848385878A9191857D7D7D7E80807D7F8C979DA0A099949597928B87\
-8281868A8A88878B8B8D8D867C7978736A63615E60636463636B71747C7F7D8B92938F888C8483807B7471777A7C7F8386878E918D88888884807F7A7C869194\
-91979B9D9D9B969090938E88868785888885828384807A7A77706661625F5B595C5E66686D7276819296928F93999189837B7776766F6E747D8180868C8F9092\
-8E898C92908B8B909292928F8F919695909192928E8B868382817C767271726D67605E615E5A595D6462666B6B788B88868A95988E8783877F76726D6F6F726E\
-6F797E7F7F848B929394979694948E8B888885858585868685858583807F7B75706965625A555150504D50545960606F83838490989B95948F8E897D7874726C\
-6C6A697274767A848990979CA0A0A1A09D99938E8E8B88888687868888868685827D77736C69625958544F4E515355596D7B768294999B9CA29D9F978E8A837C\
-72756C6B6E6F70757C828B959CA3AAA8AAABA69C9A99918C8988848483828482817E7D7B75727166635E5857585555596C76707F9097989FA5A4A6A09C98948A\
-84827775757672737E80889198A1A6A8ABAEA9A3A3A09995918C8B88848384807E7E7A7876716D69655D5C5E59575A5F6D716F7E8E8F8F9A9E9C9F9B9A96928A\
-86857A79797771787E82868B969B9D9EA5A39E9E9D9994908B8985807E7C79757572706E6C67645F5D5C5955565A5D646E6E7784878A90979598989692908A83\
-837D7B7777777A7E80878F9293999C9B99999593928C8885827D7B797474726F6D6C686764615D5B585755585C5D656E6E768186878F929093928F8E8C868382\
-807B7B7D7D7E85878A8F939395969393928D8A88847F7D7A78757471706F6D696A6A6664676C655F63676563686B7276757A838482888B8A8A8B888889868385\
-8482848686898B8B8C8F8F8D8F8D8A888682807E7A797877787777777575767676737372717270706F71727172717376777778797C7D7E8082848586878A8B8B\
-8B8C8C8C8B8A89878785848587858281848284817D8381817C7B7D7E7D7A7A7D7B7C797A7C7D7B7C7B7C7E7D7F7F7F7F7F7F8181807F7F7F8180808181818280\
-828384848283828482838382848283838284828484828283838180848081827F7E81827F807E7F7F7F807E7E817F7E808080807F7D81827E80807E8080807F7D\
-8180817F7F8181807F80808381817F808080817F818380807F81837F7F8280827F7F82817F81818081807F818082818081817F82818080808181838182818082\
-82808280828181828383818181838283818183828280808281808182808381818280808181817F7F82818083827F808282808081818481818281828282838282\
-818280828282828282828382838082827F818181818383818382838281827F818282828082828281808382818085838082828383807F8182808082808282807F\
-80827E81817F7F82817F80818180818181808182807F82827E8282807F838080818081817F81808180807F80827D818080827F807F81817F807F828181818081\
-80817F80827F7F828181818082828083818083818382808181808083828081818181818080818182828082838081828082818282828383828482818481818382\
-8281818282818282838381848284817F828081808082837F827F80807F81837F8383808381838481868381858281848380838381828282838383818184828281\
-81818181838382828282828380848282838084848384828281838183828081828183838183818282828481838182828084818382828384838481858483868584\
-878584868487858584838685848685838485858486868786888686868788888B8B89898C8A888B8A8A8B898B8C8C898B8B87898A878989898B8A868B88858483\
-848384818180817E7F7E7C7C7D7B7A787776757473726E73706B6F6C6A6E686C6D6A6D6C6D6E6D6D717170737272737576747777747877777876757674787676\
-74787672787474767371726E6F716E6D6B6D6B6B6C6B696C66686A62646662625E625E5E5F5D5F5E5A5E5C595D5A5B5A5A59555857585556595758575759595A\
-5B5C5C5D5F60615F64666167686A6B6B7070717273767977787B7A7D7B7E817C81817D82817F8381818484848484858889888B8A89888C8C898C8C8B8E8D898C\
-8C8A8A8C8A8C8B8B918B8B90918F9090919091909593929093918D928F8F8D8C8C8B8A8A87838484817F837E80807C817F7C827F7F868284847F848286848885\
-848A86878887888A88858587868584868884858587868587848485838584838286848188848285838084838283848484818383838681828282817F8282817C7D\
-7E7E7D7B7A78797679787777767677767779797779797E7E7F7D7F848085868585878888868886888888888A86868C8684868584858381848081838183818283\
-85878689898A8C8B8C8C8E918E8B8F8F8D8F918E8F928F8E918E8F8F8F8F8D8E8F8B8D8B8C8C8A8A88868C878687888685848482828281837F7F817E807F7F7F\
-7F817E7B797D7A797B79797A7B77777A787778767875767878787877757979757979787A7B78787C797A7B7B7B7B7D7C7E7B7B7C7B7C7E7B7A7D7E7F7C7E8080\
-7E81807D81838182838082808083818182848384838486838789888989898A8A8B8B8B8C8B8A8B8A8B8E8D8C8D8D8E8C8F8F8D8E8E8D908E8E8E8D8E8F8E8F8F\
-8C8E8E8D8C8B8989898688858685858581848582858384868384838385858687878786888A8A888C8C8B8B8B8D8C8E9194949696929596929492959695939495\
-95939693939492929391909091909194919191918F8F90908F8E8F908D8F908D8E8E8D8E8F8F908C8F8E8D8F8D8B8C8D8C8E8C8B8C8A8C8B8989888789878486\
-88858486848284858183848382848183858280828283868382878383858284828384818181838080807F807F807F807C7D7E7F807E7F827E7F807F7C807E7E7F\
-7D7D7E7D7A7D7E7D80807E7E7F80828180828381818482828384818080827E7F7E7C7B777A7677767575717172716F706E6E6B6D6F6B6B6D6D6C6A6C696C6D6B\
-6F6C6D6D6B6D6B6D6B6C6D6C6D6E6D6D6D6A6B6D6A6D6E6B6D6F6A6B6D6C6A6B6D6B6D6C6A6B6B6B6A6A6A69696A69686A686764666565646365656264646365\
-656566686868686B6A6A6D6B6E6E6D6F6E6F70706F7071707272707172747273747275777475787677797777797A79797C797C7A797D7B7B7D7D7C7E7D7D7F7F\
-7F7E807F7E80807C7F807F7F7F7D7F7F7F80807E80807F807F817F8082817F817E7F807C7E7D7D7D7D7D7E7C7C7C7C7B7D7D7D7C7C7C7C7C7D7D7A7D7D7D7D7C\
-7E7E7C7F7E7D7E7F80807F8081818081818180838381828283828383838283838383848283848183838381838383828283828383828283828283838282838382\
-83838383838382838383848383828482838484828383848384828483838483838283838382848482838484838483848483848483848484848484848484848484\
-83848484838484848484848484848384838484838483848384848384848484848483848484848383848382838383838283828383838383838282838383838382\
-83838381838382828182818282828282828182818281828282828282828282828182828282818282808282818181818181808181818181808181818181818181\
-81808181808182818180818282818182818180818282818281828181828282818282828182828182818282818182828182818281828182828281828182828282\
-81828282828281828281828282818282818282818282828182818282818182828182828182808181818180828082818081808180818180818081808181818180\
-81818181808081808181818081818180818180818181818181818181808181818080818181818080818081818180818081818081818181808181808181818181\
-80818180818180818081808180818081818181818081818081818181808181808181818081818081818081818181808180818180818081818181808181818180\
-8180818080818181818080818081818181818081818081818181818080818081818081808181818181818081808081818081818081818181808181818181807F\
-8181818181818081817F818181808181808181817F8081817F807F808080807F8080808180818180818181808081818080807F80807F80807F80807F807F7F80\
-7F8080807F807F8080807F7F808080807F80808080807F80807F8080808080807F7F80807F807F80807F8080807F808080807F80807F8080807F808080808080\
-808080807F807F8080807F7F808080807F7F807F8080807F7F7F7F7F807F808080807F7F7E7F7F807F80807F7F80807F8080807F7F8080807F807F8080807F80\
-80807F8081818180818181828383848E8E7F81838687838A958B898F8B8E8B828589898D8581848178797F847E7C818081837C7982837D797A7D7A7574777C79\
-747F868789898988867E7B7C787373757374727071797975787E7D7D7E7D7E807D7B7B7977706B6A645E5A5756504D4B474548484345484A4B4D4E555B546E8A\
-80819CAA9FA4A29CA39B857F8A7F7373767C83817F949C97959D9D9D968A898E857684919199A4ABB6BDB1B2B8B0A49F9C989287858D898185867E78726A6355\
-42433E2A29323336475C668AAAA0B1CCCCB3AFA793896D626065596071808F96A2B3C0B3AFB1A796877B6F7367626D7A8084A0C3C9C8DADFCEC0B6A79C928788\
-8F91909AA8ADA7A4A89D8B8074604D3E3630231D2D383C4A65828DAEBAB6C8C3B19C98816C5E5556555C647D8999A3AEB7B5ACA19F8A7A6F675E5C6063737E89\
-91ABCCC0C4DAD1B3ADAA9787808286898C98A4AAABABACA795877F6C58483F36292525262D38434B5F797D95B5A0A4B5A78D857F686356565C6466738791989C\
-A5A69E918F83736B64605F636470808094B4B2B8D1CAB7B3AA9C90847F8584848D989CA2A6A8A69D8E897E67544A4130242524272D3339505F687C7F9FB18D9B\
-AD967877786460525C6D6C698094939199A19B8B81857967626666646671808B9BA8B7C6C3BDBCB69F95968A80848A868E9398A0A19E9E99887F76634E49402D\
-2A281E1E282E353D516F707EAF9F97B1A590807F68655C505E63656F848D90989C9F968B878070676563616669799098A4BDCAC5C1C1BAA698968F87828A8C8F\
-9398A3A39EA1A091847B69584D3D332E272627282D3B454559786D7EAD958AA7A0847F836E6E69616F7571768B8E898E94938881827E726C6F716E6F829293A1\
-B6BDBABBBCB3ACA19A9A958E909593929A9B9F9B989C8F837F725F584F3B33342D22242831373C576D708BAD9AA0B2A1908D8574746C68737774818E8E8E9596\
-908A86857B7676767875839497A0B4BCBDBFC0BAB1ADA6A09E9997989B97999E9D9C9D9E9487857A685E53473F3A2B2A372B263842455A6F6987AF888CB39D82\
-828D797073707C7C7680918D7F889382787980766D73777A798B9898A7B0B4B9B7B0ABADA2979E9D9693999B94979A999693948A807B6F60564F3F34332F2721\
-232D323845656A73A0988CA49F8A8084796C726E727E7E7F88908B818682797270716C6E71757A8A9E999FBAB8ADB0B6AC9AA6A1929F9D9398A1978D999B8F8C\
-908878726E5A504D43363330222628242D37465E65719C9E8799A4927D7E80727577747D89888489948A797C7B716A6B6A6B767B768CB0A79DB6C3B7AFB0AAA1\
-ABA294A1AAA0979FA39793958F8B8A82726D6A5A4D4A413631322E2B2E363F48596D7481A2A19195928E827A7C787C8688898C91928C88867B787571706E7076\
-7A80838F9FA2A2A5A1A2A09C9995949796989694928D8B86817E7B7674706D68625F5B5C5A5A5956565656595D60666E727680878C8D8E91918E8E90928F8E91\
-908D8C8F8C898987858486878283858480848B8C8C9296999A9BA0A1A1A3A3A09F9F9D979696908D8B8A86827F7A73716B64615E5B5553514E4E4E51565D5E65\
-71777D83899395969C9E9E9C9C9D989597918D898785807D7D7B79777577777D8182878E9194999D9FA1A4A4A5A3A2A29F9B9A958F8D8782807C766F6C67605B\
-5553504D4C4C4C4D53585C6672787E858D94949BA0A1A0A1A19E999896908E8B8884817E7B787673737474787E7F83898E93959A9D9FA3A3A3A5A3A19E9B9896\
-8F8D8885807B766F69635F5A55514F4A4948494A4E555A616D767980878E91969CA09E9E9C9C9793928E8988827E7C77747272706D706F707678797F858C8E92\
-989B9A9E9D9E9D9D9B9894938E8A88827D79756F6A66605957514C4A464647474C515559656C727881898C8E979A9A9B9C9C9995958E89898481807D79767473\
-6F6F6F70767C7D8084898D8D94989A9D9F9E9F9C9B9896938F8B8B85807E78746E68645C5A57524F4D4B4A4A4C4F555A606C72767D868C8F939B9C9B9E9E9C9B\
-9A96918F8B8786847F7D7B7975747776757A808184898E9195999EA1A3A7A7A7A6A4A09E9B9693908D8883807A756F6B66605D59575450515151545A5D646F75\
-7B8289909398A0A1A2A5A3A1A09D9894918D8786847E7D7C797575757576787B8084888C9297989CA1A2A4A8A7A7A7A6A29D9B9691908C87847F79746E696462\
-5E5857574F454D4F4F5A626A78818990979C999A9D98989793928D8C8885868685888884817E7875737174767D868F959EA2A6A7A49F9D989492939394959490\
-8C8A86837E7B75706A635E5C59595A5D5F606265686D74787F8A8D8B8B85847F7D8182868A8A8A888484827F7E7A7876727273757B7E8084838482848D909399\
-9697938E8F8D8D8F8F91908D8B878584807F7E7B7875706C66656361626061625F5F62646A7177788189888A8984837D7A7D7E8183878B87878781807E7B7A76\
-7476757A7C7E83848585878E8F939694928F8A8C8B8C909092908D8A8784848081807E7A75726C67666465666564615E5D5D636A737B7D838B86898784847E7B\
-7B797F82868C8C8B8A84817D7879777678777B7D7D838487868B9290939691918F8B8D8D8E929193908E8D878786828381807F79746F6B6A6568696769666364\
-62676D757D7E888F8A8E8A86857F7D7D7E838589908C8F8E8987827F7D7A7A79797E7E8286898B8A8F959497999494918C8D8E90929697959390898987848684\
-837F7B76706B6B69696B6969676563656A717B81868F918E8F8A87837D7D7E8085878E918F928E8988827E7D7978787A7D8085898A8D8E919595999694958F8D\
-8E8D9192969794928F8A8986848582817C78736E6A6A6A6B6A6867636262646C767E848F9390928C85827B7A7A7C81838A8E8D908F8B8A85807C777574737879\
-8086878B8C8D9393949592928D8A8B8A8B8D909393918E8A878480807F7C7B76716D6665656566666663626061656B757A848E8E918F86837A7676767A7E8288\
-87898B868685807E7A7572707173757C8085888A9192919491908D8787848488898C908F8F8A86837E7B7C787875706C6664626163626363605F5E5E656D747C\
-8B8E90918A837C74717173787E84868789878483817F7C7976716E6F6E74797F858B8F95939594908D8984848284878A8D8F8E8E8886827D7C7B7876726D6964\
-615F6062626362616160656C7179868F90938F898278727272767C828888898984848380807D7A7772717070767B82888F97999A9B96928C87848283878A8D91\
-91908D8985817F7D7B79756F6B6561616061636465646465686F737B898F9399938C877A757473767D838A8A8E8D8887868283817E7C78757272777981899097\
-9E9E9E9C97938B888684878B8F919393928E8A8583817F7C78746E6A666362626464666767686A70767A8994959D9B918E82797573777C818B8C8E918C8B8A87\
-878583817C79767276797D888D979FA2A4A49E99928B8884858A8D92939595908D898683827E7C77726C6662626162656768696A6A70767B8593959B9F958F87\
-7C7674747A7D878B8C908D898B88878684847E7B777373767A8289919CA0A3A5A19B968E89848285878C909193918C8B8684817F7C78726C6662605D5F606366\
-676B6D70777B838F92999E9691897C76716F75788187898E8C87888584848383807C79737073747A8489959DA0A2A19E97908A847F8182848B8C8F8F8C888582\
-7F7D7A77706D68605E5B5A5B5F6266696E72777B828E90979C9691877C746D6B6E727B81858A8B898885848482827F7C79736F7070747E848F999DA2A39E9A91\
-88837D7D7D8186888B8D8A8885807F7D7A77726E69635D5A59595C6065686C7074797D898F949C97938C7F756E676A6C747C81878A88888684848484837F7D76\
-726F6E6F777D86919AA0A3A39D988E867E7C7C7D8285888B8B888784817E7D7B77736D68625D5A585A5E62686C6E74797A828D90979D98948C7E756D69696B76\
-7B828A8A8A8A88868686878484817A76726F70777B849299A1A7A6A19C9389827E7C7C8284888B8B8A89878482817D7A76726B64605C5A5B5E63686D70767B7D\
-868F929AA09A988F8278706A686C747B828A8D8C8F8C8A89898A8988847F7B7671707478828E96A0A7A8A7A29A9087837E7D8084878B8C8B8B89878482807C7A\
-746E6A63605D5E5F61666B6F777C7F8A92959EA09C9991857B726C6A6B72787F898A8D918E8D8E8D8B8B8A87817C78727173747C868D98A1A7A9A8A39A8F887F\
-7B7A7D81878B8D8E8D8985837F7D7977726F6A65615F5D5E60666B71787E828C91949B9A98968D837D736E6C6C71747D84868B8F8D8C8E8B8A8A8684807D7974\
-737373797F88919BA2A4A5A19A9189807A7A797D8286888B898884827F7C797673706B6864605F5D6063676B72787B828B8C929996939289807B736E6C6D6F74\
-7B8183888A878A8A8787878582807D7874737172777B838D969DA0A3A0999288807B7777797E828587878582807C7A777572706D6864615E5D5E5F64696D7479\
-7E85898C929391928D848078716D6C6E70737B7D82878686888785858583827F7B7875737274777C838E959B9FA09D988F88807B7778797D8084858583827F7C\
-7B787674716C6A6763605F6062666B6F757A7D848989909390928F89837D76726E6F7072797D8085868788898787878584827F7D7A787675787B81868E979CA0\
-A19C979186817A77777A7D808486878684807C7A787474706E6B686563626263666B6F767B81898B8E959393938D86847D7875737272767A7D808486888B898A\
-8A89878785827F7C7B78787A7C81898E969CA0A19F99938A847E79797B7D828488888885837E7C78767373706F6D696866666667696F74797F86898F94949394\
-908A87817D7877767678797C7E8283858687898A8B8A8A888782817D7A7A7A7C7F868D92989C9D9C99938B86807E7D8081858787858581807E7C7C7A79767572\
-6F6C69686768696B6D707276797F82878B8E9092918E8A86827D7B7A78797B7C7D7F80808283848687878888878483817E7D7E7E82868B8E92959592908C8786\
-86868687878685838381828180807D7D7B797876747170706D6D6D6C6C6C6C6E6F71777A7D84878A8C8E8D8A8985817F7D7B7B7C7C7C7D7C7B7D7E7E80828383\
-848481817F7E7C7E7E818386898B8C8C8C8A8A8A8A888989888786868685858484838282807F7D7A7A7876757370706E6C6C6B6A69696A6B6D7174777B808385\
-88878784817E7D7D7B7D7D7C7C7C7B7B7B7B7D7D7D7F7F7E7D7D7C7B7C7D7D7F808183848587888889888A898A8A8A8A8A8A8A8A898A898886868583817F7F7D\
-7B7A7875757370706E6D6C6A6A696969696A6A6E7074777B7D7E80807F7D7E7E7F7F81817F807E7E7D7F7F7E7F80807F807F7F7E7F7E7F808081818181828283\
-848587888A8B8B8D8C8E8E8F8F8F8E8F8F8E8D8C8A8A89868684848280807D7D7C79797875757373727170706F6F6F6F7171737577797A7C7E7E7F7F81818184\
-83858687868787878687878686878686858483838383828182828281828283838485868888888A8A8C8C8E8F909091909091918F8F8E8B8B8987868584828281\
-7F7F7E7D7B7A7A7878777775757474737272737373737474757678797A7C7C7E7E7F7F8182828485858585868686858785868584858383828281828180818180\
-8180818081818283838486868888888A8A8B8C8C8D8E8E8E8D8D8C8C8A8A8888878685848381817F7E7D7B7B7B7A797876767573747271727171717171707170\
-717072737578797B7B7D7D7C7E7E7E7F7F7F7E7F7F7F7F7E7E7E7E7E7D7E7E7E7E7E7D7D7C7D7E7C7E7E7E7E7F7E7F7F7E808082848586868786878887878886\
-86858483838383828180807F7F7E7E7E7D7B7A7977777776757374727372737272717271717171717172727376797D81828484828484848384837F7E7E7E7D80\
-82828181808182838584838282818183828283838282838485848685868A8C909192908D8D8D8D8C8C8C88878787888788878685868587868582807E7D7B7A7A\
-78777574757575767776777878777977797977787A81868A8F91908D8F908E8D8C88827E7D7C7E7F8181808286888B8E8E8D8A888888888683817E7E80828386\
-878587888B8E949797959594929091908D8B898888898A8A8A898A898A8C898785827E7B79787573716E6D6D6E6E6D6E6F71737374747373767671767F84898C\
-8F8F8D8E93908C88847E7B7D7D7B7A7A7C7E83898A88898A8C8A8A8A847F7D7E7D7C7C7C7A7B81848685888887898B88878D918D8E8E8E8B8D90918D8D8C8C89\
-8A8A87838485848484837D7C7C7975706E6C696865615F5F616463696C6B6C6F74746F6D798384878988878B908A827D7D7D7D7B7976757D8386848388878A8C\
-89847F80827E7B7978797D82818182878A8B8A8886838583807D7C7E8C98969596969D9F9C928C908F8F8B8382868B8B878786898D887E7976767069625B5B5F\
-5E5B5E62636B6E6C6E6F74726A6B7D857D7F868A8D8F8D85818483807972767C7C7C7C8183888D8B85858B87807D7B797A7C7A7A7D81848686878B8C88868582\
-817F7E7A7B7F7E899D9491A3AAA69E9F95949B8E848688888A8D878794908787847E78776D62625B5658554F545B626364676F71706C696562717F7271828B8F\
-8A8885898D7D7579747474746F7584817D85878A8A86817D827C74767474787B7A7A85888586898886847F7C7C7B78787885918C8F9DAEA89B99989E9888848D\
-948E8A8D8F97978D898B8F8479746D6F665B56575B565350545F605A626761646B67616171817D7A818F989086838B897A7071747574707581878686878C8F89\
-807D7E7D777273767A7A7C7F87898A89898986837E7B7A797677797C899A999CA3A6ABAAA0949B9A8E8C8B8B8F918E8E979690908C88867D736E6C65625D5759\
-5C5951545D5B5D635D6270695F65615E728071788D9091948A82908C7270767171736E73848780878E8D8D8B817F827A70727373797B7A808B898A8B8A8A8A84\
-7C7C7D767679797F8D9CA0A1A2A5B0B09F979A9C968F868B95958D8E9497948D8785847B6D686A655E595B5D5E5A55595D5B5B5D5C6067625E5E615C647B7D7B\
-8A9195999585868C7B6F6F6C6E7373707E89888A8F8F8F8F867D7E7A72727070757C7D7F888C8D8F8D8987877E7B797678797A8A9594A7B5B4B4B3A9A2A29286\
-898987898A8891958E8D8F8B8581766F70685F5B5B5B5F5F5C5E63645F5F686F6D64626F726C6362686B675D65747F84808D9D968A87878583756A7178747377\
-7C838A87858B8C8A87837C7C7B777574767A7F7F8185898B888786848989889297979A9A969A9B9492958F8F8F888486857F80807C7E7F7774756F6968656466\
-66636469686565646366686263686D6C6D6A676F736D6D6F6D6F71706E747981888B898886818079747170706F7071757A7D818585898C8A8685817D797A787C\
-7F8283888A8D8C8D8B8D8A878784828182808283838486848484828082827D7D7D7B7B7D7C7B7C7B78787C7B797A7D7F7D797A7B7D7C7B7D7F80827F7F7E7F80\
-7F7C8081828482828383868584868683848282818180808181828380818383828082858283838486868283828284818385848584868483868382878687888989\
-888786878786888C8C8A8B8A8988868484898A87878786878485878988888887868788898B8986888989898A8C8C868689888988868887878886858889848687\
-84858789878687898A87848688878384878A8783848786858684878887898B8C8C8C8A8A8C8A8788898989898A868787878A85888A8A8887878889888886888A\
-898C8B8A8B8987888485888585878584868886878686838686828485858887898B8B8D88898A898C88898E8D8D8D8A8C8E8F8E878B8D878987888A8B87868886\
-858788858A8C8586878888838688838385858A87828387858587838185838182828282818283807F8183828283827F828383827F82838283827F838281808181\
-7F7F7F7D7A797B7B7B7E7C7D7D7C7B7E7E7C7E7E7D7E7C7C7D7C7D7B78787B7B76797A7A78777978797979797B7D7B7978757C7C76787A7A7A7B767A7A78797A\
-7D7D7B7B7F7D7B7C7D7B7D7B7A7A7B7C7B787A7A7A7A7A7B7A7A7B78797A7A7C7E7F7E7D82807E7E797B7F7F7B7C7E7C7E7B797C7B7B7C79797B7B797A7D7D7C\
-7A79777A79767679787476767B7C797979797B7A7375797773777979797877787C79797A7D7C7979787D7C7C807C7A7C7A787B7B7A7B7C7C7B7C7A7C807E7F7C\
-7B7B7E7D7D7B7D7D7F807D7F827E7D82817C7E7E7D817E807F7E817F80817D7E7D807F7A7E7E7C80817E7D7D7F7F7C7D82817C7A7C7D7D7E7A7C7E807F7E7E81\
-8180807F81807E7E7E817E7D7C7F82807D7B7F7D7D7D7D7F7F807B7C7D7A7D7E7B8083817D7E807E7F807F828182827E7F82807D7F7E7981837C7D80807F7D80\
-7B80837E7D817F7E8181808283817E8282817F7F7E7F818182807F838080807C7D7E7E7D7D7A7A7D7D7C7B7E7E7D7E7D7D7E7F7E7D7F7E7F81807B7D807D7D7E\
-7D807F7F7E7F7F7F7F7C7B7D807E7B7D7F7F807E7D7F81827F808283858280828787858787878786858588858585868585868387878687868485848484848381\
-81818283818183838284838383848282818283838383848685848584858687868687878686868485848484858686868685878785848787868686868684848483\
-84838485858685848686858585858686868685848585858484838585838484838484838383848382838383828282838382838182838282818282818282828082\
-818281808281818181818182818180828182818181808181818081818181818181818080818181817F8080818080808081818080807F8180807F808080807F7F\
-80808080807F807F807F8080808080807F80807F80808080807F808080807F807F7F80807F80807F8080807F7E7F7F7F7F7E7F7E807E7F807F7F7F7E7F7F7F7F\
-7F7F7F7F7E7F7E7F7E7F7F7F7F7F7F7F7E7F7F7F7E7F7E7F7F7E7F7E7E7E7D7E7E7D7E7E7E7D7E7E7D7E7E7E7D7E7E7E7E7D7E7E7E7E7C7E7D7D7C7E7C7D7C7D\
-7D7D7D7C7D7D7D7C7D7D7C7D7D7C7D7D7D7C7D7C7D7D7D7C7C7C7C7B7D7B7C7C7C7C7B7C7C7C7C7C7C7B7C7C7C7C7B7C7C7B7B7C7C7C7B7C7C7C7B7C7A7C7C7C\
-7C7C7B7C7B7B7A7B7A7C7B7A7C7C7C7A7B7B7B7C7C7A7C7C7B7C7B7C7B7C7B7B7C7C7C7C7C7C7C7C7C7C7C7C7B7C7C7C7C7C7C7B7C7C7C7C7C7C7C7C7C7C7C7B\
-7C7C7C7C7B7C7C7D7C7D7C7D7C7D7D7C7D7D7C7D7C7D7C7D7D7C7D7D7D7C7D7D7E7E7D7E7E7E7E7E7D7E7E7E7D7E7E7E7E7D7E7E7E7E7D7E7E7D7E7E7F7E7E7F\
-7F7E7F7F7F7F7F7F7F7E7F7F7E7F7F7F80807F80807F808080808080807F7F808080808080807F80807F7F807F80808180808081818081808181818081818081\
-81808180818181818181818181818081818180818081818080818180818081818081808181808281818182828282828182828282818282818182818282818282\
-81828182818282818282818281828182818281828182828281828282818182818282818282828182828182828282828182828282828182818281828282818282\
-82818182828282828282818282828182828181828282828282828182818282818281828282828180818081818181818180818180818181818181808181818181\
-8181808181808180818180818081818081818181818080818180818180818181807F7F80808080807F807F8080807F807F808080807F808080807F807F808080\
-7F7F7F7E7F7F7F7F7F7E7F7F7F7E7F7F7F7E7F7F7F7F7F7F7F7F7E7F7F7E7F7F7F7F7E7F7F7F7F7F7E7F7E7F7E7F7E7F7F7F7E7F7E7E7F7F7D80807F7F7F7F7D\
-7E7C7E7E7D7E7D7F7F7E7F7F7E7F7E7D7D7E7E7E7E7E7F7F7E80807E7F7F7F7F7F7E7F7F8080807F80808080807F7F81827F8B9A897F86877F796E7997877282\
-908B81757587806B717F807D77788080716C71757877747F8B867B7E85857E7576817F797781878782838A8B8681838A898285898E90938D868B887E7B7C8081\
-8083898B88888884807E7B7572757F818696A5A8998880746153515760646C7A87898989847B746C656569696A7E8B868F96918D857972716C6B747D848B9193\
-949188807C757071737B838D99A4ACB4B5AAA69F8F898D8D919BA3A3A9AEA496938C77696760544E4C4F524A4D5C5F5E656E737871749B9075868E8B7C7A757E\
-88787788918D87888A8D867679818077788187898484898D877E7F85827E7F8491A2ABB7B8B0ADA6978F9091969FA2A7AEAAA19D9B8C83807768676351434447\
-4D4C3E43555D5A576A816B69A194788C8A837D7D6B6F897B7486938F8E8F86868B796D747C76737D84898A8A868A8D827C8BA4AEA5ADB6B2A89E959A9F9A98A6\
-ADA49FA29D93887F7772696257474947393845362D4A564C57737A607DAE81748F8678737A65698D7C7088998F868D84798277636A79776C7B8783878B838687\
-8DA6A5A4B0B3AAA29E96939C9C94A0ABA4979A9B877D76675E5C4B3B3A382A293027213037353F4F60604E6F91726A6F70776C6E6665838174777C817A706F62\
-656E645F626A73707372707C7B7A889297999A98908D8F8A8889878684827B797773706B65615E5959595B59595D5F5C5D5B5C5E6365646A6D6D71797C7C7D84\
-87868A91909291939893929697949092938E8E8F8C8E8B878A8A88888D919395989B9EA1A3A6AAA9AAACACABAAAAA8A3A09C9994918D88827B76706C67625C5A\
-5A59575E6467707A80858A979E9DA5ACACABACADAFA9A9ABA5A09D9D9A9490918D88868684838385858C949499A1A6A7A9B0B5B4B4B7B6B4B3B1B0A9A5A19A94\
-8E8A837A737068605E58555553555B5E626D777D808A95999AA3A9A9A7A7ABA7A2A3A19B9794918D8887847E7E7A78787777787A82888A8F95999D9FA4A8A7A9\
-A8A9A7A5A49F98958F87817C746D67615B544E4845424243494C505C646B717886878992989798989D999596948F8B8785807B7977726F6D696A68686A6B767B\
-7D828A8F9194999C9C9E9D9D9C9A9895908A847D787269635C554D4744403A3A3C404346515C6167707D82828B9593939597969193918C8A8882807B7875716D\
-6B68686766686B72797B81888D9094999C9C9F9F9F9D9D9A96918C857D79726C655E58514A44403E3C3E42464D575F666D7882848992959699999C999698958E\
-8D8885817E7C7773716E6B6A6A6A6D727A7E82898F92969A9FA1A0A4A4A2A1A09C98928B847D787269635E564D4745413F3F464A4E59646A7078878A8A959C9B\
-9C9FA19D9B9D999492908B8884807E7A77746F71716F72778086898F96999DA1A6A8AAACACAAA9A7A29F9A928B857F787169625C544E484644464C4F52616B70\
-7684929596A2A3A2A29E9F9E9B9E9A96948D8B8A7F7C7771716C6F7372778696A4A4A5A7A6A8A9A4A5A5A7ABABA69E99958E7F7269635B534D474244464A5362\
-747685988D8F8F888D8988888A9797969F9B96978E877D78767070706E767B7E818489858B9A999BA0A2A3A5A3A1A1A8A8A3A39E9A9690887F7770676059524F\
-4B494842444A52666D647E988A8587878D88807A8792898C908F908F877C7A7B706A6B6B6F7376767D83828490999D9E9DA2A19F9A999EA2A2A09E9B99918981\
-776D655E524A4A4844423A3842494E6062648C917D82858A847D757A8E86818B8F929089807E80746B6A6B6E6D6E717A817F818C9B9C9C9FA1A59E99989EA4A1\
-A1A1A39F968F88837768615A514C4841424035343C4455635C719A9083878D8C83776F82897C818E9597958B888B83726C6B6D6D6A6B768082838897A5A7A1A5\
-AEAA9F9B9CA3A7A4A1A8ACA39B9490877867635D50494743413E373B4246586860789E948A8F97918A7C7284857B7E8E95989B939197907D7573736F6A6B7580\
-82848CA0B1B0AAAFB8B1A49C9DA5A5A0A2ABADA9A09B98917F706B65564A44444037323944434E66656F9F9F8D97A39F9185787F8273707D868C9591929EA08E\
-82847F766E68697477757E91A4B2B2B3C0C2B4A8A4A4A19C97989F9E989596948C807470685B4C42403B2E2429333743545673A3A098ADB9B1A8957F827F6553\
-5F656870737B93A297969F9F968C7D767873656576838E9DA4B2C1BFB7B8B6ADA59B90908F8581858886837F7C7E75695F58514940302830332F35474E5A8397\
-93A0B0B3B0A68F8889775F5D5F5B656967738B908E959C9E9C958685867A76848484929B9CA7ABA7ACAEA6A29F96918E8881827F7E7E8184827A757470675F5C\
-5A554F48494C504E515A5D606161636A6D787E7D838B8D8C8E8C8B8E8C8485858482807E7E81807E81838586868F9795979A999897908E918F8C8A8A88878481\
-7D7E7D7977787A7572756F6E6F70706F717376777275787779767377787A78767A7D79767977797C79797A78797A7A8084898C8B8B8C8A858488848285828381\
-8180808283858987858D8883858483848280848280817E7A7F807C7F838183868283847E7E84817C828281817D817C82847C7D83848080807C8180818080847F\
-838483808082817F83807D807E7E81817D83817E82827D81857D8280837F80838283848283878481868482818583828383868082888485888884838483868683\
-84838082838181868083838386848486848782828582848486868289878387898585868383868483828482858581868581858485878481878280868483878387\
-8885888688828785818784838385848287848288858486888585878484888385848284827F84858884848B858583858480868282858286838589858487878586\
-858789838486848685848B86868A85888884858987878987838686838688888989888786888A8686868886868483868685848684868785858383828385818082\
-7E7E807D7F7B7C817B7D7A7C7D77777D797B7976797977777E7A79787A7C797B79797A787A7B777B7A7A797A7A797F77797976807C787C7A7C7A777C7D7A7A79\
-7B7C79797978787676757575777375777674737574727573717873707475727478767A78787A797C7B7B797B7D7A7D7C7B7F7D7E807F80817E807E8183818186\
-8381888481858284808584848487898585818586848682848682858682878481817F85827F808080817C7D7C7D7E7B7A77787675787877717874727674747370\
-736E706D6B6C6B6E65696B66666868676965656768666769666969686A666765666965686667676565626860626662616262605F60605C5F635D5F5F5E5F5F5B\
-59605D5B5A5C5E5D5C5F5C5F615E6162616261605F665F66616665626C646A6D676D6B6B716C6F736D71737074717677747E787C7D807C7F847D848780868684\
-888889878E8D898F91938F93919096929095949296929696979593969490989990959A939291929390919492949797999B9C9B9E9B9C9C9A9A98989897989797\
-98989698969797989897989896979796949596959595939191919092929392919290919192919290918F918F90908F8F8E8E8E8E8F8E8F8E8F8E8E8F8D8E8E8E\
-8D8E8D8E8E8E8D8E8E8F8F8E8E8D8E8E8D8D8D8D8C8C8B8C8B8C8C8C8C8C8B8B8B8B8C8C8B8C8C8B8C8C8B8C8A8B8B898A898A8A898B8A8B8B8B8B8A8A8A8A89\
-8A898A8A8A8988898989898888888887888886878786868786868685858585858585848484858485848384838484838383828383828381828282818180818180\
-807F807F7E7F7F7E7F7F7F7E7E7E7D7E7E7E7D7C7D7D7D7D7D7C7D7C7D7D7B7C7C7C7B7C7B7A7B7B7A7A7B7B7B7B7A7A7A7A797A797879797879797978797879\
-78787878787877787878777877787778787777777777777776767777767676767576767676767576767576757676757675767576767675767675767676767576\
-767676767676767676777776777677777677767776777777767778777778787878777878787878787879797978797978797979797A7A797A797A797A797A7A7B\
-7A7B7B7B7A7B7B7B7B7C7B7C7B7C7C7C7B7C7B7C7D7D7D7D7D7D7D7C7D7D7C7D7D7E7E7E7D7E7E7D7E7D7E7E7E7E7E7E7E7F7F7F7F7F7E7E7F7F7F7F80807F7F\
-807F8080807F808080807F817F818180818081818181808180818181818080818181808181818081818180828082818082828282828282818282828282828282\
-82818281828282828182828281828281828282828182818281828281828282828281828182818282828182828282818282818282828281828282828282818282\
-82818282818282818282828182818282828081808181818181808181818081818180818081818181818181818180818181818180818081818281808282828182\
-82828182818282818282818181818081818181828180818181808182828181818181818183828385838085847F7C7C7B7B7B777371717071706D6D70716E6D6D\
-6C6D6B686769696867696A696A6B6C6A686B6D6E70726F6F777976757071767D7B72737574797D787B7D777C877A778D8476899485878E828695897D939C8389\
-9A8C8E99918A9F9E8294A08F93988F8F9B968D959A90959C8E92A19183919C92878E949197918A93998F89968F8691898B938C828991868A8F8A8B918E868E93\
-86888B8C88818A85838C887F88887E83847E7D7F8481777A847C787E7B7B8076727F7F72737A767A76707A7B73787B788079757D7B7B79777978757472727472\
-7075706F74746D73756D73746E72756F7176716F76757175757177736D78756B72756F74756F7373717271707173747574747777767777757A79787B7A797D7D\
-797B7A797977777878797B7A7B7E7C7D7E7A7C7F7D7C7E7D7C7F7B7C817E7D8181818181818382828686858689878A8B898D8E8C8E918E919293949494959597\
-9899989A989A9B9999999696979491918F8B898583817D7C79767574737373737374757678797B7A7E8586858E91959798A2A2A1A3A7A5A1A2A1A09B98999593\
-8E918E8D8F9296969CA2A7A7AAB0B1B0B1B3B2AFABA9A59F98948E86817E75706D6863615D59565552545757556171687485848F909AA2A0A0A4AD9FA1A09C9A\
-8D8E8A867A7A7E72707075726F737B857C89979599A0A6A7A7A4ACA99D9F9E978E8B87827A73736E6661625D56524F4D454344433E404745475B595D71717C82\
-86919494939F9892958E8F83817E7A726A706965636769656A6D7B7B7B8C939498A0A4A5A1A3A6A09899978D8785807C7472706A6564605C5753504C46444341\
-3D3F4444444F625C61797C8386929B9A9B99A89C939795907F817F7A6E6A726B65666E6F6B717A8A87879EA6A0A2B1B3ABA9ADAEA49C9E9B908789877F79797B\
-746D6E6E665D5E5C554D4B4C4842434B4C484B5B6E626C898D8E92A3ABA6A4A6B6A7989D9F938185847D716D78746B6D7A7F777F999E94A2B9B6ADB5BDBAB2AD\
-B1B1A2989E9B8D888D8C84818689807C7D7E746C6B69605655534D484A4B515751596973797C8C9A9D9DA2B1ADA7A4A7A799918E8E8478797B756F727A797A7D\
-878B93A09FA4B0B0ACAFB1ACA9A8A2A09B95908E8E87838687838385817D7D7A746E6B665F5B5555514F4E4E525454595E6264676B7070707D857F7F89908B89\
-8A8D8F8B86868984807E80807C7D7E80858A8A909A9A999C9F9C99969392908B8483837C7575747370706E6E6C68666265615C5B5B5858595755585D6062666B\
-6E7375737374777573707172706F6A6C716F6F717373757877787B7A7A7C7B7C7C7D7C7F807E807F7F8384817F7D7E7D7D7A797A7B797A777478797A79777979\
-7876787A7A7874797D7D767A817F7A7D8080817C7A7C7F7F797A7E7B7A7C77797D7F7F7C7A7E8182817F808082827F82817F7F818180817C7E81818183818284\
-828385848688868584858785858586868787868889888787898A8A8A868588898C8C868688898A8989888788898A8C8887888A8C8B88898E8C88888A8E8C8A8B\
-898B8B8887878A89898887888888888B8A84878A8A8B8A8787878989888A8A8A8687898B88878A888689888A888789898786898A8889878889858588878C8C87\
-898C8E8B898D8984898B87898A8A8786898A89898788898987888787868687858485868583858581838384848387838484828482858683848383858683838382\
-8280818385857F818182818082808180818281828280818281817F8081807E807F7E7F80807F80817E7F7F7E7F7E7E7F7E7D7F7E7E7E7F7C7C7C7E7E7D7D7E7C\
-7D7E7D7D7D7D7E7D7D7F7E7D7D7E7E7C7E7D7C7C7D7E7D7E7F7D7C7E7E7F7E7E7F7F7E7E7E7E7D7F7E7E7E7D7E7E7F7D7E7E7E7D7D7E7E7E7F807D7E7E7C7F7F\
-7E7F7F7F7D7D7F7E7B7E7E7D7E7E7D7E7C7D7D7C7C7F7E7E7E7E7F7D7D7F807F7F7F807F7F7F807F7E7F7E7E80817F7D7F7E7E80807E7E7E807E7E7F7E7D7D7E\
-7E7F7F7E7D7E7E7D7E7E7E7D7E7E7E7E80807C7F807E7F7F7D7F807E7F7E7E7E7E7E7D7F827D7D7E7F7C7E7E7E7D7E7E7F7E80807D80807E7F7E7D7E7F807E7D\
-7C7E7F817F7E7E7F7F7D80807F7D7F7F7E80807D7D7E7E7E7D7D7C7A7D7F7F7C7E7F7E7F7E7D7E7F7E7E7D7E7E7F7D7F81828080807F7E7E82807C7E7D7F7F7E\
-7C7D7C7B7D7F7D7D7E7D7F807C7C7D7E7E7D7A7C7E7E7C7D7B7D7E7C7D7C7B7F807F7B7A7F7E7A7C7F7C7A7B7D7B7A7B7D7A7A7C7B7A7B7A79797A797C7B797B\
-7C7A7C7D7C7C797B7877797B7D7B7D79777C7F7E7D7C7C7A78787A7E80807E7D7A79787A7C7E7C7B7A7A7676797C7C7D7C7A7A7B7C7C7D807B7A797B7E7F7F80\
-7D7B7C7C7E817E7B7B7B7C7D7B7B7B7D7C7D7E7D7E7F7D7A7C7C7E817F7A79797B7B7A7D7D7B79797B797B7B7C7D7C7B7D7A797777797A7B7D807E7E7F7E7D7F\
-818082838282818081828384838484848484858786868583817F82838486858686878688898A8887888A89888786848482807E7E7C7E7E7D7C7C7A7978767778\
-7A7B7D7D7B797979787A7A7C7C7C7B7E82848A8D8E8D8C89878582828280818081828385888A8B8C8C8E9296999C9D99938E8A85878A8E8F8F8F8C8887858380\
-7E7974716E6A69676765666768696D747A808A96999C9D9A9286837A76757577777A8082868E92969595928A857F7B78777A797B7E8184888E9092969A9A9999\
-96908B898585878B8E9093928E8C88837F7C78736E69646160646465666665666A70787E848E939194928E86817C77747476767A7E83868B8C8F8E8C89837D7B\
-77757477787A7E8284888A8C8F9194959595928D88838282848A8D9190908C8884807E7B76726D68636261636365646361616368717A7E868F8F8F8F8D86807D\
-766F6F7074767D84858A8D8E8C8A87837D7A76737274777A7F8387898A8C8C8D8F939493928E88858384868C909191908C8884827E7C7A76706D696766676867\
-6665625F5D61656D787B818D909295938D827C756C6C6E74787F86898B8F91908C8B847C76737071767B8084888C8B8C8D8E8E909390908E8D8A8789898A8E91\
-9291908D898783807E7C7A7572706C69686A6B6966645F5D5D6066707A7C7E8E9193999790817A71686A71787B848A8B8C9092918C8A8175716E6F727A828588\
-8A8D8B8D8D8E8E8D8F8E8E8E8C8C8B8C8A8C8F9090918F8D87868281807E7E7A76726E6C696A6B6A66635F5E5D5F636A7076787A8993979C9A8F7E746C696E75\
-7E808386888C9195958F877C726D6E737A81858787888C8E909091918F8E8E8D8D8E8D8A8B8B8F909392908B898685848484817F7B77747270706D6B6A696563\
-615E5E5D62686E7578767F8E929A9C948678706C6C727C7F7F83868A8F959691887C736E6E747A7F828485858C91939D9E99958E898686898B8C8E8F90919390\
-8E8C878785848786827E797472737575736E6B6A6966696E6E6D6E69666867686968686F7B8B969D9A90857B7374777A7A7B7A7A7E878E92928A837D7A7A7D7E\
-7F7E7C7D8592A0A2A39D8E888485878F918E8E8C898C8F8E8B8A86868787847D79726F7274757876716D6A65666D706D6D6A65666B6E717B808586837E726A66\
-5F636A7280868B8B88888484828281848384868384848585888B8F919291908B8A8585878789898786838483838382817E7D7B7A797777767574747575757371\
-6F706F6F72716F6E6F6F707373757574767676757776767674747575767778797A7C7F80848585878683838284868A8A8A8A8986888888898A87878A8B8D8F8D\
-8A89888487878785868483848282818281808080807F7D7B7B7D7B7C7C797B7B7A797B7C797D7D7B7B7B7979797978797A787A7B7A7C7F7F80807E7F8080807F\
-7E7E7E817F80808180848182818081807E8082818282808281838383808183838384848687858789888686848688848685868785858685858584838483858382\
-838585848382838485838384818081828183838183828181808182818082828185847F8384808484848482838283818184828282838382828382828281828182\
-8081818281818280818282838283828083848280818081828182818280818280818080818080807E7F7E7F7E7F80817E7F7F80817F7F817E7F81818181818081\
-81827F81828182808181807F807E7F7F7F807F808181808181808080817E7F8080807F7F7F817E7D7F807F7F7F7F80807E807F7E8180808180817F7F807F8080\
-7F7E7F817E7F817F8080817F8181818181818282808181807E7F7F7F8180808181807F807E807F7E817F81817F818180817F80818080818081818081807F807F\
-7F7D7D807D7E7F7E7F7F7F7F7F7F7E80807F7F817F7F817F807E7E807F7F7E7D7D7D7E7D7C7C7D7D7D7C7D7D7C7E7E7D7E7C7D7E7E7E7E7F7E7F8081817F8180\
-7F7F7F7D7E7D7E7E7E7E7E7E80807E7E7E7E7D7D7F807F7E7F7F7F7E807F7E7E807F80817F7E807D7C7E7D7C7E7D7D7E7F7E7E7F807F8080807F807D7F817D80\
-7E7C807F7E81807F8080817F81818181817F7F807F7E8080807F80808081807E818181808081808080807F80808082828082818080828183818081817F818081\
-8182818180808283818083807F82818080817F80807F7F807F7F808080818080808180818182817E817F817E7E807F7F7E807F7E7F80817E8082808080818183\
-817F81807E8081807F80818180808281818280817F7F817E8181808181818081818081818282828282818180818181817F7F80807E8182818080818180808080\
-7F7E7D7E80807F807E7E807D7E7E7E7E7D807E7D7E7D7D7D7F7F7E7E7F7F807F8181808080807F807F7D80807F7E807F7C7D7B7D7C7E7C7C7E7C7D7F7F7D7F7F\
-7C7E7E7C7D807F81818082838180827F807F808080827F80807F7D7E7F7E7F7F7F7E81817D807F7D7F7E7C7F807E7F80818081818280807F80807E817F808181\
-807E808180807F7E7E7D7E7D7D7D7B7D7C7D7D7D7C7C7D7D7C7C7D7F7D80807F808280808080807F7E7E7E7F7E7D7D7E7F7D7D7E7D7F807E7F81807D80817F80\
-7F7F7F7F817F7E7F7D7C7E7F7E7E7F7E7F7E7E7F7E7D7D7C7C7D7B7C7E81817F8181808082817F80807E7E7F7D7D7D7E7D7E7D7C7C7C7C7D817F807F7F7F7E80\
-7F7F80807E80807E807F808182817F817F7F807F7E7E817F7E80818080807F7F8181818282818182808181808081817F80808282818282828384838382828182\
-8080817F828382848483848483828282818082818383828282838282818081818280817F807F818182817F7F7E7F807F7E7E7C7D7E7F7F7F7E7F7E7F7D7F7E7F\
-807F7F808283858687888A8B8C8D8F8F9090908F8F90908F8F8E90908F908F8F8D8D8C8B898987858482807D7B7877767473706F6D6B69686969696C6E707579\
-767F93929699928C8D9285807D7171797E7C8186848D969792908C8485867C777676767F8681868A8B909394959692908F8E8D8A8A898C8D90919190908F8E8A\
-898483807F7B76757273706E6D6A6A67676A6969696C6C757A7782928D92948C8686887A77766F70777E7B8088878C92908886847B797B747073777780878485\
-8B8C898A878081858A89888A898C91928F8C8E8C8C8D86838283828283807F807E7B7976706D6C6463696662686361686F70717B78708696878B8B7E7A848771\
-72746C738185787F89848A92877A7A7E77767D716C77807F8388807F898A82807C777B84898C8B8C8F9096928A8786898786817E8084868584828184827C7874\
-706B696661616465666967646A6F6F727972708691868A887E7C84867470746F7581847B7C8786898F877B787F7B767B756E7781838385847F878B847D7C7979\
-848D8F8B8D959495958A85878A868584818388898783868584857F797573716C68656263676B6A66676B6B6F72757671788C8F8A8D8680818882737271737A84\
-837D81888B8E8D867B7A7F7C797874737B848786858684898A857D7B7B7B87918F9294969996958B85878889878585858C8C8A8986868485807A77736E6D6B65\
-646767696D6D6B6A706F6F757A73718A948A8E8C847F868A78727672768288817D898E8C908B80787E7F7979797577828B8786898686898981797A7C7D848D97\
-98979D9996948F87828787858789888A8E908988888582817C7470706E696766696666686A6B6A6D6E6F737A767388938C8D8D857D848778707574777F89837F\
-8A8E8B8B8A7F777B7E7876797679828C888688878585867E75787A7B7F88898D9DA69F9B99908688877C7D8488888E918C8B8E8B8482817A7476716968696565\
-6A6963686D69686D6A68717B72758F918A8E8F857A8482716F737473808781818E8E8B88887D747B7A7273777879848B88858A888483837973777A777C7F848C\
-91A3B0A49B968C8583827777868C8D90948E8A918C7F7E7D7772747166666864636B6C64696D68696C6D6A72787180958E8C8B8B848086796E7075777A82847F\
-8A91908B88837A7A7F777174767C81898A85898B8B86837E76787C7B7A7C818A92A5AFA09C9A908A8782767A898B8B8D918D8F958E8382817B77767067696C66\
-65696D6E6C6D6B68696B6A70756E748F958E918E89848B85706D7374777E837C839293918E877F7E837B707175787D868783888F8E8C88817A7B7F7C77787B80\
-8B9BA6A6A0A19D9390887D79818886898D8D9295938B8586807E79736D6A6C68636669696D6E6C6C706F6D6F75756C7B938D8B8F8D898A9080727679787A7F7B\
-7A8A938F8C8D898489877774787A7A7E827F848D8F8C8B8985838681787A7E7F7F8F9F9F9FA5A29A99958680878583868A888D95938D8D8E8885827A7373706A\
-656665646A6B686A6F6E6C70727076746D869388888C8E898D8C76757C7C76767C7880908C87878D8987887C757A7D79757A7B7E878A86858C8B8587817B7C7F\
-7C787B86919AA19F9DA1A0968C86838386817F848B8D8D8D8B8B8E8B817B78736E68635C6062616265686E706C6C6D72757268778A84858A8788908E7E797D7F\
-777977717A85847D8288888A8B837B83837A787776797E7C7A7E8688868886848786807B7C7E7D829093929D9F9797968E8A8D88818182807F85828086868383\
-837D7977736B65625F5E6161606468696B6C6C70727470727D7E79807D777B7D787E858586878282848687868481818284858281807F7E81807F807E7D80807F\
-8080818182828382838383848485858586878888868888878788868787868685858585848483818382808181818181808080807F7D7F7D7E7E7D7B7D7C7C7C7B\
-7C7B7C7B7A7B7A7B7A7B7B7C7C7E7D7E7F808282828384848585858485858686858485848283818081817F807F807E7F7F7E7F7F7E7F7F808181808181828283\
-8484858687878688888787888787878685858383828282807F7F807F807F7F7E7F7E7E7E7E7D7C7D7D7D7C7D7D7C7D7C7C7C7B7B7C7B7B7A7B7A7B7A7B7B7B7B\
-7D7D7D7E7F7F7F807F81828282828383838383818383818281828181817F80807F7F7F7F7E828B858388868686828184878483868789888987898D8986898A8A\
-89868587918D858B8B85877F7D81817B787A7E79797A7A7A7A767173756F686C6C6A6968686B6D6B6A6D706D707B7D78828889898B8C878E8B83828381787A78\
-76787775777D7D7B7F83858285848486847E7F7F7D7779797878797A7C7E808081939C8C94A3A097949791928E82868B83777F847E7D7F7F81847F787C7E6F67\
-6C675A5D57535A5A5054605D5B646C64748F797E9A948F8E9D8B8D917D7D827E6B707C706E77787A8286818B958A8A91918885887F817E75767A7B74797F7F81\
-83878A8B8B898D8F87909C8E909D999396979194928B909389868F8E858689868785817F837A7675736F69686662615D5F5E5E5F5E62686168867A7591968F90\
-9C94949886858C8072767C6F6D727377787B7D888A85899190898A8D8885817D7F7C76767A7A787A7E818181878A8A888A8B8B89848D968C8898998F90969495\
-918F94948B8B908D86868887838283827F797B7A74706F6F6A636367645F606462616368656C8170768F8C858F978F968F87918B7E7C8379717575757474777D\
-7F7B838887878A8C8B89888787827E7F7F7C787C7D7B7B7D8181818187878587888986878C8D8D8C92939392949594919294928E8E8F8C888989868484858280\
-7D7F7E79767673706B6A6D6663676963646867696966797D6B808C87858D948F918A8D92857F8284797477777671737A79777B83838085878B8885898A878184\
-85807B7C7F7C7A797D7E7C7C81828182868784848687868386908A8690948E8C9393918E8F9290898B8E8B8585888582818584807E81807A767A76706F706E69\
-69696B66656B69686A6B68717C6C78868182858E8A8D898A8E868184827D777A78777373787776787E7E7D8283858584888685838384817F7D807D797C7D7C7A\
-7C7D7F7F7E83838182858583838484818082808183818A8C8491918F8F949391938D918F898A888882828381817E81827E7E7F7F787A7A757472736E6F6E6C6F\
-6B6D6D6D6E6E6F6A707A73727F827E8087898887868C888083857F7B7C7C7B77757A7B77797D7E7D7F8284848085878582848581807F817F7C7C7E7D7C7D7F80\
-7E7E82838180848582828483827F81827F7E7F7F7E7D7F807E848A82898F8A8C90908D8F8E8D8D898988868283848182808284818284848281837F807D7C7D7A\
-75767673727372717270727472727574747372787775787D7C7B7E83838182868684828385817F7F807C7B7D7D7C7A7C7E7E7D7F818280828384828184848281\
-8183808080807F7E7F807F7F8182808182838282828482828282828180818180807F81808080828180828281828382868B81888F86898D8B8A8C89888B868588\
-868282838281818184818083848282838382818181807D7E7F7C797A7A797677797776777A787879797B7A797A7A77777A787579797A7A7A7D7F7F7F83848284\
-85858482838382807E807F7D7D7E7D7E7D7E80807F8283838283848383828381818081807E7F80807F7E80818081828182828283828281828180818080807F80\
-7F807F8081808182818181828182818382818988818B8C87898D8C888C898888858384847E7F817F7E7E807F7E7E80817E7F7E7E7D7A7B7B7978777778767778\
-7A777A7C7C7C7D7D7C7D7C7C7D7C7B7C7B7B7A7B7B7C7C7C7E7F7F8082828282818382818180807E7E7F7E7D7E7E7E7E7F808080808281828182828181807F80\
-7F7E7F7E7E7F7E7F7E7F7F81817F81828180818081808080807E7E7F7F7F7E7F807F7F7F807F81818080817F8181807F817E848B80848E89858A8B8688868487\
-84808084807B7E7F7E7B7C7E7D7A7B7D7C787A797A797879797B79797B7C7B7B7E7E7D7F7F7E7F7C7C7C7B7A79797979797B7D7D7D8080838484848484838382\
-817E7F7E7E7D7D7D7E7D7E8081818283838383848383828181807F7E7F7E7E7D7F7E7F7F80818281838383828383818282808181818081808182818183828384\
-848483838382818181818181808181818180818180818081817F7F7F7F7E7D7C7D7C7C7B7C7C7C7C7D7D7E7E7E7F7F7E7F807E7F7E7F7D7F7E7C7D7D7A7A7C7B\
-797B7C7C7C7E80808281838484848483838281818080807F807F8081828282838484848483838382818281808181808080818181808282828182838383838383\
-8383828483828483828383838282818080807E7E7E7C7D7D7D7B7C7B7D7D7C7D7E7D7E7F7F7F7F807F808080807F7E7D7D7C7A7B7B7A7B7C7C7C7E7F80828182\
-8383838283828080807F7F7F7E7F7F80808082828383838283828281818081807F807F8081818282828383838381828281818081818082818383848585848485\
-8485838483818281807F7F7E7D7D7C7B7C7A7B7A7B7A7C7C7C7C7C7D7D7E7D7D7E7E7E7E7F7E7D7E7D7A7A7A7A7A78797A7B7C7C7E7F81828283848381818081\
-807D7E7E7D7D7C7E7F807F8181838283828281817F7E7F7F7E7E7E7E7F7F80828382828282838382818282818181828383848485868686858685848282817F7F\
-7E7D7C7A7B7A797A79797A7B7B7A7B7D7C7B7D7C7D7D7D7C7C7E7D7A7B7C797878797A797A7B7C7F7F808282848483828382817E7F7F7E7C7D7D7D7F7F808182\
-838283838283828180807F7E7E7E7E7F7F7F8082818383848484838483828382838283848485858586878687868786868686858585848282827F7F7D7D7C7B79\
-797979787978797A7B7A7C7C7D7D7E7E7E7F7E7E7D7D7C7A7B7B7A7B7B7D7D7F818182828484838483838282817F807F807F7E7F7F8081808182828281828282\
-8282828081818181808081808180818181818281828282818282838384838484838585858584858586858584858384838181828180807F7F7D7E7D7D7D7C7B7C\
-7C7C7C7C7C7B7D7D7C7D7D7E7E7E7E7F7E7F7E7E7F7F7F7F7F7F8081808181808181828282828182828081818181818081818180818081808180818181808181\
-8081818180818181818180818181808181818081808181818180818282838383838483848384848384848283828382818281808180807E7F7E7E7D7D7D7C7C7B\
-7B7B7A7B7B7A7A7B7A7B7B7A7C7C7C7D7C7C7D7D7C7E7E7D7F7F7F807F808081818082818180828281818181818081808080807F8080807F7F7F7F807F7E807F\
-80807F808080807F80807F8081817F80807F81808181808181818081818080828282828383838282838383838283838383828182818180807F7F7E7E7D7D7D7C\
-7C7B7B7A7B7A7A797A797A7A7A7B7B7B7A7B7A7C7C7C7C7B7C7C7D7D7C7D7D7E7F7E808080808181808081818281818181818081818181817F807F8080808080\
-807F7F7F7E7F80807F807F7F808080807F818081818180818180818081818180818181818282828283838283828384848384828383838383818281808180807F\
-7F7E7F7E7E7D7C7C7C7C7B7B7C7B7B7B7B7A7B7B7C7B7C7C7C7C7D7D7C7D7E7D7E7E7D7D7D7E7D7E7E7F7F7E8080808081808181818281828182818282828282\
-828281828280818181818180807F80808080807F8081818181808180818182818281828182818282828182818383838382838382838282838382838182828282\
-82808181818080807F80807E7F7E7E7E7E7D7E7C7D7D7C7D7D7C7B7B7C7C7C7C7C7B7C7C7C7D7D7D7D7D7C7D7C7D7D7D7C7D7D7D7B7C7C7D7D7D7E7E7E7F7F80\
-807F818180818082818282828282818281828081818081818181808181808080808080807F807F80807F81818180818181828282838384848383848483848383\
-83838182828081818080807F7F7F7D7E7E7D7D7C7B7B7A7B7A797A7A797B7A797A7A7A7A7A797B7B7B7C7B7B7B7A7A7A797B7C7C7D7F7F808281828283828181\
-80807F7F7F7E7F7E7F7F7F80808181808180818181818080808080807F807F8081818081808180828081808181818081808281818A8E88898B898B8B86818484\
-8084827D8083807D807D7C7F7E7A787A77777775757879767879797C7D7C7C7E7D7A7A797274787A7C818183898B8B8A898382837E7A7A78787B7E7E80838586\
-8988858583807E7D7A787B7C7C7E81808587868786848381807C7C7C7B7C7E7E81838586888791928C8F8C8B8E8E89868D8B8C908C8B8C8E8888858081807C78\
-7575747675727475757275757374737373767070706C6B656A7A80878A8B8E959488827B7675747170787C838A8D8B8E8F8C87827B78767675777C7F848B8C8D\
-8E8B8886827C797878797B7E8287888B8C898986847E7D7C79819490909B9A9DA29A8C9192888B8B868A918D8B8E8A878A837C7B7A7474706E6F707172727477\
-75767A7672727170726E6867685E5F737D828A8D8F989889817D7472716B69747C81898C8C92938D85827B76747170737A7F85898C8E918D88857F7B78757477\
-7B7D8087898B8E8B8994968B8D8F8C93948D8F99979598959296948C8A8A8686847E7C7D7B7677747376726D6B6F706C6A6E7272737170727477716768666164\
-6C747E87898D9696908B857D7A746F6C6E70777C80848A8F8F8F8C8984817B7575747475787A8186888A8C8B8B898681807C7A7979787E8B8C8B95989DA39D98\
-9898928D89807F7F7B797878777776716E6B6763605B5959575B5B59606469717A7F818183858585858584838485838484838484838382818282808181808281\
-828383828485858586868788888888878888888687878586858585838483838381818282818181828183828486868587878989888A898A8A8988888787858585\
-8482838382818080807E7F7F7E7D7E7E7E7D7F7E7F7F7E7E7D7E7D7E7E7E7E7D7E7D7E7E7E7E7D7E7E7D7D7D7C7D7D7C7C7C7C7C7A7C7B7B7C7C7C7D7D7E7F7E\
-808081828282828283838182828182818081818080807F7F7F7E7F7F7E7D7E7F7F7F7F80808081818281828382838281818281828180818181818181807F807F\
-7E7F7F7E7D7E7D7E7F7E7F7F7E7F7F7E7F7F7F7F7E7E7D7E7E7F7F7F7F7F7F7F7F7F7F7F7E7D7E7E7D7E7E7D7E7E7E7F7F7F7E7F7F807F7F80808080807F8080\
-7F7F807F808080807F80807F7F7F80808080807F7F808080807F8080807F807F8080807E7F7F7E7F7E7F7E7F7F7F807F7F7F7F7F7F7F7F7F7F7E7F7E7F7F7E7E\
-7F7E7F7F7F7F7E7D7E7E7D7E7E7E7E7E7D7E7E7F7F7F7E7D7E7D7D7E7E7E7D7E7E7D7E7E7E7E7F7E7D7E7E7D7E7E7D7D7E7E7D7D7E7E7F7F7E7F7F7E7E7F7E7E\
-7D7F7E7E7F7F7E7F7F7F80807F807E7F7F7F7F7F7F7F7F7F80807F7F80807F80807F807F807F80807F80807F807F818181808181818180818081818181808180\
-8180818181808081818081818181818181818081828182828282808181818081818181808180807F818181818180818180818181818081818181818282828282\
-82828181818081808181808181818181818280818181817F81818181818181808181808181818180817F80807F80807F7F807F80807F807F808080807F808080\
-7F807F808080807F808080807F807F807F808080807F808080807F807F80807F80808080807F8080807F7F808080807F80808080807E7F7F807E7F7F807F807E\
-80807F7E7F7F7F7E7F7F7E7F7E7F7E7F7E7F7F7E7F7F7F7F7F7F7E7E7F7E7F7E7F7F7F7F7F7E7F7F7E7F7F7E7F7F7F7F7E7F7F7E7E7F7F7F7F7E7F7F7E7F7F7E\
-7F7F7F7F7E7F7F7F7F7F7E7F7F7F7E7F7E7E7F7D7D7F7E7E7D7E7E7D7E7E7E7E7F7F7F7E7F7E7F7E7F7F7E7F7F7F7E7F7F7F7F7F7E7F7F7F7E7F7F7F7E7F7F7F\
-7F7F7F7F7E7F7F7F7F7F7E7F7F7F7F7F7F7E7F7E7E7F7F7F7F7E7F7F7F807F807F80807F7F808080807F807E7F807F8080807F80807F807F808080807F808080\
-80807F807F808080808080807F80808080807F80807F808181808181808180818180818181808181808181818181818182828281828282818281828282818281\
-82818182818282828182828282818282818283828382828382838382838383828283838383838283838182818282828182828382828183838283838382828383\
-82828181828282818282828281828281828180828281808181808181818081808181818081818282818281808081828282818181818181818181808081808181\
-8080808181807F81808081808181818080807F80807F80807F7F80807F808080807F80807F8080807F7F807F807F807F7F7E7F7E7F7F7F7E7F7F7F7E7F7F7F7F\
-7F7E7F7E7E7F7F7E7F7E7F7E7F7F7E7F7F7F7E7F7F7F7E7F7F7F7F7F7E7F7F7E7E7F7F7E7E7F7F7F7F7E7E7F7F7F7F7F7F7E7F7F7E7F7F7F7E7F7E7F7F7E7F7F\
-7F7F7F7F7F7F7F7F7F7F7F7F7F7E7E7F7F7E7F7F7F7F7E7F7F7E7F7E7F7F7F7F7F7F7E7F7E7F7E7F807F80807F807F807F807F80807F807F807F80807F807F80\
-7F80808080807F8080807F8080808080807F8080807F8080807F807F80807F8180828385878B91928886898481807F80767D859295878C8C827A767C80737A84\
-898682848580757473756F6E777D75727A77757F7F84908B8C8F868A858584827B7A787876787B7374777275767175766A6B676265655D5B5D645E5A65686464\
-6569635E60605D5F555C625A576467605E646A677270647784747A817372847174827F758781889B8C838C94898C8B8B94868696928489878D938B8599928995\
-989791939DA18F87A398869396898A8F8C979272839B8B8893968A898E999B8C899097908C9292918D9095958C81909287888B8782827D868D827D8A8077878B\
-7C898E7C848D7E7F8B847E948A7A8E8B808C927F85877780927A6C8284857D8D8986897F80888A81878D88898D8C85868186857D848B807A7B777C83817C7C7F\
-7C7D7181897574827E7582867E7C73798C846E78807C7C7174766E7778787F797886807080876E7E8E8481837B808A787A85777E7E7278877B6879827E777982\
-7C79847B7A85726D7C7B7E82787C8378797C73817F6E7A7B717C867D7F847A7F858386817E87877B85877381897C838784817F7D788284778190837689918283\
-878B8B7F828E86868B87898A7C7D88808188898185827B83888582858080867F818B87828787838B87868789868683827E818680858A8A8C898A8D8982838683\
-85888E88838E8D828189868C8D8B8E8B888B8C86878B8B89858989868C8D84888D878A8886888680848983858885858684868683898985888484888583868685\
-8483858687878585838181828084827D7F7F7C7C7C7A7A7B7A7C7D787A7D7B7B7B7C79777A7B787A797B7A7C7E7C7B7D7D7F7C797D7C7C7D7C7E7F7B7C7D7B7B\
-7C7A7A7C78787A76777977787A797A7A7A787B7C7B7D7D7C7C7B7A7C7B7A7A79787978787A79797774737371706F6E6D6C69686767686767686967686C6C6B6E\
-6F7071717275757576787A7B7B7C7C7C7D7E7D7F7E8081818283858687898A8A8C8C8D8F90908F918F8E908E8C8D8C898785827F7B78787470706E6A69666563\
-5F5E5D5B5B5B5C5C5D5E6162646A6C7077798081878C8B90929694969896969395928E8D8A89868683848281848486878A8D8F919596999B9C9E9C9C9D999894\
-938E8B8784807B7673706C676563615D5D5C5B5A5B5B5D5E5F646C6870787A80818A8D8E93969B959A9C99979498928F8D8D8A858483827E7F81808183858789\
-8D90929497989B9A9C9B9A979793918F8A8782807C78756F6D6A6764625F5F5C5C5B5B5D5C5E60616A686B74767D7C86898A8D8F9792959896959195918E8C8C\
-89848482817D7F7F7F7E81848486888D8E90939495969696949491918C8A86837F7B7874706D6B6564625E5D5B5B585857595A5B5B6365656D7177787D87848B\
-8C93918F9793969193928E8C8B8A848383827E7D807D7D7E81828286888A8B8F919090939392928F8F8A898683807C7A75726E6B686463615F5C5D5C5B5A5C5D\
-5E5F6369676D7277797C8587898D90959096969694949791908F8F8B86888783818283828283868587898C8D8F91929292939290908F8D898785817C7B777371\
-6E6C696765646160605F5E60626364666C6C70757A7D7E868A898E90969195979595929691908F8D8C86888684828384828183858587888A8B8C8F8F90909190\
-8E8E8B8A878483807C7977736F6E6A67656562616060605F60616262656B6B6E74767B7D8288878D8E939291979496939593908F8E8E89898786848284828283\
-858486898A8B8D8F908F9190918F8F8E8C8A8885817F7D7A7673706C6A676663605F5E5E5D5D5D5F6060656A6A6D74777B7C8487878C90949194979494929592\
-8E8E8D8B868787838182837F8082848385888A8B8B90919191929490908F8F8A898784817E7B7874716F6A68676463605F5F5D5E5F60606163666B696E74777A\
-7D8488888D8F9492939894959395908D8D8C89858685838081828080838585878B8D8E8F9395929497969392918F8A8886837D7A7A75706F6D696463605E5B5B\
-5A58575A5B5B5D62676C6E737B7D82858A8E8F94959998979B98959595928D8D8A8884848381808083838387898C8D90949497979A999998979592908D888581\
-807B7675716D6B6866625F5E5C5B5A5A5A5B5E5F6164676F6E737B8085888F9694999D9F9B9B9E9B9793948F8A888685807F818180828787888D919797989EA1\
-9E9FA1A19C9A99958F8C88867F7C7A7673706D6C69666260605C5858585656575C5C5C676F6D748086878C9899989AA1A198989A948D8A8A837E7B7D7B77797E\
-8180868F92949AA2A5A3A6AAA9A2A1A09B948E8E87807D7C79727375726F6F716E6A68686560605E5D5C5A5D5F5F606B7070778188878B9497919298968C8C8C\
-87817E7C7B7673767877787F84888A90999A9BA0A5A09E9D9D96908C8B857E7B7D797676787976787C7C78777976706B6C6A616165656062686A6C73797E8489\
-8E9193959393908D8884817B787574727474787C7F858A8E93989A9D9F9E9E9D9A9593918C8A8887868385868585858583817D7A757068625E5A5554575C6167\
-6F77848F9296A0A39E9997948A7F7A776F6B6A6B7073767E888E92979C9E9998969189837D78757473767B81868D969D9FA4A7A5A19C97948C84817F7C7A7A7E\
-7E808182827F7A746D69615A595A595D697178818E97999B9D9B928B837A746D6666696B7077818A8F94989A97938D867E76716D696B6D737980888F94969896\
-918C857E78746F6E6F74787F848E9CA19A9CA19B8D84847F797574797D82868C98A3A29A9B9C95837670675A4F4E50555C646F7F8E9AA0A3A09C9385776B645E\
-5C5F68737D89949CA09F9990877C71665F60666C727D8D959A9C9A978F82776F6A686769737F8790959A9B978E867E76706B6B6D757C838B929495928C857D77\
-716E6E73787D858B90928F8D87807B74727173777D82878D8E8F8B88827D77757275797B86928C8A8D8F8A7F7C78777A7D7C7F888F8E8B8B8D87848385847E76\
-757878736E6C6F76797B7D858D8E8A8582807D78757577797D7F7F7E82837E79777772737D82828388898582807A77787B7A7A808687888782807C7B7675767C\
-7F828588898885817C797778777A7D8285888785837F7C7A79777A7D7F8386888684847F7B7C7A7A7C7F818284858480807E7B7C7D7E7F8284858383817F7D7B\
-7C7C7E818283858484827F7E7C7C7C7E7F81848784889893807D7F7F7C81817D848F908984817E807F7C777A828181807E7F7E7D78777A7E828385858281807E\
-7978797A7C7D7E807F82817F7F7F818283838483858483878581848282858384838183838283817F81807D7F8282828485848281817E7E8082807E81837F7D82\
-827D7D8080818688848383827F7E7C7977787675787A7C8692918A847E78777B7A7A7E838687857D77797D7D7F8184848889847E7B7A7B7E818282848786837E\
-7C7B7E81838385858384827D7B7B7F82838685858382817E7D7D7F80848585848282807F7F7E81838485838381808080808080838584848181807E807F818284\
-84848381807F7F807F8082828484838280807F81808282848384969A897E7C7A7B878A8180888E8C88827676808786848582868A827C7B7C8084827C797A7C82\
-837D767B7E8082807A77798184837E7A7879808580787C82807E7F797479817F7D7D7E7D7C7E7B77797C7D7D7B756D696B6F777A797574808D8D82786F6D7881\
-827E7E8284888579706F78808686817C81837F7C77727680878884807D7F818585868D97A1A19787807F868E918F8D88847C746C67666B7073787A74706C696C\
-727576787B7975716B62636D747B8D938A827B70666C73757E8B8E8B8781746B6C72767F898B8989827772706F737F868A8B88827A777472767D83878A88827C\
-7877767A97AFA89E907A737E8C8B8F9C9E9A9C9480777F86898D8B7B6E75776B67645C514F576B7F857F726968696661585A6D849AA499806D6666696E767D8A\
-999C917F6B61636F7D83898E908F897B6C646875838E948E89837D77706D717C8B92928E877A819EA49B988C828A989B93969C98999C93878690918F8E84736E\
-72746F6B6559504F535D647077746E675B524849658FAFB6A387685B5F62676F8195A6AEA07F635658667A898F979D9B8E7963575C7187989D998E867D736963\
-6B7B909EA1978A7A8CB6B194887C7D98B5AE99999F9B9E9E8C7E8B9E9E968B76696D7064616557546367575061675D67675C58584E487DBCB8AA936C4F567370\
-6B7F919CADAF8D60535A61798D918D97A094806D59536987999C9A9185807A6E646776899BAA9F90B2C49E84776C7AA6C4B1A5AC9E90959585869EA69A95866D\
-676E6C6869614F4A565D595556585C69675C59584C4E8AB6AC9F8C6A586276696781939FACA7825F5C64697987888B99A3927D6C5B5C7189929194918A857D6E\
-636B7D8F9BA1B5C3B29D85717285A2ACB1B7B0A1988E828295A2A3A09785766E645B5F6B6C5E54585A545457595C5D5D5E646A5E4C70A5A69F95765C5F7B766B\
-7C8793A1AA916960696D788586838D9F97857565606C838E8C8D8F8D8A8478696978899497ACC4B7A69478707E96A3A9B5B3A8A293827C8CA0A3A19B8B7F766C\
-5B55646D6558595D5454534D515C666C6A6C61526596A08E867D7172827C646980919D9F8F746D7A7E7672767D8B9F9B85777273777E7E7A8091989186797275\
-7F8685839DC5C9B19E827481969A98AAB8B3AEA1897B8798999A9C958986775B52626A65574E51596265574D52555E6C7065525F99B19A89756A718182646582\
-9AA4A08C706A7E83746C728094A29B8076797C7B78747884999D8F827D7B7C7F7B77839796B8EDC68C817B79879D9E9ABAD5B993897D7C939E918B9DA589715F\
-4B4B616B5C52575E645D4F454759626A705C569CC1987D746E717E7E615E8BADA4928876788880675D759197998D7F838C8470656D7F8D938F8287928C7E6F6E\
-78899198AEBEB8ACA08B80878D8F9CADB3B1A99E908B8D8C8C9194928F826C59566059495260616054474F606659596A6E5E4E62949D8D8D828087816A5A6C82\
-8A8C8A8B8F958F74676E74797B7D8490999481797A7C7771747A89948F87898C8C81839DB0AAA4A59E9A9B8F8692A6A8A1A4A59D9B998C82898D87807971675C\
-585B53474D5859585752575B58585B584871B09B7D8E9E8D817354597488777494A2A1938475747B6E5D687E8A90908A8D948C796B6F75767578849099938988\
-91828DCCBE8694B09C8C918690B1B89990ACA993898381848C7E6B7A8162515952454A585248545B58585658646951619C987B87968C847F656578816F6C8A95\
-958C868688877264727D78747F878F91888286887E716F797E7E7D828E9797A6B3AEA7A69A92908C8B959E9FA2ABACA39C95918A86837F7C7A756860625A4845\
-555D504F5D5E626258626F654F507C9B7D7690A09887757084826A5E778E877D8290998F7D7A828574676F8282797C8794938681888B8172737D857F88A9B9AC\
-AFB5ABA397898A94928E94A2A9A69F9C9B958A827C7A75665C5E5D514F575956515C605A585F66656158567B93787996A495837E828676656B7C837977879994\
-84828D8D8172717C7E716D7E8B8A828590948B7F8086847C7484A5A897A4BDB8A39A9A9F97898B979D98959BA4A08E888F8B77706E6961585151565853556061\
-5F5C636C6D6863636D837A6F8A959187848E8E817277807A74747D8A867F838F8E838081867F74747D817B79808A8C85848D8F86858584A9AC85A4BBA69E969B\
-A7988694A69891989A9E99878B95857578716B6257555C595254585A5C585C6869666A666988846C8A948B8C828790867179847B76797D88857E838E8B828282\
-858377787F7E787C81848584878C8C88888B88909D9B9AA7A8A4A09F9D9F9995979A96949798979390928E867F7C756E675D5858555455555A60605D67716E6A\
-696B81846D8193888782888F89787C8981767B8084827B828A877F848886827D7F8480797D83827F81868B8785898F898AA2A196A4AAA5A09C9CA19A90969E96\
-9296989A948E9193867D7F786F675E5C595852555D575B5E5F686A6A716B6C8383718792878A86868C86787C877D757C8083807D848A867F858683807C7D827C\
-787F8180808286888885898B8985889E9C919EA9A29C9D9E9F9A91989B9391969895908F91908680837B6E6A67625A5452555554515C615966716D6775907D76\
-958D898B82898A7E737E84767681828381828A8A848085857F7B7A7D7E787780807F8085898987888B8A868585889799919EA8A19DA1A19C9A969599958D9296\
-908D8F8F8D86817F79706866605557574F51585B585D6869707066728F826B8896837D8586847F7878858271778783797C8486807B7C808178717B8077747B80\
-7F7C7E8387847E8288857F7F8E9D908C9EA69992989B94918F8F9291888A929286848B8A7F7876736A625C5C58515151585A5355616664656D6B6B7D8474788B\
-8B807A86867D7C7B7A7C7C7A7879817F7A7B7E7E7B7A7A7B78797A7A79797E7F7E7D7F8181808281818282868B8C8C8A8C8A89868784848284878887878A8B89\
-898C8E8A87868581807D7A79767471716F6D6D6C6C6C6B6C6C6D6E70717274747576797A7C7F8182848585878887888988878785858584828381817F7F7E7F7D\
-7C7E7E7E7E7E808182838285868686888A8A8C8E9090919293929393929292918F8E8E8D8A8A8A8885848483807F7E7F7D7B7B79797877767676767676767675\
-767777787779797A7A7C7F7F80828485848787888788888887878686848583828181807E7E7F7E7E7D7F7F7F7E7F808080818182828282858687888A8B8C8F91\
-9392929292918F8E8E8D8B8A898987868483827F7D7A79767674716F6D6C6B686868666868686B6B6D6C6F7477797A7F838384888989898A8B8A878989858585\
-84817F7F7D7C7B7A7A7979797A79797A7A7B7D7E7D7F81828185898B8C8C909091919292929291908E8F8D8A8A88868482817E7C7A79767573716F6B6A6A6867\
-65666666676768696B6B6C737778797E818282878A88888B8C8A888A8A87868483817E7F7D7D7C7B7A797978787A7A797A7B7B7C7D80818184888A8C8E919291\
-939593949493939190908D8B8B88858481807E7B79767372706D6C69686766646465646567696A6B6B6F75787A7D7F8484868A8B8B8C8D8C8B898B8A86888684\
-8281807E7E7D7C7A797A79797A797A7B7B7D7D7F7F8182868A8C8D8F909291929594949493939290908D8D8A89868483827F7D7B777573716F6C6B6967686665\
-65656667696B6A6C7176787B7D828585878D8E8D8D8F8F8D8D8D8C8A8A8787858381817F7F7D7D7C7C7B7A7C7B7C7C7E7D7F8182818486878C8D8F9192949394\
-9797959695949292918F8E8B8A87868483817F7C78777472716F6D6B6A696766676868696B6B6C6D6F75797A7D808383858A8E8B8C8E8D8C8C8B8B8989888684\
-8280807F7E7D7B7B7B7A7A7B7A7B7A7C7D7C7E7F7F81828486898C8D8E9090929195949393939191908F8D8C898786848380807D7A787573716F6D6B69696666\
-65656465656768696A6D727777797E808183898B8A8B8C8C8B8A8B898887868482817F7E7E7B7B797A7878797977797A7A7A7C7D7D7E7F818285858A8D8D8D8F\
-91919294959493929290908E8D8B8A8886858382807F7C7976767471706F6C6B6A696867676867696A6A6C6D7178787A7E808283888B8C8C8E8D8E8E8D8C8A8A\
-888786848280817F7E7D7D7C7B7B7C7C7C7D7D7D7F7F7F818282848687888A92918F8F949694959998949795949392928F8D8B888888848382807C7979777473\
-716E6D6D6B696968696867696A696B737677797E8181838A8D8D8F90908E8F8F8D8C8B8A878884838382807E7C7D7B7B7B7B7A7C7D7D7D7E7F80818282838586\
-8688888E95918F91959692969B969394929190908E8A8A8684858380807F7B767676726F706E6B69686666656465656465656A707274767B7E7E82878A8B8D8D\
-8E8C8C8C8A8988848383807E7C7C7A7876777574767575777777797A7A7B7B7E7E808282838586898D8C8D8E90918F93939291908F8E8C8C8A8987858382807F\
-7E7D7978767473706E6D6A6A66656564625E5F5E5C5A5A626E7881898F908984837E7B7B7B7C7B7D82888E94949086766D65656A71777C7B7D7E7F8382827E76\
-7272777F8990918D86817D8086929F9E96887E797E88939B9B978E8A858586858685888C8D8A81766C6A6D7678766D6160646A6E6F69646062666A6A7C929499\
-917C71686F7F8B97958E8C8885888581797880858E948B8077757B828A8D878481808587878585898E92928D837A7A7F868F95918FB5D0B893745B6991BCC5B7\
-A58D818D958E8E92949395937E6E6E6F798885705C57585D6662595D636470715E463861A7C0C2A06A5153758D88867F829DAC9F7C5B5564819E9E8878737A82\
-807663698197A1947C666272868E8C8481878E8C7D6B666E829499948196D2CE9871585D89BDC8A59396939493847483A2A5948471626A7C7E736B685E596060\
-555251494C656F5F4B49485399C4A3866F67646D81706586A7ADA28C6E596885897D7D848C989682635C6F828E9189807F898A796D707A8B9B99887A7A7D7E7D\
-7A7880919EA4B7D1BA826C6D7B93ADB3A4A7B2A387797C8496A79E887E7C756F6F6A686D72695B5351545453565A5E635B524A3D6CBAB698837170667169526B\
-98B1A7907F716B77735E607B99A49686746872766D66708A979A927B6D7079797275818A95948577727676757D8294D5F4B56D60747D8190919BD1E2AA70677E\
-888C8E8587A09F75575762676963535873714C3D41485C66584642555C7CB2A28589928865535A5D6E90948C8A9CA5856B646065717E838295A89984746F6C6C\
-71757788979B928A848075706F737D89909296A0B2B9A9948C8E928E8C929EAEB2A698949795918F91949695897D777B766A65666662605C56575E6061564752\
-675B423D78C1AE8A8CA3A17F604C51698B87768CB0B9997B7774706A64657894A2978B949C8B70646971797D7D8798A1978781837E746F7584A0BCBDA9A6ADA5\
-8A7C8392999D9FA1A5A89D8D8993958A888F9083756D6B69605B5D66645A5155574C495059544650545389A9907A96B795675E726A5A626C79899A9A8C919C8D\
-6E63727467637483878C9193928C81746E73746D6D7B888A888A95948AAFCBA17F9BB6937082A3A18E99A5A3A19D93899294847C8992857477827A625B65665D\
-5252595C5957585D5D5A555254574B5787927C7DA6B48F7686967459637A766971838C8A8B8F8E9090887C7C81786B6C7C807A7C8A928B868C908C8384A9B58E\
-84ABBD917895B49B7C8FA69B8389959286818A8A857F7E7B7877716E7074706D7075726C6D70716D6E737775777B7D7A76797D7C797B7E7E787B7F7B78797B7C\
-78787F827D7C898C8480898C8581868B85828489888485878785848689888486898A858387888684868687888988878887848285868383878885858788838384\
-85838183838385868484858483828282818383848484848382818081848484848586848182828182818281838383828381818183828182838282838484808183\
-82818081838381828382828283828181828181838383828381808181818081828382828183838182828181818181828282838481808282817F81838181818283\
-82808082828281828181817F7F8180807F8282807F8183807E828381818082817F808182828180807F807E7C7F80807F7F807E7E7E7F7D7E7D7E7F7F7E7E7D7E\
-7E7C7C7C7E7E7D7C7D7D7E7C7D7C7D7D7C7D7D7D7B7C7C7C7C7C7E7D7D7C7B7A7B7C7C7B7D7D7C7C7C7D7C7C7D7C7B7D7C7C7B7C7C7B7B7B7D7D7D7C7C7B7B7A\
-797A7C7D7C7B7B7B7B7B7A7C7C7B7C7D7C7C7A7C7E7F7E7E7D7E7D7D7C7F807F7F7F7F7F7F7E807E7F7E807E7E7D7D7E7D7E7E7F7F7E7E7D7D7E7E7E7E7D7E7C\
-7C7C7D7E7E7E7D7C7D7D7C7D7D7E7D7E807F7F80807E7F7F80807F7F8181808081818080808281807F8080807E8080807E7F7E7E7D7C7E7F8080807F7E7E7C7D\
-7E7E807F8080807F7E7E7F7F7F7E807F7F7D7F7F7E7F7F80818080828181808080807F818180818080807F80808080807F7F7F7F7E7F808081807F80807F7F80\
-818080807F807F8080807F8181808281818283838183848286948D7C79717895988778829998937F727A85908A79787F888C86807B818687837A7A838683838D\
-8F85838082898D8B8380858687817E81808285807D7B7F8281817F7D8081807F7A7A7B7E7D7C7B79787D8B877F847F7C8285847D7C7F7E81807B7E7B7F88847F\
-7C7F818080807B7C80807D7C7E7F7F80817F807E808B91877C76787F807F7A74777D82817D7A7D7F81817D79777A7D7D7B7B7A7D807F7F7E7B7C80847F7A7B7B\
-7C7D7C7B7B797D8280808080807E7B767A7E7B76787C7D78797E7C77797F7B787C7972777B807C767D7D798083807D797C7F7C7E7F7B797C7B7F838079767C88\
-7E737B85847B768288857C737D8E887A787D8584797E89807A7C858D7F777F8584807E7F83837D7F85837C7B8087837B7B7F8581787D82817E7B7C827F7E7F81\
-7E7F7D7D7D7A7D827E7D7C787E82817E767D8483817E7C7E7B7D837D777B8084827F817B787F8382807B7A808485817D7C797C82837F7C7A7C8081837E7C7D7F\
-808483827F7B7D818383817F7D7D818481817E7E81818183817D7E8083838181807E7F8081807D7E818081818182818282818183817F82838182838481828383\
-858483838484848283838284848383838381818281807E8181817E7D7D7E7C7D7E807E7E7D7F807E7F8080807E7E7F7F7E7E7C7D7D7D7B7D7D7D7C7C7F808083\
-84888C8F9091918F8E8D8C8D8D8D8C8E8E8F909191908F8D8F8E8D8D8B8A8787858582817E7F7E7E7D7A797574716F6D6E6E6E6F707273797B7C7A7A7F889192\
-8F8C87837F8384837F7B7C7E83878D8F8C86868A8A8786837F7A7B7E838585868587878B8D8F8F8F8F8F9090908F8C8B898B8B8E8F8E8D8C8B8A89868582807C\
-7C7A7977757372706D6F71727271707375787D7E7C7B7C83898C8C8A85807E7F8282807E7C7C7E8388898884838282838583807C7A7C7F818484848183848789\
-8D8D8D8D8D8D8E8D8C8A8787888A8A8C8C8A89868685868483817E7A7A797776747371707171737371717173767A7B7B7A797980888A8B8985817E818381807D\
-7B787B7F85868684838282848585817C7B7B7C7E8181817F818283878B8E8D8D8D8C8A8A89888584848486898A8886848383838482817E7C7A78767777757574\
-7273737374747372727375777978767777777D83868686838281828282807D7A79787C7F8081807F7F7F828284817F7D7C7B7D7E7E7E7C7D7D7F82858A8A8A8A\
-8786858583817E7E7E7E818183817F7E7E7D7F7F7F7C7B787878797A797A797877787979797A7878767877787978797878787879787A7A7A7B7C7E808180817F\
-808080807E7E7D7C7C7C7E7E7F7F7F7E7E7E7F7E7F7F7E7E7C7E7E7F807F80807F8080828182818281818280818180817F80807F818080807E7F7E7F7E7E7D7E\
-7D7E7D7D7E7E7D7E7E7D7D7D7D7D7E7D7E7C7C7E7E7D7E7D7E7E7E7E7E7E7F7F7D7E7D7E7E7D7E7D7E7D7E7E7F7F7F7E7F7E7F7F7F807F807F807F8080807F80\
-81818081818081818180818180818181818181818180818180818181808181818081818181808181808181818180818081808181818180818181808080808080\
-7F807F8080807F807F80807F80807F80807F80807F8080807F7F808080807F807F808080807F7F7F7F7F7F7F7F7F7F7F7E7F7F7F7F7F7F7F7F7E7F7E807F7F7F\
-7F7F7E7F7F7E7F7F7F7E7F7E7F7E7F7E7F7F7F7E7F7F7E7F7F7E7F7E7F7F7F7F7E7F7F7F7E7F7E7F7F7F7F7F7F7E7F7F7F7F7D7E7E7E7F7F7D7E7E7E7F7E7F7E\
-7F7E7D7E7D7E7D7E7D7E7D7D7E7D7E7D7E7E7E7E7D7F7E7D7E7E7E7D7E7E7D7E7E7E7D7E7E7E7E7F7E7E7D7E7E7D7E7E7E7D7E7D7D7E7D7D7E7E7D7E7E7E7E7E\
-7E7E7D7E7D7F7E7F7D7F7F7E7F7F7E7F7F7E7E7D7E7E7D7D7E7E7D7E7E7E7D7D7E7E7D7E7E7D7E7E7E7E7D7D7E7E7D7F7F7E7E7E7F7F7F7F7F7E7E7F7E7E7F7F\
-7F7F7F7F7F7F7F7F7E7F7F7F7F7F7F7E7F7F7E7F7F7F7F7E7F808080807F7F7E7F7F807F7F8080808080807F808080808082878988837C77777B81848683807B\
-7B7C838C9290898076757A848C8D8B837D7A7C82878B888787858688827F79787A7E83878986878684848482827F7D7C7C7E7F828383818080808181807F7B78\
-7A7F888A86817A777982878986827C7A7B81878786817C7B7C81848584817E7D7F83848582817E7F868D8F918A827B7B7E858A88857E7C7C80848887827C7879\
-7C8183817E7978797E8385837F7A7A7C7F82817F7A77787A7E80817F7D7B7B7C7F7F7E7C7A78787B7E7F7E7C7C797A7E7F807F7D7A79797B7D7E7C7B7B7A7B7D\
-7E7E7D7A7A7A7C7D7E80807C7B7A7C7D7F807F7B7B7C7C7F7E7B7A797A7A7D7D7C7A77787A7C7D7A7A797576777A7C7B7A7776787A7D7E7E7A797776787B7C7B\
-7A7776797E80817F79787B7E7F7D7D7A7D7F80817F7F7E7D7D7B7B7B7B7B7B7B7B7D7E7D7E7E7F807F80807F7E7D7E7D7F808081828383828181808081818280\
-817E7F7E7E81818081817F808282818382828281838382838382818080828383858583807E7F8183868684827F81838585848382808285868585838283858787\
-87848483858588888585858588888A8985858487898B8B89878686898989878683838385858483807F7F8181817E7C7B7B7C7B7D7D7C7B7B7A7D7D7B7C7A7A7B\
-7B7A787572707070727F8E959798948D878484817978787A7F89909491908E888685837E7A797F858D9599999692918D8C8B8B898A8B8E8F8D8D8A8887888685\
-84807D7978757472706D6E6F70706D696A6D6F7273787773747F8E90908F88827E848785807E7D7E838B8F8C858380808082807B787A7C808586858282838485\
-83827F7E8084878C90919090908E8C888786878A8D8C8C8A8889898886828280807F7E7B787474717272716F6D6F706F6F6F6E70717577767573767B858A8785\
-8484848687858481828386878784838584848483838282817F808281807F7F80808182828383838586878789898A8B8B8B8C8C8B8B8A8B898988878585858383\
-828081807F7D7D7D7F7F7D7D7D7C7B797979797676767575747575747574747476777B7E7C7D828482858887868787868787868583838182807F7E7E7D7D7D7C\
-7D7D7C7C7C7D7D7E7F808081838485898A8A8C8D8C8E8E8D8D8C8C8C8C8A8A89888786848383838181807F7D7C7B7A787776757474737272706F6E6D6E6E6E6F\
-6E6F6E6F70737677797C7F80828486868584848384848281817F7F7E7D7C7B7A7879797879797979787A7A7B7B7C7D7F82848587888A8B8B8B8B8B898A8A8989\
-878786848583838280807F7F7F7E7D7D7C7B7A79797977787777757575747273737271717272727273727272737373757578797A7A7E7E7F8182818082818282\
-81817F807F7D7E7D7B7C7B7A7B7A7B7A797B7B7B7B7D7E7D808183848587878787898988898889878887858584848383828280817F807E7F7D7C7D7C7C7B7C7C\
-7A7B7B7A7B7A7B7A7A7A797A7979787978797A797A797A7B7A7B7B7C7C7C7C7C7B7B7C7C7B7A7B7B7C7C7B7C7E7F808083838484858585858584858584838382\
-828081807F8080807F80818080818281838283838585858486868586868585848585858384838382838382828182818081808181808180818082828281828182\
-8383828182818382828182808181808181807F7F8080808081808181808181818182828082828280828282818281828182818281808182818281828182828282\
-8281828282828281828282818181828181818181818180818181808181818180818081807F808080808080807F807F807F7F7F7E7F7F7E7F7E7F7F7F7F7F7F7F\
-7F7F7E7F7F7F7E7F7E7F7E7D7E7D7E7D7E7D7E7E7E7D7E7E7D7E7E7D7D7E7E7D7E7D7E7E7E7E7E7F7E7F7F7F7F7F7F7E7F7F7E7F7E7E7F7F7E7F7F7F7F7F7E7F\
-7E7F7F7E80807F807F7F80807F80807F808080808080808081818181818181818180808181808180818081808181818180818180818181818080818181818182\
-8282828282818280828281828281828281828182828182828282818282828282828182818282818284848689817982817F86867F888C7C80857C81877E818680\
-80848483848684828782838480817F8381838581868787888E888085817F897E808B7F848C7D868E7F848D7E8082797E887981887686837F887B7B807A7E827A\
-7A7B747F79777D727C80728079748075777B707E7D70837671887478867478837979837876857A7881787B8377787F7A7D827A77817B79867B72868073877E75\
-867C78877A74857A7B837978887F75857A75817D7A817E767F85767C827B807B77827E797F7C79827B7E7F787E7E7C817E7C807B7C81817D7D807E8180808082\
-7F81827A80817D7D817F7C827E7F7F81867F81897B7D888081837D82837D85837B847F80857E82847F8080818082838181818085837D80848080867F7B848081\
-867D83827C86817B82867A7F8B7D7B847D81837E81817F84837E7F83837B828A7D7F817E8082808183828083858081867F7E85828085857C83877F8386818082\
-808086818086808187817F87827F8382818583808383827F8286828085847F85857E82858581838383838382818483828280838280848182837F838683818282\
-84838283848482818482818481828582808686808383838283838283848182848283848183838280848681828381848381818383828381828483828283837E80\
-828481807F8283828282838382808184828084828182828183838080828281828080808280818383818082818182808082828181828081817F7F81807F81827F\
-7F808181807F7E807F7F7D807F80807F7D7E817E7F7E7E80807C7D7F7F7E7E7C7D7F807E7C7D7E7F7D7C7D807D7C7D7D7C7D7E7C7C7C7E7D7C7D7C7E7B7C7E7E\
-7F7E7B7D7F7D7E7D7D7D7F7D7D7D7E7E7D7D7C7D7F807E7C7D7E7E7D7D7E7D7E7D7C7C7E7E7E7C7D7D7E7D7D7D7C7E7D7C7C7D7F7E7D7C7C7D7E7D7C7D7E7E7D\
-7A7D7F7E7D7C7B7E7F7C7C7D7E7D7E7B7D7E7F7E7F7E7C7E7E7F7F7D7D7E7F7E7E7E7F7F7E7C7D7E7F7E7E7C7E7F7E7F7E7D7F807E7E7D7F80807E7D7E807F7F\
-7F7F7F807E7D7F7F7F7E7E7E7E7D7E7E7E7E7F7E7D7F7E7D7F7F7D7E7D7E7F807F7F7F7E7F7F7E7E7F7D7E7D7C7D7D7D7C7D7B7B7A7B7A7B7C7E818284848486\
-86858687868685848385878889898B8A8B8B8C8B8B8A878686858586858684848483838282807E7D7C7C7A7A7978767575747578787777777576777776767270\
-78828B91928E8985807F80827F7B7776787C838A8F8D8A868483828382807B7777797E8487898A88858383858683817C7B7A7A7F85898D8F9293918F8E8B8784\
-81828286888A8A8A898A89878686848380807E7D7B7B7A7979787778767878757675747474757576757471747C878D939390877F7A79797A7A7C7A797A7E8489\
-8D908D86807A7979797C7D7C7B7C7E8186898C8B87817E7B7A7B7C7E7F7E7E7F8083888E9093928D8883807F7F82848786878788888888858481807E7E7E7F7E\
-7D7A7877767577777777757373717171727374747371706F70767E858C8F8D89817C7675767877787879787C8083888A8884807B76757577797A7B7C7D7D8081\
-84858584817D7A7676777A7B7E7F80807F80818282848288908E8C90897C7D7B767C85898B8D89857E7C7D7C7C83807C7E797374757374787777767675727375\
-72707372707373717174767C828A8D8C8D88807A7573727577787B7C7E7E808385868887827F7A77747376787B7F818382838382848383817F7C797878787B7E\
-80838485858483828181868D8C90908A84827D7B7F8387898D8C8583837D7D80818182827D7B7B7777797A797B7B7A7979777576767476767776787876767778\
-7A8085898C8E8C88847D79777577797C7D8081828183858586878683827F7B7A78797A7D80848686868583838281828281817F7D7C7B7D7E8183868787878687\
-89898A8D8C8B89858282818285868A898A88868483818082818182807E7D7B7B797B7C7D7E7E7C7D7B7A79797979797B7B7B7D7D7C7B7A77767676787D82868B\
-8F8E8B89847E7C7979797C7E7F81818281838383868888878683807D7A7A7A7C7E8083858587868583838282828181817E7E7E7E7F8083878D8F9296928E8B84\
-7D7D7B7C808486898A8987858481818281807F7E79797877787A7B7D7E7F7E7D7D7C7A797978777778797A7B7B7A7A797877797B7E84878A8C8A8884807C7977\
-78797C7E80818182808182828284848482817E7C7A787A7B7D8082838585848381817F807F80807F7E7D7D7D7E7F81848A8B8F918F8A88847D7D7C7B7F828386\
-8686848482828081817F7E7D7B78777877797B7B7D7E7D7B7B7A797878777779797778797978797A78777678787A7E8286898A8887827F7B797678787B7D7F7F\
-81818082828383858583807F7C7A78797B7C808283848482828182828281817F7E7C7C7C7C7D8083888C8E9092908B86847F7C7F7F8184868686858586858486\
-8482817E7A79777777797A7B7B7D7D7D7B7C7A797A797777777877797A78797876797C7E83888A8A8886827E7C7B7B7C7D7E7E7D7E7D7F81858788888884817F\
-7D7B7D7E8080808081818283858686878483817F7E7E7F7F8181818282838485888A90908E8E8C868381838385868688878586878888878684827F7C7D7E7B7B\
-7B7B797A7A7B7B7C7C7B7B7B7A797C7C7C7B7979787777777A7E8285888788878584848483817E7B7B7A797C7F818284848385848686848482807C7D7D7E7F7F\
-81818081818485868685848281807E807F807F7F8080818284858586898E8F8D8C8B8986858385878683838586868788888884838283817F7E7E7A7977797A7C\
-7B7B7C7B7B7A7C7D7B7A7A7C7C7B797979777674787C8083848786868584858583807E7C79797B7D7E8080818282848487878583807F7E7D7F7F7E7E7D7E7F80\
-8284858584828281828180807F7E7C7E7E808081818384879093908D8D8882828585858282818282838789858183828080817E7B777573757678797876767877\
-777B7C7A787A797676787573737172797E7E8286838183848282827E79787775777A7A7B7C7C7C7F83838484837F7E7E7B7B7D7C78797A787B7E808081828080\
-828180817E7C7B7B7A7A7D7D7D7D7E7E7F8182818383838B928F8A8E887F8188847F86857D7E83838186847E7D7D7B7C7E7C7778747073777273787674787B78\
-767B797778797575757476797C7E8282818385828185837E7E7E79777D7D7B7E7F7D7C8282838486838182807E7F807E7E7E7D7D808080858382838383848483\
-7F7F7E7D80818183828283838587868482807F8081818282828284868688898588979E989892817C8383838B8B86868D8D8C8E897F797A7B7D82857C7779797B\
-81817B787A7A7D85847E7C7C77777F7E7778787178878B8C8E8B827F8484807F7B76777F878A8E8D8583858483837F79797D82878B8C888484868584837E7A7C\
-8183888988848584858583807C7C7F83858888858486868484817E7D7F82848786858484858583827F7D7F8084858485848485858481807E8082848486858684\
-8CA2A99B958574747F8484888C8A8C9790857E746E707B7D7D7F7D797D807C75767370767A7A7A7E7D80827F7B7672706E73787B838685888683807B77737174\
-767D8386878785827F7A77727275777C8182848483817E7A76747275777A7F808181817E7D7977747274767A7C7D7F7F7E7E7B7A7674747575797A7D7D7F7F7D\
-7C7977757476777A7B7D7E7E7E7D7D7B78777678797A7B7D7F807F7F7E7D7D7A809CA3938E8370737D827E7D848386938C7C75706E70777B73777E7C7D807A70\
-707679787C7D777B8482807F7870747A7B79797674787D808283848080817D7A797A7B7E8285858585858483807C7B7C7F818486848686868583817F7D7F8082\
-8484848686878583818080818283838485858887858282808082838384848787878785828282828383838484878786878584838385858394A79F938E827B828A\
-8780868C8A92958A7F7D807F8085807B81868383827E7A7E838280807C7D808381807F7F7F8185827E7E7D7B7C7F7C7C7E7C7C7E7E7D7B7E7E7C7F7F7E7F8080\
-7F81818089928D87857E7C7F82817E818383878784807F80808182828183858584858481828483848484838585868584848485858586848381828281817F8081\
-7F7D7C7B7A7A7A7A7A7A7979797879787878777A7A797978787A7B7A78777877797976757575767779787878787A79787777797A7B7A797C7C7D7C7B7977797A\
-7C7C7C7D7C7B7B7C7C7B7D7E7F7F7E7E7E7F80807F7F7F8081818281817F8082838382838282828280808080807F8181818080807F7C7A7C7E7E7F7E7E7A7A7B\
-7A797A7B7C7C7C7A797A7A7B7B7978797C7B7A7B7877797B7B7C7D7B7A7A7A78777A797A7D7E7C7C7B787A7C7E7E7E7C7C7E7E7E7D7D7E7F7F81807F81817F81\
-8281818181828383838282808182828182828081828182818180818081807E7F7F7F7F7D7E7F7F7F7F7E7C7C7B7C7B7D7E7F7E7D7D7B7C7C7B7E7F7D7E7C7C7C\
-7C7C7E7F7F7F807F7F7F7F7F7E808081828282818282828281828282838384848485848584838384858584858584838384848483828282828181818180828080\
-807F7E80807F81817F80807E7E7D7F807F7F7D7F7F7F80808282808282828181807F808082828382808283838483838484838482848486858686868585848487\
-86878686858585868786878686868584868586878585848585858385858585848484848384848585868585838384848485848586858585838484848586858686\
-86858584858485858686858685858585868585858484848483848484838383828181828282828382828180818280828280828081828282818081818181808180\
-81808182818180818180828281808181818081818180807F8081807F808080807F808080807E80807F7F7E7F7E7F807F7F7F7F7E7E7F7E7F7F7E7E7D7E7D7D7E\
-7E7E7E7D7E7E7D7D7E7D7D7D7D7C7E7D7E7E7E7E7E7E7D7D7E7E7D7E7E7E7E7D7D7D7E7E7C7D7D7C7D7D7D7C7D7D7D7C7D7D7D7C7D7D7C7D7D7C7D7D7D7C7D7D\
-7D7C7D7C7D7D7C7D7C7C7D7D7D7C7C7C7D7C7D7D7C7D7D7D7D7D7D7C7D7D7D7D7D7C7D7D7B7C7B7C7C7B7D7B7C7C7B7C7A7B7A7C7C7C7C7B7C7C7C7B7C7C7B7D\
-7C7D7D7D7D7D7D7D7C7D7C7D7C7D7C7D7C7D7C7C7C7B7C7C7C7C7C7B7D7C7D7C7D7D7D7D7C7C7D7D7D7C7C7D7D7D7C7D7D7D7C7D7D7C7D7C7D7D7D7C7E7E7E7E\
-7E7D7E7D7E7E7E7E7E7D7E7E7E7E7D7E7E7E7D7D7E7E7E7E7F7F7D7E7D7E7D7E7F7F7E7E7F7F7E7F7F7E7F7D7E7E7E7E7E7D7D7E7D7E7E7F7F7E7F7F7F7E7F7F\
-7F7E7F7F7F7F7F7F7E7F7F7F7E7F7F7F7E7F7E7F7F7F7F7E7F7F7F7F8080807F8080807F80808080807F807F7F7E7F807F7E7F7F7E7E7F7E7F7F7F7F7E7F7F7F\
-7F7F7E7F7F7E7F7F7F7F807F807F80807F8080807F808080807F807F80807F807F80807F7F808080808080808180808181808180818081808180818181818081\
-818180818181808180818081818181818081818181818081818181818180818080807F8080807F807F7F80808080807F807F8080807F80808081818081818181\
-81818181818081808081818181808081808181818081818180818180818181818181818180818181818081818180818180818181808180818181818181808180\
-8180818181808180818081808100\
-')
-
-# From the Welcome Monika .s19 file - aka "Welcome ..." - Stripped of preample and addresses
-audio3 = bytes.fromhex('\
-A14D00008180808080808080808080808080807F7F808080808080807F8181818081818180818181818180808181818080808080808080808080808080808081\
-80818181828282818281828282818282828281818080808080807F7F7F80807E7F7F7F7F7F808180818182828283848483848483838383828382828281808080\
-7F7F7F7F7F7D7E7E7D7E7F7F7F80808181818383838585858686848584848583848382808080807F7D7E7C7C7C7B7B7B7A7A797B7B7D7F8183868888898A8A89\
-8988898888878786858483807F7E7B797777767573747273727577797E82888E909293918F8D8C8C8C8C8B898886858382807D7C79777472706D6C6B6B6D7075\
-7C82888D9090908E8A8A8A8D8E8F8F8E8B8A888888888584817F7B7773716F6C6B69686A6B70757C82878B8E8D8D8C8A8B8D8E90908E8D89898888878584817E\
-7A77726F6D6B696767686B6F747A8085898D8D8D8B88888A8C8F8F908E8B898887878684807E7A76716F6D6A68676666686C6F777E858A8D8D8E8B8889898C8E\
-9090908D8B898888868581807976726F6A6867656263676970777F858C8F908F8B8A898A8C8F9090908D8D8C8A8A898885817B77716D6765635F5F5F62676E77\
-7F878E90908E898886888A8C8C8D8B8B8B8E8E8D8D8A86807B77716D67645F5D5B585D6068747F89919594918B888585878A8B8D8C8B8B8E9091908F8A847D74\
-6F68625F5A575553585F6B7987929A9C99938C8683838588898A898B8D91959899958C82776F66605B554F4D4C515A6A7E909FA8A9A39A8E85807E8082848788\
-8A8F939BA0A29E968777685D57524E4B454349566A859DAFB9B5A898877C7777797F808184878D9AA6B1B2AB9B88715F544B4947433B3A44547396B4C8CDBFA6\
-8D776D6C6F777D7D7F828898A8B9C2BEAD947A6051494644423C3236476490B8D3DDD1B19071626268707477777D8C9FB5C6CBC1AA8D736056514C463E33252B\
-456798C5DADBC9A38370656A6F6F6B696C7C98B4CCD5CAB4977F706D69665A48362C232A4E6F9AC1CBC8B79C867B71706E645F627088A8BFC9C7B5A090827E7B\
-7367544336333031506B8DB4C2C5BBA2887B6B676763646B7E94AEC0C3BEAB998C847E7D7667554539363131526F95BEC8C4B5987D7468676761636F81A0BCC9\
-C9B79E8C807C807E726550413A362C3C5F7DADC8C6BCA281756C6366605D697896BACACDBE9F887D797E80796D57433B372B335A77A5C9C8BEA5806F6A606360\
-5C6A7F97BBCDC9BD9E847A7579827B74634C403B2C2B51709FC9C9BCA77E6E685F63615F6F8498BAC6C2BB9D877E77778077715F473B3120366588BFD0C1AF8E\
-6F6C645D625D647E96ACC9CABDAC8D7C78757E82796C563E322025557EB1D6C9B4987469675E6260647B97A9C2C7B9AE94827F797A817B715E443220224E7DB5\
-DDD1B5966F6568636767677E99B4D0CDBAA28276797D858776634C3B2D1D3B6A95CAD6C1A88062615E626F6F7C94A3C1CEBEAF907675767D877A674E36261D39\
-6C98C8D4BEA07D605F5E616B6F7E96ABC8D3C3AA856A69708187775C3D291C255788B6D6C5AA8C675D5F5D676E7489A1BDD6D1B7916F626C7A8680623E261D22\
-5388BEDECCAC8C655C605F686F7389A3BED4CFB5917269707D84795B36221B2C5E98D0E2CBAC825F5D5F646F717790ADCBDECEAB856562717E806C43261D2550\
-91CCE2CFAD815C5C656C77767388A4C6DCCDA97F605C6C797D6438201E2D62B0DCDEC698634F5B6A7A81757790B1D3DBBE9268525D6F786F4B251E254B9ED8DE\
-D1A6684A53657B8880798FA9C7D8C196715354646A6545231F2A59B3DFDAD19A533E4D678B97898893A7C8CDB994674C4C535D57361F243D8CD4DBDCC171403B\
-4E75969F9D9FA5B5BFB3997B5D504B463E2B1E335A9ED8DDDAB56D46414F738D98A7AEB1BBB4A18C6C584D4137281B284987CADFDCCD8F5544445B7C94A5B1B1\
-B1AB9D8C776556442F1E1C25468CCEDFDECE91624F4E60788EA0AEB1B2A997856E5B4C3B271D1E3263A9D6E0DAB58063575A708595A5A9ABABA1918067513922\
-1C1D2D5D9DD0E0DBBE90756463707D89989EA7ACA69C886D56371E1C1E3068A8D1DED4B4907E72717B818B989DA7A8A094836C563A1F1D223E7FBBD9DEC9A287\
-7A7681888D939498A0A19B8E775F472A1C213667A1C7D6CFB59B8C807F82858D949BA0A09A8F7D6953371E1E305B98C1D2CEB79C91898A908B8C8D8E97999690\
-7D6754361F23386297B9C7C7B3A39B8E8E8D888D8F9299949086756756382327406E9DB9C4BCADA29C96979390908E8F918D887E6E5F4C2E25365486AAB9BCB1\
-A6A69E9A97908E91919490857A6C6058432C31466B9AAEB7B5ABAAA79C99908D92939691857D706559492E283F608DA8ABABA9A8ACA49C948E9395918C827A73\
-6A5E4D2F233B5C839EA0A3A8ADB4A897918E989B92887C777A70634F33253B5B768D909BAEB8B9A89290959FA0908279777A6E594D3A30455C6E838A98ABB1B1\
-A5989DA09D99888385807B6A564D412F3A5167839094A5A8ABA99CA0A49C9A8D8789817669574F483637506277888B9DABACABA1A0A8A1988E8487877A6F5F54\
-4F3E354B5F6C7F8391A8ABAAA6A1ACAB9E948B8888776A635E574A39465F69737A869CA8A1A0A3ADB1A59892928F806F67645E5140455E65676E7C90A09C98A3\
-AFB2A6989899948678737165574D4B5A635C6679859095949FA7A7A59F9B9B9589847F776E665F5D5D5E64696A717E858B90959CA39F999998938A817E7A726C\
-69696762666B6F72777E868A8D90939694938F88837D7A7978777677797874757778797B8085858487898885828284818080818384848382807E7D7E80828180\
-81828381828383838381818384848484848281828385858382808182818282828081818081808182838283818383838383848384858483838382818080807F80\
-818080807F80808081807D7A7D84847F8085868381838480808182807F7D7E7F7F7F7F7E80808080808181828282818181828180807E7E7F8080808080818180\
-80808080807F7E7E7D7D7D7C7C7C7D7D7E7E7F807D7E80807F7E80807E7E7F807E7D7F807E807F807F7E7E7E7D807F7F7F7E7F807F807F807F7D7E7F7F808080\
-808080807F7F807E7E7E7E7E7E7F7F807F80808080807F80808080807F807F807F7E7F7F7E7F7E7E7E7F8080807F807F7F8080807F8080808081807F7E7F7F7F\
-7F7E807F807F7F8080808080807F8080808080808080807F7F7F7F7E808080807F80808080808080808080807F808080807F7F807F807F80807F808080807F80\
-807F80807F807F8080817E7D80807E80807F807F7F807F7E807F7F7F80807F80807F7F7F7F7F7F7F7F7E807E8080807F7E7F7F7F7F80807F8080807E7E7E7D7E\
-7F7E7F7F7E7F7F7F7E7F7F7F7F807F7F8080807F807F7E7F7F7E7E7E7F7D7E7F7E7E7D7F7E7F7E7F7E7F7F7F807F7F7F7F7E7F7D7E7E7E7D7E7E7E7E7D7E7F7F\
-7F7F7E7F7D7F7F7E7E7E7E7F7E7E7D7D7D7D7E7E7E7C7D7E7D7E7E7E7F7D7E7D7E7D7E7E7E7E7E7C7D7E7C7D7D7D7D7C7D7C7E7D7D7E7E7D7E7D7D7E7E7E7D7D\
-7C7D7E7D7C7D7D7C7D7D7D7D7C7E7E7D7D7E7D7C7D7D7E7D7D7C7D7D7D7D7E7D7E7D7E7D7D7E7E807E7F85837F929771748F7D6F818C8079808B81829C866986\
-8E767D8786A08D6D878B76888C797A8280807B8E98807F8F8880888882818484817F807E7A7E7C7A7F80849790868F867B81776F7775767F7E7F828182807B7E\
-7D77788984747F82757B7E76787B7A7D7E7E807F7C7A787370766F6F747275706F746F6A77776B6E6F7A7B6F7777646B6F60696F68746E75827A7F8787899190\
-868C9088888C8189908088988F929C9A98958C8F908283857E7F7D7B7F7677756D675F57574E4853564C4E615F4A5667524D6663576E6F6465696F5B5D7D6150\
-756D56666E625F646B6B6E777A7B7F87887C858A84818184848B8E91908F9A958E989E9890909A90829192888D908E8A868D8A88929095948B919588888F8785\
-8C8B878C8788898085887D787C7D776F6B71705F5E645E5B5F615E5452514E4E4D4F5457565C6760656E62616A696668686F726B7170636068625B6063606361\
-6D77686D807D767E7F7C84888E91919EA39798A093969D9195A29D9DA7A9ADB1B2B6AEB1B8B1ADB4B7B8B6B8BEC2BAB5C0B6ABB5B3A6AAB5AFB1B7B6B1A8AEB7\
-A8A0A9A69796918B8A76656E654D484E4939323B3420232C201717151414141314151513141515151F241F2A3230354244475352515754545757544E54514B4A\
-4E504C44545F48465F57465B6A5F5A5F67675E5E6A6F666871706F6A6F736B6E6F6C6E70717B7279887E7F9596888A939B989BABAFA6AFBFC0C3CBD3E0E4D2CC\
-DFD5C9D1DDD3C9CDCAC2D0D4CFE2E3D8E1E7E2E4EAEAEAEAEAEBEAEBE8E2E2E8E2CFCAC1B3ABA0999F937C757676726F72796E697B858893A09F99A1A3999EAC\
-ACB1B0A8A09F93929E948277716F6C60677386A3B0B1BECAC9BEBFD4E3DBDBE5E2E2DFD4D2D0C2ADA0948F8E7A64574855808C8DAAC0BFB5A097AAB9A9B1CFC9\
-C0C6BFB5BEAE99948972625D594E351B3D7D878098AAAC9A776680A4A092AEC3B5A697919F9B8277796A4C3B3B2E20192265988E8B9B9E8E64475B8198A2AAB2\
-B5A791868C928E887D705C40332B231A2473B4ADA7AAA3986F41548892A0C4BFBFC99F849A9B909C97827A623D373622154EAFC7BBB7A9A58E4D37678E9ABAC9\
-BAC2B1848497919CA18D7E75503530291C1F6CBFC4AE98858162353E749BA4B0C1B8A7997F80989B98998B7B6541282321192781C4BAA0806B6A543A4D7FA4B1\
-A39FB9B49183808FA89E878884664023191F1A237AC4B99B785B5F543C4E80A4ADB0B1A49A98888093A09C9280705F432318201A2580C1B19470555750415585\
-A9AFA39F9E9EA091808E9E9A8D8072674F2D191D1D1C5CA9B29A775757594B4F749BAEA7A0A5A09D937E859B9A8D8476664E2C191D1D1954A7B69B755453574D\
-527099B0A9A0A09B999685859A9C9388766753351D1D1F173F98B69F7E5A545F57556B8FADB0A7A79E9B9E8984989D9993816B5840281F20193488B9A9846157\
-5F5E5C698BADB5A39F9FA1AF9D88929F9E9988776C553628251E1D58A5B59D775C5F67646276A0B8B0AAABA4A8A38D8F9FA3A0937D6C5B3F2C27201A4C9DB8A3\
-7D5F606867637098B7B6A29BA0AFB19B8D98A3A49981746A51382A23192977B2AF936F5E6667636A86AAB8AFAAADAAAA9F9094A4A7A1917C6952392E2A1D2365\
-AAB89D745E636A696B7FA3B9B4A5A0A8AEAB9E989FA6A196807262493328211C4692B5A78366636A6B677091B1B8B1AFA8A9A998919BA5A49A86715C44352C24\
-1A3581B5AB88655B646A696C85A9B4A9A0A3ABAFA090919DA0988876644C362C261B2565A0AA916F5F63676762779CAEB1B4A9A0A59E90939A9C9A8D79624838\
-2E251D1F58A0B194735D5F6A6C657092ADB2A99CA2B3AE9D90919A9C907D6A584231271E1B448AA99F84685F696D676A87A4B0B8B6A7A2A39C96999994908771\
-563F322D231B3D7AA1A18B6F63686F6B6B809AACB2A9A5AAA9A59E969394928876634D3B362D1D2E67929E937E6A6D736F6B7890A3B0B6B2ACAAA49D9897928E\
-8A7F6950423C33252E5D899B9583757377736F778A9BAAAEADAFB1A9A19C938F8D887F726252464037354F778C918F827B7F7D767784919CA6ADAEB0ADA5A098\
-908A88827B6F6358524C424F6F818688868185847D7A828B91999EA0ACAFA8A5A298928F8A827C766B6560544D6275767A807C8086817A80888B8E9299A2A8A9\
-A8A7A39E99928D867C726B665C4F586A6E6C7175777E7F7A7D84888B8E90959FA8A8A9A9A3A09F958C877F746D67575360655F6167697278777780878B8C8E91\
-9AA0A3A8ABABAAA9A39C94897E736B5F4F515A59555A62697477767B84898C8C90949AA4A8ACAFAEADACA59991887C6F66574A535B54525C626C7676757D8789\
-8B8E9099A0A4A8AFAFADADA8A0999082766C61514C545751555F646F7574778085888B8E9298A0A6A8ADAEACA9A79D958D7F72685D4E4C57564F5561666F7472\
-777E83878A8D9199A3A6A7ACAEAAA8A29891897B6E63574D5157514E5A63676F7070787F8287898C939BA0A4A8ACACA9A8A0989086776C64584E525752525E63\
-67707072787F83888A8D949CA2A7A8AAADAAA79F958E83776C63574E555953545F656B7171727A8086888B90969EA3A7AAADABA8A69D948D81756D6356515757\
-54595F656C7272757D8286888A90989FA4A9ABABADA9A29A93897E746B6053525957545B61676F7272777F8488888C939BA2A6ABAEACAAA8A19891877B73695D\
-53555A58575E646A717373798086888B8E949EA5A9AAABADACA79E968F857970665A52575A57595F666C7272757C8286898A9098A1A4A8ACABA9A9A49B948B7F\
-766E5F55535859565A62676E7170777E8386898B929BA4A6A8A9ABAAA69E978F867970675A50565B57575F64696F717179808387898C959FA1A2A8ACA8A7A49B\
-928D82766F6356525759555960666D7170747D808387898E97A0A2A5A7A9A9A8A09790887F72695E53545A59555C63696F727277808184888B9099A1A3A7A9A9\
-A8A59D948F847971675954575A58595F666C71717479808386888C949EA1A3A8A8A7A8A199938C80776F625754585A575A62676D7173767C8183888A90989FA0\
-A2A9A8A6A5A09891887D736B6056565858575E63676E7373787E8286898E939AA0A2A7A8A7A6A39C958F837971675D56575858595F656A6F72757B8083888C90\
-969DA0A1A7A8A5A4A09A928C80766E655A555757575B5F656B7072777C8186898F93999EA2A5A7A7A6A39D9790857C726A6057555657585C5F666D7074787E83\
-888B90969B9FA2A7A6A6A4A09A958C807770675E57555657595D5F676D7074798084898E92989DA0A5A7A4A5A39E98938880776E665D565757575A5E61676D70\
-757C80848C90929A9DA0A5A6A3A4A19C9790867E776D635D575757575A5D62686D70757D81888D91969AA0A2A4A7A5A29F99958D847B746A635C585757585B5F\
-62676D70777D82888F92979CA0A2A4A2A2A19D98918A827A726B635D5A5A585A5D5F646A6E70787E838B9093989E9EA1A3A09F9E99928E877F78726A64605D5C\
-5B5D5E6166696F747A7F878B909398999D9E9E9D9A98928F88817D776F6C676360605F606265676B70757A7F84898D9094969897989793918D8985817C77736F\
-6D6A69666767676A6C6F7175787C808387888B8E8F8F8F8F8D8B888784807E7B78777473727071707072737577777A7B7E7F818284868686878786868482837F\
-807E7D7C7C7B7A797A797A7A7A7A7C7C7D7E8080808180828283848383818281818080807F7F807F7E7F7F7F7F7E80807F808080808082818283828283828382\
-83838282818182828180828282818281828282818282818282828383828383838283838283828383838383828383828382838283838282818383828283838383\
-83828384828382838283838382838383828383838382828282818282818282828281828281828282818282828281828282818282808181818080808080808080\
-808080808080818181808181818081808180818180807F80807F7F807F807F80807F807F7F808080807F808080808080807F808080808080807F807F80807F7F\
-80807F7F7F807F80808080808080808080808080807F807F80808080807F807F807F8080807F807F7F7F80808080807F7F808080808080808080807F807F807F\
-80807F7F807F7F7F7F807F807F7F7F7F7F8080807F808080808080807F8080807F807F807F7F80807F80807F807F8080807F80808080808080807F8080808080\
-80808080808080807F808080808080808080808080807F808080808080807F8080808080808080808080807F808080808080808080808080807F808080808080\
-81808080808080808080808080808081808184887E9FAB7F9282787F889B867E88867C7E8D847D838A9889879480797E84857881988A88988E84858484817C80\
-847F81888582848284827B81827C7F837F8180827F7B7F7D77797A7677757474767879777679727179736F7A7673777577767577777377757273737777757C7B\
-757977777B76797E75758076737C75777D797D79747D80787C7F7B7C797A7F7A787B79767D7F80777D80797A797E79777C7D78777E7F777D80777D7D7B817876\
-847979817A7E7F7E807E79777C807A7C7D80817A7A7E7E79788380747D877A7A877D7D897B7E88767F88768388717F8A757B8B7D7A887C8085777B847B7B7E77\
-827F777E86777E88807D888680808388807B82887F7786867A85877E86807E87807A868979808A82858B7D83887F87887B7E8B7F7C867F80868181837F7F8480\
-777F877F7A8085817D828C837F858480827F7F827F80848180848082827E80817E80828183817F8280808386828086867E82827E807F7C807C7D81807D7E8080\
-7D7A7E827D7D8080837F8082807F81808280808082828180818083857F80818182807F808080807F81828080817F80807D80807E8081818284807F85837E8082\
-82828081858281838281848280807F818380808180828180818281808083827F80808182808283828382818384838386848282838482828182817F7F7F7F7C7C\
-7C7B7979797A7B7A7C7E80808285878788898A8A8A8A8D8D8B8B8C8C8A888584807D797671706F6A6A6A68696E71777C82899297989C9D9C9B9894918E8C8988\
-858485817C7A77726D67605A575B64697077808992979898989896908B88888A8A8C8E9093959592908881796F67615C5754565E656D777F8790969898989591\
-8F8985858686878B8F91959595938E8880766D665F595650535B626D777F868F9598999893918D898681818184878A8E919494939089837A7168625D58535257\
-5E67727B81899195979895918C88868280808183858B90919392908F8881786F67615C5955555A616A757D83898E939797938F8B868482807E7F8185888F9092\
-91908E8A857D736B645F5C5757595F68717B81878D90959695918D88858180807F8082868B8E91918F8D8A847F776F67615D5A595B5F676F777F868A8F919293\
-908E8A8582807E7E7F7F8284888C8F90908E8A85807A726C66605C5A5C5F676E767C81888C8F9292908E898682807F7E7F808284878B8D8F908D89857F79736C\
-66605D5B5D62686F757D82878C909091908C898683807F7E7D7E7E808487898D8D8E8C8985807A746E68635F5D5F626970777E83878B909190908C8884827F7D\
-7E7C7D7D8085888B8F8F8C8A86827D776F69635F5E5F636970777D82868B8E9191908D8885807F7F7D7C7C7C7C808285888A8B8D8B8A87817D78736D69666262\
-656A71777D8387898D8E908F8D8986817F7D7D7C7B7B7E8083858A8E8D8E8A8883807A766F69656161666D737A8084878A8D9090908C88837F7E7C7C7C7B7A7B\
-7E80828687878786848788898887837F7C787775716D6867696F767F838687888A8D8E8E8C86817D797979797A7A7A7A7F81858888878685838488888A898783\
-807F7E7E7A75706B67676C72797F808384888A8E8E8C87827D7B787A7A7978787A7C8186888988898988888785817F7C7B797A7A797A797B7D7F808283828383\
-848383838080807F807F7F7E7B797774736F6F6F72777C808184868789898886807E7B7A79797778797B7E808486878585848282807E7C797879797C7D7E8081\
-838484848282817F7F7D7B7B7B7B7C7C7F808080828383818180807E7E7C7D7C7B7C7D7E7F8080818181808180807F7F7D7E7D7C7D7E7D7F7F807F807F80807F\
-7F7F7F7E7D7E7F7E7F7E7F7F80807F80807F7E7F7E7E7D7E7E7E7E7F7F7F807F80807E7E7F7E7F7F7E7E7D7E7F7E7F7F7F7E7F7F7F7F7E7E7E7E7E7D7E7E7F7F\
-7E7F7E7F7F7D7E7E7D7E7E7E7E7E7F7E7F7F7E7F7F7F7F7F7E7E7E7E7E7E7E7D7F7E7F7F7E7F7F7F7F7F7F7D7E7D7E7E7D7F7F7F7E7F7F7F7F7E7F7F7E7E7E7E\
-7D7E7D7E7E7D7E7F7F7E7F7E7F7F7E7F7E7F7F7F7E7E7E7E7E7D7E7F7F7F7E7E7F7F7F7F7F7F7E7E7E7D7E7D7E7E7E7D7E7F7F7E7F7F7E7F7F7E7F7F7F7E7E7E\
-7D7F7F7F7F7F7E7F7E7F7E7E7E7F7F7F7E7F7F7F7F7F7F7F7F7F7E7F7F7F7E7F7F7E7F7F7F7E7F7F7F7F7E7F7F7F7F7E7F7F7E7F7E7F7F7F7F7F7E7F7E807F7F\
-7F7F7F7F7F7F7F7E7F7E7F7E7F7F807F80807F7F7F7E7F7F7F7F7F7E7F7F7F7E7F7F7F7E7F807F7F807F7F7E7F7F7E7F7F7F7E7F7F7F7F7E7F7E7F7F7F7F7F7F\
-7F7E7F7E7F7F7F7F7F7F7E7F7F7E7F7E7F7F7F7E7F7E7F7E7F7F7F7F7F7F7F7E7F7F7E7F7E7F7F7E7E7F7F7E7F7F7E7F7F7F7E7F7F7E7F7F7F7F7F7E7F7F7F7F\
-7F7F7E7F7F7F7F7F7F7E7F7F7F7F7F7F807F7E7F7F80807F807F807F7F80807F7F7E807F7F807F7F7E7F7F7F7E7F7E7F7F807F807F80807E807F7E807F807F7F\
-80807F8080807F807F807F7F807F7F7F7E80807F807F807F7F80807F807F80807F7F807F807F8080807F807F807F8080807F807F7F808080807F7F807F80807F\
-7F807F808080807F7F807F80807F808080807F7F807F80807F808080807F80807F807F80807F807F80807F807F80807F807F80807F807F7F807F807F80807F7F\
-7F7F7F7F8080807F7F807F807F807F7F7F807F807F807F7F7F8080807F80807F8080807F8080807F80807F7F80807F7F80807F8080807F7F808080807F80807F\
-80807F807F80807F80807F807F80807F80807F807F807F7F7F807F807F807F807F807F7F7F807F807F7F807F8080807F8080808080807F8080807F8080808080\
-80808080808080808080808080807F8282808D988A8588857D77777F7F787B7F7E7E787880807C7D817F7E7B7E81818085888A8888898988868786847F77706D\
-68556798927E8C948771616F7F72768896988B7D8687726F7D838582848C897B767B7C79777D87877F8183817D7A7E84817F838783807E7F807E7C8082817F7E\
-80807D7C7E807F808082827F8080808180808181807F8080807F8080807F80807E7E808081817F8B92807E88847F7D808B8880868984827F8083807D8183807F\
-8082827E7F808180808182817F80807F7F7F7F80807F7F7F7F7E7F807F7D7E7F7F7F7F7F7F7F7E7F80807E7F8080807E80807F80828281808080807F7D7C7978\
-75716E686766697581898A8E9088807F84888C929A9C988F877F7A75706C645A5A433CACC25870A3847B5D5C907C67889EA39A7985987E7798A3998E8F99907C\
-7D8B8C7E726B60514B54536390988B908B796B5F697A7B82939F9C90889FA88B889899908484907E5F54504F443E73A18E868F8B775856747F788198A79D8987\
-8A8190A8A0999E97908880807763564E4E4E465F949A878C8D77615D6F7B768199A1A09590ADA880899F9A9088969B8065564E4B4136569587749A9D806A5965\
-7D777F9B9E9098A2AEAE8F8A9A908C9599927F6A5D514D4E3A3365A6B1856478836761839B917D7F9FABA0A39890968E8F9EA6A18C756C60595A4025316FC0A7\
-5C82B1794049819E776FA2C1A78C9CAA9B8287A3A6908F99916F514D524636366D9D8C7C88907C5E5A778883889DB2A698A39E949191999F95908E8068504646\
-3D2F4F8D9786888D836B576780868898AAB1ACA39897959196989B9689806B504641362D518E988A8A8C8367566780878A9BAEB9B29D94999690929B9D94877A\
-644F443C31315F8D8F8B8D8B7F655A6D8088909DADC1B498989B968D8D9AA2927E6D5D51423126457F8D8188918B725A6279848992A5C0C1A197A1A090878F9F\
-98836E60594735253B70857F83908F7B605F7281888D99B9C6AF9C9F9F988A869095876B57534E3C273B6F857C79848A7F675F6F808B8C94B3BFAA9C9E9E9990\
-8786887F66514C4B3F34466D807F787C818070646C818D8E98AAAEA59F9894938D847F7D726256514C45465B6D77787B7E808079707480898D9AA1A0A3A19B95\
-949086807A6E66615A55525A6A7375787D7A7F817C7A80868A94989499A2A199989794938A817F7D756B636268686569727172797B787C83868F949094A0A3A4\
-A4A3A0A5A0948A867D74685F61625B575E656B7270717C84858C959698A0A8ABACAAA8AAA99C90887E71685F5E5E58555A5E636F6E6E7780878D95989AA5ACAB\
-ABB1AEA8A9A2948A8172675E5C5B54545B5E626A6A6E7780848C94969BA6ADAFAEAFABAAA8A0928B8072675F5B595450575E636A6A6D7781858A929898A2ABAF\
-AFAEACA9A89F91888071635C5C595050575C60696B6C777F868B91989BA3AAABADB0AFA8A59E90867C6E605B57565150575D6267696D7780848B91989CA4ACAC\
-ADB0ABA6A69B8D8478695F5857524F50575D6369696D7880858F95969EAAACADB0AEA9A8A1938B8173645A57574F4C53585D66676A737C8088929698A4ACADB0\
-B1AEAAA69C9085796B5F5757574E4E565A6168676B7881848E97969FABADADB1B0ABAAA1958C8070635957574E4A53595D666769737D818995969AA9AEADB1B3\
-ACA9A79B8E8578675B5757514B4E575B636867707D818690989AA3ADAFB0B2B0ABA8A094887C6D605757534C4D55585F67676A7780848D96989FACAEAEB2B2AA\
-A8A3958B8070645957554E4B52575C646768737F808A95969DA9AEADB1B1AAA8A2958B8072635957574E4A51565B6366666F7B808792979BA8ACADB0B1A9A5A3\
-988B8072635A57554E4A4F565B6165676F7A7F87909699A7ADADAEAEA9A7A195898073665856564E49505659626665707B7F87919799A7AEADAEB0A9A5A09488\
-7E70625958554E4D51575C636568737C818995989DA8AFAEAFAEA9A5A093867C70625757554E4E55595E65676A7780838B979BA0AAB0AFB1AFA8A39E9084796D\
-5F5759554E51575A6168676C7A808691989AA7B2B1B3B4AEAAA69886786A5648494E4F5159636A7172707782858E9DA6AEBABEBBBAB5A89B8A7967594C3D3F4E\
-5759626B7174737378818893A2AAB4BCBFBAB7ADA08E7F6D5C4F41363F52575B6670757573747A838A97A4AFB8BCBFB9B4A998887666574B403742565A5E6872\
-747473777F88929BA8B4B9BEBDB8B0A49182726253483C394C585C6076837874777F858A929FADB5B6B8BDB6A79A8B7B6C594A403A455157606C757777797E82\
-89959EA7B1B7BAB9B6B0A39080706052423A4251585F6A757A78797E828A9598A4B1B6B6B9B7B0A69584756757483D404F575B67737878787E838B9498A1AFB3\
-B6B8B8B2A99A89796C5C4D3F3E4D54586270797A7A7D848B92969BABB1B1B5B6B3AA9D8E7F706051443F495256606C757A787D818891959AA7AFAFB3B5B2ADA0\
-9387796A594E46454E555A656F77797D80878F94969FA9ACADB0B1AEA5988C80746759524C4B51585D626B70767980888D90979DA3A7A9AAA9A39D91867B7267\
-5F5A575051575C5F656B6F777E84899096999EA0A0A1A099928D857D756D68635E5C5A5A5C5D61676C72797F83888C909296989695918B88837D77746F6B6868\
-646463616567646A7172757E7D8084838689888A84838580807D787974706F6F6E6E6E6E706F6F717273777677787A7A7C7E7D807E7C80827A7B7E78777B756E\
-747572727679737376767A77757B7B777C7D7A807E7A827F7F7F7B7E7E797D7C7B7C75797B777E77767A757578767677777A7C787B7A7D7D7C7F7F7E7E7E7F7D\
-7E7F7F797C818180807E7D7E808081807A777B81807F848281847F7F807F807C7C817C7A7F80797B7F808281827E7B7E807F81807F80858583848284817F8080\
-80808081808082807E7F838886858886868889898A8B8889878A8C88888587878486848786808183818282858482858182837E80878181828082808185818084\
-8180858685828185858484838287848884818282828388888886848583838286858283807F818380858882808486827F85888483858884868583848682808584\
-818182838080878585888286868286838082847F7F8382818483828581808480808383838285827F808382808383807F80818381828083838187848183828282\
-81858583858683858082858384817E828181808083818083828285848082838384848684808186847F8183817F7E7F8081807E7E80817F7E7E7D817F7E7F7F80\
-808280807F818081808082818080807E7C7D7F81817F807D7E7F7E7D7E807C7F818080807D7D7E7D7E7F7E80807F82807B7F807D7E7E80807E8080807E807E7D\
-807F7E827F7F8081807F807F7F7D7C7E7E7C7E7D7F7F7D80817F80807E7B7E807F7F7E7F80828283807F7F7E807F7F81807F80807F7C807D7D7F7E7B80807F82\
-807F7E807F80807E7F7E7E7F7E7F7F7F7F7F7C7E7F7C7D807F7D7D7F7E7D7F7F807F7D7E81807F80807E7F807E80807F7E7D7D7E7E7F7D7D8080817E7F7F807F\
-7E7F807F7E80807E8080807E7F7E7F7F7F7E7F7E7F807D81817F7F807F80807F8082807F80807F80817D7F817D7C827E7E7F7E7F807F817F7E7F7C7D807E7C7D\
-807E807E7E807F7D7D7E7E7F7E7C7D7B7D7E7F7C7F7D7E7D7C7E7E7B7D7D7F7B7E7D7E7E7C7D7D7D7C7D7C7C7C7C7E7E7C7B7B7B7A7C7D797C7C7D7A7B7D7C7B\
-7B7D7F7D7D7D7D7E7D7F7F7D7F7D7F7C7F7E7B7F7C7E7D7F7F7D7F7D7F7F7C7F7E7D817F7F7F80807F7E807F807E7F807F808080807E807F808080807F807F80\
-81808181808180818081818282818281808180828081808082808181808181818181828281828281818281828282828282828383818283818283828283828382\
-82838183838382828282828182818282828281828282818282828282828282818182828282818281828182818282828182828182828180828181818080818181\
-8181808180818081818181808080808080808080808080808080807F80808080807F80807F807F807F7F7F8080807F807F807E80807F7F807E7F7F7F7F7F7F7F\
-7F7E7F7E7F7E7F7F7F7F7E7E7F7D7E7E7E7D7E7D7E7E7D7E7E7E7E7D7E7E7D7E7E7E7D7E7E7D7E7E7E7D7E7E7E7E7D7E7E7E7E7D7E7D7E7C7D7C7D7C7E7E7E7E\
-7D7D7E7E7D7E7D7C7D7E7C7D7E7E7C7D7D7E7E7E7E7D7E7E7D7E7D7E7E7E7E7D7E7E7E7E7E7E7D7E7E7E7E7D7E7E7D7D7E7E7E7D7E7E7E7D7E7D7E7E7E7E7E7D\
-7E7E7E7D7E7D7E7E7D7E7E7E7D7E7E7E7E7E7D7E7E7D7E7D7E7D7E7D7D7E7E7E7E7E7E7E7E7E7E7E7E7D7E7E7E7E7E7E7D7E7E7E7E7E7E7E7E7E7E7E7D7E7E7E\
-7E7D7E7D7E7E7E7D7E7D7E7E7D7E7E7D7E7D7E7D7E7E7D7E7E7E7D7E7E7E7E7E7E7E7E7E7E7D7E7E7E7D7E7E7E7E7D7E7E7E7E7D7E7E7D7E7E7E7D7E7E7E7D7E\
-7E7E7E7E7E7E7D7E7E7D7E7E7E7E7E7E7E7E7D7E7E7E7E7E7E7E7D7D7E7E7E7E7E7E7E7D7E7E7D7D7E7D7E7F7F7D7E7D7E7E7D7E7E7F7F7E7D7F7F7D7E7F7E7F\
-7E7F7F7F7F7F7F7F7F7F7F7E7F7F7F7E7F7E7F7F7E7E7F7F7E7F7E7F7F7E7F7E7F7F7E7F7F7F7E7F7F7F7F7F7E7F7F7F7F7E7F7F7E7E7F7E7F7F7E7F7F7E7F7E\
-7F7E7F7F7E7F7F7F807F807F7F7F807E7F7F7F7F7F7F807F807F7F7F7F807F7F8080807F7F807F8080807F807F807F8080807F807F807F7F80807F8080807F7F\
-8080807F80807F7F8080807F8080807F80838281808181808080808082848187888789868486848583828482828886818485807E7D7C7B7777777472716F6D6A\
-6A6967686768676667626366646265645F5F605E5E5F5F60595E615B626459636B62626F6C626A767267737971686F7C7668747F7677777E81777D8887778290\
-807D8F8877848985818A9186828D8F888C8F8B908D8792948794978D9198888E988B909391938F8A968E8A94928B8B90908B85908F7E869087888E888A88888D\
-868A8E85888C85858A88868D8A848C8E8A8A8782828185837C878A7F8489808586828783808886808A8B858F8D8B8B848C8B81888B8186858484828784878E88\
-8A8E8989898B8E878A888388878487878888878C8B8B908B8E8D87888A888785888586898887888C878888888988888A87888482888482868483888587888788\
-8684888884888B88888A858788838786848684838380807E7A7C77767773757876767A797980817F8388878B90909296959596969290908A86837E77736F6763\
-5F58585550575E5E697479858F989DA5AAA9ABABA8A4A09B96928D88837C77756B645F5548494C3E4B575265747788949BA1A8ADA9ACAFA3A6A19C9A98979291\
-9189877C726D5E5048473E3B47485160697783909A9FABAAACAFABA7A6A39C999A949396908E8A817A6F65574646413742454B5862747A8C989BA8AAABADABAA\
-A0A39D949A92909390908B887F746E5F4F46473B3946434E5E67738191989FABA9AAAEA8A6A29A9B969195909091908E8882786E6454474C3E3B4A43505D6574\
-7F8F969DA9A7A9ACA5A2A09B9398908E93908F918F89847D71675B4B4C443B46464C58626E77889098A4A6A7A9A8A29F9E9792968F90908F8E8E8C8580776D62\
-574B4B404047475158676F7B899098A2A3A5A7A29F9B9894908E908C8D8E8D8D8C8881797367594F4E453F48474C59636A77848C939FA0A2A5A39D9D99949290\
-8D8D8D8C8B8D8A86837B736B5F4F4E4B3E48494A555E67708087909A9EA1A2A4A09B9C9692928F8E8E8D8B8E8B8988807972685A4F5147404C484E5861697682\
-88919C9DA0A2A19F9D9A9794939090908F8E8E8D89877F776F6557504F43464B47535A636C788388949B9CA2A2A09F9D9798969091908F8E8F8D8D8A867F786F\
-6757545245494D4C545D646B7B828895989CA1A3A09EA0989896929390908F908F8B8D88807A73685E56534C484E4C525B616A757E858F97989FA0A0A09F9997\
-999290948E8F8F8E8C8B89817D776E645B57514A504E51595F676F7C818A94979CA0A09F9F9D989795928F908F8C8E8D8B8A88827B786D645C58534B554F535C\
-6168717C818B94959C9F9F9E9E9C989792918E8F8E8D8F8C8C8A88837D786F665F5B53505452555E6369737D828B93969B9F9E9D9F9A98979190908D8E8E8C8D\
-8C8B88847D7771665F5F56525755585F666A747E828A9395999E9D9C9D9B9896928F908E8D8F8F8C8E8D8987817C766C63625A555B575A60666A737D7F8A9192\
-989D9C9C9D9A98989190928E8D908C8D8D8C8888827B776F65615F56595B595F65696F797F828D90939899999A999694918F8D8D8B8A8D8B8A8B898783807773\
-6B62635B575D5B5C62686C747C80868F909498989799979293908D8E8C898D8B898B898785807B756F676261585B5C5C5F666A6F777E818A8F90949796969793\
-91908D8B8C898A8A8B8A88888782807A736E66635F5A5E5C5E63676D717A7D848A8D91949594959491908F8C898C88888C8889888886827F78726C64655E5B5F\
-5E5F656A6E757C7E868B8E91959494959490908F8B8B8B88898A8789888784827D78716A66655E5F5F5F63686C70787D81888B8F92949595969390908E8A8B8C\
-88898B88898A8786837E79726B67675F606161666A6E737A7F838A8D9094969695969390918D8B8F8B888D8A888B898685817A77716867655F626362676D7076\
-7D81858B8E90949593949390908F8B888B89878A89878B888684807A7670676864606563656B6E72787F83878E8E929595949493908F8F8B888A8988898A888A\
-8886837F7B746F6B6862636462676B6F74797F83888D8E9294929493908E8D8B8888888688888789888785817D77726C6A68626566656B6E71777C81868A8E8F\
-9293929292908F8D89888B88868B8888898784827E79726E6B6763666566696E71777C81868A8F8F93949193928F8D8D8A888988848A8985898882827E77746D\
-686864626766677072757D8185888C8E909091908F8E8B8A89888686878685868481807D76746F686967626668676C727277808184898A8A8D8D8C8989888684\
-8585828485818284807E7C77736F69656662606467676C7173777E7F808486858685838485848183838080818080807C7878736E6D6F6864676764696E6D7075\
-797A7D7F828182868385898684888883828483808080797C7D77767775717173737072757477777C7E7F8383838688868788888888888786878586848080817B\
-7A797877777573777775797B797B7D7E807F8083818085868686858685858483837F8082807F7E7D807B7B7D7A7E7F7C7D8081807F8082818180818582848583\
-85858687858588868384858084847E8383828281828280818382828283828482858681818382848183858483828284848181808385808085828285818187817F\
-8683828481828782848683838682858280858282827F828582808087858082818283808282818380828181828081828281807F84818081818081818080808082\
-8281818184847F80827F818280808281838283838285827F8488848184848280828483818484828383858281858183828082827F808281808181838480818282\
-83828083848183848382838282828284838383828283818282838182828281828182828182848283838083818081808183808182828181828280818381828080\
-8181827F80828080808081808081818081818080818080817F8182828081808080808081808181817F81818080808080808180808081807F827F8081817F8080\
-817F808080808080807F818080807F80807F807F807F8080807F807F807F7F7F807F807F7F7F7E7F807F7F7F7F7E7F7F80807F7E807F80807F807F80807F807F\
-7F80807F807E7F7E7E7F7F7F807E7F7F7F7E7F7F7F7F7F7E7F7E7F7E7F7E7E7E7E7E7E7E7F7D7E7E7D7F7D7E7F7E7E7D7E7F7D7F7E7F7F7E7E7F7D7E7F7E7E7E\
-7E7F7E7F7E7F7D7F7F7E7E7E7E7F7F7E7F7E7F7E7F7F7E7E7E7F7F7F7F7E7E7F7E7F7E7F7F7E7E7E7F7F7E7E7F7F807E7E7F7F7F7F7F7F7F7E7F7F7E7F7F7E7F\
-7E7F7F7E7F7F7F7E807F7E807F7F7E7F7F7F807F7F7F7F7F7E7F807F7F7E7F7F7F7E7F7F7F7F7E7F7F7F7F7F7F7F807E80807F7F807F7F80807F7E807F7F8080\
-7F7F7F7F7F7E7F80807F7E7E807F7F807F7E7F7F7F7F7E80807F7F7F7F7F7F807F7F7F7F807F7F7F7F7F8080807F807E7F80807F807F807F807F807F80808080\
-8080808080807F8080807F808080807F80807F808080807F8080808080807F807F7F808080807F807F808080808080807F807F80807F7F807F807F80807F8080\
-7F7F8080807F80807F807F7F7F807F807F807F80807F808080807F80807F807F7F80807F7F807F7F7E8080807F7F7F8080808080807F7E807F807F7E80807E7F\
-807F807F7F7F807E7F7F807E7E807F7F807E7F7F807F807F7E807F7F7F7F807F7D7F807E807F807F807E7F7F7F7D7F7F7F7E7F7E7E7F7F7F807E7F7F7E80807F\
-807F7F7F7F7F7F807F7E7E80807E7F7F7D81807F807E7E807F7F7F80807F7F807F807C80817F7F80817F80817F7D807F807E7F7D7D82807D7F7F807F7E80807C\
-807F7D7E807E7D7E7D7D7F7F7D7B807E80807D807F7B7D7E79797C7C80807C7B7F7F787A7B7D7E7C7F807C80807C7C7D807F7D7F797B7E7A797C807D7C7D8184\
-8683827D7B7A7B7D7B7774797B7F7A7784867C79747077777C7A74737374737B807B7B77777977777870727A77777A7875737777777C7C757675777D7E7B736F\
-6F74777170706E6F6F7073747677747072747777756E66697179746F7173777B79736F6D747C79807D75787F7D77777775747D82807E83837C7A81827D7F7E77\
-798185828082807F8188888084867B808881808685818387858788848283818088888484807F8287888784848786818182818389898585888B88888788898B8B\
-888B8C888C8C8788898888888986858A8A8988868989898B8C8B8A888A857F858A888783858680838684848587888884838585858789898A8884848588888888\
-878584838386878886858485858586858786888A8885828285868889888886868688888685858788888685858483828481818283848385858484858587858584\
-8484878888888884838183838280807F7F7E7E7E7D7D7D7D7B7B7B7A7C7E8387898B8E8F8F908E8E8C8B8A888988898884807A756F6B6663615F626B778795A0\
-A5A2988D847D7B7D82868B8F909395989999968E877B736B645E5A57555964718597A3A7A5998B7E757073777C8287888C90969B9FA09B93887E756F6B676360\
-5C58575E69778B9AA1A0998C7E746F6F7579808386878A8F93999D9C978F82786F68625F5D5A58575B65748598A2A4A09282746A686D747C8287888A8D91969C\
-9D9892887A716A6561605F5E5A5B606C7B8E9CA4A29A897B6F68687078808588888A8B9096999A978D81756D676361605F5E5A5E667183939FA29F9080736965\
-6B727C84888A8B8B8F929798968F85786F696462615F5D5B5B636C7D8F9CA0A09485766B6769717A82888A8B8B8D9094989692887F736C6765635F5F5D5A5F68\
-7788969FA0988B7B6F67676F7780878A8B8B8D8F929696918C82776F6B676362615F5C5F677381929D9F9C9080736B696D7780868B8C8B8D8E919595918B827A\
-736C686662615F5C5D667181919CA09C9082756E6A6F777F868B8B8C8D91949698928B8379716E6B6765615F5B5D667282939EA09B907F726D6A70788087898C\
-8A8C8E929698928D847B726F6C6765625E5A5B646F80919CA09C9181756E6C70798288898B8B8D91969898948A837A736F6E6967635E5A5C65728494A0A09B8E\
-7F726F6F757E85888A898A8D90959897918A817974706C67645F5B575D69778B9AA2A19888796F6E6F7780888A8B8A8B8F939696958F867F7973726F69645F5A\
-575F6C7B8C9CA19D9285777070747A8287888788888E959899958C817A74716F6C67625E585763738295A0A097897C706F72798088888888888B919798959088\
-7F7876736F6B655F57565C697A8E9CA09A9082757071787E83858585878B9097999891887F787573706A655F59555967798C9BA19E9084787173787E83868684\
-878B90989B9A938B827D7A7875716A645E5A5D697C8D9CA19E92867A75767B8084858685888C959C9C989188807C7A79756F675F5A575E6F81939D9F988B7F78\
-77797E81828183878B939A9C9A948B847E7E7C78746C625C5959647687949C9A94887F7A7A7C7E818282858891999F9E968C85807E7D7C776E645C5958617386\
-939C9B968A827E7E807F808181848C949A9E9D978C8581807F7E796F655E5A5A5F6E808D9799989084807E7E7F7E808083888F989E9C989087817E7D7B756E64\
-5D5A5A5F6D7E8E9797948F857F7F7F7F7D7D8083888F989E99938D86827F7C7971675E5B595A606F818F9494928C827F7E807F7D7D80878D969A9B938D898784\
-807C746A5F595B5C5D677788929591908A817E7F80807D7F858B8F959B9A948C8887837E776F68605B5B5F64707E8C95928F8B8882818080807F818890969693\
-8F8C8A88847F786E675F5F605F606A78879092908E88828181828080808590959795908D8C888580786E676160605F5F6773838E908F8B878181808180808289\
-919493908C8A8C898680766C656161625F5F6775828C8D8B8885808183838383858B9192928D8A8B8A87827A736B646362625F616C77838A8888878283838283\
-84878A9090908E8A8B8888847E776F696667666563636C747D8486868584858486868586888B8E8E8E8D8A8985817D77706D6B6B6A6868676A71767C80818285\
-86878787868787898B8E8D8C8B8886827D7A75706E6C6D6F6F6C6B6C6F767B7F818283878788898A898A89898889888785827F7E79757472747574716F6F7174\
-75777A7E8180818385868787868888888888878683817F7E7C7977777978777777767777777878797A7B7E7F7F807F808181818384858384828283817F7F7F7D\
-7C7D7A797A7A7B7A78797B7C7F807F7F808080807F7F7F7F8081807F82817F807F7F7E7C7A7B79797B7B797A7A7B7A7B7A797B7B7A7D7C7A7A7B7C7C7D7C7B7B\
-7C7D7A7B7C7978787976787A77787A7B7F7F7C7C7D7E7C7D7C7A7D7A7D7F7C80807D7F807F808182818081828584848686848887878888888885898887888687\
-88888786878886848785858687858688878485868486868587848385858484858586848584848687878583858685878683848583838384868483868485858484\
-848485838484848485858584838483808281828584818283838384838284858284817F82838284838182808281817F80817F7F807F807F8081807F8080808080\
-8080807F7D807F7E7F7F7F807E7F7F7E807E7D7E7F7E7D7F7F7D7F8080807F807F7E7F7E7F7E7E7F7E7F7E807E807F7D7F7E7E7F7E7E807D807F7C7E7E7E7F7E\
-7E7E7E7F7E7D7E7D7D7C7E7F7E7F7E7F7F7C7E807D7D7E7D7D7E7D7E7F7D7E7F7E7E7D7E7F7E7F7E8080807F7E8080808082807E808080807E7F807F7F808080\
-7F7D80807D7F7F808080808080807E7E81807F80808080807F807F7D7F807E807E7E7F7F7F8080807F807F81817F7F7F81807E7F807F80807F80807F80807F80\
-7F7E7F80807F7E8081807C7F7F7C7F817F7F7F7F807E7D7E7E807D7D8080807F7F80807F7F7F7F7E7F7E807F7F7F7E7E7F7E80807D7F8080807E81827F807F7E\
-807F7F7F808080807F80807F817F80807F7F807D80807F7F80807E7E807F7F808081807D80827F7E7E80827F7D7E80807F81807E7D7F807F7E7E80807C7E7D7D\
-7F7D7F7F7E7E7E807F7F807F7E7E7C80807E7E7E7E807C7A7F7F807E7D7D807F7B7D807D7E7D7D7C7E7E7E7F7E7D7C7E7D7E807E7E7C7E7F827D7C7F7E7F7F7E\
-7D7D7D7F807C7E807F7B7E7E7F7F807F80807F807E80807E7E7F7E7E7F81817E7D807E7E7E7F7F81807F7D7D7F7F7F80808080807F807F7E80807F7F80817F80\
-807E7F807F7E7E7C7D7E7D7E7E80807F80818282858583848582848383838180838283828281817F7E7F7E7F7F7E7F7E7D7F7F7D7C7D7A797C7A7A7B7A7C7979\
-7B7C7C7B7977777777777876777C7A797D80797A7A7A7C75747B7A7A7A7A7A7B7C7B797B7B7A7B7B7C7F7D7E7D7C7B7C787C7E787878787A7777797676777778\
-74777273757673737777787779797777797A7A79797B7C7E7C7E807F7E7F7F80817C7D807F7D7F80828380818282838183808083818183838185848286858482\
-83888886878684878987888886868786868888878884878683858683848481858684858480838581818480828685888886858A87848584838482838686858583\
-8282838487858082838284837F7F807E81838184858181818080817F8083838583808282807D7F7F807F80808384848383838382808084838082838285868282\
-828383838382838383848281838381818182837F8184828486848788868487858685838588868587888886858485858383828484858485858585858483858585\
-85828485838282848080807F828180808382818184838482828281818180818182808283808181818281818281828182828180808182807F8281817F7F808381\
-7D81818080828181828183848482838280807F7F7E7D7E7E7D7D7C7A7A787A7A7A7C7D7F8080818384848586898B89888888888782807C78746E6C6865606063\
-65676E77818990979C9B99969290908E8D8D908E8D88847D746860584E463D496E80858FA0A8A7998883837A6F6F77838F959CA6ADAB9F968E82746457514E4A\
-46476582898D99A5A398877A78776E69707D889095A1AAAAA298928B7E70675F56504D4B485E7D878893A0A197897D78766F6A6E7A838B919BA4A9A59C948E86\
-776B665F554E4F4B4D6883868998A29C90847C78756E68717E8488909CA4A7A298929086776E6861554E4C4B4B6380868898A69F91887F7A736A676E7A83858B\
-9DA4A3A49F9590897B6E6A65574D4E5048537B8D8890A4A7958B837874706765757F8288969EA3A5A197918E83756E6A5F504E514C496786888999A89F91887D\
-777369646D7B7F828E9A9F9FA4A298908A8077716B615753564F486082888491A5A29288807D776D656D7B7F8089989F9FA0A29C938B837C746D645B56575549\
-527C8C8088A3AA95888480796F656A797E7D85959B9B999EA29C8D868781726867605654524B597F888190A8A4908B8980766E686E797C7B88969A989CA0A198\
-8C888680726B69625756564A577D887D8AA7A4908D8A8279706B6E787A79849497979CA0A49C8E8989816F6A6B63565657505273878087A0A6948D8B827A736B\
-6A757979809098979AA0A29C948C88847A706F6C5D565B584B5A7F847C8EA7A0908E8982796F686F7A7778889696969EA0A09F92888886776E716C5C575E584B\
-5F82827A90A59D8D8C8A82776F6B747975798B9492949FA19C96949088817C77766E615E615A4B5477827782A1A2908C908C7E726F72777174849290909DA4A1\
-9A958F8B857A7677715F5C625D4D4F7080777E9BA4928B908F80747071757274808E908F97A09C9192958E84808380776F6D68615B544F627975748DA3968B94\
-97887A777673707179858B8C95A0A09E9997908A807B7872695F5F5F594E54747E72809EA08E8C978F7E767674726F76818A8A8E979E989296948D888683807B\
-756F6A645C584E556C746F7F9B9C90939B91827A7875706F737D83868D989C9DA19C96918B8279766F645E5F5C534E59717672869C988F93968C7F797773706F\
-757E83868D989896999C948F8C88817B77716865635B5752596C70708298968E96998F827E7C76716F757D7F808C9597969FA39690928B7D77766D615F5F584F\
-5161716F778E9A929099978880807C757073797D7F87909494A0A398949890827E7B706561635A535357676E718091958F959D938885847C74747779797F898F\
-9098A0A09A99988E847D796F6262605753525C6A6A7085928D8F9B9A8D8B8C847A797978777A818689909B9C989C9D948B8881776D67645A5556535A67697083\
-8D8A929C9890919086807F7E79787A7F838689959A96979E978A8987776B6C685A575B595F6669717F84858E97939093928A8786837E7E7E7F8188898B90928F\
-8D8B88807C7770706D696967676D6C6C7678797F8587888A8C8C8A898A878583838482818688858689888384847F7D7B7C777476736F717571707677787B7D80\
-828386878788878686868384858684848785848585848281807F7E7B7A7A797776777675757878787B7D7F7F8182838485868584858684858787878688888684\
-85848180807F7D7C7D7B797979787878787A7A7B7D7E7F8080838383838484858685878787888686878684838280807F7F7D7D7D7C7B7A7A7979797A79797C7D\
-7C7D808080818283838484868586878785868584848383818180807F7F7E7C7D7C797B7B77797A78797B7C7D7D7F808082838385848686858685878584838384\
-8181827F7E7F7E7B7A7B7B7677787677777777797A7B7E7F80828486858687878787868787848286857F8180807E7D7E77797978767577747375777677787A7D\
-7D818284858787878888888886878786858482838380817E7D7E7C7879767675717372717376757B7D7E81818487878889888887868685858685858785868883\
-898B888D83837F7878706F6C67696B6A7173777E8188888C908F908E8E8C8A888887858688888A8B8C8B8A8884807B77716B66605C575B595C64686E767B8188\
-8A8E908F908D8A888684828083848388898B8C8E8D8A88817D796F69645E59595A5C5F666C717A80868C90929292928F8D8A87858383848387898B8C9090908E\
-8985817B726D675F5C5E595D64676F767D8489909294959492908C89868381818483868B8A8E9190908F89837F786F69645D5C5E5B60676A737C838890949698\
-989692908C88868481818483878B8D90929291908C858079716A645C5D5C5B61666D737B848890949798999693908D89848482818486878D8D90929390908A84\
-7F776F68605C5E5A5B64666F757D8589919496989892928E898683817E7F808284888B8E909091908A85807B706C665C5E5C5861656A717980878D9293969793\
-92908A8784827F7F808283888B8B90908F8F8A838078706B645D5E5B5A61646A72787F868C919396969391908A888580808080808386888B8E90908F8D88837F\
-776F6B625F605B5E65656D757981878E9191969592918E898884818180828585898C8D9090908D89857F78716D6560605E5D64666C747780878C8F9295959293\
-908C8A86838381818585888B8B8F90908E8B86807D756F696460605F61666970777C83888E9092949492908D8A8884838181838386888A8C908F8F8D8885827B\
-7471696362625F6367696F777B82888C8E91929191908D89888582828383848889898D8E8C8E8B86838077736F686365605F67676C74777D82888D8E91919090\
-8E8B89868483828182838587898B8C8D8D8A8985817C78726E686566616368696F74788083888C8D90908F8F8B8A88858582818284848889898A8C8C8A898680\
-7E78726F696666636368696E73777E81868A8C8E908F8F8D898886838380808283858588898A8A8A898884807D77726F6967676466696B6F75787D8287898C8E\
-8D8E8C8B8987868383818283848586888A888B8A8886837F7977716C6967656768696E72777B8082888A8C8E8D8D8C8A888685838281828285858788898A8988\
-8785807D79756F6C6A676767696C6F74787D808588898C8C8D8C8B89888685828283838385878788898A89898583817B77756F6D6A6969686D6E7077797D8286\
-88898C8D8C8B8B888887848482838385868588888889888784837E7B77746F6E6A6A6A696D6F7177797E8285878A898C8B8B8A88878685848384838587878888\
-8888888583807C7977716E6C68696A6B6F7174797E808487888A8B8A8A8A8887868585858685888888898A8889888681807D7876716F6D6B6A6B6A6D7072767A\
-7D8183868788898888888886878687888789898A8C8A8A8A8886827E7B7874726F6E6C696B6B6C6F7275787C7E8284868688888889888888888888898A8B8C8C\
-8C8A8A8885837F7B7A7674736E6F6D6C6E6E707274787A7E81828386868787888888888A8B8B8D8D8F8F8E8D8B89888582807C7A7774726F6E6C6C6C6C6F7172\
-77797C7F8082848686878888898A8A8C8C8E8F8E8F8E8C8A8A8884837F7C7A7674726F6E6D6C6D6C6F707276787A7E7F81848586878889898A8C8D8E8E8F8E90\
-8E8B8B898785837E7C7A777472706E6E6B6B6D6E6E7274777A7C7F818383868788898A8B8C8D8D8E8F8E8D8E8C8A88878483807C7A777473716E6E6C6B6D6F6F\
-717576797C7E80838385878888898A8A8D8D8E8F8F8E8E8B8A898783837F7C7A787574716F6E6E6C6D6E6F717477777B7E7F8184868788888A898C8C8D8D8F8E\
-8D8C8C8988878382807D7978777571716F6F6E6F6E6F72737678797C7F828387888A8B8D8E8F9090908F8F8D8C8A8885827F7D7A7776736F6F6D6D6C6D6B6E71\
-7173787A7B7F828485898B8B8D8E8F908F908F8E8C8B89878582807D7B79767575737171717070727372757777797E827B7B8B917F789098857C8C978A808890\
-8880858B847B7C827F78777B7B76737777747374777676777A7A7B7B7F808080828485848687888788888687878685858380807F7F7E7C7C7B79787877777777\
-77777778787A7B7B7D7D7F7E7F818180818283828383848283848383828280807F7E7E7C7C7B7A7A797879797878797978787A7A7A7B7B7B7C7C7C7C7C7D7D7E\
-7E7D7E7E7F7E7F7E7F7F7F7D7E7E7C7D7C7B7C7B7A7A7A79787978777778777878777978787979797A797A797A7B7B7B7B7A7B7A7B7B7B7A7B7A7B7A7A7A797A\
-79797978797979787A7A7979797A7A79797A7B7A7A7B7A7B7A7C7C7C7B7C7B7C7C7C7D7B7B00\
-')
-
-# From audio2.py and audio2.h - Monika's Welcome
-audio2 = [
-0xA1,0x4D,0x00,0x00,0x82,0x81,0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x80,0x81,0x80,0x80,0x80,0x80,0x7F,0x7F,0x81,0x81,0x81,0x81,0x81,
-0x81,0x81,0x80,0x82,0x82,0x82,0x81,0x82,0x82,0x82,0x81,0x82,0x82,0x82,0x82,0x82,0x81,0x81,0x82,0x82,0x82,0x80,0x81,0x81,0x81,0x81,
-0x80,0x81,0x81,0x81,0x81,0x80,0x81,0x80,0x81,0x80,0x81,0x82,0x81,0x82,0x82,0x82,0x83,0x83,0x83,0x82,0x83,0x82,0x83,0x83,0x83,0x82,
-0x83,0x83,0x83,0x83,0x82,0x82,0x81,0x81,0x81,0x81,0x80,0x81,0x80,0x7F,0x80,0x80,0x80,0x7E,0x7F,0x80,0x7F,0x80,0x80,0x81,0x82,0x81,
-0x82,0x82,0x83,0x83,0x83,0x84,0x85,0x85,0x84,0x85,0x85,0x84,0x84,0x84,0x84,0x83,0x84,0x83,0x83,0x83,0x82,0x81,0x80,0x81,0x80,0x7F,
-0x7F,0x7F,0x7F,0x7D,0x7E,0x7E,0x7D,0x7E,0x7F,0x7F,0x80,0x80,0x81,0x82,0x82,0x82,0x84,0x84,0x84,0x86,0x86,0x86,0x87,0x87,0x85,0x86,
-0x85,0x85,0x86,0x84,0x85,0x84,0x83,0x81,0x81,0x80,0x80,0x7F,0x7D,0x7E,0x7C,0x7C,0x7C,0x7B,0x7B,0x7B,0x7A,0x7A,0x79,0x7B,0x7B,0x7D,
-0x7F,0x82,0x84,0x87,0x89,0x8A,0x8B,0x8C,0x8C,0x8B,0x8B,0x8A,0x8B,0x8A,0x8A,0x88,0x88,0x87,0x86,0x85,0x84,0x81,0x80,0x7E,0x7B,0x79,
-0x77,0x76,0x75,0x74,0x72,0x73,0x71,0x72,0x71,0x74,0x76,0x79,0x7E,0x83,0x8A,0x90,0x93,0x95,0x96,0x94,0x91,0x8F,0x8E,0x8E,0x8E,0x8E,
-0x8D,0x8B,0x89,0x87,0x86,0x84,0x83,0x81,0x7D,0x7C,0x79,0x76,0x73,0x71,0x6F,0x6B,0x6A,0x69,0x69,0x6B,0x6F,0x74,0x7C,0x83,0x8A,0x8F,
-0x93,0x93,0x93,0x90,0x8C,0x8C,0x8C,0x8F,0x90,0x91,0x91,0x90,0x8D,0x8C,0x8A,0x8A,0x8A,0x89,0x86,0x85,0x82,0x7F,0x7B,0x77,0x72,0x70,
-0x6D,0x6A,0x69,0x67,0x66,0x68,0x69,0x6F,0x74,0x7C,0x83,0x88,0x8D,0x90,0x8F,0x8F,0x8E,0x8C,0x8D,0x8F,0x90,0x92,0x92,0x90,0x8F,0x8B,
-0x8B,0x8A,0x89,0x88,0x86,0x85,0x82,0x7E,0x7A,0x76,0x71,0x6E,0x6B,0x69,0x67,0x65,0x65,0x66,0x69,0x6D,0x73,0x7A,0x81,0x86,0x8B,0x8F,
-0x8F,0x8F,0x8D,0x8A,0x8A,0x8C,0x8E,0x91,0x91,0x92,0x90,0x8D,0x8B,0x8A,0x88,0x88,0x87,0x85,0x81,0x7E,0x7A,0x75,0x70,0x6E,0x6B,0x68,
-0x66,0x65,0x63,0x63,0x66,0x6A,0x6E,0x77,0x7E,0x86,0x8C,0x8F,0x8F,0x90,0x8D,0x8A,0x8B,0x8B,0x8E,0x90,0x92,0x92,0x92,0x8F,0x8D,0x8B,
-0x8A,0x89,0x87,0x86,0x82,0x80,0x79,0x75,0x71,0x6D,0x68,0x66,0x64,0x62,0x5F,0x60,0x64,0x67,0x6F,0x77,0x7F,0x86,0x8E,0x91,0x92,0x91,
-0x8D,0x8C,0x8B,0x8C,0x8E,0x91,0x92,0x92,0x92,0x8F,0x8F,0x8E,0x8C,0x8C,0x8B,0x89,0x86,0x82,0x7B,0x76,0x70,0x6B,0x65,0x62,0x60,0x5C,
-0x5C,0x5C,0x5F,0x65,0x6C,0x76,0x80,0x88,0x90,0x93,0x92,0x90,0x8B,0x89,0x87,0x89,0x8C,0x8E,0x8E,0x8F,0x8D,0x8D,0x8D,0x90,0x90,0x8F,
-0x8F,0x8C,0x87,0x81,0x7B,0x77,0x70,0x6B,0x65,0x61,0x5C,0x59,0x57,0x54,0x59,0x5D,0x66,0x73,0x7F,0x8B,0x94,0x98,0x97,0x94,0x8D,0x89,
-0x86,0x86,0x88,0x8C,0x8D,0x8F,0x8E,0x8D,0x8D,0x90,0x92,0x94,0x93,0x91,0x8C,0x85,0x7D,0x73,0x6D,0x66,0x5F,0x5B,0x56,0x53,0x50,0x4E,
-0x54,0x5C,0x69,0x79,0x88,0x95,0x9E,0xA0,0x9D,0x96,0x8E,0x87,0x84,0x84,0x86,0x89,0x8B,0x8C,0x8B,0x8D,0x8F,0x94,0x98,0x9C,0x9D,0x98,
-0x8E,0x83,0x76,0x6D,0x63,0x5D,0x57,0x50,0x4A,0x47,0x46,0x4C,0x56,0x68,0x7E,0x92,0xA3,0xAE,0xAF,0xA8,0x9E,0x90,0x86,0x80,0x7E,0x80,
-0x83,0x85,0x88,0x8A,0x8C,0x91,0x96,0x9F,0xA4,0xA7,0xA2,0x99,0x88,0x76,0x66,0x59,0x52,0x4D,0x49,0x45,0x3E,0x3C,0x43,0x51,0x68,0x86,
-0xA1,0xB5,0xC0,0xBC,0xAE,0x9C,0x88,0x7C,0x76,0x76,0x79,0x7F,0x81,0x82,0x85,0x88,0x8F,0x9E,0xAB,0xB7,0xB9,0xB1,0x9F,0x89,0x70,0x5C,
-0x4F,0x45,0x43,0x41,0x3C,0x33,0x32,0x3D,0x4F,0x72,0x99,0xBB,0xD1,0xD7,0xC7,0xAB,0x8F,0x76,0x6B,0x6A,0x6E,0x76,0x7D,0x7D,0x7F,0x83,
-0x89,0x9B,0xAE,0xC0,0xCB,0xC6,0xB3,0x97,0x7A,0x5D,0x4C,0x43,0x3F,0x3D,0x3B,0x34,0x29,0x2E,0x41,0x61,0x92,0xBF,0xDE,0xE9,0xDB,0xB7,
-0x92,0x70,0x5F,0x5F,0x66,0x6F,0x73,0x76,0x77,0x7D,0x8E,0xA3,0xBC,0xCF,0xD5,0xC9,0xB0,0x8F,0x72,0x5D,0x51,0x4C,0x46,0x3F,0x36,0x2A,
-0x1B,0x21,0x3E,0x64,0x9C,0xCE,0xE6,0xE7,0xD2,0xA8,0x84,0x6F,0x62,0x68,0x6E,0x6E,0x69,0x67,0x6A,0x7C,0x9B,0xBB,0xD6,0xE0,0xD4,0xBB,
-0x9A,0x7F,0x6F,0x6B,0x67,0x63,0x56,0x42,0x2E,0x22,0x18,0x20,0x48,0x6E,0x9E,0xC9,0xD5,0xD1,0xBE,0xA0,0x87,0x7B,0x70,0x6F,0x6C,0x61,
-0x5B,0x5F,0x6F,0x8A,0xAD,0xC7,0xD3,0xD0,0xBC,0xA4,0x92,0x83,0x7E,0x7B,0x72,0x64,0x4F,0x3C,0x2D,0x2A,0x27,0x28,0x4B,0x69,0x8F,0xBB,
-0xCB,0xCE,0xC3,0xA7,0x89,0x7B,0x69,0x64,0x65,0x60,0x61,0x69,0x7E,0x97,0xB4,0xC8,0xCC,0xC6,0xB1,0x9D,0x8E,0x85,0x7E,0x7D,0x75,0x65,
-0x50,0x3E,0x31,0x2D,0x28,0x28,0x4D,0x6E,0x98,0xC6,0xD1,0xCD,0xBC,0x9B,0x7D,0x73,0x66,0x65,0x64,0x5E,0x60,0x6D,0x82,0xA5,0xC4,0xD2,
-0xD2,0xBE,0xA2,0x8E,0x81,0x7C,0x80,0x7E,0x71,0x62,0x4B,0x3A,0x32,0x2D,0x22,0x34,0x5C,0x7D,0xB3,0xD1,0xCF,0xC4,0xA7,0x82,0x74,0x6A,
-0x60,0x63,0x5D,0x59,0x67,0x78,0x99,0xC2,0xD4,0xD7,0xC6,0xA3,0x8A,0x7D,0x79,0x7E,0x81,0x79,0x6B,0x52,0x3C,0x33,0x2F,0x21,0x2A,0x56,
-0x76,0xAA,0xD3,0xD1,0xC6,0xAA,0x81,0x6E,0x68,0x5D,0x60,0x5D,0x58,0x68,0x7F,0x9A,0xC3,0xD7,0xD3,0xC5,0xA2,0x85,0x7A,0x74,0x79,0x83,
-0x7B,0x73,0x60,0x46,0x39,0x33,0x22,0x21,0x4C,0x6F,0xA3,0xD3,0xD3,0xC4,0xAC,0x7E,0x6C,0x66,0x5B,0x60,0x5E,0x5B,0x6D,0x85,0x9C,0xC2,
-0xCF,0xCB,0xC3,0xA1,0x88,0x7E,0x76,0x77,0x80,0x77,0x70,0x5C,0x41,0x33,0x28,0x15,0x2E,0x62,0x89,0xC7,0xDA,0xCA,0xB5,0x90,0x6E,0x6A,
-0x61,0x59,0x5F,0x59,0x61,0x7E,0x99,0xB2,0xD2,0xD4,0xC5,0xB2,0x8F,0x7C,0x78,0x74,0x7E,0x83,0x79,0x6A,0x51,0x36,0x29,0x15,0x1A,0x50,
-0x7E,0xB8,0xE1,0xD3,0xBB,0x9C,0x73,0x67,0x64,0x5A,0x5F,0x5D,0x61,0x7B,0x9A,0xAF,0xCB,0xD0,0xC0,0xB4,0x97,0x83,0x7F,0x79,0x7A,0x82,
-0x7B,0x70,0x5A,0x3D,0x29,0x15,0x17,0x49,0x7D,0xBC,0xE9,0xDB,0xBC,0x99,0x6D,0x62,0x66,0x60,0x65,0x65,0x65,0x7E,0x9D,0xBB,0xDA,0xD7,
-0xC2,0xA7,0x83,0x75,0x79,0x7D,0x86,0x88,0x75,0x60,0x46,0x33,0x23,0x12,0x33,0x68,0x98,0xD4,0xE1,0xCA,0xAE,0x80,0x5F,0x5E,0x5A,0x5F,
-0x6D,0x6E,0x7C,0x97,0xA8,0xCA,0xD8,0xC6,0xB5,0x92,0x75,0x74,0x75,0x7D,0x88,0x7A,0x64,0x49,0x2E,0x1C,0x11,0x31,0x6A,0x9C,0xD1,0xDF,
-0xC6,0xA5,0x7D,0x5D,0x5B,0x5A,0x5E,0x69,0x6E,0x7E,0x99,0xB1,0xD1,0xDE,0xCC,0xB0,0x86,0x68,0x67,0x6F,0x82,0x88,0x77,0x58,0x35,0x1F,
-0x10,0x1B,0x53,0x89,0xBD,0xE1,0xCE,0xB0,0x8E,0x65,0x59,0x5B,0x59,0x65,0x6C,0x73,0x8B,0xA6,0xC5,0xE1,0xDB,0xBE,0x94,0x6E,0x5F,0x6A,
-0x7A,0x87,0x81,0x5F,0x37,0x1C,0x11,0x17,0x4E,0x8A,0xC6,0xEA,0xD6,0xB2,0x8E,0x62,0x58,0x5D,0x5B,0x66,0x6E,0x72,0x8B,0xA8,0xC6,0xDF,
-0xD9,0xBC,0x94,0x71,0x67,0x6F,0x7D,0x85,0x79,0x57,0x2E,0x17,0x0F,0x22,0x5A,0x9C,0xDA,0xEE,0xD5,0xB2,0x83,0x5B,0x59,0x5B,0x61,0x6D,
-0x70,0x77,0x93,0xB3,0xD5,0xEA,0xD8,0xB1,0x86,0x62,0x5F,0x70,0x7E,0x81,0x6A,0x3C,0x1C,0x11,0x1A,0x4B,0x94,0xD6,0xEE,0xD9,0xB3,0x82,
-0x58,0x58,0x62,0x6A,0x76,0x75,0x72,0x89,0xA9,0xCF,0xE8,0xD7,0xAF,0x7F,0x5D,0x58,0x6A,0x79,0x7D,0x61,0x30,0x15,0x13,0x23,0x5F,0xB6,
-0xE8,0xEA,0xCF,0x9C,0x60,0x4A,0x57,0x68,0x7A,0x82,0x74,0x77,0x93,0xB8,0xDE,0xE7,0xC6,0x95,0x66,0x4D,0x59,0x6E,0x78,0x6E,0x45,0x1A,
-0x13,0x1A,0x45,0xA2,0xE3,0xEA,0xDC,0xAB,0x66,0x44,0x4E,0x62,0x7B,0x8A,0x81,0x79,0x91,0xAF,0xD0,0xE3,0xC9,0x99,0x70,0x4E,0x4F,0x61,
-0x68,0x62,0x3E,0x18,0x14,0x20,0x55,0xBA,0xEB,0xE5,0xDB,0x9E,0x4E,0x37,0x47,0x64,0x8D,0x9A,0x8B,0x8A,0x96,0xAC,0xD1,0xD7,0xC0,0x97,
-0x64,0x46,0x46,0x4E,0x59,0x52,0x2D,0x14,0x19,0x35,0x8E,0xDF,0xE7,0xE8,0xCA,0x70,0x39,0x33,0x48,0x74,0x99,0xA3,0xA1,0xA3,0xAA,0xBC,
-0xC7,0xBA,0x9D,0x7B,0x59,0x4B,0x45,0x3F,0x37,0x21,0x13,0x2A,0x56,0xA2,0xE3,0xE9,0xE5,0xBC,0x6B,0x40,0x3A,0x4A,0x72,0x8F,0x9C,0xAC,
-0xB4,0xB8,0xC3,0xBB,0xA6,0x8E,0x6A,0x54,0x47,0x3A,0x2F,0x1E,0x0F,0x1E,0x43,0x88,0xD4,0xEB,0xE8,0xD7,0x91,0x50,0x3D,0x3D,0x57,0x7C,
-0x97,0xAA,0xB8,0xB8,0xB8,0xB1,0xA1,0x8E,0x76,0x62,0x51,0x3D,0x26,0x13,0x10,0x1B,0x40,0x8E,0xD8,0xEB,0xEA,0xD8,0x94,0x5F,0x4A,0x48,
-0x5D,0x78,0x90,0xA4,0xB4,0xB8,0xB9,0xAF,0x9A,0x86,0x6C,0x57,0x46,0x33,0x1D,0x11,0x13,0x29,0x60,0xAF,0xE1,0xEC,0xE6,0xBC,0x81,0x60,
-0x52,0x56,0x6F,0x86,0x98,0xAA,0xAF,0xB1,0xB1,0xA6,0x94,0x80,0x64,0x4C,0x31,0x17,0x10,0x12,0x23,0x59,0xA1,0xDA,0xEC,0xE7,0xC6,0x93,
-0x74,0x61,0x60,0x6F,0x7D,0x8B,0x9B,0xA2,0xAC,0xB2,0xAB,0xA0,0x8A,0x6B,0x51,0x2F,0x13,0x10,0x13,0x27,0x66,0xAE,0xDB,0xEA,0xDF,0xBB,
-0x93,0x7E,0x71,0x70,0x7B,0x82,0x8D,0x9B,0xA1,0xAC,0xAD,0xA4,0x97,0x84,0x6A,0x51,0x32,0x14,0x11,0x17,0x37,0x7F,0xC3,0xE4,0xEA,0xD3,
-0xA7,0x88,0x7A,0x75,0x82,0x8A,0x8F,0x96,0x97,0x9C,0xA5,0xA6,0x9F,0x90,0x76,0x5C,0x41,0x20,0x10,0x16,0x2E,0x65,0xA6,0xD0,0xE1,0xD9,
-0xBC,0x9F,0x8E,0x81,0x7F,0x83,0x86,0x8F,0x97,0x9F,0xA5,0xA5,0x9E,0x91,0x7D,0x67,0x4E,0x2F,0x13,0x13,0x27,0x57,0x9B,0xCA,0xDD,0xD8,
-0xBE,0xA0,0x94,0x8B,0x8C,0x92,0x8D,0x8E,0x8F,0x90,0x9A,0x9D,0x99,0x92,0x7D,0x64,0x4F,0x2E,0x14,0x18,0x30,0x5F,0x9A,0xC0,0xD0,0xD0,
-0xBA,0xA8,0x9F,0x90,0x90,0x8F,0x89,0x8F,0x91,0x95,0x9D,0x97,0x92,0x87,0x74,0x64,0x51,0x30,0x18,0x1D,0x39,0x6C,0xA1,0xC0,0xCD,0xC4,
-0xB3,0xA7,0xA0,0x99,0x9A,0x96,0x93,0x93,0x90,0x91,0x94,0x8F,0x89,0x7E,0x6C,0x5C,0x46,0x25,0x1A,0x2D,0x4F,0x87,0xB0,0xC1,0xC4,0xB8,
-0xAB,0xAB,0xA2,0x9E,0x9A,0x92,0x90,0x94,0x94,0x97,0x92,0x86,0x7A,0x6A,0x5D,0x54,0x3C,0x22,0x28,0x40,0x69,0x9E,0xB4,0xBE,0xBC,0xB1,
-0xB0,0xAC,0xA0,0x9D,0x93,0x8F,0x95,0x96,0x99,0x94,0x86,0x7D,0x6F,0x62,0x55,0x43,0x24,0x1E,0x38,0x5D,0x8F,0xAD,0xB1,0xB1,0xAE,0xAD,
-0xB2,0xA9,0xA0,0x97,0x90,0x96,0x98,0x94,0x8E,0x83,0x7A,0x72,0x68,0x5A,0x47,0x26,0x18,0x33,0x58,0x84,0xA2,0xA4,0xA8,0xAE,0xB3,0xBB,
-0xAD,0x9A,0x94,0x90,0x9B,0x9F,0x95,0x89,0x7C,0x77,0x7A,0x6F,0x60,0x4A,0x2A,0x1B,0x33,0x57,0x75,0x8F,0x93,0x9F,0xB4,0xBF,0xC1,0xAD,
-0x95,0x93,0x98,0xA3,0xA5,0x92,0x83,0x79,0x76,0x7A,0x6C,0x55,0x47,0x32,0x27,0x3E,0x58,0x6C,0x84,0x8C,0x9C,0xB1,0xB7,0xB8,0xAA,0x9B,
-0xA1,0xA5,0xA1,0x9D,0x89,0x84,0x86,0x81,0x7B,0x68,0x51,0x47,0x3A,0x26,0x32,0x4C,0x64,0x84,0x92,0x97,0xAA,0xAD,0xB1,0xAE,0xA0,0xA5,
-0xA9,0xA0,0x9E,0x8F,0x88,0x8B,0x82,0x75,0x67,0x52,0x4A,0x42,0x2D,0x2F,0x4B,0x5F,0x77,0x89,0x8D,0xA1,0xB1,0xB2,0xB1,0xA6,0xA4,0xAE,
-0xA6,0x9C,0x90,0x85,0x88,0x88,0x7A,0x6D,0x5B,0x4F,0x4A,0x37,0x2C,0x45,0x5B,0x6A,0x7F,0x84,0x94,0xAD,0xB1,0xB0,0xAB,0xA6,0xB2,0xB1,
-0xA2,0x97,0x8D,0x8A,0x89,0x77,0x68,0x60,0x5A,0x53,0x44,0x31,0x40,0x5B,0x67,0x72,0x7A,0x87,0xA0,0xAD,0xA6,0xA4,0xA8,0xB3,0xB8,0xAA,
-0x9B,0x95,0x95,0x91,0x81,0x6E,0x64,0x61,0x5A,0x4C,0x39,0x3E,0x5A,0x62,0x64,0x6C,0x7C,0x93,0xA4,0xA0,0x9C,0xA8,0xB5,0xB9,0xAB,0x9B,
-0x9B,0x9D,0x97,0x87,0x78,0x72,0x70,0x62,0x53,0x47,0x45,0x56,0x60,0x58,0x63,0x79,0x86,0x93,0x98,0x97,0xA3,0xAC,0xAC,0xAA,0xA3,0x9F,
-0x9F,0x98,0x8B,0x85,0x7F,0x76,0x6C,0x63,0x5B,0x59,0x59,0x5A,0x61,0x67,0x68,0x70,0x7E,0x86,0x8D,0x93,0x98,0xA0,0xA8,0xA3,0x9D,0x9D,
-0x9C,0x96,0x8C,0x82,0x7E,0x7A,0x71,0x6A,0x67,0x67,0x64,0x5F,0x63,0x69,0x6D,0x71,0x77,0x7E,0x87,0x8C,0x8F,0x93,0x96,0x99,0x97,0x96,
-0x91,0x8A,0x84,0x7D,0x7A,0x79,0x78,0x76,0x75,0x77,0x79,0x78,0x73,0x74,0x76,0x78,0x79,0x7B,0x81,0x86,0x86,0x85,0x88,0x8B,0x89,0x86,
-0x83,0x83,0x85,0x82,0x81,0x80,0x82,0x84,0x85,0x85,0x84,0x83,0x80,0x7E,0x7D,0x7E,0x80,0x83,0x82,0x80,0x82,0x83,0x84,0x82,0x83,0x84,
-0x84,0x84,0x84,0x82,0x82,0x84,0x85,0x85,0x85,0x85,0x85,0x83,0x82,0x83,0x84,0x86,0x86,0x84,0x83,0x81,0x82,0x83,0x82,0x83,0x83,0x83,
-0x81,0x82,0x82,0x81,0x82,0x81,0x82,0x83,0x84,0x83,0x84,0x82,0x84,0x84,0x84,0x84,0x84,0x85,0x84,0x85,0x86,0x85,0x84,0x84,0x84,0x83,
-0x82,0x81,0x81,0x80,0x80,0x80,0x82,0x81,0x81,0x80,0x80,0x81,0x80,0x81,0x82,0x81,0x7D,0x7A,0x7D,0x85,0x85,0x80,0x80,0x86,0x87,0x84,
-0x82,0x84,0x85,0x81,0x80,0x82,0x83,0x81,0x7F,0x7D,0x7E,0x7F,0x7F,0x7F,0x80,0x7E,0x80,0x80,0x81,0x80,0x81,0x82,0x82,0x83,0x83,0x83,
-0x82,0x82,0x82,0x83,0x82,0x81,0x80,0x7E,0x7E,0x80,0x81,0x81,0x80,0x81,0x81,0x82,0x82,0x81,0x81,0x81,0x81,0x81,0x81,0x80,0x7E,0x7E,
-0x7D,0x7D,0x7D,0x7C,0x7C,0x7C,0x7D,0x7D,0x7E,0x7E,0x7F,0x80,0x7D,0x7E,0x81,0x80,0x7F,0x7E,0x80,0x80,0x7E,0x7E,0x80,0x81,0x7E,0x7D,
-0x80,0x80,0x7E,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x7E,0x7D,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x81,0x80,0x80,0x7F,0x7D,0x7E,0x7F,
-0x7F,0x80,0x80,0x81,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x81,0x81,0x81,0x80,0x80,0x80,0x80,0x80,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7E,0x7E,0x80,0x80,0x81,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x81,0x80,0x80,0x80,0x81,0x81,0x81,0x82,0x80,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x80,0x7F,0x80,0x80,0x80,0x80,0x81,0x80,
-0x81,0x81,0x80,0x7F,0x80,0x81,0x80,0x81,0x81,0x81,0x81,0x81,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x80,0x81,0x81,0x80,0x7F,0x81,0x81,0x81,
-0x81,0x80,0x80,0x81,0x81,0x81,0x81,0x80,0x80,0x81,0x81,0x81,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x81,0x81,
-0x80,0x81,0x81,0x80,0x81,0x81,0x80,0x80,0x80,0x80,0x81,0x82,0x7E,0x7D,0x80,0x80,0x7E,0x81,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7E,
-0x80,0x80,0x80,0x7F,0x81,0x80,0x7F,0x81,0x81,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x80,0x7E,0x80,0x80,0x80,0x7F,0x7E,0x7F,
-0x7F,0x80,0x80,0x81,0x81,0x7F,0x81,0x81,0x80,0x7E,0x7E,0x7E,0x7D,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,
-0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7E,0x7F,0x7D,0x7E,0x7F,0x7E,0x7E,0x7D,0x7F,0x7E,0x7F,
-0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7F,0x7F,
-0x7F,0x7F,0x7E,0x7F,0x7D,0x7F,0x7F,0x7E,0x7E,0x7E,0x7E,0x7F,0x7E,0x7E,0x7D,0x7D,0x7D,0x7D,0x7E,0x7E,0x7E,0x7C,0x7D,0x7E,0x7D,0x7E,
-0x7E,0x7E,0x7F,0x7D,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7C,0x7D,0x7E,0x7C,0x7D,0x7D,0x7D,0x7D,0x7C,0x7D,0x7C,0x7E,0x7D,
-0x7D,0x7E,0x7E,0x7D,0x7E,0x7D,0x7D,0x7E,0x7E,0x7E,0x7D,0x7D,0x7C,0x7D,0x7E,0x7D,0x7C,0x7D,0x7D,0x7C,0x7D,0x7D,0x7D,0x7D,0x7C,0x7E,
-0x7E,0x7D,0x7D,0x7E,0x7D,0x7C,0x7D,0x7D,0x7E,0x7D,0x7D,0x7C,0x7D,0x7D,0x7D,0x7D,0x7E,0x7D,0x7E,0x7D,0x7E,0x7D,0x7D,0x7E,0x7E,0x80,
-0x7E,0x7F,0x86,0x84,0x7F,0x95,0x9A,0x70,0x73,0x91,0x7D,0x6E,0x82,0x8E,0x81,0x79,0x81,0x8D,0x82,0x83,0xA0,0x87,0x67,0x87,0x90,0x75,
-0x7D,0x88,0x87,0xA4,0x8F,0x6B,0x88,0x8D,0x75,0x89,0x8E,0x79,0x7A,0x83,0x81,0x81,0x7B,0x90,0x9C,0x80,0x7F,0x91,0x8A,0x81,0x8A,0x8A,
-0x83,0x82,0x85,0x85,0x82,0x7F,0x81,0x7E,0x7A,0x7E,0x7C,0x7A,0x7F,0x81,0x85,0x9A,0x92,0x87,0x91,0x87,0x7B,0x82,0x77,0x6E,0x76,0x74,
-0x75,0x7F,0x7E,0x7F,0x83,0x82,0x83,0x81,0x7B,0x7E,0x7D,0x76,0x78,0x8B,0x85,0x73,0x80,0x83,0x74,0x7B,0x7E,0x75,0x78,0x7B,0x7A,0x7D,
-0x7E,0x7E,0x81,0x7F,0x7C,0x7A,0x78,0x72,0x6F,0x75,0x6E,0x6E,0x73,0x71,0x74,0x6F,0x6E,0x73,0x6E,0x68,0x76,0x77,0x69,0x6C,0x6E,0x7A,
-0x7B,0x6D,0x77,0x76,0x61,0x69,0x6D,0x5D,0x67,0x6D,0x66,0x73,0x6C,0x74,0x83,0x7A,0x80,0x88,0x88,0x8B,0x94,0x92,0x87,0x8E,0x93,0x8A,
-0x8A,0x8E,0x82,0x8B,0x93,0x81,0x89,0x9B,0x91,0x95,0xA0,0x9E,0x9B,0x98,0x8E,0x91,0x93,0x83,0x84,0x86,0x7E,0x80,0x7D,0x7B,0x7F,0x75,
-0x77,0x74,0x6B,0x65,0x5B,0x53,0x52,0x49,0x42,0x4E,0x51,0x46,0x48,0x5E,0x5B,0x44,0x51,0x64,0x4D,0x47,0x63,0x60,0x53,0x6C,0x6E,0x61,
-0x62,0x67,0x6D,0x57,0x59,0x7D,0x5E,0x4B,0x74,0x6B,0x51,0x63,0x6C,0x5F,0x5B,0x61,0x69,0x69,0x6C,0x77,0x7A,0x7B,0x7F,0x88,0x89,0x7C,
-0x86,0x8C,0x85,0x82,0x82,0x85,0x85,0x8D,0x90,0x94,0x93,0x91,0x9E,0x98,0x90,0x9C,0xA2,0x9C,0x92,0x93,0x9E,0x93,0x83,0x94,0x95,0x89,
-0x8F,0x93,0x90,0x8C,0x87,0x8F,0x8C,0x89,0x95,0x93,0x98,0x97,0x8D,0x94,0x98,0x8A,0x8A,0x91,0x88,0x86,0x8E,0x8D,0x88,0x8E,0x88,0x89,
-0x8B,0x80,0x86,0x8A,0x7D,0x78,0x7C,0x7D,0x76,0x6E,0x69,0x70,0x6F,0x5C,0x5A,0x61,0x5A,0x57,0x5B,0x5E,0x5A,0x4F,0x4D,0x4C,0x48,0x49,
-0x47,0x4A,0x4F,0x52,0x51,0x58,0x64,0x5D,0x62,0x6C,0x5F,0x5E,0x68,0x67,0x63,0x66,0x66,0x6E,0x71,0x69,0x70,0x6F,0x60,0x5D,0x66,0x5F,
-0x57,0x5D,0x60,0x5D,0x60,0x5E,0x6B,0x76,0x66,0x6B,0x80,0x7D,0x75,0x7E,0x7F,0x7C,0x85,0x8A,0x90,0x94,0x94,0xA2,0xA8,0x9A,0x9C,0xA4,
-0x96,0x99,0xA1,0x94,0x98,0xA7,0xA1,0xA1,0xAC,0xAF,0xB3,0xB7,0xB9,0xBD,0xB4,0xB7,0xBF,0xB7,0xB3,0xBB,0xBE,0xBF,0xBD,0xBF,0xC6,0xCB,
-0xC2,0xBC,0xC8,0xBD,0xB1,0xBC,0xBA,0xAB,0xB0,0xBC,0xB5,0xB7,0xBE,0xBD,0xB8,0xAD,0xB4,0xBE,0xAD,0xA4,0xAE,0xAB,0x9A,0x99,0x94,0x8D,
-0x8C,0x75,0x62,0x6C,0x62,0x47,0x42,0x48,0x43,0x31,0x29,0x33,0x2B,0x15,0x18,0x22,0x15,0x0B,0x0B,0x08,0x07,0x07,0x07,0x06,0x07,0x08,
-0x08,0x06,0x07,0x09,0x08,0x09,0x14,0x19,0x14,0x20,0x29,0x27,0x2C,0x3B,0x3D,0x41,0x4E,0x4D,0x4C,0x53,0x4F,0x4F,0x52,0x52,0x4F,0x49,
-0x4F,0x4C,0x45,0x44,0x48,0x4B,0x46,0x3D,0x4F,0x5C,0x42,0x3F,0x5B,0x53,0x40,0x57,0x68,0x5B,0x56,0x5C,0x65,0x65,0x5A,0x5A,0x68,0x6E,
-0x63,0x66,0x70,0x6F,0x6D,0x68,0x6E,0x72,0x69,0x6C,0x6E,0x6A,0x6C,0x6F,0x70,0x7B,0x71,0x79,0x89,0x7E,0x80,0x98,0x99,0x89,0x8C,0x96,
-0x9F,0x9B,0x9F,0xB1,0xB5,0xAB,0xB5,0xC7,0xC8,0xCC,0xD5,0xDE,0xEC,0xF1,0xDD,0xD6,0xEB,0xE0,0xD2,0xDC,0xE9,0xDE,0xD3,0xD7,0xD4,0xCB,
-0xDA,0xDF,0xD9,0xEE,0xF0,0xE3,0xED,0xF4,0xEF,0xF1,0xF7,0xF7,0xF8,0xF8,0xF8,0xF9,0xF7,0xF9,0xF5,0xEE,0xEE,0xF5,0xEE,0xD9,0xD4,0xCA,
-0xBA,0xB1,0xA4,0x9D,0xA3,0x96,0x7C,0x74,0x75,0x75,0x71,0x6D,0x71,0x79,0x6C,0x67,0x7B,0x86,0x89,0x96,0xA5,0xA3,0x9D,0xA6,0xA8,0x9D,
-0xA2,0xB2,0xB2,0xB7,0xB6,0xAD,0xA4,0xA3,0x96,0x95,0xA2,0x97,0x83,0x76,0x70,0x6E,0x6A,0x5D,0x65,0x72,0x87,0xA8,0xB6,0xB8,0xC6,0xD4,
-0xD2,0xC6,0xC7,0xDF,0xF0,0xE7,0xE7,0xF2,0xEF,0xEF,0xEB,0xDF,0xDD,0xDA,0xCB,0xB3,0xA4,0x97,0x91,0x90,0x7A,0x61,0x53,0x42,0x50,0x81,
-0x8E,0x8F,0xB0,0xC8,0xC7,0xBC,0xA5,0x9A,0xB0,0xC1,0xAF,0xB8,0xD9,0xD3,0xC8,0xCF,0xC7,0xBC,0xC6,0xB4,0x9D,0x97,0x8B,0x71,0x5F,0x59,
-0x55,0x48,0x2C,0x0F,0x35,0x7D,0x88,0x81,0x9B,0xB0,0xB2,0x9E,0x77,0x63,0x80,0xA9,0xA4,0x95,0xB4,0xCC,0xBC,0xAB,0x9A,0x94,0xA3,0x9F,
-0x83,0x77,0x79,0x68,0x46,0x33,0x33,0x24,0x15,0x0D,0x17,0x62,0x9C,0x90,0x8D,0x9F,0xA2,0x90,0x61,0x41,0x57,0x82,0x9B,0xA7,0xB0,0xB9,
-0xBC,0xAC,0x94,0x87,0x8E,0x95,0x90,0x89,0x7D,0x6F,0x58,0x39,0x2A,0x21,0x18,0x0E,0x19,0x72,0xBB,0xB3,0xAC,0xB0,0xA8,0x9C,0x6D,0x3A,
-0x4F,0x89,0x95,0xA5,0xCD,0xC7,0xC7,0xD2,0xA3,0x85,0x9E,0x9F,0x92,0xA0,0x9A,0x83,0x7A,0x5F,0x35,0x2F,0x2D,0x17,0x09,0x48,0xB5,0xD0,
-0xC3,0xBE,0xAF,0xAA,0x90,0x47,0x2F,0x64,0x90,0x9E,0xC2,0xD3,0xC2,0xCB,0xB8,0x85,0x85,0x9A,0x94,0xA0,0xA6,0x8F,0x7E,0x74,0x4B,0x2C,
-0x27,0x1F,0x10,0x14,0x6A,0xC7,0xCD,0xB4,0x9B,0x86,0x82,0x5F,0x2C,0x37,0x73,0x9F,0xA9,0xB6,0xCA,0xBF,0xAC,0x9D,0x7F,0x81,0x9B,0x9F,
-0x9C,0x9D,0x8D,0x7B,0x62,0x3A,0x1E,0x18,0x16,0x0D,0x1D,0x82,0xCD,0xC2,0xA4,0x81,0x69,0x68,0x4F,0x32,0x47,0x7F,0xA9,0xB7,0xA8,0xA3,
-0xC0,0xBB,0x94,0x84,0x81,0x91,0xAE,0xA2,0x88,0x89,0x85,0x63,0x39,0x18,0x0D,0x14,0x0E,0x18,0x7A,0xCD,0xC0,0x9F,0x78,0x57,0x5B,0x4F,
-0x34,0x49,0x81,0xA9,0xB3,0xB6,0xB7,0xA9,0x9E,0x9C,0x8A,0x81,0x96,0xA4,0xA0,0x95,0x81,0x6F,0x5C,0x3C,0x18,0x0C,0x15,0x0E,0x1A,0x81,
-0xC9,0xB7,0x97,0x6F,0x50,0x53,0x4B,0x3A,0x50,0x86,0xAF,0xB5,0xA8,0xA3,0xA2,0xA2,0xA4,0x94,0x81,0x90,0xA2,0x9E,0x8F,0x80,0x71,0x65,
-0x4A,0x23,0x0D,0x12,0x11,0x10,0x58,0xAF,0xB9,0x9E,0x77,0x53,0x52,0x55,0x45,0x4A,0x73,0x9F,0xB4,0xAC,0xA5,0xAA,0xA4,0xA1,0x96,0x7E,
-0x86,0x9F,0x9E,0x8F,0x85,0x75,0x63,0x48,0x22,0x0D,0x11,0x12,0x0D,0x4F,0xAC,0xBD,0x9F,0x74,0x4F,0x4E,0x53,0x47,0x4D,0x6F,0x9D,0xB6,
-0xAF,0xA5,0xA5,0x9F,0x9D,0x99,0x86,0x86,0x9E,0xA0,0x96,0x89,0x75,0x65,0x4E,0x2C,0x12,0x11,0x14,0x0B,0x38,0x9C,0xBD,0xA3,0x7E,0x56,
-0x4F,0x5C,0x53,0x50,0x69,0x91,0xB3,0xB6,0xAC,0xAC,0xA2,0x9F,0xA2,0x8B,0x85,0x9C,0xA1,0x9D,0x96,0x82,0x69,0x54,0x39,0x1E,0x14,0x15,
-0x0D,0x2B,0x89,0xC0,0xAF,0x85,0x5E,0x53,0x5B,0x5A,0x58,0x67,0x8D,0xB3,0xBC,0xA8,0xA3,0xA3,0xA6,0xB5,0xA1,0x89,0x95,0xA3,0xA2,0x9D,
-0x89,0x76,0x6A,0x50,0x2E,0x1E,0x1B,0x13,0x11,0x54,0xAA,0xBC,0xA1,0x77,0x58,0x5C,0x65,0x61,0x5F,0x75,0xA4,0xBF,0xB6,0xB0,0xB1,0xA9,
-0xAE,0xA8,0x8F,0x91,0xA3,0xA8,0xA4,0x96,0x7D,0x6A,0x57,0x38,0x22,0x1D,0x15,0x0E,0x46,0xA1,0xBF,0xA8,0x7D,0x5C,0x5D,0x66,0x64,0x60,
-0x6F,0x9C,0xBE,0xBD,0xA7,0x9F,0xA5,0xB5,0xB8,0x9F,0x8F,0x9B,0xA8,0xA9,0x9D,0x82,0x73,0x68,0x4C,0x30,0x20,0x18,0x0D,0x1F,0x76,0xB9,
-0xB5,0x96,0x6E,0x5A,0x63,0x64,0x60,0x68,0x87,0xB0,0xBF,0xB5,0xB0,0xB3,0xB0,0xB0,0xA3,0x92,0x97,0xA9,0xAC,0xA6,0x94,0x7C,0x67,0x4D,
-0x31,0x25,0x20,0x11,0x18,0x62,0xB0,0xBF,0xA1,0x73,0x5A,0x60,0x68,0x67,0x69,0x7F,0xA8,0xC1,0xBB,0xAA,0xA5,0xAD,0xB4,0xB1,0xA2,0x9B,
-0xA3,0xAB,0xA6,0x99,0x81,0x71,0x5F,0x43,0x2A,0x1E,0x16,0x10,0x3F,0x95,0xBC,0xAC,0x84,0x63,0x60,0x68,0x69,0x65,0x6F,0x94,0xB8,0xBF,
-0xB7,0xB5,0xAD,0xAF,0xAF,0x9C,0x94,0x9F,0xAA,0xA9,0x9E,0x87,0x70,0x58,0x3D,0x2C,0x22,0x19,0x0E,0x2C,0x82,0xBC,0xB1,0x89,0x62,0x57,
-0x61,0x68,0x67,0x6A,0x86,0xAF,0xBB,0xAF,0xA5,0xA8,0xB1,0xB5,0xA5,0x92,0x94,0xA1,0xA4,0x9C,0x8A,0x75,0x61,0x46,0x2D,0x22,0x1C,0x0F,
-0x1A,0x62,0xA5,0xB0,0x94,0x6E,0x5B,0x60,0x65,0x64,0x5F,0x77,0xA0,0xB4,0xB8,0xBB,0xAF,0xA5,0xAA,0xA2,0x93,0x96,0x9E,0xA0,0x9E,0x8F,
-0x79,0x5F,0x42,0x30,0x24,0x1B,0x11,0x14,0x54,0xA4,0xB7,0x97,0x72,0x59,0x5C,0x68,0x6A,0x62,0x6F,0x95,0xB3,0xB9,0xAF,0xA0,0xA7,0xBA,
-0xB4,0xA1,0x93,0x94,0x9E,0xA0,0x92,0x7D,0x68,0x54,0x3B,0x28,0x1D,0x13,0x0F,0x3D,0x8C,0xAF,0xA3,0x85,0x66,0x5C,0x67,0x6B,0x64,0x68,
-0x88,0xA9,0xB6,0xBF,0xBD,0xAC,0xA7,0xA8,0xA0,0x99,0x9D,0x9D,0x97,0x93,0x88,0x70,0x51,0x38,0x29,0x23,0x18,0x0F,0x35,0x7A,0xA6,0xA6,
-0x8D,0x6E,0x60,0x66,0x6E,0x69,0x69,0x81,0x9E,0xB2,0xB9,0xAF,0xAA,0xB0,0xAF,0xAA,0xA2,0x99,0x96,0x97,0x95,0x89,0x75,0x60,0x47,0x33,
-0x2D,0x23,0x12,0x25,0x65,0x95,0xA2,0x96,0x7E,0x68,0x6B,0x72,0x6D,0x69,0x78,0x92,0xA8,0xB6,0xBD,0xB9,0xB2,0xB0,0xA9,0xA1,0x9B,0x9A,
-0x95,0x90,0x8C,0x7F,0x67,0x4B,0x3B,0x34,0x2A,0x1B,0x25,0x59,0x8B,0x9F,0x98,0x84,0x74,0x72,0x77,0x72,0x6E,0x77,0x8C,0x9F,0xB0,0xB4,
-0xB3,0xB5,0xB7,0xAF,0xA6,0xA0,0x96,0x91,0x8F,0x89,0x7F,0x71,0x5F,0x4D,0x3F,0x39,0x2F,0x2C,0x4A,0x77,0x8E,0x94,0x91,0x83,0x7B,0x7F,
-0x7D,0x75,0x77,0x85,0x94,0xA0,0xAB,0xB3,0xB4,0xB6,0xB3,0xAA,0xA4,0x9B,0x93,0x8C,0x89,0x83,0x7B,0x6E,0x60,0x54,0x4D,0x46,0x3B,0x4A,
-0x6E,0x82,0x87,0x89,0x87,0x82,0x86,0x85,0x7D,0x7A,0x83,0x8D,0x94,0x9D,0xA2,0xA5,0xB2,0xB5,0xAD,0xAA,0xA7,0x9C,0x95,0x91,0x8C,0x83,
-0x7C,0x75,0x69,0x62,0x5D,0x4F,0x47,0x5F,0x74,0x75,0x7A,0x80,0x7C,0x80,0x87,0x82,0x7A,0x81,0x89,0x8D,0x90,0x95,0x9D,0xA7,0xAD,0xAF,
-0xAE,0xAC,0xA8,0xA2,0x9D,0x95,0x8F,0x87,0x7C,0x71,0x69,0x63,0x58,0x4A,0x54,0x68,0x6C,0x6A,0x70,0x74,0x76,0x7E,0x7F,0x7A,0x7D,0x85,
-0x89,0x8D,0x90,0x93,0x98,0xA3,0xAD,0xAD,0xAF,0xAE,0xA8,0xA5,0xA3,0x98,0x8E,0x88,0x7F,0x73,0x6B,0x64,0x53,0x4E,0x5D,0x62,0x5C,0x5E,
-0x65,0x67,0x71,0x78,0x76,0x76,0x80,0x88,0x8D,0x8E,0x90,0x94,0x9E,0xA4,0xA8,0xAE,0xB1,0xB1,0xB0,0xAE,0xA8,0xA0,0x97,0x8B,0x7E,0x72,
-0x69,0x5B,0x4A,0x4C,0x56,0x55,0x50,0x56,0x5F,0x67,0x73,0x77,0x75,0x7B,0x85,0x8B,0x8E,0x8E,0x92,0x97,0x9E,0xA9,0xAE,0xB2,0xB5,0xB4,
-0xB3,0xB2,0xAA,0x9D,0x94,0x8A,0x7C,0x6E,0x63,0x52,0x44,0x4E,0x57,0x4F,0x4D,0x58,0x5F,0x6A,0x75,0x75,0x74,0x7D,0x88,0x8B,0x8D,0x90,
-0x93,0x9D,0xA5,0xA9,0xAE,0xB5,0xB5,0xB3,0xB3,0xAD,0xA4,0x9D,0x93,0x83,0x75,0x6A,0x5E,0x4C,0x46,0x4F,0x52,0x4C,0x50,0x5B,0x61,0x6D,
-0x74,0x73,0x77,0x80,0x86,0x89,0x8D,0x90,0x95,0x9C,0xA4,0xAB,0xAD,0xB3,0xB4,0xB2,0xAF,0xAC,0xA1,0x98,0x8F,0x7F,0x71,0x66,0x59,0x48,
-0x46,0x53,0x51,0x4A,0x50,0x5E,0x63,0x6D,0x73,0x71,0x76,0x7E,0x84,0x88,0x8C,0x8F,0x94,0x9D,0xA8,0xAB,0xAC,0xB2,0xB4,0xB0,0xAE,0xA7,
-0x9C,0x94,0x8B,0x7B,0x6C,0x60,0x53,0x47,0x4C,0x52,0x4C,0x49,0x56,0x60,0x65,0x6E,0x6F,0x6F,0x78,0x7F,0x83,0x88,0x8B,0x8E,0x96,0x9F,
-0xA5,0xA9,0xAD,0xB2,0xB2,0xAF,0xAD,0xA5,0x9B,0x93,0x87,0x77,0x6A,0x61,0x54,0x48,0x4D,0x53,0x4D,0x4D,0x5A,0x60,0x65,0x6F,0x6F,0x71,
-0x78,0x7F,0x84,0x89,0x8C,0x8F,0x97,0xA0,0xA7,0xAC,0xAE,0xB0,0xB3,0xB0,0xAC,0xA3,0x98,0x90,0x84,0x76,0x6A,0x60,0x52,0x49,0x50,0x55,
-0x4E,0x4F,0x5C,0x62,0x69,0x70,0x70,0x71,0x7A,0x81,0x87,0x8A,0x8D,0x92,0x99,0xA2,0xA8,0xAC,0xB0,0xB3,0xB1,0xAE,0xAB,0xA1,0x97,0x8F,
-0x82,0x74,0x6B,0x60,0x51,0x4C,0x53,0x53,0x4F,0x55,0x5C,0x62,0x6A,0x71,0x71,0x74,0x7D,0x83,0x87,0x8A,0x8C,0x92,0x9C,0xA3,0xA9,0xAF,
-0xB1,0xB1,0xB3,0xAE,0xA7,0x9E,0x96,0x8B,0x7E,0x73,0x69,0x5D,0x4E,0x4D,0x55,0x53,0x4F,0x57,0x5E,0x65,0x6D,0x71,0x71,0x76,0x7F,0x85,
-0x89,0x8A,0x8E,0x96,0x9F,0xA7,0xAB,0xB1,0xB4,0xB2,0xB0,0xAD,0xA6,0x9C,0x94,0x88,0x7B,0x72,0x67,0x59,0x4E,0x50,0x56,0x54,0x53,0x5A,
-0x61,0x68,0x70,0x72,0x72,0x79,0x81,0x87,0x8A,0x8D,0x90,0x97,0xA2,0xAA,0xAF,0xB0,0xB1,0xB3,0xB2,0xAC,0xA2,0x99,0x91,0x86,0x79,0x6F,
-0x63,0x56,0x4D,0x52,0x56,0x53,0x55,0x5B,0x63,0x6A,0x71,0x71,0x74,0x7C,0x83,0x87,0x8B,0x8C,0x92,0x9C,0xA6,0xA9,0xAE,0xB2,0xB1,0xAF,
-0xAF,0xA9,0x9F,0x97,0x8D,0x7F,0x75,0x6C,0x5C,0x50,0x4E,0x54,0x55,0x51,0x56,0x5F,0x65,0x6C,0x70,0x6F,0x76,0x7E,0x84,0x87,0x8B,0x8D,
-0x95,0x9F,0xA9,0xAB,0xAD,0xAF,0xB1,0xB0,0xAB,0xA2,0x9A,0x91,0x87,0x79,0x6F,0x64,0x56,0x4B,0x51,0x57,0x52,0x52,0x5B,0x61,0x67,0x6E,
-0x70,0x70,0x79,0x80,0x84,0x88,0x8B,0x8E,0x98,0xA3,0xA6,0xA7,0xAD,0xB2,0xAD,0xAC,0xA9,0x9F,0x95,0x8F,0x83,0x75,0x6D,0x60,0x51,0x4D,
-0x53,0x55,0x50,0x55,0x5D,0x63,0x6B,0x70,0x6F,0x73,0x7D,0x81,0x84,0x88,0x8B,0x90,0x9A,0xA5,0xA7,0xAA,0xAC,0xAF,0xAF,0xAD,0xA4,0x9A,
-0x93,0x8A,0x7F,0x71,0x67,0x5A,0x4E,0x4F,0x56,0x55,0x50,0x58,0x60,0x67,0x6D,0x71,0x71,0x77,0x80,0x82,0x85,0x8A,0x8D,0x92,0x9D,0xA6,
-0xA8,0xAC,0xAF,0xAE,0xAD,0xAA,0xA1,0x97,0x91,0x85,0x79,0x70,0x65,0x55,0x4F,0x53,0x56,0x54,0x55,0x5B,0x63,0x6A,0x70,0x70,0x73,0x79,
-0x81,0x84,0x87,0x89,0x8E,0x97,0xA2,0xA6,0xA8,0xAD,0xAE,0xAC,0xAD,0xA6,0x9D,0x96,0x8E,0x81,0x76,0x6D,0x5F,0x53,0x4F,0x54,0x56,0x52,
-0x56,0x5F,0x64,0x6B,0x70,0x72,0x75,0x7C,0x82,0x84,0x89,0x8C,0x92,0x9C,0xA3,0xA4,0xA7,0xAF,0xAD,0xAB,0xAA,0xA4,0x9B,0x94,0x8A,0x7D,
-0x72,0x69,0x5D,0x51,0x51,0x54,0x54,0x53,0x5A,0x60,0x65,0x6C,0x72,0x72,0x78,0x7E,0x83,0x87,0x8B,0x90,0x96,0x9E,0xA4,0xA7,0xAC,0xAD,
-0xAC,0xAB,0xA8,0xA0,0x98,0x91,0x84,0x79,0x70,0x64,0x59,0x51,0x52,0x54,0x54,0x55,0x5B,0x62,0x68,0x6E,0x71,0x74,0x7B,0x81,0x84,0x89,
-0x8E,0x92,0x99,0xA1,0xA4,0xA6,0xAC,0xAE,0xAA,0xA9,0xA5,0x9E,0x95,0x8E,0x80,0x75,0x6C,0x62,0x56,0x50,0x52,0x52,0x53,0x57,0x5C,0x62,
-0x69,0x6F,0x71,0x76,0x7C,0x82,0x87,0x8B,0x91,0x96,0x9D,0xA2,0xA7,0xAA,0xAC,0xAC,0xAB,0xA8,0xA1,0x9A,0x92,0x86,0x7C,0x71,0x68,0x5D,
-0x53,0x50,0x51,0x53,0x54,0x58,0x5C,0x63,0x6B,0x6F,0x73,0x78,0x7E,0x84,0x89,0x8D,0x92,0x99,0x9F,0xA3,0xA7,0xAC,0xAB,0xAB,0xA9,0xA5,
-0x9E,0x98,0x8E,0x81,0x77,0x6F,0x65,0x5A,0x52,0x50,0x51,0x52,0x55,0x59,0x5C,0x64,0x6B,0x6F,0x73,0x79,0x80,0x85,0x8B,0x90,0x95,0x9B,
-0xA1,0xA5,0xAA,0xAC,0xA9,0xAA,0xA8,0xA2,0x9C,0x96,0x8A,0x80,0x77,0x6C,0x63,0x59,0x52,0x52,0x53,0x52,0x56,0x5A,0x5E,0x65,0x6B,0x6F,
-0x74,0x7C,0x81,0x85,0x8E,0x92,0x95,0x9E,0xA1,0xA4,0xAA,0xAB,0xA8,0xA9,0xA6,0xA0,0x9A,0x92,0x87,0x7E,0x76,0x6B,0x60,0x59,0x52,0x53,
-0x53,0x53,0x56,0x59,0x5F,0x66,0x6B,0x6F,0x74,0x7D,0x82,0x89,0x8F,0x94,0x99,0x9E,0xA4,0xA7,0xA9,0xAC,0xAA,0xA7,0xA3,0x9D,0x98,0x8F,
-0x85,0x7B,0x73,0x68,0x60,0x58,0x54,0x53,0x53,0x54,0x57,0x5B,0x5F,0x65,0x6B,0x6F,0x77,0x7D,0x83,0x8A,0x91,0x95,0x9A,0xA0,0xA4,0xA7,
-0xA9,0xA7,0xA7,0xA6,0xA1,0x9B,0x94,0x8C,0x83,0x7A,0x71,0x69,0x60,0x59,0x56,0x56,0x54,0x56,0x59,0x5C,0x61,0x68,0x6C,0x6F,0x78,0x7E,
-0x84,0x8D,0x92,0x96,0x9B,0xA2,0xA2,0xA6,0xA8,0xA5,0xA3,0xA2,0x9D,0x95,0x90,0x88,0x7F,0x78,0x71,0x68,0x61,0x5D,0x59,0x58,0x57,0x59,
-0x5A,0x5E,0x63,0x67,0x6E,0x73,0x7A,0x7F,0x88,0x8D,0x93,0x96,0x9B,0x9D,0xA1,0xA2,0xA2,0xA1,0x9E,0x9B,0x95,0x91,0x8A,0x82,0x7D,0x76,
-0x6E,0x6A,0x65,0x60,0x5D,0x5D,0x5C,0x5D,0x5F,0x62,0x65,0x69,0x6F,0x74,0x7A,0x80,0x85,0x8B,0x8F,0x93,0x97,0x99,0x9B,0x9A,0x9B,0x9A,
-0x96,0x94,0x8F,0x8B,0x86,0x82,0x7C,0x77,0x72,0x6E,0x6B,0x68,0x67,0x63,0x65,0x65,0x64,0x68,0x6A,0x6D,0x70,0x74,0x78,0x7C,0x80,0x84,
-0x88,0x8A,0x8D,0x90,0x91,0x91,0x91,0x91,0x8F,0x8D,0x89,0x88,0x85,0x81,0x7E,0x7B,0x78,0x76,0x73,0x72,0x71,0x6F,0x70,0x6F,0x6F,0x71,
-0x72,0x74,0x76,0x77,0x7A,0x7B,0x7E,0x7F,0x82,0x83,0x85,0x87,0x87,0x87,0x88,0x88,0x87,0x87,0x85,0x83,0x84,0x80,0x80,0x7E,0x7D,0x7C,
-0x7C,0x7B,0x7A,0x79,0x7A,0x79,0x7A,0x7A,0x7A,0x7A,0x7C,0x7C,0x7D,0x7E,0x80,0x81,0x80,0x82,0x81,0x83,0x83,0x84,0x85,0x84,0x84,0x82,
-0x83,0x82,0x82,0x81,0x81,0x80,0x7F,0x80,0x80,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x80,0x80,0x7F,0x80,0x81,0x81,0x81,0x81,0x83,0x82,
-0x83,0x84,0x83,0x83,0x84,0x83,0x84,0x83,0x84,0x84,0x83,0x83,0x82,0x82,0x83,0x83,0x82,0x81,0x83,0x83,0x83,0x82,0x83,0x82,0x83,0x83,
-0x83,0x82,0x83,0x83,0x82,0x83,0x83,0x83,0x84,0x84,0x83,0x84,0x84,0x84,0x83,0x84,0x84,0x83,0x84,0x83,0x84,0x84,0x84,0x84,0x84,0x83,
-0x84,0x84,0x83,0x84,0x83,0x84,0x83,0x84,0x84,0x83,0x83,0x82,0x84,0x84,0x83,0x83,0x84,0x84,0x84,0x84,0x84,0x83,0x84,0x85,0x83,0x84,
-0x83,0x84,0x83,0x84,0x84,0x84,0x83,0x84,0x84,0x84,0x83,0x84,0x84,0x84,0x84,0x83,0x83,0x83,0x83,0x82,0x83,0x83,0x82,0x83,0x83,0x83,
-0x83,0x82,0x83,0x83,0x82,0x83,0x83,0x83,0x82,0x83,0x83,0x83,0x83,0x82,0x83,0x83,0x83,0x82,0x83,0x83,0x81,0x82,0x82,0x82,0x81,0x81,
-0x81,0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x81,0x81,0x80,0x81,0x82,0x82,0x82,0x81,0x82,0x82,0x82,0x81,0x82,0x81,0x82,0x81,0x82,0x82,
-0x81,0x81,0x80,0x81,0x81,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x81,0x81,0x80,0x81,0x80,0x81,0x81,
-0x81,0x80,0x81,0x80,0x80,0x81,0x80,0x80,0x81,0x81,0x81,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x80,0x81,0x80,0x81,0x80,0x81,0x81,0x81,0x81,0x81,0x81,0x80,0x81,0x80,0x81,0x81,0x81,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x81,0x81,0x81,0x81,0x81,0x80,0x80,0x81,0x81,0x80,
-0x81,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x81,0x7F,0x80,
-0x81,0x80,0x81,0x81,0x81,0x81,0x80,0x81,0x81,0x81,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x81,
-0x80,0x80,0x81,0x80,0x81,0x81,0x81,0x81,0x81,0x80,0x80,0x81,0x81,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x80,0x80,0x81,0x81,0x80,0x81,
-0x81,0x81,0x81,0x81,0x81,0x81,0x80,0x81,0x81,0x81,0x80,0x81,0x80,0x81,0x81,0x80,0x81,0x80,0x81,0x81,0x80,0x81,0x80,0x81,0x80,0x81,
-0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x81,0x81,0x81,
-0x81,0x81,0x82,0x80,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x82,0x81,0x82,0x85,0x89,0x7E,0xA3,0xB1,0x80,
-0x95,0x83,0x78,0x7F,0x8A,0x9F,0x87,0x7E,0x89,0x87,0x7C,0x7E,0x8F,0x85,0x7D,0x84,0x8C,0x9C,0x8B,0x88,0x97,0x81,0x79,0x7E,0x85,0x86,
-0x78,0x82,0x9C,0x8C,0x89,0x9B,0x90,0x85,0x86,0x85,0x85,0x82,0x7C,0x81,0x85,0x7F,0x82,0x8A,0x86,0x83,0x85,0x83,0x85,0x83,0x7B,0x82,
-0x83,0x7C,0x7F,0x84,0x7F,0x82,0x80,0x83,0x7F,0x7B,0x7F,0x7D,0x77,0x79,0x7A,0x75,0x77,0x74,0x73,0x73,0x75,0x78,0x79,0x76,0x75,0x79,
-0x71,0x70,0x79,0x72,0x6E,0x7A,0x75,0x72,0x77,0x74,0x76,0x75,0x74,0x76,0x76,0x72,0x77,0x74,0x71,0x72,0x72,0x77,0x76,0x74,0x7C,0x7B,
-0x74,0x79,0x76,0x77,0x7B,0x75,0x79,0x7E,0x74,0x74,0x81,0x75,0x72,0x7C,0x74,0x77,0x7D,0x79,0x7D,0x79,0x73,0x7D,0x80,0x78,0x7C,0x7F,
-0x7B,0x7C,0x79,0x7A,0x7F,0x7A,0x78,0x7B,0x79,0x75,0x7D,0x7F,0x80,0x76,0x7D,0x81,0x79,0x7A,0x79,0x7E,0x79,0x77,0x7C,0x7D,0x78,0x76,
-0x7E,0x80,0x76,0x7D,0x80,0x77,0x7D,0x7D,0x7B,0x82,0x78,0x75,0x85,0x79,0x79,0x82,0x7A,0x7E,0x80,0x7E,0x80,0x7E,0x79,0x77,0x7C,0x81,
-0x7A,0x7C,0x7D,0x80,0x82,0x7A,0x7A,0x7E,0x7E,0x79,0x78,0x84,0x81,0x73,0x7D,0x88,0x7A,0x7A,0x88,0x7D,0x7D,0x8B,0x7B,0x7E,0x8A,0x75,
-0x7F,0x89,0x75,0x84,0x8A,0x70,0x7F,0x8C,0x74,0x7B,0x8D,0x7D,0x7A,0x89,0x7C,0x81,0x86,0x77,0x7B,0x85,0x7B,0x7B,0x7E,0x77,0x83,0x80,
-0x76,0x7E,0x87,0x76,0x7E,0x8A,0x80,0x7D,0x89,0x87,0x81,0x81,0x84,0x8A,0x81,0x7B,0x83,0x8A,0x7F,0x77,0x87,0x87,0x7A,0x86,0x88,0x7E,
-0x87,0x80,0x7E,0x88,0x80,0x7A,0x87,0x8B,0x79,0x81,0x8C,0x83,0x86,0x8D,0x7D,0x84,0x89,0x7F,0x88,0x8A,0x7B,0x7E,0x8D,0x7F,0x7C,0x87,
-0x7F,0x81,0x87,0x82,0x82,0x84,0x7F,0x7F,0x85,0x80,0x77,0x7F,0x88,0x7F,0x7A,0x81,0x86,0x82,0x7D,0x83,0x8E,0x84,0x7F,0x86,0x85,0x81,
-0x83,0x7F,0x7F,0x83,0x80,0x80,0x85,0x82,0x81,0x85,0x81,0x83,0x83,0x7E,0x81,0x82,0x7E,0x81,0x83,0x82,0x84,0x82,0x80,0x83,0x80,0x81,
-0x84,0x87,0x83,0x80,0x87,0x87,0x7E,0x83,0x83,0x7E,0x80,0x80,0x7C,0x80,0x7C,0x7D,0x82,0x80,0x7D,0x7E,0x80,0x81,0x7D,0x7A,0x7E,0x83,
-0x7D,0x7D,0x81,0x81,0x84,0x80,0x80,0x83,0x80,0x7F,0x82,0x81,0x83,0x81,0x81,0x81,0x83,0x83,0x82,0x81,0x82,0x81,0x84,0x86,0x80,0x81,
-0x82,0x82,0x83,0x80,0x7F,0x81,0x80,0x81,0x80,0x7F,0x82,0x83,0x80,0x81,0x82,0x7F,0x81,0x80,0x7D,0x80,0x80,0x7E,0x80,0x82,0x82,0x83,
-0x85,0x80,0x80,0x86,0x84,0x7E,0x81,0x83,0x83,0x83,0x80,0x82,0x86,0x83,0x82,0x84,0x83,0x82,0x85,0x83,0x81,0x81,0x7F,0x82,0x84,0x81,
-0x81,0x82,0x81,0x83,0x82,0x81,0x82,0x83,0x82,0x80,0x81,0x84,0x83,0x80,0x81,0x80,0x82,0x83,0x81,0x83,0x84,0x83,0x84,0x83,0x82,0x84,
-0x85,0x84,0x84,0x87,0x85,0x83,0x83,0x84,0x85,0x83,0x83,0x82,0x83,0x82,0x80,0x7F,0x7F,0x80,0x7C,0x7C,0x7C,0x7B,0x79,0x79,0x79,0x7A,
-0x7B,0x7A,0x7C,0x7E,0x81,0x81,0x83,0x86,0x88,0x88,0x8A,0x8B,0x8C,0x8C,0x8C,0x8C,0x8F,0x8F,0x8D,0x8D,0x8E,0x8E,0x8C,0x8A,0x86,0x85,
-0x81,0x7D,0x79,0x75,0x70,0x6F,0x6D,0x68,0x68,0x68,0x66,0x67,0x6C,0x70,0x76,0x7C,0x83,0x8B,0x95,0x9A,0x9C,0xA0,0xA1,0xA0,0x9F,0x9C,
-0x97,0x94,0x90,0x8E,0x8B,0x8A,0x86,0x85,0x86,0x82,0x7C,0x7A,0x76,0x71,0x6B,0x64,0x5D,0x56,0x52,0x57,0x61,0x67,0x6F,0x77,0x81,0x8B,
-0x95,0x9A,0x9B,0x9C,0x9C,0x9B,0x99,0x93,0x8D,0x89,0x8A,0x8C,0x8C,0x8E,0x90,0x92,0x96,0x98,0x98,0x95,0x92,0x89,0x82,0x79,0x6D,0x65,
-0x5E,0x58,0x53,0x4F,0x51,0x5A,0x62,0x6B,0x77,0x80,0x88,0x92,0x99,0x9C,0x9C,0x9C,0x98,0x94,0x91,0x8B,0x86,0x86,0x87,0x87,0x88,0x8D,
-0x91,0x94,0x98,0x98,0x98,0x96,0x90,0x8A,0x81,0x75,0x6B,0x63,0x5C,0x55,0x51,0x4B,0x4E,0x57,0x5F,0x6B,0x76,0x7F,0x87,0x91,0x98,0x9C,
-0x9D,0x9B,0x96,0x94,0x8F,0x8B,0x87,0x82,0x82,0x82,0x85,0x88,0x8C,0x90,0x94,0x97,0x97,0x96,0x93,0x8B,0x84,0x7A,0x70,0x66,0x5F,0x59,
-0x54,0x4E,0x4D,0x53,0x5A,0x65,0x71,0x7B,0x82,0x8B,0x94,0x98,0x9A,0x9B,0x98,0x94,0x8E,0x8A,0x87,0x83,0x81,0x81,0x82,0x84,0x86,0x8D,
-0x92,0x94,0x96,0x95,0x92,0x91,0x8A,0x82,0x78,0x6D,0x65,0x5E,0x58,0x55,0x50,0x50,0x56,0x5E,0x68,0x74,0x7D,0x84,0x8B,0x90,0x96,0x9A,
-0x9A,0x96,0x91,0x8D,0x87,0x85,0x83,0x81,0x7E,0x7F,0x82,0x86,0x8A,0x91,0x93,0x95,0x94,0x93,0x90,0x8C,0x86,0x7D,0x72,0x69,0x61,0x5C,
-0x58,0x53,0x52,0x55,0x5C,0x66,0x70,0x7B,0x82,0x88,0x8F,0x93,0x98,0x99,0x98,0x94,0x8F,0x89,0x86,0x82,0x81,0x80,0x80,0x80,0x83,0x87,
-0x8D,0x90,0x94,0x94,0x91,0x8F,0x8C,0x85,0x7F,0x76,0x6D,0x65,0x5E,0x59,0x56,0x55,0x57,0x5B,0x64,0x6D,0x76,0x7F,0x87,0x8C,0x91,0x94,
-0x95,0x96,0x92,0x90,0x8C,0x86,0x83,0x81,0x7E,0x7E,0x7F,0x7F,0x83,0x85,0x8A,0x8E,0x91,0x93,0x93,0x90,0x8C,0x86,0x81,0x7A,0x71,0x6A,
-0x63,0x5D,0x58,0x56,0x58,0x5C,0x64,0x6C,0x75,0x7C,0x82,0x89,0x8E,0x91,0x95,0x95,0x92,0x90,0x8B,0x87,0x83,0x81,0x80,0x7E,0x7F,0x80,
-0x83,0x85,0x88,0x8D,0x8F,0x91,0x92,0x8F,0x8B,0x86,0x80,0x79,0x72,0x6A,0x63,0x5D,0x59,0x57,0x59,0x5F,0x66,0x6E,0x74,0x7D,0x83,0x88,
-0x8E,0x92,0x93,0x94,0x92,0x8E,0x8B,0x87,0x84,0x81,0x7F,0x7E,0x7D,0x7E,0x7E,0x81,0x85,0x88,0x8B,0x8F,0x8F,0x90,0x8E,0x8B,0x86,0x81,
-0x7A,0x73,0x6C,0x66,0x60,0x5C,0x59,0x5C,0x5F,0x67,0x6F,0x76,0x7E,0x84,0x88,0x8D,0x92,0x94,0x93,0x93,0x8E,0x8A,0x85,0x83,0x80,0x7D,
-0x7E,0x7C,0x7D,0x7D,0x81,0x86,0x8A,0x8D,0x91,0x91,0x8E,0x8C,0x87,0x83,0x7D,0x76,0x6E,0x67,0x60,0x5C,0x5A,0x5B,0x60,0x67,0x6F,0x76,
-0x7D,0x83,0x87,0x8D,0x90,0x94,0x94,0x92,0x8F,0x8A,0x86,0x81,0x7F,0x7F,0x7D,0x7C,0x7C,0x7C,0x7C,0x80,0x83,0x86,0x89,0x8C,0x8D,0x8F,
-0x8D,0x8C,0x88,0x82,0x7D,0x78,0x72,0x6B,0x67,0x63,0x5F,0x5F,0x62,0x68,0x70,0x77,0x7D,0x84,0x88,0x8B,0x8F,0x90,0x93,0x91,0x8F,0x8B,
-0x87,0x82,0x7F,0x7D,0x7D,0x7C,0x7B,0x7B,0x7E,0x80,0x84,0x86,0x8C,0x90,0x8F,0x90,0x8C,0x89,0x84,0x80,0x7A,0x75,0x6E,0x67,0x62,0x5E,
-0x5E,0x63,0x6B,0x72,0x7A,0x80,0x85,0x88,0x8C,0x8F,0x93,0x93,0x92,0x8E,0x89,0x84,0x7F,0x7E,0x7C,0x7C,0x7C,0x7B,0x7A,0x7B,0x7E,0x81,
-0x83,0x87,0x88,0x88,0x88,0x87,0x85,0x88,0x8A,0x8B,0x8A,0x88,0x84,0x7F,0x7C,0x78,0x76,0x74,0x70,0x6B,0x66,0x64,0x67,0x6D,0x75,0x7F,
-0x84,0x87,0x88,0x8A,0x8C,0x8F,0x90,0x90,0x8E,0x87,0x82,0x7D,0x79,0x79,0x79,0x79,0x7A,0x7A,0x7A,0x7A,0x7F,0x82,0x86,0x89,0x89,0x88,
-0x87,0x86,0x84,0x85,0x89,0x8A,0x8C,0x8B,0x88,0x84,0x81,0x7F,0x7E,0x7E,0x7A,0x74,0x6F,0x69,0x64,0x65,0x6A,0x71,0x79,0x7F,0x81,0x84,
-0x85,0x89,0x8C,0x90,0x90,0x8E,0x88,0x83,0x7D,0x7B,0x78,0x7A,0x7A,0x79,0x78,0x78,0x7A,0x7C,0x82,0x87,0x89,0x8B,0x8A,0x8B,0x8B,0x8A,
-0x89,0x88,0x86,0x82,0x7F,0x7C,0x7B,0x79,0x7A,0x7A,0x79,0x7A,0x79,0x7B,0x7D,0x7F,0x81,0x83,0x84,0x83,0x84,0x84,0x85,0x84,0x84,0x84,
-0x81,0x81,0x80,0x80,0x80,0x7F,0x7F,0x7E,0x7B,0x79,0x77,0x73,0x72,0x6D,0x6D,0x6D,0x71,0x76,0x7C,0x80,0x82,0x85,0x87,0x88,0x8B,0x8B,
-0x8A,0x87,0x81,0x7E,0x7B,0x7A,0x79,0x79,0x77,0x78,0x79,0x7B,0x7E,0x81,0x85,0x87,0x88,0x86,0x86,0x85,0x83,0x83,0x81,0x7E,0x7C,0x79,
-0x78,0x79,0x79,0x7C,0x7D,0x7E,0x80,0x82,0x84,0x85,0x85,0x85,0x83,0x83,0x82,0x80,0x7F,0x7D,0x7B,0x7B,0x7B,0x7B,0x7C,0x7C,0x7F,0x80,
-0x81,0x81,0x83,0x84,0x84,0x82,0x82,0x81,0x80,0x7E,0x7E,0x7C,0x7D,0x7C,0x7B,0x7C,0x7D,0x7E,0x7F,0x81,0x80,0x82,0x82,0x82,0x81,0x82,
-0x81,0x81,0x80,0x7F,0x7D,0x7E,0x7D,0x7C,0x7D,0x7E,0x7D,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x81,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7D,0x7E,
-0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7E,0x7F,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7F,0x7F,0x7F,0x80,0x7F,
-0x80,0x80,0x7E,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7D,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x7E,0x7E,0x7E,
-0x7E,0x7D,0x7E,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x7E,0x7D,
-0x7E,0x7E,0x7D,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7F,
-0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,
-0x7F,0x7E,0x7E,0x7E,0x7D,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7E,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,
-0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,
-0x7F,0x7E,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,
-0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,
-0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7E,0x80,0x7F,0x7F,0x80,
-0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7E,0x80,0x7F,0x7E,0x80,0x7F,0x80,0x80,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7E,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x80,0x81,0x7F,0x80,0x81,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,
-0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,
-0x80,0x7F,0x80,0x81,0x80,0x80,0x81,0x80,0x80,0x81,0x81,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x81,0x81,0x80,0x81,0x81,0x81,0x80,0x81,
-0x81,0x81,0x81,0x80,0x81,0x80,0x81,0x81,0x81,0x80,0x80,0x83,0x83,0x80,0x8F,0x9C,0x8C,0x86,0x89,0x86,0x7D,0x77,0x76,0x7F,0x7F,0x78,
-0x7B,0x7F,0x7E,0x7E,0x78,0x78,0x80,0x81,0x7C,0x7D,0x82,0x7F,0x7E,0x7B,0x7E,0x82,0x82,0x81,0x86,0x8A,0x8C,0x8A,0x8A,0x8B,0x8B,0x89,
-0x87,0x88,0x87,0x85,0x7F,0x76,0x6F,0x6B,0x66,0x50,0x64,0x9C,0x95,0x7E,0x8E,0x97,0x88,0x70,0x5E,0x6E,0x7F,0x71,0x75,0x8A,0x99,0x9B,
-0x8D,0x7D,0x87,0x88,0x71,0x6D,0x7D,0x84,0x86,0x83,0x85,0x8E,0x8B,0x7B,0x75,0x7B,0x7C,0x79,0x77,0x7D,0x88,0x88,0x80,0x82,0x84,0x82,
-0x7D,0x7A,0x7E,0x85,0x82,0x7F,0x84,0x88,0x84,0x81,0x7E,0x80,0x81,0x7E,0x7C,0x80,0x83,0x82,0x80,0x7E,0x81,0x81,0x7D,0x7C,0x7E,0x81,
-0x80,0x81,0x81,0x83,0x83,0x7F,0x80,0x81,0x81,0x82,0x81,0x81,0x82,0x82,0x80,0x7F,0x81,0x80,0x80,0x80,0x81,0x81,0x81,0x80,0x80,0x80,
-0x7E,0x7E,0x80,0x81,0x82,0x82,0x7F,0x8D,0x95,0x80,0x7E,0x8A,0x85,0x7F,0x7D,0x80,0x8D,0x89,0x81,0x87,0x8B,0x85,0x83,0x7F,0x80,0x84,
-0x80,0x7D,0x82,0x84,0x81,0x80,0x81,0x83,0x83,0x7E,0x7F,0x81,0x82,0x80,0x81,0x82,0x83,0x82,0x7F,0x81,0x81,0x80,0x7F,0x7F,0x7F,0x81,
-0x80,0x7F,0x7F,0x80,0x7F,0x7E,0x7F,0x80,0x7F,0x7D,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7E,0x7F,0x81,0x80,0x7E,0x80,0x80,0x80,
-0x80,0x7E,0x81,0x81,0x7F,0x80,0x83,0x83,0x82,0x81,0x81,0x81,0x81,0x7F,0x7D,0x7C,0x79,0x78,0x74,0x70,0x6C,0x66,0x64,0x63,0x67,0x74,
-0x82,0x8B,0x8C,0x90,0x92,0x8A,0x80,0x80,0x85,0x8A,0x8E,0x95,0x9E,0xA0,0x9B,0x91,0x88,0x80,0x7A,0x74,0x6F,0x6A,0x61,0x56,0x56,0x3C,
-0x34,0xB2,0xCB,0x54,0x6F,0xA8,0x85,0x7B,0x59,0x58,0x93,0x7C,0x64,0x8A,0xA2,0xA8,0x9E,0x79,0x86,0x9B,0x7E,0x77,0x9B,0xA8,0x9D,0x90,
-0x91,0x9D,0x92,0x7C,0x7D,0x8D,0x8E,0x7E,0x71,0x69,0x5D,0x4C,0x45,0x4F,0x4E,0x60,0x93,0x9C,0x8D,0x92,0x8D,0x79,0x69,0x5C,0x67,0x7A,
-0x7B,0x83,0x96,0xA3,0xA0,0x92,0x89,0xA3,0xAD,0x8D,0x89,0x9C,0x9D,0x92,0x85,0x85,0x93,0x7E,0x5B,0x4F,0x4B,0x4A,0x3D,0x36,0x72,0xA6,
-0x90,0x87,0x91,0x8D,0x76,0x54,0x51,0x73,0x7F,0x78,0x82,0x9C,0xAC,0xA1,0x8B,0x88,0x8C,0x82,0x93,0xAD,0xA4,0x9D,0xA2,0x9A,0x92,0x89,
-0x81,0x80,0x76,0x60,0x51,0x48,0x49,0x49,0x3F,0x5B,0x97,0x9E,0x88,0x8E,0x8F,0x76,0x5E,0x59,0x6E,0x7B,0x75,0x82,0x9D,0xA6,0xA4,0x98,
-0x93,0xB3,0xAD,0x80,0x8B,0xA3,0x9E,0x92,0x8A,0x99,0x9F,0x81,0x62,0x51,0x49,0x45,0x3A,0x2E,0x51,0x98,0x88,0x73,0x9E,0xA1,0x80,0x68,
-0x55,0x62,0x7D,0x76,0x7F,0x9F,0xA2,0x92,0x9B,0xA7,0xB4,0xB4,0x91,0x8C,0x9E,0x93,0x8E,0x98,0x9D,0x95,0x7F,0x68,0x59,0x4C,0x47,0x48,
-0x32,0x2A,0x62,0xAB,0xB7,0x86,0x61,0x78,0x84,0x65,0x5E,0x84,0x9F,0x94,0x7D,0x7F,0xA3,0xB1,0xA5,0xA8,0x9B,0x93,0x99,0x90,0x91,0xA2,
-0xAB,0xA6,0x8E,0x74,0x6A,0x5D,0x55,0x56,0x39,0x1B,0x28,0x6D,0xC8,0xAC,0x58,0x83,0xB7,0x79,0x39,0x43,0x82,0xA2,0x77,0x6D,0xA7,0xCA,
-0xAC,0x8E,0xA0,0xB0,0x9F,0x83,0x88,0xA8,0xAB,0x93,0x91,0x9D,0x94,0x6D,0x4C,0x47,0x4D,0x40,0x2D,0x2D,0x6B,0xA1,0x8E,0x7C,0x8A,0x93,
-0x7C,0x5A,0x56,0x76,0x89,0x84,0x89,0xA1,0xB9,0xAB,0x9B,0xA8,0xA2,0x97,0x94,0x94,0x9D,0xA3,0x98,0x93,0x90,0x81,0x66,0x4B,0x40,0x3F,
-0x35,0x26,0x4A,0x8F,0x9A,0x87,0x8A,0x8F,0x84,0x69,0x53,0x65,0x80,0x87,0x8A,0x9B,0xB0,0xB8,0xB2,0xA8,0x9B,0x9A,0x98,0x94,0x99,0x9B,
-0x9F,0x99,0x8B,0x81,0x69,0x4B,0x3F,0x3A,0x2E,0x23,0x4C,0x90,0x9B,0x8C,0x8C,0x8E,0x84,0x65,0x51,0x64,0x80,0x88,0x8C,0x9F,0xB4,0xC0,
-0xB9,0xA1,0x97,0x9D,0x99,0x93,0x95,0x9F,0xA1,0x97,0x88,0x7A,0x61,0x4A,0x3D,0x34,0x28,0x28,0x5C,0x8F,0x91,0x8D,0x8F,0x8D,0x80,0x62,
-0x56,0x6B,0x81,0x89,0x92,0xA1,0xB3,0xCA,0xBB,0x9C,0x9B,0x9F,0x99,0x8F,0x8F,0x9E,0xA7,0x95,0x7E,0x6B,0x59,0x4C,0x3B,0x28,0x1C,0x3E,
-0x7F,0x8F,0x82,0x8A,0x94,0x8D,0x71,0x56,0x5F,0x79,0x85,0x8B,0x95,0xAA,0xC8,0xCA,0xA6,0x9A,0xA6,0xA4,0x93,0x88,0x91,0xA3,0x9C,0x84,
-0x6C,0x5D,0x55,0x41,0x2C,0x1B,0x33,0x6F,0x86,0x7F,0x84,0x92,0x91,0x7B,0x5D,0x5B,0x71,0x82,0x89,0x8F,0x9D,0xC0,0xCF,0xB5,0xA0,0xA3,
-0xA3,0x9B,0x8C,0x87,0x93,0x98,0x88,0x69,0x52,0x4E,0x49,0x34,0x1D,0x33,0x6D,0x86,0x7C,0x79,0x85,0x8C,0x7F,0x65,0x5C,0x6E,0x81,0x8D,
-0x8E,0x97,0xBA,0xC7,0xB0,0xA0,0xA2,0xA2,0x9D,0x92,0x88,0x87,0x8A,0x7F,0x63,0x4C,0x46,0x45,0x38,0x2B,0x40,0x6B,0x81,0x7F,0x78,0x7C,
-0x82,0x81,0x6F,0x61,0x6A,0x82,0x8F,0x90,0x9C,0xB0,0xB4,0xAA,0xA3,0x9C,0x97,0x96,0x8F,0x85,0x7F,0x7D,0x71,0x5F,0x52,0x4C,0x46,0x3E,
-0x40,0x57,0x6B,0x76,0x78,0x7B,0x7E,0x80,0x81,0x79,0x6F,0x73,0x81,0x8B,0x8F,0x9E,0xA6,0xA5,0xA8,0xA6,0x9F,0x98,0x97,0x92,0x87,0x80,
-0x7A,0x6C,0x63,0x5E,0x56,0x50,0x4D,0x56,0x68,0x72,0x74,0x78,0x7D,0x7A,0x7F,0x82,0x7C,0x7A,0x80,0x87,0x8C,0x97,0x9B,0x97,0x9D,0xA7,
-0xA6,0x9D,0x9B,0x9A,0x97,0x96,0x8C,0x82,0x7F,0x7D,0x74,0x69,0x60,0x5F,0x66,0x66,0x62,0x67,0x71,0x70,0x71,0x79,0x7B,0x78,0x7C,0x84,
-0x87,0x91,0x97,0x93,0x97,0xA4,0xA8,0xA9,0xA9,0xA8,0xA4,0xAA,0xA5,0x97,0x8C,0x87,0x7D,0x73,0x66,0x5C,0x5E,0x5F,0x57,0x53,0x5A,0x62,
-0x69,0x71,0x6F,0x70,0x7C,0x85,0x86,0x8E,0x98,0x99,0x9B,0xA5,0xAD,0xB1,0xB2,0xB0,0xAD,0xB0,0xAF,0xA0,0x92,0x89,0x7E,0x70,0x66,0x5C,
-0x5A,0x5A,0x54,0x50,0x56,0x5A,0x60,0x6D,0x6C,0x6C,0x77,0x81,0x88,0x8F,0x98,0x9B,0x9E,0xAA,0xB2,0xB1,0xB1,0xB7,0xB4,0xAE,0xAE,0xA7,
-0x97,0x8C,0x82,0x71,0x64,0x5A,0x58,0x57,0x4F,0x4F,0x57,0x5A,0x5F,0x68,0x68,0x6C,0x77,0x81,0x85,0x8E,0x97,0x99,0x9F,0xAB,0xB3,0xB5,
-0xB4,0xB5,0xB1,0xB0,0xAD,0xA4,0x95,0x8D,0x81,0x71,0x64,0x5B,0x57,0x55,0x4F,0x4B,0x52,0x5A,0x60,0x68,0x68,0x6B,0x76,0x82,0x86,0x8C,
-0x95,0x9B,0x9C,0xA7,0xB1,0xB5,0xB5,0xB4,0xB2,0xAF,0xAE,0xA3,0x94,0x89,0x80,0x70,0x60,0x58,0x58,0x55,0x4B,0x4B,0x53,0x58,0x5D,0x67,
-0x69,0x6A,0x76,0x80,0x87,0x8D,0x94,0x9B,0x9F,0xA8,0xB0,0xB1,0xB3,0xB6,0xB5,0xAE,0xAA,0xA2,0x93,0x87,0x7C,0x6C,0x5D,0x57,0x53,0x51,
-0x4C,0x4B,0x52,0x59,0x5F,0x64,0x67,0x6B,0x76,0x80,0x85,0x8D,0x94,0x9B,0xA0,0xA9,0xB2,0xB2,0xB3,0xB6,0xB1,0xAB,0xAB,0x9F,0x8F,0x85,
-0x78,0x67,0x5C,0x54,0x52,0x4D,0x4A,0x4B,0x52,0x59,0x60,0x67,0x67,0x6B,0x78,0x81,0x86,0x91,0x98,0x99,0xA2,0xB0,0xB2,0xB3,0xB6,0xB4,
-0xAF,0xAD,0xA6,0x96,0x8D,0x82,0x72,0x61,0x56,0x53,0x53,0x4A,0x46,0x4E,0x54,0x59,0x63,0x65,0x68,0x72,0x7C,0x81,0x89,0x95,0x99,0x9C,
-0xA9,0xB2,0xB3,0xB6,0xB8,0xB4,0xB0,0xAB,0xA0,0x92,0x86,0x79,0x69,0x5C,0x52,0x53,0x52,0x48,0x48,0x51,0x56,0x5E,0x66,0x64,0x69,0x78,
-0x82,0x85,0x90,0x9A,0x99,0xA3,0xB1,0xB3,0xB3,0xB7,0xB6,0xB1,0xB0,0xA6,0x98,0x8E,0x80,0x6F,0x60,0x55,0x52,0x52,0x49,0x44,0x4E,0x55,
-0x59,0x63,0x65,0x67,0x72,0x7D,0x82,0x8B,0x98,0x99,0x9E,0xAE,0xB4,0xB3,0xB7,0xBA,0xB2,0xAF,0xAC,0x9F,0x90,0x86,0x78,0x65,0x57,0x53,
-0x53,0x4C,0x45,0x49,0x53,0x57,0x60,0x66,0x65,0x6F,0x7D,0x82,0x87,0x93,0x9B,0x9E,0xA8,0xB3,0xB5,0xB6,0xB9,0xB6,0xB1,0xAD,0xA4,0x97,
-0x89,0x7C,0x6B,0x5D,0x52,0x53,0x4E,0x46,0x47,0x50,0x54,0x5C,0x64,0x65,0x68,0x77,0x81,0x85,0x8F,0x99,0x9C,0xA3,0xB2,0xB4,0xB4,0xB9,
-0xB9,0xB0,0xAD,0xA8,0x98,0x8D,0x80,0x6F,0x61,0x55,0x53,0x50,0x48,0x45,0x4D,0x53,0x58,0x61,0x65,0x66,0x72,0x7F,0x81,0x8C,0x98,0x99,
-0xA1,0xAF,0xB4,0xB3,0xB7,0xB7,0xB0,0xAE,0xA7,0x98,0x8D,0x81,0x71,0x60,0x55,0x53,0x52,0x49,0x44,0x4C,0x51,0x57,0x60,0x63,0x63,0x6E,
-0x7B,0x81,0x88,0x95,0x9A,0x9F,0xAD,0xB2,0xB3,0xB6,0xB7,0xAE,0xAA,0xA8,0x9B,0x8D,0x81,0x71,0x60,0x56,0x53,0x50,0x48,0x44,0x4A,0x51,
-0x57,0x5E,0x62,0x64,0x6E,0x7A,0x80,0x88,0x93,0x99,0x9D,0xAC,0xB3,0xB3,0xB4,0xB4,0xAF,0xAC,0xA6,0x98,0x8B,0x80,0x72,0x63,0x54,0x51,
-0x51,0x48,0x43,0x4B,0x51,0x55,0x5F,0x63,0x62,0x6F,0x7B,0x7F,0x88,0x94,0x9A,0x9D,0xAC,0xB4,0xB3,0xB4,0xB6,0xAF,0xAA,0xA4,0x97,0x89,
-0x7E,0x6F,0x5F,0x55,0x54,0x50,0x48,0x47,0x4C,0x53,0x58,0x60,0x62,0x66,0x72,0x7C,0x82,0x8B,0x98,0x9C,0xA1,0xAD,0xB5,0xB4,0xB5,0xB4,
-0xAF,0xAA,0xA5,0x96,0x87,0x7C,0x6F,0x5F,0x53,0x53,0x50,0x49,0x49,0x50,0x55,0x5A,0x62,0x65,0x68,0x76,0x80,0x84,0x8D,0x9A,0x9F,0xA5,
-0xB0,0xB6,0xB5,0xB7,0xB5,0xAD,0xA8,0xA2,0x93,0x85,0x79,0x6B,0x5C,0x53,0x55,0x50,0x48,0x4C,0x53,0x56,0x5E,0x66,0x65,0x6A,0x7A,0x81,
-0x87,0x94,0x9C,0x9E,0xAC,0xB9,0xB7,0xBA,0xBB,0xB4,0xB0,0xAB,0x9C,0x87,0x78,0x68,0x51,0x42,0x43,0x48,0x4A,0x4C,0x55,0x60,0x68,0x70,
-0x71,0x6F,0x77,0x83,0x86,0x90,0xA1,0xAB,0xB4,0xC2,0xC6,0xC3,0xC2,0xBC,0xAE,0x9F,0x8C,0x79,0x64,0x55,0x46,0x35,0x38,0x49,0x53,0x55,
-0x5F,0x69,0x70,0x73,0x72,0x72,0x78,0x82,0x89,0x96,0xA7,0xB0,0xBB,0xC4,0xC7,0xC2,0xBE,0xB3,0xA4,0x90,0x7F,0x6B,0x58,0x4A,0x3A,0x2E,
-0x38,0x4D,0x52,0x57,0x63,0x6F,0x74,0x74,0x72,0x73,0x7A,0x84,0x8C,0x9A,0xA9,0xB5,0xBF,0xC4,0xC7,0xC1,0xBB,0xAF,0x9C,0x89,0x75,0x63,
-0x52,0x45,0x39,0x2F,0x3B,0x51,0x56,0x5A,0x66,0x71,0x73,0x73,0x72,0x77,0x7F,0x89,0x95,0x9F,0xAD,0xBB,0xC0,0xC6,0xC5,0xBF,0xB6,0xA9,
-0x94,0x83,0x71,0x5F,0x4E,0x42,0x34,0x31,0x46,0x54,0x58,0x5D,0x75,0x84,0x78,0x73,0x77,0x80,0x86,0x8C,0x95,0xA3,0xB3,0xBC,0xBD,0xBF,
-0xC5,0xBD,0xAC,0x9E,0x8D,0x7B,0x6A,0x55,0x44,0x39,0x32,0x3E,0x4C,0x53,0x5D,0x6A,0x74,0x77,0x77,0x79,0x7E,0x83,0x8B,0x98,0xA2,0xAC,
-0xB7,0xBE,0xC2,0xC1,0xBD,0xB6,0xA8,0x93,0x80,0x6F,0x5D,0x4D,0x3B,0x32,0x3B,0x4C,0x54,0x5B,0x68,0x74,0x7A,0x78,0x79,0x7E,0x83,0x8C,
-0x98,0x9C,0xA9,0xB8,0xBD,0xBD,0xC0,0xBE,0xB6,0xAB,0x98,0x85,0x74,0x64,0x52,0x42,0x35,0x39,0x4A,0x52,0x57,0x64,0x72,0x78,0x78,0x78,
-0x7E,0x84,0x8D,0x97,0x9B,0xA6,0xB5,0xBA,0xBD,0xBF,0xBF,0xB9,0xAF,0x9E,0x8B,0x79,0x6A,0x58,0x47,0x38,0x36,0x47,0x4F,0x54,0x5F,0x6F,
-0x79,0x7A,0x7A,0x7D,0x85,0x8D,0x95,0x99,0x9F,0xB1,0xB7,0xB7,0xBC,0xBD,0xBA,0xB0,0xA1,0x90,0x80,0x6F,0x5D,0x4C,0x3D,0x38,0x43,0x4D,
-0x51,0x5D,0x6A,0x74,0x7A,0x78,0x7D,0x82,0x89,0x94,0x98,0x9E,0xAC,0xB5,0xB5,0xBA,0xBC,0xB9,0xB3,0xA5,0x96,0x88,0x79,0x68,0x55,0x48,
-0x3F,0x3E,0x48,0x50,0x56,0x62,0x6E,0x76,0x79,0x7D,0x81,0x88,0x91,0x97,0x99,0xA3,0xAF,0xB2,0xB3,0xB6,0xB8,0xB4,0xAA,0x9C,0x8E,0x81,
-0x73,0x65,0x55,0x4D,0x46,0x45,0x4C,0x54,0x59,0x5F,0x69,0x6F,0x75,0x79,0x80,0x89,0x8F,0x93,0x9A,0xA1,0xA8,0xAC,0xAF,0xB0,0xAE,0xA8,
-0xA1,0x94,0x87,0x7B,0x71,0x64,0x5C,0x56,0x52,0x4B,0x4C,0x53,0x58,0x5C,0x62,0x69,0x6E,0x76,0x7E,0x85,0x8B,0x93,0x99,0x9D,0xA2,0xA5,
-0xA5,0xA6,0xA4,0x9D,0x95,0x8F,0x86,0x7D,0x74,0x6B,0x66,0x60,0x5A,0x58,0x56,0x56,0x58,0x59,0x5E,0x65,0x6A,0x71,0x79,0x7F,0x84,0x89,
-0x8E,0x93,0x95,0x99,0x9B,0x99,0x98,0x94,0x8D,0x8A,0x84,0x7D,0x77,0x73,0x6D,0x69,0x66,0x66,0x61,0x61,0x60,0x5E,0x62,0x65,0x61,0x68,
-0x70,0x71,0x74,0x7E,0x7D,0x80,0x85,0x84,0x87,0x8B,0x8A,0x8C,0x85,0x84,0x86,0x81,0x81,0x7D,0x78,0x79,0x73,0x6F,0x6D,0x6D,0x6C,0x6C,
-0x6C,0x6C,0x6F,0x6E,0x6D,0x70,0x71,0x72,0x76,0x75,0x77,0x78,0x7A,0x7A,0x7C,0x7E,0x7D,0x81,0x7E,0x7C,0x81,0x83,0x7A,0x7B,0x7E,0x78,
-0x76,0x7B,0x74,0x6C,0x73,0x74,0x71,0x71,0x75,0x79,0x72,0x72,0x75,0x75,0x7A,0x77,0x74,0x7B,0x7B,0x76,0x7C,0x7D,0x7A,0x80,0x7E,0x7A,
-0x83,0x7F,0x7F,0x7F,0x7B,0x7E,0x7E,0x79,0x7D,0x7C,0x7B,0x7C,0x74,0x79,0x7B,0x77,0x7E,0x76,0x75,0x7A,0x74,0x74,0x78,0x75,0x75,0x77,
-0x76,0x7A,0x7C,0x78,0x7B,0x7A,0x7D,0x7D,0x7C,0x7F,0x7F,0x7E,0x7E,0x7E,0x7F,0x7D,0x7E,0x7F,0x7F,0x79,0x7C,0x82,0x82,0x81,0x81,0x7E,
-0x7D,0x7E,0x81,0x80,0x82,0x80,0x7A,0x76,0x7B,0x82,0x80,0x80,0x85,0x83,0x82,0x85,0x7F,0x7F,0x81,0x7F,0x80,0x7C,0x7C,0x82,0x7C,0x7A,
-0x7F,0x81,0x79,0x7B,0x7F,0x81,0x83,0x82,0x83,0x7E,0x7B,0x7E,0x80,0x7F,0x82,0x81,0x80,0x81,0x86,0x86,0x84,0x85,0x83,0x85,0x82,0x7F,
-0x80,0x81,0x81,0x81,0x80,0x82,0x81,0x80,0x83,0x81,0x7E,0x7F,0x84,0x8A,0x87,0x86,0x89,0x87,0x87,0x89,0x8B,0x8B,0x8C,0x8D,0x8A,0x8B,
-0x88,0x8C,0x8E,0x8A,0x89,0x86,0x88,0x88,0x85,0x87,0x85,0x88,0x87,0x80,0x82,0x84,0x82,0x83,0x83,0x86,0x85,0x83,0x86,0x82,0x83,0x84,
-0x7E,0x80,0x88,0x82,0x82,0x83,0x81,0x83,0x81,0x82,0x86,0x82,0x80,0x85,0x82,0x80,0x86,0x87,0x86,0x83,0x82,0x86,0x86,0x85,0x85,0x84,
-0x83,0x88,0x85,0x89,0x85,0x82,0x83,0x83,0x83,0x84,0x8A,0x89,0x89,0x87,0x85,0x86,0x84,0x84,0x83,0x87,0x86,0x83,0x84,0x81,0x7F,0x82,
-0x84,0x81,0x86,0x8A,0x83,0x81,0x85,0x87,0x83,0x7F,0x86,0x89,0x85,0x84,0x86,0x89,0x85,0x87,0x86,0x84,0x85,0x87,0x83,0x81,0x86,0x85,
-0x82,0x82,0x83,0x84,0x81,0x81,0x88,0x86,0x86,0x89,0x83,0x87,0x87,0x83,0x87,0x84,0x80,0x83,0x85,0x7F,0x7F,0x84,0x83,0x82,0x85,0x84,
-0x83,0x86,0x82,0x81,0x85,0x80,0x80,0x84,0x84,0x84,0x83,0x86,0x83,0x7F,0x81,0x84,0x83,0x81,0x84,0x84,0x80,0x7F,0x80,0x82,0x84,0x82,
-0x83,0x81,0x84,0x84,0x82,0x88,0x85,0x82,0x84,0x83,0x83,0x83,0x82,0x86,0x86,0x84,0x86,0x87,0x84,0x86,0x81,0x83,0x86,0x84,0x85,0x82,
-0x7E,0x83,0x82,0x82,0x81,0x80,0x84,0x82,0x81,0x84,0x83,0x83,0x86,0x85,0x81,0x83,0x84,0x84,0x85,0x85,0x87,0x85,0x81,0x82,0x87,0x85,
-0x80,0x82,0x84,0x82,0x7F,0x7E,0x7F,0x81,0x82,0x81,0x7E,0x7E,0x80,0x82,0x7F,0x7E,0x7E,0x7D,0x82,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x83,
-0x81,0x80,0x7F,0x82,0x81,0x82,0x81,0x81,0x83,0x82,0x80,0x80,0x80,0x7E,0x7C,0x7D,0x7F,0x82,0x82,0x7F,0x81,0x7D,0x7E,0x7F,0x7E,0x7D,
-0x7E,0x81,0x7C,0x7F,0x82,0x80,0x80,0x80,0x7D,0x7D,0x7E,0x7D,0x7E,0x7F,0x7E,0x81,0x80,0x7F,0x83,0x80,0x7B,0x7F,0x81,0x7D,0x7E,0x7E,
-0x81,0x81,0x7E,0x81,0x81,0x81,0x7E,0x80,0x7E,0x7D,0x80,0x7F,0x7E,0x83,0x7F,0x7F,0x81,0x82,0x80,0x7F,0x80,0x80,0x7F,0x7D,0x7C,0x7E,
-0x7E,0x7C,0x7E,0x7D,0x7F,0x7F,0x7D,0x80,0x82,0x7F,0x80,0x81,0x7E,0x7B,0x7E,0x80,0x7F,0x7F,0x7E,0x80,0x81,0x83,0x83,0x84,0x81,0x7F,
-0x7F,0x7E,0x81,0x80,0x7F,0x82,0x81,0x7F,0x81,0x81,0x7F,0x7C,0x81,0x7D,0x7D,0x7F,0x7E,0x7B,0x81,0x81,0x7F,0x83,0x80,0x7F,0x7E,0x80,
-0x7F,0x80,0x81,0x7E,0x7F,0x7E,0x7E,0x80,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7C,0x7E,0x7F,0x7C,0x7D,0x80,0x7F,0x7D,0x7D,0x7F,0x7E,0x7D,
-0x7F,0x7F,0x81,0x80,0x7D,0x7E,0x82,0x80,0x7F,0x81,0x80,0x7E,0x7F,0x80,0x7E,0x80,0x80,0x80,0x7E,0x7D,0x7D,0x7E,0x7E,0x7F,0x7D,0x7D,
-0x80,0x81,0x82,0x7E,0x80,0x7F,0x80,0x80,0x7E,0x7F,0x81,0x80,0x7E,0x80,0x81,0x7E,0x80,0x81,0x81,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,
-0x7F,0x7E,0x7F,0x80,0x7D,0x82,0x82,0x7F,0x80,0x81,0x7F,0x81,0x80,0x7F,0x81,0x83,0x80,0x7F,0x81,0x81,0x7F,0x80,0x82,0x7D,0x7F,0x82,
-0x7D,0x7C,0x83,0x7E,0x7E,0x7F,0x7E,0x7F,0x81,0x80,0x82,0x7F,0x7E,0x7F,0x7C,0x7D,0x80,0x7E,0x7C,0x7D,0x80,0x7E,0x81,0x7E,0x7E,0x80,
-0x7F,0x7D,0x7D,0x7E,0x7E,0x7F,0x7E,0x7C,0x7D,0x7B,0x7D,0x7E,0x7F,0x7C,0x7F,0x7D,0x7E,0x7D,0x7C,0x7E,0x7E,0x7B,0x7D,0x7D,0x7F,0x7B,
-0x7E,0x7D,0x7E,0x7E,0x7C,0x7D,0x7D,0x7D,0x7C,0x7D,0x7C,0x7C,0x7C,0x7C,0x7E,0x7E,0x7C,0x7B,0x7B,0x7B,0x7A,0x7C,0x7D,0x79,0x7C,0x7C,
-0x7D,0x7A,0x7B,0x7D,0x7C,0x7B,0x7B,0x7D,0x7F,0x7D,0x7D,0x7D,0x7D,0x7E,0x7D,0x7F,0x7F,0x7D,0x7F,0x7D,0x7F,0x7C,0x7F,0x7E,0x7B,0x7F,
-0x7C,0x7E,0x7D,0x7F,0x7F,0x7D,0x7F,0x7D,0x7F,0x7F,0x7C,0x7F,0x7E,0x7D,0x82,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7E,0x80,0x7F,0x80,0x7E,
-0x7F,0x80,0x7F,0x81,0x80,0x80,0x81,0x7E,0x81,0x80,0x81,0x80,0x81,0x81,0x7F,0x81,0x7F,0x80,0x82,0x80,0x82,0x82,0x81,0x82,0x81,0x82,
-0x81,0x82,0x82,0x83,0x83,0x82,0x83,0x82,0x81,0x82,0x81,0x83,0x81,0x82,0x81,0x81,0x83,0x81,0x82,0x82,0x81,0x82,0x82,0x82,0x82,0x82,
-0x83,0x83,0x82,0x83,0x83,0x82,0x82,0x83,0x82,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x84,0x84,0x82,0x83,0x84,0x82,0x83,0x84,0x83,0x83,
-0x84,0x83,0x84,0x83,0x83,0x84,0x82,0x84,0x84,0x84,0x83,0x83,0x83,0x83,0x83,0x82,0x83,0x82,0x83,0x83,0x83,0x83,0x82,0x83,0x83,0x83,
-0x82,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x82,0x82,0x83,0x83,0x83,0x83,0x82,0x83,0x82,0x83,0x82,0x83,0x82,0x83,0x83,0x83,0x82,
-0x83,0x83,0x82,0x83,0x83,0x82,0x81,0x83,0x82,0x82,0x82,0x81,0x81,0x82,0x82,0x82,0x82,0x82,0x81,0x82,0x81,0x82,0x81,0x82,0x82,0x82,
-0x82,0x81,0x81,0x80,0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x81,0x80,0x81,0x81,0x81,0x81,0x7F,0x81,0x80,0x80,0x81,0x80,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7E,0x80,0x80,0x7F,0x7F,0x80,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,
-0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,
-0x7E,0x7D,0x7E,0x7D,0x7E,0x7C,0x7D,0x7C,0x7D,0x7C,0x7E,0x7E,0x7E,0x7E,0x7D,0x7D,0x7E,0x7E,0x7D,0x7E,0x7D,0x7C,0x7D,0x7E,0x7C,0x7D,
-0x7E,0x7E,0x7C,0x7D,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,
-0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,
-0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7D,
-0x7E,0x7D,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,
-0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,
-0x7E,0x7D,0x7E,0x7D,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,
-0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,
-0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7D,
-0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7D,0x7E,0x7E,0x7D,0x7D,0x7E,0x7D,0x7E,0x7F,0x7F,0x7D,0x7E,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7F,
-0x7F,0x7E,0x7D,0x7F,0x7F,0x7D,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,
-0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,
-0x7E,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7E,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,
-0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,
-0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x81,0x84,
-0x83,0x82,0x81,0x82,0x82,0x80,0x81,0x80,0x81,0x81,0x83,0x85,0x82,0x88,0x89,0x88,0x8B,0x87,0x85,0x87,0x85,0x86,0x84,0x83,0x85,0x83,
-0x83,0x89,0x87,0x82,0x85,0x86,0x81,0x7E,0x7D,0x7C,0x7B,0x76,0x77,0x77,0x73,0x71,0x70,0x6E,0x6B,0x68,0x68,0x67,0x65,0x66,0x65,0x66,
-0x64,0x63,0x64,0x5F,0x60,0x63,0x61,0x5F,0x62,0x61,0x5B,0x5B,0x5D,0x5A,0x5A,0x5B,0x5C,0x5D,0x55,0x5A,0x5E,0x57,0x5F,0x61,0x55,0x60,
-0x69,0x5F,0x5F,0x6E,0x6A,0x5F,0x68,0x75,0x71,0x64,0x72,0x79,0x70,0x66,0x6D,0x7C,0x75,0x66,0x73,0x7F,0x75,0x77,0x77,0x7E,0x82,0x77,
-0x7D,0x8A,0x88,0x77,0x83,0x92,0x81,0x7D,0x91,0x8A,0x77,0x85,0x8B,0x86,0x82,0x8C,0x94,0x87,0x83,0x8F,0x91,0x89,0x8E,0x91,0x8D,0x93,
-0x8F,0x88,0x95,0x97,0x88,0x97,0x9A,0x8F,0x94,0x9B,0x8A,0x90,0x9B,0x8D,0x92,0x96,0x94,0x96,0x91,0x8C,0x99,0x90,0x8C,0x97,0x95,0x8D,
-0x8D,0x92,0x92,0x8D,0x86,0x92,0x91,0x7E,0x87,0x93,0x88,0x89,0x90,0x8A,0x8C,0x8A,0x8A,0x8F,0x87,0x8C,0x90,0x86,0x89,0x8E,0x86,0x86,
-0x8C,0x8A,0x87,0x8F,0x8C,0x85,0x8E,0x90,0x8C,0x8C,0x88,0x83,0x83,0x82,0x86,0x84,0x7C,0x88,0x8C,0x7F,0x85,0x8B,0x81,0x86,0x87,0x83,
-0x88,0x84,0x80,0x8A,0x87,0x80,0x8C,0x8D,0x86,0x91,0x8F,0x8D,0x8D,0x85,0x8E,0x8D,0x82,0x8A,0x8D,0x82,0x87,0x86,0x85,0x85,0x83,0x88,
-0x85,0x88,0x90,0x89,0x8C,0x90,0x8B,0x8B,0x8B,0x8D,0x90,0x88,0x8C,0x89,0x84,0x89,0x88,0x85,0x88,0x88,0x8A,0x8A,0x88,0x8E,0x8D,0x8D,
-0x93,0x8D,0x90,0x8F,0x88,0x89,0x8C,0x8A,0x88,0x86,0x89,0x86,0x87,0x8B,0x8A,0x88,0x8A,0x8E,0x88,0x8A,0x8A,0x89,0x8B,0x89,0x89,0x8C,
-0x88,0x8A,0x85,0x83,0x8A,0x85,0x83,0x87,0x85,0x84,0x89,0x86,0x88,0x8A,0x88,0x8A,0x87,0x85,0x89,0x8A,0x85,0x89,0x8D,0x8A,0x89,0x8C,
-0x86,0x88,0x89,0x84,0x88,0x87,0x85,0x87,0x85,0x84,0x84,0x81,0x81,0x7E,0x7A,0x7C,0x76,0x75,0x76,0x72,0x74,0x78,0x75,0x75,0x7A,0x79,
-0x79,0x80,0x82,0x80,0x84,0x8A,0x88,0x8D,0x92,0x92,0x95,0x99,0x98,0x98,0x99,0x99,0x95,0x93,0x93,0x8C,0x87,0x84,0x7E,0x77,0x72,0x6E,
-0x64,0x60,0x5C,0x54,0x54,0x50,0x4B,0x53,0x5A,0x5A,0x67,0x73,0x79,0x86,0x91,0x9B,0xA1,0xAA,0xB0,0xAF,0xB1,0xB1,0xAD,0xA9,0xA4,0x9F,
-0x99,0x95,0x8F,0x89,0x84,0x7C,0x76,0x74,0x69,0x61,0x5C,0x50,0x42,0x43,0x46,0x37,0x45,0x53,0x4D,0x62,0x73,0x77,0x89,0x97,0x9F,0xA6,
-0xAD,0xB3,0xAE,0xB2,0xB5,0xA8,0xAB,0xA6,0xA0,0x9E,0x9B,0x9A,0x95,0x94,0x94,0x8B,0x88,0x7C,0x71,0x6B,0x5A,0x4B,0x42,0x41,0x37,0x33,
-0x41,0x42,0x4C,0x5D,0x67,0x77,0x84,0x93,0x9E,0xA3,0xB1,0xB0,0xB2,0xB5,0xB1,0xAC,0xAB,0xA8,0xA0,0x9D,0x9E,0x97,0x96,0x99,0x93,0x90,
-0x8C,0x82,0x7A,0x6E,0x62,0x53,0x40,0x40,0x3A,0x2F,0x3B,0x3E,0x45,0x54,0x5F,0x73,0x7A,0x8E,0x9C,0x9F,0xAE,0xB0,0xB1,0xB3,0xB1,0xB0,
-0xA5,0xA8,0xA1,0x97,0x9E,0x95,0x93,0x96,0x93,0x92,0x8D,0x8A,0x7F,0x73,0x6C,0x5C,0x4A,0x40,0x41,0x33,0x31,0x40,0x3C,0x48,0x5A,0x65,
-0x72,0x82,0x94,0x9C,0xA3,0xB1,0xAF,0xB0,0xB4,0xAD,0xAB,0xA7,0x9E,0x9F,0x99,0x94,0x98,0x93,0x93,0x94,0x93,0x90,0x8A,0x83,0x78,0x6C,
-0x61,0x4F,0x41,0x46,0x37,0x33,0x44,0x3C,0x4B,0x59,0x62,0x73,0x7F,0x91,0x99,0xA1,0xAF,0xAC,0xAF,0xB2,0xAA,0xA7,0xA5,0x9F,0x96,0x9C,
-0x93,0x90,0x96,0x92,0x91,0x94,0x91,0x8B,0x85,0x7D,0x70,0x65,0x57,0x45,0x46,0x3D,0x33,0x40,0x3F,0x46,0x54,0x5F,0x6C,0x77,0x8A,0x93,
-0x9B,0xA9,0xAB,0xAC,0xAF,0xAD,0xA7,0xA3,0xA2,0x9A,0x95,0x99,0x91,0x92,0x92,0x91,0x90,0x90,0x8E,0x86,0x80,0x77,0x6B,0x5F,0x52,0x45,
-0x45,0x39,0x39,0x41,0x41,0x4C,0x54,0x64,0x6E,0x7B,0x8B,0x93,0x9C,0xA7,0xA8,0xAA,0xAC,0xA7,0xA3,0x9F,0x9B,0x97,0x93,0x90,0x92,0x8E,
-0x8F,0x90,0x8F,0x8F,0x8E,0x8A,0x82,0x79,0x72,0x64,0x55,0x4A,0x48,0x3E,0x38,0x42,0x41,0x46,0x55,0x60,0x68,0x77,0x85,0x8E,0x96,0xA3,
-0xA5,0xA7,0xAA,0xA8,0xA1,0xA1,0x9D,0x97,0x95,0x93,0x8F,0x8F,0x8F,0x8E,0x8D,0x8F,0x8C,0x87,0x84,0x7B,0x72,0x69,0x5B,0x4A,0x49,0x45,
-0x36,0x42,0x43,0x44,0x50,0x5A,0x65,0x6F,0x81,0x88,0x92,0x9E,0xA2,0xA6,0xA7,0xA9,0xA4,0x9F,0xA0,0x99,0x95,0x95,0x91,0x90,0x90,0x8F,
-0x8D,0x90,0x8D,0x8B,0x89,0x81,0x79,0x71,0x66,0x56,0x4A,0x4C,0x41,0x39,0x46,0x42,0x48,0x54,0x5E,0x67,0x75,0x83,0x89,0x94,0xA0,0xA1,
-0xA5,0xA7,0xA6,0xA3,0xA1,0x9E,0x9A,0x97,0x96,0x93,0x92,0x92,0x91,0x90,0x90,0x8F,0x8B,0x88,0x80,0x77,0x6E,0x62,0x53,0x4B,0x4A,0x3C,
-0x3F,0x45,0x41,0x4E,0x56,0x60,0x6A,0x78,0x84,0x8A,0x97,0x9F,0xA0,0xA7,0xA7,0xA5,0xA3,0xA1,0x9A,0x9B,0x99,0x93,0x94,0x92,0x91,0x90,
-0x91,0x8F,0x8F,0x8C,0x87,0x80,0x78,0x6E,0x64,0x53,0x4F,0x4D,0x3E,0x43,0x47,0x46,0x4F,0x59,0x61,0x69,0x7B,0x83,0x89,0x98,0x9C,0xA0,
-0xA6,0xA8,0xA5,0xA2,0xA4,0x9C,0x9B,0x99,0x95,0x96,0x93,0x92,0x91,0x93,0x91,0x8D,0x8F,0x89,0x81,0x7A,0x72,0x66,0x5A,0x51,0x4E,0x46,
-0x42,0x49,0x46,0x4D,0x57,0x5E,0x68,0x74,0x7E,0x86,0x91,0x9A,0x9C,0xA3,0xA5,0xA4,0xA4,0xA3,0x9D,0x9A,0x9D,0x95,0x93,0x97,0x90,0x91,
-0x91,0x90,0x8E,0x8D,0x8B,0x82,0x7D,0x77,0x6C,0x61,0x57,0x53,0x4C,0x44,0x4B,0x49,0x4C,0x55,0x5C,0x65,0x6D,0x7C,0x82,0x8C,0x97,0x9A,
-0xA0,0xA4,0xA5,0xA3,0xA3,0xA1,0x9B,0x9A,0x98,0x95,0x91,0x93,0x91,0x8E,0x90,0x8F,0x8D,0x8C,0x8A,0x83,0x7B,0x78,0x6B,0x61,0x58,0x54,
-0x4E,0x45,0x50,0x4A,0x4E,0x58,0x5E,0x66,0x70,0x7C,0x82,0x8D,0x97,0x98,0xA0,0xA3,0xA3,0xA2,0xA2,0xA0,0x9B,0x9A,0x95,0x94,0x90,0x91,
-0x90,0x8F,0x91,0x8E,0x8E,0x8C,0x89,0x84,0x7D,0x78,0x6D,0x63,0x5B,0x57,0x4E,0x4B,0x4F,0x4D,0x50,0x5A,0x60,0x67,0x72,0x7D,0x83,0x8D,
-0x96,0x99,0x9F,0xA3,0xA2,0xA1,0xA3,0x9E,0x9B,0x9A,0x94,0x93,0x92,0x8F,0x90,0x90,0x8E,0x8F,0x8E,0x8D,0x89,0x85,0x7D,0x77,0x70,0x63,
-0x5B,0x5B,0x51,0x4D,0x53,0x50,0x54,0x5C,0x63,0x68,0x73,0x7E,0x83,0x8C,0x96,0x98,0x9D,0xA2,0xA1,0xA0,0xA1,0x9F,0x9B,0x99,0x95,0x91,
-0x93,0x90,0x8F,0x91,0x91,0x8E,0x90,0x8F,0x8B,0x88,0x82,0x7C,0x75,0x6A,0x60,0x5F,0x56,0x50,0x57,0x52,0x56,0x5D,0x63,0x68,0x72,0x7D,
-0x80,0x8C,0x94,0x95,0x9B,0xA1,0xA0,0xA0,0xA1,0x9E,0x9B,0x9B,0x94,0x92,0x95,0x90,0x8F,0x93,0x8E,0x8F,0x8F,0x8E,0x89,0x89,0x83,0x7B,
-0x76,0x6D,0x62,0x5E,0x5C,0x51,0x55,0x57,0x55,0x5B,0x62,0x67,0x6E,0x79,0x7F,0x83,0x8F,0x93,0x96,0x9B,0x9D,0x9D,0x9E,0x9D,0x99,0x97,
-0x94,0x91,0x8F,0x8F,0x8D,0x8C,0x8F,0x8D,0x8C,0x8D,0x8B,0x88,0x84,0x80,0x76,0x72,0x69,0x5F,0x60,0x57,0x53,0x59,0x57,0x58,0x5F,0x66,
-0x6A,0x73,0x7C,0x80,0x87,0x91,0x93,0x97,0x9C,0x9C,0x9A,0x9D,0x9A,0x95,0x96,0x93,0x8F,0x90,0x8E,0x8B,0x8F,0x8D,0x8B,0x8D,0x8B,0x88,
-0x86,0x81,0x7B,0x74,0x6D,0x64,0x5F,0x5E,0x54,0x57,0x58,0x58,0x5C,0x63,0x68,0x6E,0x77,0x7E,0x82,0x8C,0x91,0x92,0x97,0x9A,0x99,0x99,
-0x9A,0x96,0x94,0x93,0x8F,0x8D,0x8E,0x8B,0x8C,0x8C,0x8D,0x8C,0x8A,0x8A,0x88,0x83,0x80,0x7A,0x72,0x6C,0x63,0x60,0x5C,0x56,0x5A,0x58,
-0x5A,0x60,0x64,0x6B,0x70,0x7A,0x7D,0x85,0x8C,0x8F,0x94,0x97,0x98,0x97,0x98,0x97,0x94,0x92,0x91,0x8E,0x8B,0x8E,0x8A,0x89,0x8E,0x8A,
-0x8B,0x8A,0x89,0x87,0x83,0x7F,0x78,0x71,0x6A,0x61,0x62,0x5A,0x57,0x5B,0x5A,0x5C,0x62,0x68,0x6C,0x74,0x7C,0x7E,0x87,0x8D,0x90,0x94,
-0x98,0x97,0x97,0x98,0x97,0x93,0x93,0x91,0x8D,0x8D,0x8D,0x89,0x8B,0x8C,0x88,0x8B,0x8A,0x88,0x85,0x83,0x7D,0x78,0x70,0x68,0x63,0x62,
-0x5A,0x5B,0x5C,0x5C,0x60,0x66,0x6A,0x6F,0x78,0x7D,0x82,0x8A,0x8D,0x91,0x95,0x97,0x98,0x98,0x99,0x96,0x93,0x93,0x90,0x8C,0x8D,0x8E,
-0x8A,0x8B,0x8D,0x89,0x8B,0x8C,0x88,0x87,0x84,0x7E,0x79,0x71,0x69,0x65,0x64,0x5B,0x5D,0x5E,0x5E,0x63,0x68,0x6C,0x72,0x7A,0x7F,0x84,
-0x8C,0x8F,0x92,0x97,0x99,0x99,0x98,0x99,0x96,0x93,0x94,0x8F,0x8D,0x91,0x8D,0x8A,0x8F,0x8C,0x8A,0x8D,0x8B,0x87,0x86,0x82,0x7A,0x76,
-0x70,0x66,0x65,0x62,0x5B,0x5F,0x60,0x5F,0x65,0x6B,0x6F,0x75,0x7D,0x82,0x86,0x8D,0x90,0x93,0x97,0x98,0x96,0x97,0x96,0x93,0x92,0x91,
-0x8D,0x89,0x8D,0x8B,0x88,0x8C,0x8B,0x88,0x8D,0x89,0x87,0x85,0x81,0x7A,0x75,0x6F,0x65,0x66,0x61,0x5D,0x62,0x60,0x62,0x69,0x6C,0x71,
-0x78,0x80,0x84,0x88,0x90,0x90,0x95,0x98,0x98,0x97,0x97,0x96,0x92,0x91,0x91,0x8D,0x8A,0x8C,0x8B,0x89,0x8B,0x8C,0x89,0x8C,0x8A,0x87,
-0x84,0x80,0x7B,0x73,0x6D,0x69,0x66,0x5F,0x60,0x61,0x5F,0x65,0x69,0x6D,0x73,0x79,0x7F,0x84,0x8A,0x8F,0x90,0x95,0x97,0x95,0x97,0x96,
-0x93,0x90,0x8F,0x8D,0x8A,0x8A,0x89,0x87,0x8A,0x8A,0x88,0x8B,0x8A,0x88,0x86,0x82,0x7D,0x77,0x71,0x6A,0x68,0x66,0x5F,0x62,0x63,0x62,
-0x69,0x6C,0x70,0x76,0x7C,0x82,0x87,0x8C,0x90,0x91,0x95,0x96,0x95,0x95,0x95,0x92,0x91,0x8F,0x8B,0x8A,0x8D,0x89,0x87,0x8D,0x89,0x89,
-0x8B,0x88,0x85,0x83,0x7E,0x79,0x71,0x6C,0x69,0x64,0x60,0x63,0x62,0x63,0x67,0x6C,0x70,0x77,0x7C,0x82,0x87,0x8C,0x91,0x91,0x96,0x97,
-0x94,0x96,0x95,0x91,0x8F,0x8F,0x8C,0x89,0x8B,0x8A,0x85,0x8C,0x8B,0x86,0x8B,0x89,0x83,0x83,0x7E,0x76,0x73,0x6B,0x66,0x66,0x61,0x5F,
-0x65,0x63,0x64,0x6F,0x71,0x74,0x7D,0x82,0x86,0x8A,0x8E,0x90,0x92,0x92,0x94,0x93,0x91,0x90,0x8D,0x8C,0x8B,0x89,0x87,0x87,0x88,0x87,
-0x86,0x87,0x85,0x82,0x80,0x7D,0x75,0x73,0x6D,0x66,0x67,0x64,0x5F,0x63,0x66,0x64,0x6A,0x71,0x71,0x76,0x81,0x82,0x85,0x8B,0x8C,0x8C,
-0x8F,0x8F,0x8E,0x8B,0x8B,0x8A,0x87,0x85,0x86,0x86,0x83,0x85,0x86,0x82,0x83,0x85,0x80,0x7E,0x7C,0x76,0x72,0x6E,0x67,0x62,0x63,0x5F,
-0x5D,0x61,0x64,0x64,0x6A,0x70,0x72,0x77,0x7E,0x7F,0x81,0x85,0x87,0x86,0x87,0x86,0x84,0x85,0x86,0x85,0x82,0x84,0x84,0x80,0x81,0x82,
-0x81,0x80,0x80,0x7C,0x78,0x78,0x72,0x6C,0x6B,0x6D,0x66,0x61,0x65,0x65,0x61,0x67,0x6C,0x6B,0x6F,0x74,0x79,0x7A,0x7D,0x7F,0x83,0x82,
-0x83,0x87,0x84,0x86,0x8B,0x87,0x85,0x8A,0x8A,0x84,0x83,0x85,0x84,0x80,0x81,0x81,0x79,0x7C,0x7D,0x76,0x75,0x77,0x74,0x70,0x70,0x72,
-0x72,0x6F,0x71,0x74,0x73,0x76,0x77,0x7C,0x7E,0x7F,0x84,0x84,0x84,0x87,0x89,0x87,0x88,0x89,0x89,0x89,0x89,0x8A,0x88,0x87,0x88,0x86,
-0x87,0x85,0x80,0x81,0x82,0x7B,0x7A,0x79,0x78,0x77,0x76,0x74,0x72,0x77,0x76,0x74,0x79,0x7B,0x79,0x7B,0x7D,0x7E,0x81,0x7F,0x80,0x84,
-0x82,0x81,0x86,0x87,0x87,0x87,0x86,0x87,0x86,0x86,0x85,0x84,0x84,0x80,0x81,0x83,0x80,0x7F,0x7E,0x7D,0x81,0x7B,0x7B,0x7D,0x7A,0x7E,
-0x7F,0x7C,0x7D,0x81,0x82,0x81,0x80,0x80,0x83,0x82,0x82,0x80,0x82,0x86,0x83,0x85,0x86,0x84,0x86,0x86,0x87,0x88,0x86,0x86,0x89,0x87,
-0x84,0x85,0x86,0x81,0x85,0x85,0x7E,0x84,0x84,0x83,0x83,0x82,0x83,0x83,0x81,0x82,0x84,0x83,0x83,0x83,0x84,0x83,0x85,0x83,0x86,0x87,
-0x82,0x82,0x84,0x83,0x85,0x82,0x84,0x86,0x85,0x84,0x83,0x83,0x85,0x85,0x82,0x82,0x81,0x84,0x86,0x81,0x81,0x86,0x83,0x83,0x86,0x82,
-0x82,0x88,0x82,0x7F,0x87,0x84,0x83,0x85,0x82,0x83,0x88,0x83,0x85,0x87,0x84,0x84,0x87,0x83,0x86,0x83,0x80,0x86,0x83,0x83,0x83,0x7F,
-0x83,0x86,0x83,0x81,0x81,0x88,0x86,0x80,0x83,0x82,0x83,0x84,0x81,0x83,0x83,0x82,0x84,0x81,0x83,0x82,0x82,0x83,0x81,0x82,0x83,0x83,
-0x82,0x81,0x80,0x85,0x82,0x80,0x82,0x82,0x81,0x82,0x82,0x80,0x81,0x81,0x80,0x83,0x83,0x82,0x82,0x82,0x85,0x85,0x80,0x81,0x83,0x80,
-0x82,0x83,0x80,0x81,0x83,0x82,0x84,0x83,0x84,0x84,0x83,0x86,0x83,0x7F,0x85,0x89,0x85,0x82,0x85,0x85,0x83,0x81,0x83,0x85,0x84,0x82,
-0x85,0x85,0x83,0x84,0x84,0x86,0x83,0x82,0x86,0x82,0x84,0x83,0x80,0x83,0x83,0x7F,0x81,0x83,0x82,0x81,0x82,0x82,0x84,0x85,0x81,0x82,
-0x83,0x83,0x84,0x83,0x81,0x84,0x85,0x82,0x84,0x85,0x84,0x83,0x84,0x83,0x83,0x83,0x83,0x85,0x84,0x84,0x84,0x83,0x83,0x84,0x82,0x83,
-0x83,0x84,0x82,0x83,0x83,0x83,0x82,0x83,0x82,0x83,0x83,0x82,0x83,0x85,0x83,0x84,0x84,0x81,0x84,0x82,0x81,0x82,0x81,0x82,0x84,0x80,
-0x82,0x83,0x83,0x82,0x82,0x83,0x83,0x81,0x82,0x84,0x82,0x83,0x81,0x81,0x82,0x82,0x83,0x80,0x80,0x83,0x81,0x80,0x80,0x81,0x82,0x80,
-0x81,0x82,0x82,0x81,0x82,0x82,0x80,0x81,0x82,0x81,0x81,0x82,0x80,0x82,0x83,0x83,0x81,0x82,0x80,0x81,0x81,0x80,0x81,0x82,0x81,0x82,
-0x82,0x82,0x80,0x82,0x82,0x81,0x80,0x81,0x80,0x81,0x80,0x82,0x81,0x81,0x81,0x82,0x81,0x80,0x83,0x80,0x80,0x82,0x82,0x80,0x81,0x81,
-0x82,0x7F,0x81,0x81,0x80,0x80,0x81,0x81,0x81,0x80,0x82,0x80,0x81,0x81,0x7F,0x81,0x81,0x7F,0x81,0x80,0x81,0x7F,0x80,0x81,0x80,0x80,
-0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x7E,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x7F,0x7E,
-0x80,0x7F,0x80,0x81,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7E,0x7F,0x7E,0x7E,0x80,0x7F,0x7F,0x80,0x7E,
-0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7F,0x7D,0x7E,0x7E,
-0x7D,0x7F,0x7D,0x7E,0x7F,0x7E,0x7E,0x7D,0x7E,0x7F,0x7D,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7F,0x7D,0x7E,0x7F,0x7E,0x7E,0x7E,0x7E,0x7F,
-0x7E,0x7F,0x7E,0x7F,0x7D,0x7F,0x7F,0x7E,0x7E,0x7E,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7E,0x7F,0x7F,0x7F,
-0x7F,0x7E,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7E,0x7E,0x7F,0x7F,0x7E,0x7E,0x7F,0x7F,0x80,0x7E,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x80,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x80,0x7F,0x7E,0x80,0x7F,0x7F,0x7E,0x7F,
-0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x80,0x7E,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x80,0x7E,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7E,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,
-0x7F,0x7E,0x7F,0x80,0x80,0x7F,0x7E,0x7E,0x80,0x7F,0x80,0x80,0x7F,0x7E,0x7F,0x7F,0x80,0x7F,0x7E,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,
-0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,
-0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x81,0x80,0x80,0x81,0x80,0x81,0x81,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x81,
-0x7F,0x81,0x81,0x81,0x81,0x7F,0x80,0x81,0x81,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x81,0x80,0x7F,0x81,0x80,0x80,0x80,0x81,
-0x80,0x80,0x81,0x81,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x80,0x81,0x7F,0x7F,0x81,0x81,0x80,0x7F,
-0x81,0x80,0x80,0x80,0x80,0x7F,0x80,0x81,0x7F,0x80,0x80,0x80,0x7F,0x81,0x80,0x80,0x81,0x81,0x80,0x80,0x7F,0x80,0x80,0x7F,0x81,0x7F,
-0x80,0x80,0x81,0x7F,0x80,0x81,0x7F,0x80,0x7E,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x81,0x80,0x80,0x7F,0x7E,0x80,0x7F,0x80,
-0x80,0x7E,0x80,0x80,0x7E,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7E,0x7F,0x7F,0x80,0x7E,0x7E,0x80,0x7F,0x7F,0x80,0x7E,0x7F,0x80,
-0x80,0x7F,0x80,0x7F,0x7E,0x80,0x7F,0x7F,0x7F,0x7F,0x81,0x7F,0x7D,0x80,0x80,0x7E,0x80,0x7F,0x80,0x7F,0x80,0x7E,0x7F,0x7F,0x7F,0x7D,
-0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7E,0x7F,0x7F,0x7F,0x80,0x7E,0x7F,0x80,0x7E,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,
-0x80,0x7E,0x7E,0x80,0x80,0x7E,0x80,0x7F,0x7D,0x82,0x81,0x80,0x81,0x7E,0x7E,0x81,0x7F,0x7F,0x7F,0x80,0x81,0x7F,0x80,0x80,0x80,0x80,
-0x7C,0x81,0x82,0x80,0x7F,0x81,0x82,0x7F,0x80,0x82,0x7F,0x7D,0x80,0x80,0x80,0x7E,0x7F,0x7D,0x7D,0x83,0x80,0x7D,0x7F,0x7F,0x81,0x7F,
-0x7E,0x81,0x80,0x7C,0x80,0x7F,0x7D,0x7E,0x80,0x7E,0x7D,0x7E,0x7D,0x7D,0x7F,0x7F,0x7D,0x7B,0x80,0x7E,0x80,0x81,0x7D,0x80,0x80,0x7B,
-0x7D,0x7E,0x79,0x79,0x7C,0x7C,0x80,0x81,0x7C,0x7B,0x80,0x7F,0x78,0x7A,0x7B,0x7D,0x7E,0x7C,0x7F,0x80,0x7C,0x81,0x80,0x7C,0x7C,0x7D,
-0x81,0x80,0x7D,0x7F,0x79,0x7B,0x7E,0x7A,0x79,0x7C,0x80,0x7D,0x7C,0x7D,0x82,0x85,0x87,0x84,0x83,0x7D,0x7B,0x7A,0x7B,0x7D,0x7B,0x76,
-0x73,0x79,0x7B,0x7F,0x7A,0x77,0x85,0x87,0x7C,0x79,0x73,0x6F,0x77,0x77,0x7C,0x7A,0x73,0x72,0x72,0x73,0x72,0x7B,0x80,0x7B,0x7B,0x77,
-0x76,0x79,0x76,0x76,0x78,0x6F,0x71,0x7A,0x76,0x77,0x7A,0x78,0x74,0x72,0x76,0x77,0x77,0x7C,0x7C,0x74,0x75,0x74,0x76,0x7D,0x7E,0x7B,
-0x72,0x6E,0x6D,0x73,0x77,0x70,0x6F,0x6F,0x6C,0x6E,0x6E,0x6F,0x72,0x73,0x75,0x76,0x73,0x6F,0x71,0x73,0x76,0x77,0x74,0x6C,0x63,0x67,
-0x70,0x79,0x73,0x6E,0x70,0x72,0x76,0x7B,0x79,0x72,0x6E,0x6B,0x73,0x7C,0x79,0x80,0x7D,0x74,0x78,0x80,0x7D,0x77,0x76,0x77,0x74,0x73,
-0x7D,0x83,0x81,0x7E,0x84,0x84,0x7C,0x7A,0x82,0x83,0x7D,0x7F,0x7E,0x76,0x79,0x82,0x86,0x83,0x80,0x83,0x81,0x7F,0x82,0x8A,0x8A,0x80,
-0x85,0x87,0x7B,0x81,0x89,0x82,0x80,0x87,0x86,0x82,0x84,0x88,0x86,0x88,0x89,0x85,0x83,0x84,0x82,0x81,0x89,0x89,0x85,0x85,0x81,0x7F,
-0x83,0x88,0x8A,0x88,0x85,0x85,0x88,0x87,0x82,0x82,0x83,0x82,0x84,0x8B,0x8B,0x86,0x86,0x8A,0x8D,0x8A,0x8A,0x88,0x8A,0x8B,0x8D,0x8D,
-0x8A,0x8D,0x8E,0x89,0x8E,0x8E,0x88,0x89,0x8B,0x89,0x8A,0x8A,0x8B,0x87,0x86,0x8C,0x8C,0x8B,0x89,0x87,0x8B,0x8B,0x8B,0x8D,0x8E,0x8D,
-0x8C,0x8A,0x8C,0x86,0x80,0x86,0x8C,0x89,0x88,0x84,0x86,0x87,0x81,0x84,0x87,0x85,0x85,0x86,0x88,0x89,0x8A,0x85,0x84,0x86,0x86,0x86,
-0x88,0x8B,0x8B,0x8C,0x89,0x85,0x85,0x86,0x89,0x8A,0x8A,0x8A,0x88,0x86,0x85,0x84,0x84,0x87,0x88,0x89,0x87,0x86,0x85,0x86,0x86,0x86,
-0x87,0x86,0x88,0x87,0x8A,0x8C,0x8A,0x86,0x83,0x83,0x86,0x87,0x8A,0x8B,0x8A,0x89,0x87,0x87,0x87,0x8A,0x8A,0x87,0x86,0x86,0x88,0x89,
-0x89,0x87,0x86,0x86,0x85,0x84,0x83,0x85,0x82,0x82,0x83,0x84,0x85,0x84,0x86,0x86,0x85,0x85,0x86,0x86,0x88,0x86,0x86,0x85,0x85,0x85,
-0x88,0x89,0x8A,0x8A,0x89,0x85,0x84,0x82,0x84,0x84,0x83,0x81,0x81,0x7F,0x7F,0x7E,0x7E,0x7E,0x7D,0x7D,0x7D,0x7D,0x7B,0x7B,0x7B,0x7A,
-0x7C,0x7E,0x84,0x88,0x8B,0x8D,0x90,0x91,0x91,0x92,0x90,0x90,0x8E,0x8D,0x8C,0x8A,0x8B,0x8A,0x8B,0x89,0x85,0x80,0x7A,0x74,0x6E,0x69,
-0x63,0x60,0x5E,0x5C,0x5F,0x69,0x76,0x88,0x98,0xA5,0xAA,0xA7,0x9B,0x8F,0x85,0x7D,0x7B,0x7D,0x83,0x87,0x8D,0x91,0x92,0x96,0x98,0x9B,
-0x9D,0x9D,0x99,0x90,0x88,0x7B,0x72,0x69,0x61,0x5A,0x56,0x52,0x50,0x55,0x61,0x70,0x86,0x9A,0xA8,0xAC,0xAA,0x9D,0x8D,0x7E,0x74,0x6F,
-0x72,0x77,0x7C,0x83,0x88,0x8A,0x8E,0x93,0x99,0x9F,0xA3,0xA4,0x9F,0x96,0x89,0x7E,0x74,0x6D,0x69,0x65,0x60,0x5D,0x58,0x54,0x53,0x5A,
-0x67,0x77,0x8D,0x9E,0xA6,0xA5,0x9D,0x8E,0x7E,0x73,0x6D,0x6E,0x74,0x79,0x80,0x84,0x87,0x88,0x8C,0x91,0x96,0x9D,0xA1,0xA0,0x9A,0x91,
-0x83,0x78,0x6D,0x66,0x5F,0x5C,0x59,0x56,0x54,0x52,0x57,0x62,0x73,0x86,0x9B,0xA7,0xA9,0xA4,0x95,0x83,0x73,0x68,0x66,0x6B,0x73,0x7C,
-0x83,0x88,0x89,0x8C,0x8F,0x94,0x99,0xA0,0xA1,0x9C,0x95,0x89,0x7A,0x70,0x68,0x62,0x5E,0x5D,0x5B,0x5A,0x56,0x57,0x5D,0x6A,0x7B,0x90,
-0xA0,0xA9,0xA7,0x9E,0x8B,0x7B,0x6D,0x66,0x66,0x6F,0x78,0x80,0x86,0x8A,0x8A,0x8C,0x8D,0x93,0x99,0x9D,0x9E,0x9A,0x8F,0x82,0x74,0x6B,
-0x64,0x60,0x5E,0x5D,0x5B,0x5A,0x56,0x5A,0x63,0x70,0x84,0x96,0xA3,0xA7,0xA3,0x92,0x81,0x72,0x67,0x62,0x69,0x71,0x7C,0x85,0x8A,0x8C,
-0x8D,0x8D,0x91,0x95,0x9A,0x9C,0x99,0x91,0x86,0x78,0x6E,0x67,0x61,0x5F,0x5E,0x5C,0x59,0x57,0x57,0x60,0x6A,0x7D,0x91,0xA0,0xA5,0xA4,
-0x97,0x86,0x75,0x69,0x64,0x67,0x70,0x7A,0x83,0x89,0x8C,0x8D,0x8D,0x8F,0x92,0x97,0x9B,0x99,0x95,0x8A,0x7F,0x72,0x6A,0x65,0x62,0x60,
-0x5C,0x5C,0x59,0x56,0x5C,0x66,0x76,0x89,0x99,0xA3,0xA5,0x9C,0x8D,0x7B,0x6D,0x65,0x64,0x6D,0x76,0x80,0x88,0x8C,0x8D,0x8D,0x8F,0x91,
-0x95,0x99,0x99,0x94,0x8E,0x83,0x77,0x6E,0x69,0x64,0x60,0x5F,0x5E,0x5C,0x58,0x5C,0x65,0x72,0x82,0x95,0xA1,0xA3,0xA0,0x92,0x81,0x72,
-0x69,0x67,0x6B,0x76,0x80,0x87,0x8D,0x8E,0x8D,0x8F,0x90,0x94,0x98,0x98,0x94,0x8D,0x83,0x7A,0x72,0x6A,0x66,0x63,0x5F,0x5E,0x5B,0x58,
-0x59,0x63,0x70,0x82,0x94,0xA0,0xA4,0xA0,0x93,0x83,0x74,0x6C,0x68,0x6D,0x77,0x7F,0x87,0x8D,0x8D,0x8E,0x8F,0x94,0x97,0x99,0x9B,0x95,
-0x8D,0x84,0x79,0x70,0x6C,0x69,0x64,0x62,0x5E,0x5B,0x57,0x59,0x63,0x71,0x83,0x96,0xA2,0xA4,0x9F,0x92,0x80,0x71,0x6B,0x68,0x6F,0x78,
-0x81,0x88,0x8B,0x8E,0x8C,0x8E,0x90,0x95,0x99,0x9B,0x95,0x8F,0x85,0x7B,0x71,0x6E,0x6A,0x65,0x62,0x5F,0x5A,0x56,0x57,0x61,0x6D,0x81,
-0x94,0xA0,0xA5,0xA0,0x94,0x82,0x74,0x6C,0x6A,0x6F,0x79,0x83,0x89,0x8B,0x8D,0x8D,0x8F,0x94,0x99,0x9C,0x9B,0x97,0x8C,0x84,0x7A,0x72,
-0x6E,0x6C,0x67,0x64,0x60,0x5A,0x56,0x58,0x62,0x71,0x85,0x97,0xA4,0xA5,0x9F,0x90,0x7F,0x71,0x6D,0x6E,0x74,0x7E,0x86,0x8A,0x8C,0x8B,
-0x8C,0x8F,0x93,0x98,0x9C,0x9A,0x94,0x8C,0x82,0x79,0x73,0x6F,0x6A,0x65,0x61,0x5C,0x57,0x52,0x59,0x67,0x77,0x8D,0x9E,0xA7,0xA6,0x9B,
-0x8A,0x79,0x6E,0x6C,0x6E,0x77,0x81,0x8A,0x8C,0x8D,0x8C,0x8D,0x91,0x96,0x99,0x99,0x98,0x91,0x87,0x80,0x79,0x72,0x71,0x6D,0x67,0x61,
-0x5C,0x56,0x53,0x5B,0x6A,0x7B,0x8E,0xA0,0xA6,0xA1,0x95,0x86,0x76,0x6F,0x6F,0x73,0x7A,0x83,0x88,0x89,0x88,0x8A,0x8A,0x90,0x98,0x9C,
-0x9D,0x98,0x8E,0x82,0x7A,0x73,0x70,0x6D,0x6A,0x65,0x5F,0x5A,0x54,0x53,0x60,0x72,0x83,0x98,0xA4,0xA4,0x9A,0x8B,0x7C,0x6F,0x6D,0x71,
-0x79,0x81,0x89,0x8A,0x89,0x89,0x8A,0x8D,0x94,0x9A,0x9C,0x98,0x92,0x89,0x7F,0x78,0x75,0x72,0x6E,0x69,0x62,0x5B,0x53,0x51,0x58,0x67,
-0x7A,0x90,0xA0,0xA5,0x9E,0x92,0x83,0x74,0x6F,0x70,0x78,0x7E,0x84,0x86,0x86,0x86,0x88,0x8D,0x92,0x9A,0x9D,0x9B,0x94,0x8A,0x7F,0x78,
-0x74,0x72,0x6F,0x68,0x62,0x5C,0x55,0x50,0x55,0x65,0x79,0x8E,0x9F,0xA6,0xA2,0x93,0x85,0x78,0x70,0x72,0x78,0x7E,0x84,0x87,0x87,0x85,
-0x88,0x8D,0x93,0x9C,0x9F,0x9E,0x96,0x8D,0x83,0x7D,0x7A,0x78,0x74,0x70,0x68,0x61,0x5A,0x56,0x59,0x67,0x7C,0x8F,0xA0,0xA6,0xA2,0x95,
-0x87,0x7A,0x74,0x75,0x7B,0x81,0x85,0x86,0x87,0x86,0x8A,0x8E,0x98,0xA0,0xA0,0x9C,0x94,0x89,0x81,0x7C,0x7A,0x79,0x74,0x6E,0x64,0x5B,
-0x56,0x53,0x5A,0x6D,0x82,0x96,0xA1,0xA3,0x9C,0x8D,0x7F,0x78,0x76,0x79,0x7E,0x82,0x83,0x82,0x84,0x88,0x8D,0x96,0x9E,0xA0,0x9E,0x97,
-0x8D,0x85,0x7E,0x7E,0x7C,0x78,0x73,0x6A,0x5F,0x58,0x55,0x55,0x61,0x75,0x88,0x97,0xA0,0x9E,0x97,0x8A,0x7F,0x7A,0x7A,0x7C,0x7E,0x82,
-0x83,0x83,0x86,0x8A,0x94,0x9D,0xA3,0xA2,0x99,0x8E,0x86,0x80,0x7E,0x7D,0x7C,0x77,0x6C,0x61,0x58,0x55,0x54,0x5E,0x72,0x87,0x96,0xA0,
-0x9F,0x99,0x8C,0x83,0x7E,0x7E,0x80,0x80,0x81,0x82,0x82,0x85,0x8E,0x97,0x9E,0xA2,0xA1,0x9A,0x8E,0x86,0x82,0x81,0x7F,0x7E,0x79,0x6D,
-0x62,0x5A,0x56,0x56,0x5B,0x6C,0x80,0x8F,0x9A,0x9D,0x9B,0x92,0x85,0x80,0x7E,0x7E,0x7F,0x7E,0x80,0x80,0x84,0x89,0x91,0x9B,0xA2,0xA0,
-0x9C,0x93,0x88,0x82,0x7E,0x7D,0x7B,0x74,0x6C,0x61,0x59,0x56,0x56,0x5B,0x6B,0x7E,0x90,0x9A,0x9A,0x97,0x91,0x86,0x7F,0x7F,0x7F,0x7F,
-0x7D,0x7D,0x80,0x84,0x8A,0x91,0x9C,0xA2,0x9D,0x96,0x8F,0x87,0x83,0x7F,0x7C,0x79,0x70,0x64,0x5A,0x57,0x55,0x56,0x5D,0x6E,0x82,0x91,
-0x97,0x97,0x95,0x8E,0x83,0x7F,0x7E,0x80,0x7F,0x7D,0x7D,0x81,0x88,0x8F,0x99,0x9E,0x9F,0x96,0x8F,0x8B,0x88,0x85,0x81,0x7C,0x73,0x68,
-0x5B,0x55,0x57,0x58,0x59,0x65,0x77,0x89,0x95,0x98,0x94,0x93,0x8C,0x82,0x7E,0x80,0x80,0x80,0x7D,0x7F,0x86,0x8D,0x91,0x98,0x9F,0x9E,
-0x97,0x8E,0x8A,0x88,0x84,0x7E,0x76,0x6E,0x66,0x5D,0x57,0x57,0x5B,0x61,0x6F,0x7E,0x8E,0x98,0x95,0x91,0x8D,0x89,0x83,0x82,0x81,0x80,
-0x81,0x7F,0x82,0x89,0x93,0x99,0x99,0x96,0x91,0x8E,0x8C,0x8A,0x85,0x80,0x78,0x6C,0x64,0x5C,0x5C,0x5D,0x5C,0x5D,0x68,0x78,0x88,0x93,
-0x95,0x93,0x90,0x8A,0x83,0x82,0x82,0x83,0x81,0x81,0x81,0x86,0x92,0x98,0x9A,0x98,0x93,0x8F,0x8E,0x8A,0x86,0x81,0x78,0x6C,0x64,0x5E,
-0x5D,0x5D,0x5C,0x5C,0x65,0x72,0x84,0x90,0x92,0x91,0x8D,0x88,0x82,0x82,0x81,0x82,0x81,0x81,0x83,0x8B,0x94,0x97,0x96,0x92,0x8E,0x8C,
-0x8E,0x8B,0x87,0x80,0x75,0x6A,0x62,0x5E,0x5E,0x5F,0x5C,0x5C,0x64,0x74,0x83,0x8E,0x8F,0x8D,0x8A,0x86,0x81,0x82,0x84,0x84,0x84,0x84,
-0x86,0x8D,0x94,0x95,0x95,0x8F,0x8C,0x8D,0x8C,0x88,0x83,0x7A,0x72,0x69,0x61,0x60,0x5F,0x5F,0x5C,0x5E,0x6A,0x76,0x84,0x8C,0x8A,0x89,
-0x88,0x83,0x84,0x84,0x83,0x84,0x85,0x88,0x8C,0x92,0x93,0x92,0x90,0x8C,0x8D,0x8A,0x89,0x85,0x7E,0x76,0x6E,0x67,0x63,0x64,0x63,0x62,
-0x60,0x60,0x6A,0x73,0x7D,0x85,0x87,0x87,0x86,0x85,0x86,0x85,0x87,0x87,0x86,0x87,0x8A,0x8D,0x90,0x90,0x90,0x8F,0x8C,0x8B,0x86,0x82,
-0x7D,0x76,0x6F,0x6B,0x69,0x69,0x68,0x66,0x66,0x64,0x68,0x70,0x75,0x7C,0x80,0x82,0x83,0x86,0x87,0x88,0x88,0x88,0x87,0x88,0x88,0x8B,
-0x8D,0x90,0x8F,0x8E,0x8D,0x89,0x87,0x83,0x7D,0x7A,0x74,0x6F,0x6C,0x6A,0x6B,0x6D,0x6D,0x6A,0x69,0x6A,0x6E,0x75,0x7B,0x7F,0x82,0x83,
-0x84,0x88,0x88,0x89,0x8B,0x8C,0x8B,0x8C,0x8B,0x8B,0x8A,0x8B,0x8A,0x88,0x86,0x83,0x7F,0x7E,0x79,0x74,0x73,0x71,0x73,0x74,0x73,0x70,
-0x6D,0x6E,0x70,0x73,0x74,0x77,0x7A,0x7E,0x82,0x81,0x82,0x84,0x86,0x87,0x88,0x88,0x87,0x89,0x89,0x8A,0x8A,0x89,0x88,0x87,0x84,0x82,
-0x80,0x7E,0x7C,0x79,0x77,0x76,0x79,0x78,0x77,0x77,0x76,0x75,0x77,0x77,0x77,0x78,0x78,0x79,0x7A,0x7B,0x7E,0x7F,0x7F,0x80,0x80,0x80,
-0x82,0x82,0x82,0x84,0x85,0x86,0x84,0x85,0x83,0x83,0x84,0x82,0x80,0x7F,0x7F,0x7D,0x7C,0x7D,0x7A,0x79,0x7A,0x7A,0x7B,0x7A,0x78,0x79,
-0x7B,0x7C,0x7F,0x80,0x7F,0x80,0x80,0x81,0x80,0x81,0x7F,0x7F,0x7F,0x7F,0x81,0x82,0x81,0x7F,0x83,0x82,0x7F,0x80,0x7F,0x7F,0x7E,0x7C,
-0x7A,0x7B,0x79,0x79,0x7B,0x7B,0x79,0x7A,0x7A,0x7B,0x7A,0x7B,0x7A,0x79,0x7B,0x7B,0x7A,0x7D,0x7C,0x7A,0x7A,0x7B,0x7C,0x7C,0x7D,0x7C,
-0x7B,0x7B,0x7C,0x7D,0x7A,0x7B,0x7C,0x79,0x78,0x78,0x79,0x75,0x78,0x7A,0x77,0x78,0x7A,0x7B,0x7F,0x7F,0x7C,0x7C,0x7D,0x7E,0x7C,0x7D,
-0x7C,0x7A,0x7D,0x7A,0x7D,0x80,0x7C,0x80,0x81,0x7D,0x80,0x80,0x7F,0x81,0x82,0x83,0x82,0x81,0x82,0x83,0x86,0x85,0x85,0x87,0x87,0x85,
-0x8A,0x88,0x88,0x8A,0x8A,0x89,0x89,0x86,0x8B,0x8A,0x88,0x8A,0x87,0x88,0x8A,0x89,0x88,0x87,0x88,0x89,0x87,0x85,0x88,0x86,0x86,0x87,
-0x88,0x86,0x87,0x8A,0x88,0x85,0x86,0x87,0x85,0x87,0x87,0x86,0x88,0x85,0x84,0x86,0x86,0x85,0x85,0x86,0x86,0x87,0x85,0x86,0x85,0x85,
-0x87,0x88,0x88,0x86,0x84,0x86,0x87,0x86,0x88,0x87,0x84,0x85,0x86,0x84,0x84,0x84,0x85,0x87,0x85,0x84,0x87,0x85,0x86,0x86,0x85,0x85,
-0x85,0x85,0x86,0x84,0x85,0x85,0x85,0x85,0x86,0x86,0x86,0x85,0x84,0x85,0x84,0x81,0x83,0x82,0x83,0x86,0x85,0x82,0x83,0x84,0x84,0x84,
-0x85,0x84,0x83,0x85,0x86,0x83,0x85,0x82,0x80,0x83,0x84,0x83,0x85,0x84,0x82,0x83,0x81,0x83,0x82,0x82,0x80,0x81,0x82,0x80,0x7F,0x81,
-0x7F,0x81,0x7F,0x80,0x82,0x80,0x7F,0x80,0x81,0x81,0x80,0x81,0x80,0x80,0x81,0x7F,0x7D,0x80,0x80,0x7E,0x7F,0x7F,0x7F,0x80,0x7E,0x7F,
-0x7F,0x7E,0x80,0x7E,0x7D,0x7E,0x7F,0x7E,0x7D,0x7F,0x80,0x7D,0x7F,0x81,0x80,0x80,0x7F,0x80,0x7F,0x7E,0x7F,0x7E,0x7F,0x7E,0x7E,0x7F,
-0x7E,0x80,0x7E,0x80,0x7E,0x80,0x7F,0x7D,0x7F,0x7E,0x7E,0x80,0x7E,0x7E,0x80,0x7D,0x80,0x7F,0x7C,0x7E,0x7E,0x7E,0x7F,0x7E,0x7E,0x7E,
-0x7E,0x7F,0x7E,0x7D,0x7E,0x7D,0x7D,0x7C,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x80,0x7C,0x7E,0x80,0x7D,0x7D,0x7E,0x7D,0x7D,0x7E,0x7D,0x7E,
-0x7F,0x7D,0x7E,0x7F,0x7E,0x7E,0x7D,0x7E,0x7F,0x7E,0x7F,0x7E,0x80,0x80,0x80,0x80,0x7E,0x80,0x80,0x80,0x81,0x83,0x80,0x7E,0x80,0x81,
-0x81,0x80,0x7E,0x80,0x81,0x80,0x80,0x80,0x81,0x81,0x80,0x7D,0x81,0x80,0x7D,0x7F,0x7F,0x81,0x81,0x80,0x80,0x81,0x81,0x81,0x7E,0x7E,
-0x82,0x81,0x80,0x81,0x81,0x80,0x81,0x80,0x7F,0x81,0x7F,0x7D,0x7F,0x80,0x7E,0x80,0x7E,0x7E,0x80,0x7F,0x7F,0x81,0x80,0x80,0x7F,0x81,
-0x7F,0x82,0x82,0x80,0x7F,0x7F,0x82,0x81,0x7E,0x80,0x80,0x7F,0x81,0x81,0x7F,0x81,0x81,0x7F,0x81,0x80,0x80,0x81,0x7F,0x7E,0x7F,0x81,
-0x80,0x80,0x7E,0x80,0x82,0x80,0x7C,0x7F,0x7F,0x7C,0x80,0x82,0x7F,0x7F,0x80,0x7F,0x81,0x7E,0x7D,0x7E,0x7E,0x81,0x7D,0x7D,0x81,0x80,
-0x80,0x7F,0x7F,0x81,0x81,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x80,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x7E,0x81,0x81,0x7D,0x7F,0x80,0x80,
-0x81,0x7E,0x82,0x83,0x7F,0x80,0x80,0x7E,0x80,0x7F,0x7F,0x80,0x80,0x80,0x81,0x81,0x7F,0x81,0x80,0x7F,0x82,0x80,0x80,0x81,0x7F,0x7F,
-0x80,0x7D,0x81,0x81,0x7F,0x7F,0x81,0x80,0x7E,0x7E,0x81,0x7F,0x80,0x81,0x80,0x82,0x80,0x7D,0x80,0x83,0x7F,0x7E,0x7E,0x80,0x83,0x7F,
-0x7D,0x7E,0x80,0x80,0x7F,0x82,0x81,0x7E,0x7D,0x7F,0x80,0x7F,0x7E,0x7E,0x81,0x81,0x7C,0x7E,0x7D,0x7D,0x7F,0x7D,0x7F,0x7F,0x7E,0x7E,
-0x7E,0x80,0x7F,0x7F,0x81,0x7F,0x7E,0x7E,0x7C,0x81,0x81,0x7E,0x7E,0x7E,0x7E,0x81,0x7C,0x7A,0x7F,0x7F,0x80,0x7E,0x7D,0x7D,0x81,0x7F,
-0x7B,0x7D,0x80,0x7D,0x7E,0x7D,0x7D,0x7C,0x7E,0x7E,0x7E,0x80,0x7E,0x7D,0x7C,0x7E,0x7D,0x7E,0x80,0x7E,0x7E,0x7C,0x7E,0x80,0x83,0x7D,
-0x7C,0x7F,0x7E,0x7F,0x7F,0x7E,0x7D,0x7D,0x7D,0x7F,0x80,0x7C,0x7E,0x81,0x7F,0x7B,0x7E,0x7E,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x80,
-0x7E,0x81,0x80,0x7E,0x7E,0x80,0x7E,0x7E,0x80,0x82,0x82,0x7E,0x7D,0x80,0x7E,0x7E,0x7E,0x7F,0x80,0x82,0x80,0x7F,0x7D,0x7D,0x7F,0x80,
-0x7F,0x81,0x81,0x80,0x80,0x81,0x80,0x80,0x7F,0x7E,0x80,0x80,0x7F,0x7F,0x80,0x82,0x7F,0x81,0x81,0x7E,0x7F,0x81,0x7F,0x7E,0x7E,0x7C,
-0x7D,0x7E,0x7D,0x7E,0x7E,0x81,0x81,0x7F,0x81,0x82,0x83,0x83,0x86,0x86,0x84,0x85,0x86,0x83,0x85,0x84,0x84,0x84,0x82,0x81,0x84,0x83,
-0x84,0x83,0x83,0x82,0x82,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,0x7E,0x7F,0x7E,0x7D,0x7F,0x7F,0x7D,0x7C,0x7D,0x7A,0x79,0x7C,0x7A,0x7A,0x7B,
-0x7A,0x7C,0x79,0x79,0x7B,0x7C,0x7C,0x7B,0x79,0x76,0x77,0x77,0x77,0x77,0x78,0x75,0x77,0x7C,0x7A,0x79,0x7D,0x80,0x79,0x7A,0x7A,0x7A,
-0x7C,0x74,0x73,0x7B,0x7A,0x7A,0x7A,0x7A,0x7A,0x7B,0x7C,0x7B,0x79,0x7B,0x7B,0x7A,0x7B,0x7B,0x7C,0x7F,0x7D,0x7E,0x7D,0x7C,0x7B,0x7C,
-0x78,0x7C,0x7E,0x78,0x78,0x78,0x78,0x7A,0x76,0x77,0x79,0x75,0x75,0x76,0x77,0x78,0x73,0x76,0x71,0x72,0x74,0x75,0x72,0x72,0x76,0x77,
-0x78,0x77,0x79,0x79,0x77,0x76,0x79,0x7A,0x7A,0x79,0x79,0x7B,0x7C,0x7E,0x7C,0x7E,0x81,0x7F,0x7E,0x7F,0x7F,0x81,0x82,0x7C,0x7D,0x81,
-0x7F,0x7D,0x7F,0x81,0x83,0x84,0x81,0x82,0x83,0x83,0x84,0x82,0x84,0x80,0x80,0x84,0x82,0x82,0x84,0x84,0x82,0x86,0x85,0x83,0x87,0x86,
-0x85,0x83,0x84,0x89,0x8A,0x87,0x88,0x87,0x85,0x88,0x8B,0x88,0x89,0x8A,0x87,0x87,0x88,0x87,0x87,0x89,0x8A,0x88,0x89,0x85,0x88,0x87,
-0x84,0x86,0x87,0x84,0x85,0x85,0x82,0x86,0x87,0x85,0x86,0x85,0x80,0x84,0x86,0x82,0x82,0x85,0x80,0x83,0x87,0x86,0x89,0x8A,0x87,0x86,
-0x8C,0x88,0x85,0x86,0x85,0x84,0x85,0x83,0x84,0x87,0x87,0x86,0x86,0x84,0x83,0x83,0x84,0x85,0x88,0x86,0x81,0x83,0x84,0x83,0x85,0x84,
-0x7F,0x80,0x80,0x7E,0x82,0x84,0x82,0x85,0x86,0x82,0x82,0x82,0x81,0x81,0x82,0x7F,0x81,0x84,0x84,0x86,0x84,0x81,0x83,0x83,0x80,0x7D,
-0x7F,0x7F,0x80,0x7F,0x81,0x81,0x84,0x85,0x85,0x84,0x84,0x84,0x84,0x83,0x80,0x81,0x85,0x84,0x81,0x83,0x84,0x83,0x86,0x87,0x83,0x83,
-0x83,0x84,0x84,0x84,0x84,0x83,0x84,0x84,0x84,0x85,0x83,0x82,0x84,0x84,0x82,0x82,0x82,0x83,0x84,0x80,0x82,0x85,0x83,0x85,0x87,0x85,
-0x88,0x8A,0x87,0x85,0x88,0x86,0x87,0x86,0x84,0x86,0x89,0x87,0x86,0x88,0x89,0x89,0x87,0x86,0x85,0x86,0x86,0x84,0x84,0x83,0x85,0x85,
-0x86,0x85,0x86,0x86,0x86,0x86,0x86,0x85,0x84,0x86,0x86,0x86,0x86,0x83,0x85,0x86,0x84,0x83,0x83,0x85,0x81,0x81,0x81,0x80,0x83,0x82,
-0x80,0x81,0x84,0x83,0x82,0x82,0x85,0x84,0x85,0x83,0x83,0x83,0x82,0x82,0x82,0x81,0x82,0x82,0x83,0x81,0x83,0x84,0x81,0x82,0x82,0x82,
-0x83,0x82,0x82,0x83,0x82,0x83,0x82,0x83,0x83,0x82,0x81,0x81,0x82,0x83,0x80,0x7F,0x83,0x82,0x82,0x80,0x80,0x80,0x84,0x82,0x7D,0x82,
-0x82,0x81,0x80,0x83,0x82,0x82,0x83,0x82,0x84,0x85,0x85,0x83,0x84,0x83,0x80,0x80,0x80,0x7F,0x7E,0x7D,0x7E,0x7E,0x7D,0x7D,0x7C,0x7A,
-0x7A,0x78,0x7A,0x7A,0x7A,0x7C,0x7D,0x80,0x81,0x81,0x82,0x84,0x85,0x85,0x86,0x87,0x8B,0x8D,0x8B,0x89,0x8A,0x8A,0x8A,0x88,0x83,0x81,
-0x7C,0x78,0x73,0x6C,0x6A,0x66,0x62,0x5D,0x5D,0x60,0x62,0x64,0x6C,0x76,0x82,0x8B,0x93,0x9A,0xA0,0x9F,0x9D,0x99,0x95,0x93,0x93,0x90,
-0x8F,0x8F,0x92,0x90,0x8F,0x8A,0x85,0x7D,0x73,0x66,0x5D,0x54,0x48,0x40,0x35,0x43,0x6C,0x80,0x86,0x91,0xA5,0xAE,0xAC,0x9D,0x8A,0x84,
-0x84,0x7A,0x6E,0x6D,0x76,0x84,0x91,0x98,0xA0,0xAB,0xB3,0xB1,0xA3,0x99,0x90,0x83,0x73,0x61,0x53,0x4C,0x48,0x44,0x3F,0x41,0x62,0x83,
-0x8B,0x8F,0x9D,0xAA,0xA8,0x9C,0x88,0x7A,0x78,0x76,0x6C,0x67,0x6F,0x7D,0x8A,0x93,0x98,0xA6,0xB0,0xB0,0xA7,0x9C,0x95,0x8D,0x7E,0x6F,
-0x65,0x5C,0x51,0x4B,0x47,0x45,0x42,0x5A,0x7D,0x88,0x8A,0x96,0xA4,0xA6,0x9A,0x8B,0x7D,0x78,0x75,0x6E,0x68,0x6C,0x7A,0x84,0x8D,0x94,
-0x9F,0xA9,0xAF,0xAA,0xA0,0x97,0x90,0x87,0x76,0x69,0x63,0x5C,0x50,0x49,0x4A,0x45,0x47,0x66,0x84,0x87,0x8B,0x9B,0xA7,0xA0,0x93,0x85,
-0x7C,0x78,0x74,0x6C,0x66,0x70,0x7E,0x85,0x8A,0x92,0xA0,0xA9,0xAC,0xA7,0x9C,0x95,0x92,0x87,0x77,0x6C,0x66,0x5E,0x50,0x48,0x46,0x45,
-0x45,0x60,0x81,0x87,0x8A,0x9C,0xAB,0xA3,0x94,0x89,0x7F,0x7A,0x72,0x68,0x64,0x6C,0x7A,0x84,0x86,0x8D,0xA1,0xA9,0xA8,0xA9,0xA3,0x98,
-0x93,0x8B,0x7B,0x6C,0x68,0x62,0x52,0x47,0x48,0x4B,0x42,0x4E,0x7B,0x8F,0x89,0x92,0xA9,0xAC,0x98,0x8D,0x84,0x78,0x73,0x6F,0x64,0x62,
-0x74,0x80,0x83,0x89,0x99,0xA2,0xA8,0xAA,0xA6,0x9A,0x94,0x90,0x84,0x74,0x6C,0x68,0x5C,0x4B,0x49,0x4C,0x46,0x43,0x64,0x87,0x89,0x8B,
-0x9D,0xAD,0xA3,0x94,0x89,0x7D,0x76,0x72,0x67,0x61,0x6B,0x7B,0x80,0x83,0x90,0x9E,0xA3,0xA3,0xA9,0xA7,0x9B,0x93,0x8C,0x81,0x77,0x70,
-0x69,0x5E,0x53,0x4E,0x51,0x4A,0x42,0x5D,0x83,0x89,0x85,0x94,0xAA,0xA7,0x95,0x89,0x80,0x7D,0x77,0x6B,0x62,0x6B,0x7B,0x7F,0x80,0x8B,
-0x9C,0xA3,0xA3,0xA4,0xA7,0xA0,0x96,0x8D,0x84,0x7C,0x73,0x6B,0x61,0x57,0x51,0x52,0x50,0x43,0x4D,0x7C,0x8E,0x81,0x89,0xA8,0xB0,0x98,
-0x8A,0x85,0x81,0x79,0x6E,0x62,0x68,0x79,0x7E,0x7D,0x86,0x98,0x9F,0x9F,0x9D,0xA2,0xA7,0xA0,0x8F,0x87,0x88,0x82,0x71,0x66,0x64,0x5D,
-0x51,0x4F,0x4D,0x45,0x55,0x7F,0x8A,0x82,0x93,0xAD,0xA9,0x92,0x8D,0x8B,0x80,0x75,0x6C,0x66,0x6C,0x79,0x7C,0x7B,0x89,0x99,0x9E,0x9B,
-0xA0,0xA5,0xA6,0x9C,0x8E,0x89,0x87,0x80,0x71,0x69,0x67,0x5F,0x53,0x51,0x51,0x44,0x52,0x7D,0x89,0x7D,0x8C,0xAC,0xA9,0x93,0x8F,0x8C,
-0x83,0x79,0x6F,0x69,0x6C,0x78,0x7A,0x79,0x85,0x97,0x9A,0x9A,0xA0,0xA5,0xA9,0xA0,0x90,0x8B,0x8B,0x82,0x6E,0x68,0x69,0x60,0x51,0x51,
-0x53,0x4B,0x4D,0x72,0x88,0x80,0x88,0xA5,0xAB,0x97,0x8F,0x8D,0x83,0x7A,0x72,0x69,0x68,0x74,0x79,0x79,0x81,0x93,0x9B,0x9A,0x9E,0xA4,
-0xA7,0xA0,0x97,0x8E,0x8A,0x85,0x7A,0x6F,0x6D,0x6A,0x59,0x51,0x57,0x54,0x45,0x56,0x80,0x85,0x7C,0x90,0xAC,0xA5,0x92,0x90,0x8B,0x83,
-0x79,0x6E,0x66,0x6E,0x7A,0x76,0x78,0x89,0x99,0x99,0x99,0xA2,0xA5,0xA5,0xA3,0x95,0x89,0x8A,0x87,0x76,0x6C,0x70,0x6A,0x58,0x53,0x5A,
-0x54,0x45,0x5C,0x83,0x83,0x7A,0x93,0xAA,0xA1,0x8F,0x8E,0x8C,0x83,0x77,0x6D,0x69,0x73,0x79,0x74,0x79,0x8D,0x97,0x95,0x97,0xA3,0xA6,
-0xA0,0x99,0x97,0x92,0x89,0x82,0x7C,0x76,0x75,0x6C,0x5E,0x5A,0x5E,0x56,0x45,0x4F,0x76,0x83,0x76,0x83,0xA6,0xA7,0x92,0x8E,0x93,0x8E,
-0x7E,0x71,0x6D,0x71,0x76,0x70,0x73,0x85,0x95,0x93,0x93,0xA1,0xA9,0xA6,0x9E,0x98,0x91,0x8D,0x86,0x7A,0x75,0x77,0x70,0x5C,0x58,0x5F,
-0x59,0x47,0x4A,0x6F,0x81,0x76,0x7E,0x9F,0xA9,0x95,0x8D,0x93,0x91,0x80,0x73,0x6F,0x70,0x74,0x71,0x73,0x80,0x90,0x93,0x91,0x9A,0xA5,
-0xA0,0x94,0x95,0x98,0x90,0x85,0x80,0x84,0x81,0x76,0x6D,0x6B,0x66,0x5E,0x57,0x4F,0x4A,0x5F,0x79,0x74,0x73,0x8F,0xA8,0x99,0x8D,0x97,
-0x9A,0x89,0x7A,0x76,0x75,0x72,0x6F,0x70,0x79,0x86,0x8D,0x8E,0x98,0xA4,0xA5,0xA2,0x9D,0x9A,0x93,0x8C,0x81,0x7B,0x78,0x71,0x67,0x5C,
-0x5C,0x5C,0x55,0x48,0x4F,0x73,0x7E,0x71,0x80,0xA2,0xA5,0x90,0x8E,0x9A,0x91,0x7E,0x75,0x75,0x73,0x71,0x6E,0x75,0x82,0x8C,0x8C,0x90,
-0x9A,0xA2,0x9B,0x95,0x99,0x97,0x8F,0x89,0x87,0x84,0x81,0x7B,0x74,0x6D,0x68,0x61,0x58,0x54,0x49,0x50,0x6A,0x73,0x6D,0x80,0x9F,0xA0,
-0x92,0x96,0x9F,0x94,0x83,0x7A,0x78,0x74,0x6F,0x6D,0x72,0x7D,0x84,0x87,0x8F,0x9C,0xA0,0xA1,0xA6,0xA0,0x99,0x94,0x8D,0x83,0x79,0x75,
-0x6E,0x61,0x5A,0x5B,0x58,0x4E,0x49,0x55,0x70,0x75,0x71,0x87,0xA0,0x9C,0x91,0x96,0x99,0x8E,0x7F,0x79,0x76,0x72,0x6F,0x6E,0x74,0x7E,
-0x84,0x87,0x8F,0x9B,0x9B,0x99,0x9D,0xA0,0x97,0x91,0x8E,0x89,0x82,0x7B,0x76,0x70,0x66,0x62,0x60,0x57,0x52,0x4D,0x55,0x6A,0x6F,0x6F,
-0x83,0x9B,0x99,0x90,0x99,0x9D,0x91,0x83,0x7E,0x7C,0x75,0x70,0x6E,0x74,0x7D,0x7F,0x81,0x8E,0x98,0x9A,0x99,0xA3,0xA8,0x99,0x92,0x95,
-0x8D,0x7D,0x76,0x75,0x6B,0x5E,0x5B,0x5C,0x54,0x4A,0x4C,0x5E,0x70,0x6E,0x76,0x90,0x9E,0x95,0x93,0x9D,0x9A,0x8A,0x81,0x80,0x7C,0x74,
-0x6F,0x72,0x79,0x7D,0x7F,0x88,0x93,0x97,0x97,0xA4,0xA8,0x9C,0x97,0x9B,0x92,0x83,0x7E,0x7B,0x6F,0x62,0x5E,0x60,0x56,0x4E,0x4E,0x53,
-0x65,0x6C,0x70,0x81,0x94,0x98,0x91,0x98,0xA1,0x96,0x89,0x86,0x85,0x7C,0x73,0x73,0x76,0x79,0x79,0x7F,0x8B,0x91,0x92,0x9C,0xA5,0xA4,
-0x9E,0x9D,0x9B,0x90,0x85,0x7D,0x79,0x6D,0x5F,0x5F,0x5D,0x52,0x4E,0x4D,0x58,0x68,0x68,0x6F,0x86,0x95,0x8F,0x91,0x9F,0x9E,0x8F,0x8D,
-0x8E,0x85,0x7A,0x79,0x79,0x78,0x76,0x7A,0x82,0x87,0x8B,0x93,0x9F,0xA0,0x9C,0xA0,0xA1,0x97,0x8D,0x8A,0x82,0x76,0x6B,0x65,0x61,0x56,
-0x50,0x52,0x4E,0x56,0x65,0x67,0x6F,0x84,0x8F,0x8C,0x95,0xA0,0x9C,0x93,0x94,0x93,0x87,0x80,0x7F,0x7E,0x79,0x78,0x7A,0x7F,0x84,0x87,
-0x8B,0x98,0x9E,0x99,0x9A,0xA2,0x9A,0x8C,0x8B,0x88,0x77,0x69,0x6A,0x66,0x56,0x53,0x57,0x55,0x5B,0x63,0x67,0x70,0x7F,0x85,0x86,0x90,
-0x9A,0x96,0x93,0x96,0x95,0x8C,0x88,0x87,0x84,0x7E,0x7E,0x7E,0x7F,0x82,0x89,0x8B,0x8D,0x92,0x95,0x91,0x8F,0x8D,0x89,0x81,0x7C,0x77,
-0x6F,0x6F,0x6B,0x67,0x67,0x65,0x65,0x6B,0x6A,0x6A,0x75,0x78,0x79,0x7F,0x86,0x88,0x89,0x8C,0x8E,0x8E,0x8C,0x8B,0x8C,0x88,0x86,0x84,
-0x84,0x85,0x83,0x82,0x87,0x8A,0x86,0x87,0x8B,0x89,0x84,0x85,0x85,0x7F,0x7D,0x7B,0x7C,0x77,0x73,0x75,0x72,0x6E,0x70,0x74,0x70,0x6F,
-0x75,0x76,0x78,0x7B,0x7D,0x81,0x83,0x84,0x87,0x88,0x88,0x89,0x88,0x87,0x87,0x87,0x84,0x85,0x86,0x87,0x85,0x85,0x88,0x86,0x85,0x86,
-0x86,0x85,0x83,0x82,0x81,0x7F,0x7E,0x7B,0x7A,0x7A,0x79,0x76,0x75,0x77,0x75,0x74,0x74,0x78,0x78,0x78,0x7B,0x7D,0x7F,0x7F,0x82,0x83,
-0x84,0x85,0x86,0x87,0x86,0x85,0x86,0x87,0x85,0x86,0x88,0x88,0x88,0x87,0x89,0x89,0x87,0x85,0x86,0x85,0x82,0x81,0x81,0x7F,0x7D,0x7C,
-0x7D,0x7B,0x79,0x79,0x79,0x78,0x78,0x78,0x78,0x7A,0x7A,0x7B,0x7D,0x7E,0x7F,0x80,0x81,0x84,0x84,0x84,0x84,0x85,0x85,0x86,0x87,0x86,
-0x88,0x88,0x88,0x89,0x87,0x87,0x88,0x87,0x85,0x84,0x83,0x81,0x81,0x7F,0x7F,0x7D,0x7D,0x7D,0x7C,0x7B,0x7A,0x7A,0x79,0x79,0x79,0x7A,
-0x79,0x79,0x7C,0x7D,0x7C,0x7D,0x81,0x81,0x81,0x82,0x83,0x84,0x84,0x85,0x85,0x87,0x86,0x87,0x88,0x88,0x86,0x87,0x86,0x85,0x85,0x84,
-0x84,0x82,0x82,0x81,0x80,0x7F,0x80,0x7E,0x7C,0x7D,0x7C,0x79,0x7B,0x7B,0x77,0x79,0x7A,0x78,0x79,0x7B,0x7C,0x7D,0x7D,0x7F,0x80,0x81,
-0x83,0x84,0x84,0x86,0x85,0x87,0x87,0x86,0x87,0x86,0x88,0x86,0x85,0x84,0x84,0x85,0x82,0x82,0x83,0x7F,0x7E,0x7F,0x7E,0x7B,0x7A,0x7B,
-0x7B,0x75,0x77,0x78,0x75,0x76,0x76,0x76,0x77,0x79,0x7A,0x7B,0x7E,0x7F,0x81,0x83,0x85,0x87,0x86,0x87,0x88,0x88,0x88,0x88,0x87,0x88,
-0x88,0x85,0x83,0x87,0x86,0x80,0x82,0x81,0x80,0x7E,0x7D,0x7E,0x77,0x79,0x79,0x78,0x75,0x74,0x77,0x73,0x72,0x74,0x76,0x75,0x77,0x78,
-0x7A,0x7D,0x7D,0x82,0x83,0x85,0x86,0x88,0x88,0x88,0x8A,0x89,0x89,0x8A,0x87,0x88,0x88,0x87,0x86,0x85,0x83,0x84,0x84,0x81,0x82,0x7E,
-0x7D,0x7E,0x7C,0x78,0x79,0x75,0x75,0x74,0x70,0x72,0x71,0x70,0x72,0x75,0x74,0x7B,0x7D,0x7E,0x82,0x82,0x85,0x88,0x88,0x89,0x8B,0x89,
-0x89,0x88,0x87,0x87,0x86,0x86,0x87,0x86,0x86,0x88,0x86,0x87,0x89,0x84,0x8B,0x8D,0x8A,0x8F,0x84,0x84,0x7F,0x78,0x78,0x6F,0x6D,0x6A,
-0x64,0x67,0x69,0x68,0x70,0x72,0x76,0x7E,0x82,0x89,0x8A,0x8E,0x92,0x91,0x92,0x90,0x90,0x8E,0x8C,0x8A,0x89,0x88,0x86,0x87,0x8A,0x8A,
-0x8C,0x8D,0x8E,0x8D,0x8C,0x8A,0x85,0x81,0x7B,0x77,0x70,0x69,0x63,0x5D,0x58,0x53,0x57,0x55,0x58,0x61,0x66,0x6C,0x75,0x7B,0x82,0x89,
-0x8C,0x90,0x92,0x91,0x92,0x8F,0x8C,0x8A,0x87,0x85,0x83,0x81,0x84,0x85,0x84,0x89,0x8B,0x8D,0x8E,0x90,0x8F,0x8C,0x8A,0x82,0x7D,0x79,
-0x6D,0x67,0x61,0x5A,0x55,0x55,0x56,0x58,0x5C,0x63,0x6A,0x70,0x7A,0x81,0x87,0x8E,0x92,0x95,0x95,0x95,0x95,0x91,0x8F,0x8C,0x88,0x86,
-0x84,0x84,0x85,0x84,0x88,0x8B,0x8D,0x8E,0x93,0x93,0x92,0x90,0x8B,0x86,0x82,0x7B,0x71,0x6B,0x64,0x5B,0x58,0x5A,0x55,0x59,0x61,0x64,
-0x6D,0x75,0x7D,0x85,0x8B,0x92,0x95,0x97,0x98,0x97,0x95,0x92,0x8E,0x8B,0x87,0x84,0x82,0x82,0x85,0x84,0x87,0x8D,0x8C,0x90,0x94,0x93,
-0x92,0x91,0x8B,0x84,0x7F,0x78,0x6D,0x67,0x61,0x59,0x58,0x5A,0x57,0x5D,0x65,0x68,0x72,0x7C,0x84,0x8A,0x92,0x97,0x99,0x9B,0x9C,0x99,
-0x95,0x93,0x8E,0x89,0x87,0x85,0x82,0x82,0x85,0x84,0x88,0x8D,0x8F,0x92,0x95,0x95,0x94,0x93,0x8E,0x86,0x81,0x79,0x70,0x68,0x61,0x58,
-0x59,0x58,0x57,0x5E,0x63,0x6B,0x72,0x7B,0x85,0x8A,0x93,0x97,0x9A,0x9C,0x9D,0x99,0x96,0x93,0x8F,0x8B,0x85,0x85,0x83,0x82,0x85,0x87,
-0x88,0x8F,0x8F,0x92,0x95,0x96,0x93,0x92,0x8C,0x85,0x7F,0x76,0x6D,0x66,0x5D,0x58,0x5A,0x56,0x57,0x61,0x63,0x6D,0x74,0x7D,0x86,0x8B,
-0x94,0x97,0x99,0x9B,0x9B,0x95,0x95,0x90,0x8B,0x87,0x84,0x82,0x7E,0x7F,0x81,0x83,0x85,0x8A,0x8D,0x90,0x92,0x93,0x94,0x92,0x8C,0x86,
-0x81,0x7B,0x6F,0x6A,0x63,0x58,0x5A,0x58,0x54,0x5E,0x62,0x68,0x70,0x79,0x80,0x88,0x8F,0x95,0x96,0x99,0x9A,0x96,0x95,0x92,0x8C,0x88,
-0x85,0x83,0x80,0x7F,0x81,0x83,0x84,0x8A,0x8D,0x8D,0x92,0x93,0x91,0x91,0x8C,0x84,0x81,0x78,0x6F,0x69,0x61,0x59,0x5A,0x57,0x56,0x5E,
-0x61,0x68,0x71,0x78,0x80,0x87,0x8E,0x94,0x96,0x99,0x99,0x96,0x94,0x92,0x8C,0x8A,0x86,0x81,0x80,0x80,0x80,0x81,0x84,0x87,0x8A,0x8D,
-0x90,0x92,0x93,0x91,0x8F,0x8A,0x84,0x7F,0x76,0x6D,0x69,0x5F,0x5B,0x5D,0x57,0x5A,0x62,0x62,0x6B,0x74,0x79,0x82,0x88,0x90,0x94,0x94,
-0x99,0x98,0x95,0x94,0x90,0x8B,0x8A,0x85,0x82,0x82,0x81,0x83,0x86,0x86,0x8B,0x8E,0x8F,0x92,0x93,0x92,0x8F,0x8B,0x86,0x7F,0x78,0x70,
-0x6B,0x62,0x5D,0x5D,0x5A,0x59,0x61,0x63,0x6A,0x73,0x77,0x80,0x88,0x8E,0x91,0x95,0x98,0x98,0x95,0x96,0x92,0x8E,0x8C,0x87,0x84,0x84,
-0x82,0x82,0x86,0x86,0x8A,0x8D,0x8D,0x91,0x92,0x92,0x90,0x8D,0x87,0x81,0x7D,0x74,0x6D,0x67,0x61,0x5D,0x5D,0x5C,0x5E,0x63,0x67,0x6F,
-0x76,0x7C,0x84,0x89,0x90,0x93,0x95,0x97,0x97,0x95,0x93,0x8F,0x8C,0x8A,0x85,0x84,0x82,0x82,0x84,0x84,0x87,0x8A,0x8C,0x8E,0x92,0x91,
-0x91,0x8F,0x8A,0x86,0x83,0x7B,0x73,0x70,0x67,0x60,0x5F,0x5F,0x5B,0x60,0x65,0x67,0x6E,0x76,0x7B,0x83,0x89,0x8E,0x90,0x94,0x95,0x94,
-0x94,0x93,0x8F,0x8B,0x89,0x86,0x83,0x83,0x84,0x84,0x85,0x89,0x8B,0x8B,0x8F,0x90,0x8E,0x90,0x8D,0x87,0x84,0x80,0x77,0x72,0x6D,0x66,
-0x60,0x62,0x5D,0x5C,0x65,0x65,0x6A,0x73,0x77,0x7D,0x83,0x89,0x8F,0x90,0x94,0x94,0x93,0x93,0x90,0x8D,0x8B,0x87,0x85,0x84,0x83,0x82,
-0x83,0x84,0x86,0x88,0x8B,0x8D,0x8E,0x8F,0x8F,0x8C,0x8B,0x86,0x82,0x7C,0x78,0x71,0x6C,0x66,0x62,0x63,0x5E,0x60,0x66,0x67,0x6D,0x73,
-0x78,0x80,0x84,0x8A,0x8E,0x8F,0x92,0x92,0x91,0x91,0x8D,0x8C,0x8A,0x86,0x86,0x83,0x82,0x83,0x85,0x85,0x89,0x8B,0x8B,0x8C,0x8E,0x8E,
-0x8C,0x8B,0x87,0x81,0x7E,0x78,0x71,0x6D,0x67,0x63,0x63,0x60,0x60,0x66,0x67,0x6C,0x72,0x77,0x7E,0x82,0x87,0x8C,0x8E,0x90,0x92,0x91,
-0x91,0x8F,0x8B,0x8A,0x87,0x84,0x84,0x81,0x81,0x83,0x84,0x86,0x86,0x89,0x8B,0x8C,0x8C,0x8C,0x8B,0x89,0x85,0x81,0x7D,0x76,0x71,0x6D,
-0x67,0x64,0x64,0x61,0x63,0x67,0x69,0x6D,0x74,0x78,0x7D,0x83,0x88,0x8B,0x8E,0x90,0x8F,0x90,0x8E,0x8D,0x8B,0x88,0x87,0x84,0x84,0x82,
-0x83,0x84,0x85,0x86,0x87,0x8A,0x8C,0x8A,0x8D,0x8C,0x89,0x87,0x84,0x7F,0x79,0x76,0x70,0x6A,0x67,0x65,0x62,0x64,0x66,0x67,0x6C,0x71,
-0x76,0x7B,0x80,0x83,0x89,0x8C,0x8E,0x90,0x8F,0x8F,0x8E,0x8C,0x8A,0x87,0x86,0x84,0x83,0x82,0x83,0x83,0x86,0x86,0x88,0x8A,0x8B,0x8C,
-0x8B,0x8A,0x88,0x86,0x81,0x7D,0x79,0x74,0x6E,0x6A,0x68,0x64,0x65,0x64,0x67,0x6A,0x6E,0x73,0x78,0x7D,0x81,0x86,0x89,0x8B,0x8E,0x8E,
-0x8F,0x8E,0x8D,0x8B,0x8A,0x87,0x86,0x83,0x83,0x84,0x84,0x84,0x86,0x88,0x88,0x8A,0x8B,0x8C,0x8B,0x8B,0x86,0x84,0x82,0x7B,0x77,0x74,
-0x6E,0x6B,0x68,0x67,0x67,0x66,0x6B,0x6C,0x6F,0x76,0x79,0x7D,0x83,0x87,0x89,0x8B,0x8E,0x8F,0x8E,0x8D,0x8D,0x8A,0x89,0x88,0x85,0x85,
-0x83,0x84,0x84,0x86,0x87,0x86,0x89,0x8A,0x8A,0x8B,0x8A,0x88,0x85,0x84,0x7E,0x7B,0x77,0x73,0x6D,0x6C,0x68,0x68,0x68,0x67,0x6B,0x6D,
-0x70,0x77,0x79,0x7E,0x83,0x86,0x88,0x8C,0x8B,0x8E,0x8D,0x8D,0x8C,0x8A,0x88,0x87,0x86,0x85,0x84,0x85,0x84,0x86,0x88,0x88,0x89,0x8A,
-0x8A,0x8A,0x89,0x86,0x84,0x81,0x7C,0x79,0x77,0x70,0x6C,0x6A,0x66,0x67,0x68,0x69,0x6D,0x70,0x73,0x79,0x7E,0x80,0x85,0x88,0x8A,0x8C,
-0x8D,0x8C,0x8C,0x8C,0x8A,0x88,0x87,0x86,0x86,0x86,0x87,0x86,0x89,0x89,0x8A,0x8B,0x8C,0x8A,0x8B,0x89,0x87,0x82,0x80,0x7D,0x78,0x75,
-0x70,0x6D,0x6B,0x69,0x68,0x69,0x68,0x6B,0x6F,0x71,0x75,0x7A,0x7D,0x82,0x84,0x87,0x88,0x8A,0x8B,0x8A,0x8A,0x89,0x89,0x87,0x88,0x87,
-0x88,0x89,0x88,0x8B,0x8B,0x8C,0x8E,0x8C,0x8C,0x8C,0x89,0x87,0x83,0x7E,0x7B,0x78,0x73,0x71,0x6E,0x6C,0x6A,0x67,0x69,0x69,0x6A,0x6E,
-0x71,0x74,0x78,0x7C,0x7E,0x83,0x85,0x87,0x87,0x8A,0x8A,0x8A,0x8B,0x8A,0x89,0x89,0x8A,0x89,0x8A,0x8B,0x8C,0x8D,0x8E,0x8E,0x8E,0x8C,
-0x8C,0x89,0x86,0x84,0x80,0x7B,0x7A,0x75,0x73,0x72,0x6C,0x6D,0x6B,0x6A,0x6C,0x6C,0x6F,0x71,0x73,0x78,0x7A,0x7E,0x82,0x83,0x84,0x87,
-0x87,0x88,0x88,0x89,0x8A,0x8A,0x8A,0x8C,0x8D,0x8D,0x8F,0x8F,0x91,0x91,0x90,0x8F,0x8D,0x8B,0x8A,0x86,0x83,0x80,0x7C,0x7A,0x76,0x73,
-0x71,0x6E,0x6C,0x6A,0x6A,0x6A,0x6A,0x6D,0x70,0x71,0x76,0x79,0x7C,0x7F,0x80,0x83,0x85,0x87,0x87,0x88,0x89,0x8A,0x8B,0x8C,0x8C,0x8E,
-0x8E,0x90,0x91,0x90,0x91,0x90,0x8E,0x8C,0x8C,0x89,0x85,0x84,0x7F,0x7C,0x7A,0x75,0x73,0x71,0x6D,0x6C,0x6B,0x6A,0x6B,0x6A,0x6D,0x6F,
-0x71,0x75,0x78,0x7A,0x7E,0x80,0x82,0x85,0x86,0x87,0x88,0x8A,0x8B,0x8B,0x8C,0x8E,0x8F,0x90,0x90,0x91,0x90,0x92,0x90,0x8D,0x8D,0x8B,
-0x88,0x86,0x84,0x7E,0x7C,0x7A,0x76,0x73,0x71,0x6F,0x6C,0x6C,0x69,0x69,0x6B,0x6C,0x6C,0x71,0x73,0x76,0x7A,0x7C,0x7F,0x82,0x84,0x84,
-0x87,0x88,0x8A,0x8B,0x8C,0x8D,0x8E,0x8F,0x8F,0x90,0x91,0x90,0x8F,0x90,0x8E,0x8C,0x8A,0x88,0x85,0x84,0x80,0x7C,0x7A,0x76,0x73,0x72,
-0x70,0x6C,0x6C,0x6A,0x69,0x6B,0x6D,0x6D,0x70,0x74,0x75,0x79,0x7C,0x7E,0x80,0x84,0x84,0x86,0x88,0x89,0x8A,0x8B,0x8C,0x8C,0x8F,0x8F,
-0x90,0x91,0x91,0x90,0x90,0x8D,0x8C,0x8B,0x88,0x84,0x84,0x80,0x7C,0x7A,0x78,0x74,0x73,0x70,0x6D,0x6C,0x6C,0x6A,0x6B,0x6C,0x6E,0x70,
-0x73,0x76,0x77,0x7B,0x7E,0x7F,0x82,0x85,0x87,0x88,0x89,0x8A,0x8C,0x8B,0x8E,0x8E,0x8F,0x8F,0x91,0x90,0x8F,0x8E,0x8E,0x8B,0x8A,0x88,
-0x84,0x83,0x81,0x7D,0x79,0x78,0x76,0x74,0x70,0x70,0x6E,0x6D,0x6C,0x6D,0x6C,0x6E,0x71,0x72,0x75,0x78,0x79,0x7C,0x80,0x83,0x84,0x88,
-0x89,0x8C,0x8D,0x8F,0x90,0x91,0x92,0x92,0x93,0x91,0x91,0x8F,0x8E,0x8C,0x8A,0x86,0x83,0x7F,0x7D,0x7A,0x77,0x75,0x72,0x6E,0x6E,0x6B,
-0x6B,0x6A,0x6B,0x69,0x6C,0x70,0x70,0x72,0x78,0x7A,0x7B,0x80,0x83,0x85,0x86,0x8B,0x8D,0x8D,0x8F,0x90,0x91,0x92,0x91,0x92,0x91,0x90,
-0x8E,0x8D,0x8B,0x88,0x86,0x83,0x80,0x7D,0x7B,0x79,0x75,0x74,0x74,0x72,0x70,0x70,0x70,0x6F,0x6F,0x71,0x72,0x71,0x74,0x76,0x77,0x79,
-0x7E,0x83,0x7B,0x7B,0x8D,0x94,0x7F,0x78,0x93,0x9C,0x86,0x7C,0x8E,0x9A,0x8C,0x80,0x8A,0x93,0x8A,0x81,0x86,0x8D,0x85,0x7B,0x7C,0x83,
-0x7F,0x78,0x76,0x7B,0x7B,0x75,0x72,0x76,0x77,0x73,0x72,0x73,0x77,0x75,0x75,0x77,0x7A,0x7A,0x7B,0x7B,0x7F,0x81,0x81,0x81,0x83,0x85,
-0x86,0x85,0x87,0x88,0x89,0x88,0x89,0x89,0x87,0x88,0x88,0x87,0x86,0x86,0x84,0x81,0x81,0x7F,0x7F,0x7E,0x7C,0x7C,0x7B,0x79,0x78,0x78,
-0x76,0x77,0x76,0x76,0x77,0x77,0x76,0x78,0x78,0x7A,0x7B,0x7B,0x7D,0x7D,0x7F,0x7E,0x7F,0x82,0x82,0x81,0x82,0x83,0x84,0x83,0x84,0x84,
-0x85,0x83,0x84,0x85,0x84,0x84,0x83,0x83,0x81,0x80,0x7F,0x7E,0x7E,0x7C,0x7C,0x7B,0x7A,0x7A,0x79,0x78,0x79,0x79,0x78,0x78,0x79,0x79,
-0x78,0x78,0x7A,0x7A,0x7A,0x7B,0x7B,0x7B,0x7C,0x7C,0x7C,0x7C,0x7C,0x7D,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7F,0x7E,0x7F,0x7E,0x7F,0x7F,
-0x7F,0x7D,0x7E,0x7E,0x7C,0x7D,0x7C,0x7B,0x7C,0x7B,0x7A,0x7A,0x7A,0x79,0x78,0x79,0x78,0x77,0x77,0x78,0x77,0x78,0x78,0x77,0x79,0x78,
-0x78,0x79,0x79,0x79,0x7A,0x79,0x7A,0x79,0x7A,0x7B,0x7B,0x7B,0x7B,0x7A,0x7B,0x7A,0x7B,0x7B,0x7B,0x7A,0x7B,0x7A,0x7B,0x7A,0x7A,0x7A,
-0x79,0x7A,0x79,0x79,0x79,0x78,0x79,0x79,0x79,0x78,0x7A,0x7A,0x79,0x79,0x79,0x7A,0x7A,0x79,0x79,0x7A,0x7B,0x7A,0x7A,0x7B,0x7A,0x7B,
-0x7A,0x7C,0x7C,0x7C,0x7B,0x7C,0x7B,0x7C,0x7C,0x7C,0x7D,0x7B,0x7B,0x00
-]
-# From audio1.py and audio1.h "Dada"
-dada = [
-0x97,0x3C,0x00,0x00,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x81,
-0x80,0x81,0x80,0x81,0x81,0x80,0x80,0x7E,0x7C,0x79,0x82,0x85,0x85,0x85,0x81,0x7D,0x77,0x80,0x81,0x80,0x80,0x81,0x82,0x81,0x85,0x85,
-0x82,0x7F,0x80,0x80,0x7E,0x79,0x84,0x84,0x85,0x84,0x7F,0x7B,0x79,0x82,0x84,0x82,0x7F,0x7C,0x7D,0x7D,0x7C,0x89,0x87,0x85,0x84,0x81,
-0x7E,0x77,0x83,0x81,0x7F,0x82,0x85,0x84,0x79,0x7B,0x80,0x81,0x81,0x7F,0x80,0x84,0x7D,0x8B,0x89,0x84,0x80,0x7E,0x7E,0x7E,0x80,0x81,
-0x82,0x82,0x7C,0x79,0x7C,0x74,0x7E,0x82,0x84,0x83,0x8A,0x87,0x7E,0x79,0x86,0x87,0x84,0x81,0x7D,0x7A,0x72,0x81,0x88,0x83,0x7E,0x85,
-0x8C,0x83,0x7F,0x8F,0x88,0x7F,0x77,0x78,0x7C,0x83,0x81,0x86,0x7F,0x84,0x82,0x7A,0x73,0x75,0x7E,0x82,0x83,0x83,0x7C,0x80,0x83,0x84,
-0x83,0x74,0x76,0x81,0x87,0x86,0x85,0x87,0x87,0x7B,0x7B,0x82,0x86,0x80,0x7D,0x7E,0x7B,0x7D,0x85,0x86,0x7F,0x7B,0x7C,0x86,0x84,0x83,
-0x82,0x83,0x8F,0x8E,0x80,0x84,0x85,0x7F,0x7C,0x7E,0x80,0x70,0x73,0x7C,0x7A,0x78,0x79,0x80,0x87,0x79,0x88,0x89,0x8A,0x8A,0x7B,0x7D,
-0x83,0x6F,0x7F,0x81,0x88,0x8E,0x88,0x8D,0x85,0x70,0x7D,0x7D,0x7E,0x7C,0x7E,0x85,0x7E,0x85,0x8E,0x88,0x8A,0x88,0x7F,0x79,0x6D,0x79,
-0x72,0x74,0x7A,0x7F,0x80,0x7A,0x6C,0x7D,0x79,0x85,0x8E,0x8D,0x8D,0x7C,0x74,0x85,0x85,0x87,0x90,0x92,0x91,0x77,0x82,0x7E,0x74,0x80,
-0x89,0x84,0x7C,0x69,0x7E,0x7F,0x7F,0x80,0x79,0x79,0x76,0x75,0x7D,0x81,0x8E,0x90,0x86,0x89,0x75,0x7C,0x81,0x7E,0x7C,0x80,0x87,0x8E,
-0x84,0x8F,0x81,0x80,0x85,0x79,0x70,0x73,0x75,0x85,0x7E,0x7F,0x8B,0x8D,0x8D,0x89,0x88,0x85,0x82,0x8B,0x8B,0x7D,0x77,0x6E,0x81,0x86,
-0x7C,0x75,0x7C,0x7E,0x79,0x75,0x81,0x78,0x73,0x81,0x83,0x82,0x7A,0x7F,0x88,0x84,0x80,0x84,0x79,0x6D,0x69,0x83,0x8A,0x87,0x88,0x89,
-0x84,0x71,0x6D,0x83,0x84,0x82,0x86,0x8B,0x8B,0x8F,0x98,0x9A,0x8A,0x81,0x87,0x82,0x73,0x69,0x74,0x7C,0x79,0x79,0x85,0x80,0x7D,0x75,
-0x8C,0x89,0x87,0x87,0x8A,0x81,0x73,0x73,0x88,0x89,0x8C,0x88,0x84,0x83,0x7C,0x88,0x85,0x7B,0x77,0x7C,0x7F,0x7C,0x6C,0x77,0x77,0x78,
-0x76,0x79,0x74,0x78,0x7B,0x83,0x80,0x82,0x7C,0x79,0x71,0x69,0x78,0x81,0x83,0x83,0x83,0x80,0x86,0x82,0x8E,0x88,0x7D,0x79,0x7E,0x7A,
-0x7E,0x75,0x85,0x87,0x86,0x85,0x89,0x81,0x77,0x84,0x8E,0x90,0x92,0x8F,0x8B,0x82,0x6F,0x7E,0x83,0x81,0x74,0x75,0x71,0x77,0x78,0x82,
-0x84,0x85,0x7D,0x80,0x7D,0x7F,0x89,0x88,0x83,0x7C,0x7C,0x7E,0x74,0x72,0x83,0x81,0x81,0x74,0x74,0x73,0x70,0x6E,0x80,0x82,0x88,0x88,
-0x97,0x90,0x95,0x94,0x8E,0x89,0x82,0x78,0x7C,0x74,0x75,0x75,0x73,0x73,0x6A,0x78,0x72,0x79,0x73,0x85,0x8E,0x90,0x8B,0x8C,0x83,0x8B,
-0x87,0x8E,0x8F,0x88,0x84,0x83,0x71,0x72,0x7C,0x81,0x83,0x79,0x73,0x73,0x73,0x74,0x79,0x77,0x7A,0x71,0x7E,0x71,0x76,0x7D,0x82,0x81,
-0x7F,0x73,0x7E,0x6D,0x75,0x79,0x81,0x85,0x81,0x8C,0x84,0x83,0x89,0x8C,0x8F,0x8E,0x81,0x83,0x77,0x7D,0x80,0x7F,0x82,0x86,0x86,0x8E,
-0x7D,0x82,0x84,0x8E,0x8F,0x8B,0x88,0x85,0x7A,0x7F,0x76,0x80,0x7C,0x7F,0x7E,0x71,0x73,0x80,0x80,0x81,0x7E,0x7A,0x78,0x73,0x6F,0x76,
-0x77,0x7B,0x7D,0x84,0x81,0x76,0x7A,0x75,0x74,0x77,0x76,0x7D,0x77,0x77,0x86,0x7F,0x82,0x83,0x8E,0x8A,0x89,0x8B,0x8F,0x86,0x85,0x7F,
-0x7E,0x7B,0x76,0x73,0x74,0x74,0x78,0x7F,0x89,0x83,0x84,0x8C,0x8A,0x8B,0x8E,0x92,0x8F,0x8A,0x8B,0x92,0x89,0x7F,0x83,0x7E,0x76,0x79,
-0x87,0x7F,0x7E,0x80,0x7B,0x77,0x79,0x72,0x81,0x76,0x77,0x76,0x75,0x75,0x72,0x6F,0x77,0x73,0x71,0x73,0x73,0x72,0x6E,0x7C,0x7A,0x77,
-0x76,0x7D,0x7A,0x79,0x7D,0x8D,0x84,0x89,0x85,0x7E,0x7B,0x79,0x78,0x81,0x80,0x83,0x8C,0x8C,0x89,0x85,0x8B,0x8A,0x87,0x86,0x89,0x83,
-0x80,0x7F,0x89,0x80,0x7C,0x81,0x7A,0x75,0x7A,0x86,0x89,0x85,0x87,0x8A,0x7E,0x7E,0x76,0x85,0x7D,0x7C,0x7F,0x81,0x78,0x75,0x6F,0x78,
-0x6F,0x6B,0x72,0x7C,0x75,0x71,0x81,0x83,0x80,0x87,0x89,0x89,0x8C,0x8E,0x95,0x90,0x87,0x85,0x85,0x78,0x72,0x72,0x71,0x73,0x77,0x77,
-0x7B,0x7F,0x7A,0x7F,0x81,0x7E,0x7F,0x86,0x85,0x80,0x89,0x8D,0x88,0x85,0x88,0x81,0x7B,0x7B,0x84,0x7C,0x7A,0x7A,0x81,0x7B,0x77,0x75,
-0x84,0x7E,0x7C,0x7D,0x7F,0x7C,0x76,0x74,0x7D,0x7B,0x6D,0x71,0x7C,0x76,0x6F,0x7F,0x81,0x7A,0x79,0x7C,0x7F,0x7E,0x7A,0x87,0x8E,0x8A,
-0x82,0x83,0x81,0x79,0x7D,0x78,0x7E,0x85,0x80,0x84,0x89,0x7E,0x8A,0x8D,0x8B,0x83,0x85,0x84,0x82,0x82,0x80,0x7D,0x7F,0x83,0x7F,0x7A,
-0x78,0x84,0x82,0x81,0x7C,0x7F,0x7C,0x76,0x6F,0x7B,0x76,0x78,0x7D,0x80,0x7C,0x74,0x74,0x81,0x7A,0x6B,0x73,0x7B,0x75,0x69,0x7A,0x7C,
-0x7E,0x80,0x83,0x88,0x89,0x85,0x8E,0x8F,0x8C,0x88,0x86,0x87,0x7B,0x7A,0x7A,0x7E,0x80,0x7D,0x83,0x86,0x7E,0x84,0x81,0x82,0x7E,0x82,
-0x82,0x7E,0x83,0x86,0x83,0x83,0x86,0x87,0x85,0x7F,0x83,0x83,0x84,0x81,0x82,0x7B,0x77,0x7A,0x7C,0x79,0x78,0x7C,0x82,0x85,0x78,0x7A,
-0x82,0x80,0x75,0x72,0x76,0x76,0x70,0x74,0x74,0x73,0x75,0x78,0x7B,0x76,0x79,0x81,0x84,0x85,0x80,0x7F,0x81,0x7C,0x7D,0x7B,0x7E,0x80,
-0x80,0x83,0x7E,0x7D,0x84,0x87,0x81,0x7D,0x82,0x87,0x81,0x82,0x82,0x82,0x83,0x81,0x81,0x7E,0x7C,0x81,0x87,0x87,0x83,0x83,0x84,0x7F,
-0x7B,0x7B,0x7E,0x7D,0x79,0x7A,0x7F,0x78,0x7C,0x80,0x7F,0x7C,0x77,0x7B,0x7C,0x78,0x77,0x7B,0x7D,0x7E,0x7F,0x84,0x83,0x8A,0x89,0x89,
-0x8A,0x86,0x84,0x7E,0x79,0x7C,0x7E,0x7C,0x7A,0x7C,0x83,0x7C,0x7D,0x7E,0x83,0x81,0x7D,0x7C,0x7F,0x7E,0x81,0x82,0x80,0x7F,0x80,0x84,
-0x7F,0x7A,0x7C,0x80,0x84,0x7E,0x79,0x7B,0x78,0x7A,0x7A,0x7E,0x7E,0x7C,0x80,0x80,0x79,0x7D,0x82,0x83,0x7C,0x72,0x76,0x7A,0x7C,0x76,
-0x74,0x77,0x7A,0x7B,0x7B,0x77,0x7F,0x82,0x87,0x89,0x83,0x81,0x80,0x81,0x80,0x83,0x81,0x7D,0x7D,0x85,0x7E,0x82,0x84,0x87,0x83,0x7A,
-0x81,0x88,0x88,0x84,0x7F,0x7D,0x78,0x82,0x85,0x7F,0x7B,0x7D,0x81,0x85,0x84,0x82,0x85,0x7D,0x7C,0x7A,0x7E,0x75,0x77,0x7B,0x7C,0x7A,
-0x7A,0x7A,0x7A,0x80,0x7A,0x7A,0x7B,0x7F,0x7B,0x76,0x7D,0x7F,0x84,0x85,0x84,0x87,0x8A,0x89,0x92,0x87,0x84,0x80,0x83,0x80,0x7B,0x80,
-0x7F,0x81,0x89,0x7D,0x7A,0x79,0x78,0x87,0x7C,0x7C,0x81,0x87,0x8B,0x7E,0x85,0x88,0x86,0x88,0x82,0x7F,0x7E,0x83,0x97,0x8D,0x85,0x7D,
-0x79,0x7E,0x7A,0x86,0x8B,0x81,0x81,0x7E,0x7F,0x7D,0x73,0x86,0x80,0x75,0x73,0x6E,0x74,0x75,0x6B,0x7C,0x7A,0x80,0x7F,0x7A,0x7A,0x7B,
-0x7E,0x89,0x7D,0x84,0x81,0x89,0x8F,0x8F,0x89,0x7D,0x76,0x7F,0x7B,0x7F,0x76,0x77,0x83,0x73,0x73,0x72,0x7C,0x80,0x78,0x6F,0x86,0x89,
-0x89,0x83,0x86,0x80,0x77,0x82,0x86,0x7C,0x7C,0x7A,0x84,0x86,0x70,0x7F,0x85,0x88,0x87,0x84,0x86,0x83,0x85,0x89,0x80,0x84,0x84,0x89,
-0x8E,0x7F,0x8F,0x92,0x89,0x88,0x7B,0x7E,0x81,0x86,0x9D,0x8B,0x88,0x91,0x97,0x91,0x80,0x75,0x83,0x80,0x88,0x8B,0x83,0x73,0x7B,0x84,
-0x81,0x7B,0x80,0x84,0x84,0x7E,0x70,0x7B,0x88,0x82,0x80,0x87,0x85,0x89,0x7D,0x8C,0x88,0x86,0x90,0x90,0x7E,0x75,0x6F,0x7D,0x7C,0x79,
-0x70,0x60,0x62,0x6E,0x6A,0x67,0x6C,0x70,0x6D,0x66,0x6E,0x68,0x75,0x7C,0x78,0x71,0x6A,0x69,0x70,0x6E,0x7E,0x83,0x7F,0x82,0x72,0x6C,
-0x73,0x7D,0x84,0x7A,0x7A,0x83,0x86,0x93,0x8D,0x96,0x8F,0x87,0x7D,0x79,0x71,0x7B,0x78,0x85,0x8F,0x86,0x84,0x8A,0x83,0x7C,0x7C,0x8F,
-0x97,0x93,0x99,0x90,0x8F,0x87,0x92,0x97,0x90,0x8E,0x83,0x80,0x83,0x7F,0x8D,0x92,0x92,0x8A,0x7B,0x7D,0x8B,0x91,0x9B,0xA5,0xA0,0x8F,
-0x88,0x85,0x83,0x91,0x96,0x90,0x8A,0x80,0x70,0x6B,0x61,0x69,0x69,0x71,0x74,0x72,0x75,0x78,0x6B,0x6F,0x6C,0x67,0x5E,0x5A,0x5F,0x64,
-0x70,0x7C,0x7E,0x77,0x71,0x7B,0x80,0x7D,0x87,0x7E,0x87,0x8D,0x80,0x7F,0x7F,0x7E,0x7B,0x78,0x76,0x7E,0x80,0x86,0x81,0x7F,0x80,0x80,
-0x88,0x7A,0x75,0x78,0x7B,0x8C,0x88,0x85,0x87,0x78,0x8B,0x93,0x90,0x90,0x89,0x89,0x7F,0x6E,0x6E,0x7C,0x81,0x86,0x8E,0x95,0x9C,0xA1,
-0xA5,0x97,0x8C,0x7E,0x84,0x7E,0x73,0x64,0x6A,0x6A,0x85,0x85,0x80,0x7A,0x74,0x75,0x7E,0x75,0x7D,0x80,0x85,0x86,0x7B,0x7D,0x73,0x7F,
-0x78,0x71,0x63,0x73,0x79,0x72,0x65,0x72,0x74,0x7E,0x78,0x7D,0x75,0x7A,0x85,0x8F,0x8C,0x8D,0x89,0x8E,0x93,0x98,0x9A,0x8A,0x83,0x81,
-0x7B,0x72,0x74,0x75,0x80,0x82,0x85,0x88,0x96,0x88,0x7D,0x74,0x71,0x6F,0x76,0x6A,0x69,0x67,0x68,0x80,0x82,0x83,0x83,0x78,0x79,0x7A,
-0x80,0x8B,0x89,0x8A,0x7C,0x7D,0x7B,0x7F,0x86,0x87,0x83,0x8F,0x82,0x8C,0x86,0x7B,0x87,0x82,0x82,0x90,0x80,0x83,0x7C,0x6D,0x84,0x7E,
-0x89,0x86,0x85,0x7E,0x81,0x80,0x7C,0x69,0x6E,0x66,0x71,0x69,0x6B,0x7C,0x83,0x88,0x94,0x8B,0x95,0x8B,0x7E,0x82,0x72,0x75,0x76,0x70,
-0x6F,0x69,0x5F,0x71,0x70,0x7F,0x72,0x76,0x75,0x70,0x82,0x89,0x85,0x89,0x85,0x8A,0x80,0x81,0x8D,0x89,0x85,0x80,0x7A,0x7F,0x79,0x86,
-0x83,0x76,0x7D,0x76,0x89,0x89,0x79,0x92,0x91,0x8E,0x9A,0x8B,0x96,0x92,0x8D,0x90,0x81,0x80,0x79,0x7B,0x84,0x71,0x81,0x88,0x8A,0x8F,
-0x86,0x92,0x8A,0x79,0x7D,0x78,0x6F,0x73,0x6C,0x6F,0x6A,0x6E,0x72,0x7B,0x82,0x84,0x7B,0x7F,0x7E,0x8A,0x8B,0x88,0x85,0x80,0x80,0x82,
-0x6F,0x82,0x85,0x8D,0x86,0x84,0x82,0x86,0x7F,0x8B,0x87,0x82,0x7E,0x81,0x82,0x79,0x82,0x88,0x88,0x86,0x80,0x7E,0x7B,0x76,0x81,0x7B,
-0x84,0x74,0x71,0x73,0x75,0x6B,0x7D,0x7F,0x8E,0x89,0x92,0x90,0x7F,0x83,0x85,0x88,0x7B,0x78,0x7F,0x76,0x68,0x6E,0x78,0x74,0x75,0x76,
-0x72,0x74,0x7A,0x82,0x86,0x8B,0x8A,0x8D,0x87,0x80,0x88,0x8F,0x8E,0x87,0x85,0x89,0x86,0x77,0x79,0x81,0x80,0x78,0x84,0x8F,0x89,0x82,
-0x8D,0x8E,0x8A,0x8C,0x92,0x88,0x86,0x8B,0x80,0x8E,0x85,0x84,0x87,0x8A,0x85,0x7E,0x81,0x7E,0x85,0x80,0x82,0x86,0x7C,0x74,0x79,0x6B,
-0x6C,0x6F,0x69,0x5E,0x6F,0x6C,0x65,0x63,0x70,0x6B,0x6A,0x77,0x73,0x75,0x7C,0x7A,0x7D,0x81,0x77,0x82,0x8B,0x8C,0x85,0x8B,0x91,0x88,
-0x84,0x81,0x87,0x86,0x75,0x76,0x83,0x77,0x78,0x81,0x88,0x7C,0x7D,0x7B,0x7A,0x7B,0x7C,0x71,0x84,0x7F,0x78,0x7B,0x7F,0x83,0x83,0x86,
-0x8C,0x92,0x8E,0x86,0x82,0x85,0x7F,0x87,0x84,0x7B,0x76,0x76,0x73,0x7D,0x78,0x71,0x73,0x79,0x74,0x6F,0x84,0x86,0x93,0x90,0x91,0x90,
-0x92,0x84,0x87,0x8C,0x8B,0x85,0x81,0x87,0x80,0x7C,0x7A,0x80,0x7C,0x75,0x71,0x84,0x76,0x81,0x80,0x8F,0x8B,0x88,0x85,0x8E,0x96,0x87,
-0x7E,0x8A,0x85,0x75,0x78,0x7A,0x7D,0x79,0x7A,0x7A,0x7D,0x79,0x7E,0x7B,0x7F,0x73,0x77,0x6A,0x6D,0x6A,0x6A,0x64,0x6E,0x77,0x71,0x6C,
-0x70,0x6F,0x73,0x80,0x77,0x7B,0x7D,0x80,0x7C,0x84,0x85,0x87,0x91,0x92,0x87,0x86,0x8F,0x93,0x8E,0x7D,0x88,0x89,0x7C,0x7A,0x7E,0x79,
-0x83,0x81,0x85,0x80,0x81,0x7C,0x79,0x83,0x7A,0x73,0x76,0x7A,0x72,0x70,0x71,0x82,0x77,0x7F,0x89,0x87,0x83,0x80,0x7F,0x82,0x80,0x84,
-0x7E,0x78,0x76,0x77,0x7A,0x70,0x7E,0x7D,0x7A,0x74,0x71,0x73,0x81,0x83,0x84,0x8D,0x8F,0x8B,0x91,0x8F,0x8B,0x88,0x97,0x93,0x84,0x7D,
-0x7D,0x90,0x81,0x79,0x86,0x84,0x7F,0x79,0x84,0x87,0x87,0x8D,0x96,0x91,0x8A,0x86,0x9E,0x9D,0x92,0x89,0x94,0x92,0x83,0x76,0x7F,0x81,
-0x83,0x86,0x7D,0x80,0x86,0x87,0x85,0x80,0x72,0x74,0x6E,0x64,0x5D,0x6E,0x67,0x72,0x6F,0x6A,0x66,0x6F,0x74,0x7C,0x74,0x6F,0x7C,0x74,
-0x70,0x71,0x86,0x7C,0x7A,0x89,0x89,0x81,0x7E,0x81,0x91,0x80,0x7D,0x8A,0x86,0x7B,0x6E,0x89,0x88,0x84,0x81,0x87,0x8B,0x81,0x6F,0x8A,
-0x91,0x84,0x76,0x81,0x7D,0x72,0x72,0x7F,0x81,0x7E,0x8C,0x8B,0x87,0x80,0x95,0x92,0x87,0x79,0x7B,0x75,0x75,0x74,0x7B,0x76,0x7B,0x78,
-0x79,0x72,0x72,0x7A,0x87,0x81,0x77,0x81,0x86,0x86,0x7C,0x87,0x80,0x84,0x91,0x8F,0x7D,0x7C,0x7C,0x94,0x86,0x76,0x7B,0x85,0x80,0x74,
-0x83,0x83,0x86,0x89,0x90,0x8E,0x8C,0x87,0x9C,0xA4,0x92,0x96,0x9B,0x95,0x7D,0x7C,0x80,0x8A,0x83,0x85,0x7C,0x7C,0x80,0x95,0x9B,0x81,
-0x73,0x79,0x75,0x72,0x65,0x70,0x6F,0x66,0x72,0x6F,0x6B,0x66,0x72,0x80,0x76,0x68,0x71,0x6A,0x76,0x6B,0x7B,0x7C,0x7D,0x81,0x8B,0x81,
-0x82,0x88,0x99,0x8D,0x7D,0x7E,0x7F,0x80,0x6D,0x75,0x82,0x7A,0x7F,0x8C,0x82,0x78,0x77,0x87,0x94,0x7C,0x7A,0x7D,0x80,0x82,0x7C,0x80,
-0x83,0x85,0x96,0x7F,0x7E,0x7A,0x91,0x9B,0x89,0x76,0x73,0x77,0x7F,0x71,0x7D,0x80,0x79,0x83,0x7A,0x79,0x6D,0x7E,0x96,0x7F,0x74,0x7C,
-0x7B,0x8E,0x7D,0x7F,0x8B,0x85,0x87,0x8A,0x7D,0x7B,0x7C,0x90,0x91,0x7A,0x79,0x77,0x83,0x76,0x77,0x81,0x7F,0x88,0x86,0x7E,0x7E,0x7E,
-0x97,0xA4,0x89,0x8B,0x84,0x8C,0x91,0x82,0x85,0x86,0x87,0x97,0x76,0x74,0x6A,0x85,0x9B,0x85,0x72,0x72,0x77,0x83,0x70,0x74,0x77,0x6A,
-0x79,0x74,0x74,0x6D,0x6A,0x81,0x71,0x69,0x6D,0x6E,0x7E,0x70,0x74,0x7F,0x7B,0x86,0x84,0x80,0x86,0x91,0xA0,0x99,0x7F,0x7B,0x72,0x83,
-0x84,0x77,0x7B,0x77,0x7B,0x82,0x7D,0x7C,0x71,0x89,0x99,0x85,0x87,0x74,0x79,0x8D,0x8D,0x8D,0x8E,0x82,0x90,0x80,0x83,0x7A,0x85,0x96,
-0x7D,0x75,0x69,0x73,0x7C,0x72,0x7C,0x7E,0x72,0x7C,0x78,0x73,0x68,0x73,0x93,0x8C,0x7A,0x73,0x6B,0x7E,0x76,0x7D,0x7B,0x77,0x83,0x7E,
-0x7D,0x7C,0x7A,0x8E,0x9B,0x84,0x7B,0x77,0x7D,0x82,0x84,0x84,0x85,0x8A,0x8B,0x85,0x83,0x7B,0x97,0xA9,0x95,0x90,0x82,0x8F,0x95,0x8D,
-0x8D,0x8E,0x89,0x8B,0x7D,0x7B,0x72,0x85,0x8E,0x7D,0x75,0x67,0x70,0x7B,0x70,0x75,0x71,0x6B,0x75,0x71,0x72,0x6C,0x77,0x7C,0x79,0x6C,
-0x6A,0x67,0x73,0x69,0x79,0x77,0x79,0x7E,0x76,0x79,0x86,0x86,0x9B,0x99,0x83,0x78,0x77,0x7F,0x84,0x8B,0x81,0x7D,0x7F,0x7F,0x83,0x80,
-0x6B,0x87,0x95,0x8E,0x81,0x73,0x7D,0x88,0x8E,0x9C,0x9B,0x97,0x90,0x83,0x8C,0x80,0x95,0x9A,0x8F,0x78,0x70,0x72,0x7F,0x7E,0x88,0x78,
-0x7D,0x83,0x7B,0x79,0x77,0x89,0x96,0x97,0x80,0x6E,0x67,0x73,0x79,0x86,0x81,0x7E,0x83,0x79,0x78,0x81,0x79,0x92,0x92,0x82,0x72,0x73,
-0x79,0x7D,0x88,0x82,0x81,0x89,0x83,0x76,0x77,0x6E,0x8C,0x95,0x8C,0x80,0x79,0x7B,0x82,0x80,0x90,0x93,0x95,0x8E,0x77,0x74,0x6D,0x7D,
-0x89,0x84,0x6E,0x68,0x67,0x6F,0x6E,0x79,0x74,0x78,0x79,0x70,0x76,0x77,0x7C,0x84,0x86,0x79,0x70,0x6C,0x72,0x77,0x85,0x80,0x87,0x85,
-0x7F,0x83,0x87,0x81,0x96,0x90,0x8A,0x78,0x79,0x7E,0x8C,0x90,0x84,0x78,0x7B,0x7E,0x78,0x79,0x74,0x84,0x89,0x87,0x7D,0x78,0x75,0x85,
-0x8F,0x99,0x95,0x96,0x8A,0x82,0x79,0x7B,0x8F,0x94,0x8C,0x76,0x6B,0x68,0x6E,0x74,0x7A,0x75,0x75,0x77,0x6E,0x73,0x72,0x80,0x95,0x9C,
-0x84,0x71,0x6D,0x71,0x7B,0x8A,0x8B,0x86,0x7F,0x79,0x79,0x7E,0x82,0x92,0x91,0x8B,0x7E,0x76,0x78,0x8B,0x87,0x8B,0x90,0x8B,0x82,0x76,
-0x81,0x83,0x94,0x9B,0x97,0x86,0x87,0x7F,0x85,0x8C,0x99,0x96,0x96,0x9B,0x91,0x76,0x77,0x84,0x83,0x7E,0x7D,0x70,0x65,0x63,0x6E,0x75,
-0x78,0x71,0x70,0x67,0x6C,0x70,0x72,0x7E,0x89,0x72,0x6A,0x6A,0x6D,0x70,0x78,0x80,0x7C,0x78,0x7C,0x76,0x7C,0x83,0x93,0x8A,0x88,0x81,
-0x75,0x75,0x92,0x8E,0x86,0x81,0x78,0x7C,0x71,0x74,0x7C,0x84,0x82,0x8A,0x7B,0x7D,0x7D,0x82,0x81,0x9B,0x98,0x90,0x9B,0x97,0x87,0x89,
-0x90,0x8F,0x88,0x83,0x7C,0x7B,0x79,0x80,0x82,0x7F,0x80,0x7D,0x6F,0x7A,0x81,0x88,0x90,0xA0,0x8C,0x71,0x6E,0x79,0x80,0x82,0x8C,0x83,
-0x78,0x7D,0x73,0x7D,0x8F,0x9B,0x8A,0x86,0x80,0x72,0x6C,0x86,0x8A,0x88,0x81,0x7B,0x78,0x6D,0x73,0x7C,0x8A,0x84,0x8A,0x73,0x74,0x75,
-0x73,0x75,0x94,0x90,0x84,0x93,0x8E,0x80,0x7B,0x7E,0x7D,0x7A,0x76,0x6B,0x68,0x69,0x76,0x77,0x74,0x75,0x71,0x61,0x6B,0x80,0x79,0x81,
-0x95,0x82,0x7B,0x73,0x7C,0x7D,0x7E,0x92,0x93,0x8B,0x8E,0x79,0x7B,0x8D,0x9F,0x8D,0x8B,0x88,0x7A,0x72,0x8D,0x91,0x8C,0x74,0x77,0x78,
-0x67,0x6D,0x7E,0x81,0x7A,0x87,0x79,0x7B,0x7E,0x76,0x78,0x94,0x90,0x88,0x8A,0x8A,0x80,0x83,0x86,0x85,0x7B,0x6E,0x76,0x70,0x77,0x81,
-0x80,0x70,0x71,0x6F,0x63,0x6F,0x8A,0x7E,0x83,0x97,0x8D,0x83,0x6F,0x77,0x80,0x7F,0x8C,0x8B,0x7F,0x76,0x74,0x81,0x90,0xA1,0x93,0x8D,
-0x87,0x75,0x74,0x8C,0x99,0x8B,0x83,0x87,0x82,0x7A,0x7F,0x93,0x90,0x90,0x94,0x84,0x80,0x79,0x7C,0x83,0x94,0x93,0x90,0x8F,0x8A,0x81,
-0x85,0x79,0x84,0x72,0x69,0x68,0x62,0x76,0x7E,0x7E,0x76,0x72,0x65,0x58,0x5B,0x6F,0x6C,0x7D,0x82,0x82,0x76,0x6B,0x6B,0x71,0x7D,0x85,
-0x8E,0x82,0x71,0x6B,0x76,0x83,0x95,0x8D,0x88,0x82,0x78,0x73,0x84,0x86,0x86,0x84,0x7F,0x70,0x69,0x73,0x87,0x75,0x7E,0x83,0x81,0x80,
-0x75,0x80,0x81,0x91,0x97,0x92,0x95,0x8D,0x8E,0x98,0x8A,0x8C,0x7B,0x86,0x84,0x7B,0x8A,0x93,0x91,0x81,0x79,0x73,0x6E,0x72,0x83,0x80,
-0x8C,0x8D,0x96,0x87,0x7B,0x71,0x77,0x7F,0x8B,0x85,0x7A,0x7A,0x7A,0x81,0x87,0x97,0x92,0x85,0x76,0x74,0x7A,0x89,0x81,0x84,0x83,0x7B,
-0x6E,0x66,0x7E,0x83,0x78,0x85,0x81,0x80,0x6B,0x6C,0x7C,0x7C,0x82,0x8A,0x8E,0x90,0x7D,0x81,0x8C,0x89,0x81,0x6D,0x75,0x68,0x69,0x7F,
-0x87,0x82,0x80,0x7C,0x74,0x5F,0x56,0x6F,0x7D,0x8B,0x86,0x8C,0x8F,0x84,0x74,0x76,0x85,0xA0,0x9B,0x93,0x8D,0x7F,0x87,0x8B,0x92,0x92,
-0x86,0x8B,0x83,0x82,0x80,0x7F,0x90,0x90,0x82,0x6B,0x69,0x81,0x74,0x65,0x79,0x80,0x81,0x70,0x75,0x7E,0x7D,0x83,0x8E,0x8F,0x8C,0x84,
-0x89,0x8B,0x7B,0x7A,0x6D,0x79,0x70,0x6E,0x85,0x90,0x83,0x7E,0x75,0x70,0x62,0x5E,0x71,0x81,0x8C,0x87,0x8C,0x8D,0x7B,0x79,0x76,0x7D,
-0x8D,0x7C,0x80,0x83,0x7F,0x7F,0x8C,0x96,0x96,0x7D,0x7E,0x7A,0x89,0x83,0x88,0x91,0x97,0x8A,0x80,0x73,0x86,0x86,0x83,0x96,0x90,0x85,
-0x79,0x7E,0x79,0x79,0x79,0x93,0x93,0x8B,0x7C,0x89,0x86,0x7D,0x7D,0x6B,0x6D,0x6E,0x70,0x7C,0x81,0x76,0x83,0x88,0x74,0x57,0x5B,0x65,
-0x77,0x80,0x7F,0x89,0x92,0x7C,0x70,0x6A,0x73,0x8C,0x86,0x82,0x82,0x7E,0x78,0x83,0x85,0x88,0x7E,0x87,0x7F,0x7E,0x72,0x7D,0x85,0x93,
-0x80,0x7A,0x72,0x7A,0x70,0x74,0x7F,0x7B,0x80,0x7B,0x81,0x7C,0x7F,0x85,0x8F,0x92,0x8E,0x8E,0x98,0x87,0x7F,0x83,0x7B,0x7A,0x7C,0x89,
-0x9B,0x96,0x89,0x8D,0x8E,0x76,0x63,0x6B,0x73,0x81,0x88,0x8A,0x93,0x93,0x84,0x84,0x7C,0x76,0x80,0x85,0x83,0x7E,0x7B,0x7E,0x90,0x8B,
-0x86,0x78,0x77,0x71,0x7C,0x7C,0x83,0x89,0x95,0x8D,0x7C,0x71,0x75,0x75,0x7B,0x84,0x79,0x7C,0x7C,0x7D,0x76,0x7D,0x87,0x98,0x93,0x82,
-0x7E,0x83,0x75,0x78,0x82,0x72,0x6D,0x78,0x7B,0x7D,0x74,0x72,0x84,0x88,0x75,0x5F,0x66,0x69,0x72,0x81,0x8E,0x90,0x8E,0x85,0x80,0x72,
-0x73,0x8D,0x9E,0x9A,0x91,0x92,0x97,0x91,0x8C,0x8C,0x84,0x84,0x78,0x7A,0x79,0x7E,0x8B,0x93,0x97,0x89,0x79,0x75,0x6B,0x6C,0x6F,0x6E,
-0x79,0x7E,0x7C,0x77,0x71,0x73,0x85,0x8C,0x89,0x8B,0x8B,0x7D,0x7B,0x85,0x73,0x6B,0x79,0x86,0x88,0x80,0x78,0x7F,0x7D,0x70,0x6A,0x73,
-0x72,0x7F,0x86,0x89,0x80,0x87,0x83,0x83,0x7D,0x70,0x7E,0x91,0x88,0x79,0x86,0x8F,0x89,0x8A,0x8B,0x79,0x71,0x76,0x7F,0x88,0x85,0x91,
-0x98,0x9B,0x8C,0x7F,0x7A,0x7E,0x84,0x8B,0x84,0x88,0x8C,0x87,0x86,0x7C,0x79,0x8B,0x8D,0x83,0x78,0x7F,0x7F,0x84,0x88,0x7B,0x78,0x7B,
-0x7F,0x78,0x6F,0x6C,0x80,0x81,0x6C,0x64,0x68,0x64,0x74,0x7B,0x8A,0x83,0x86,0x82,0x76,0x6E,0x6D,0x82,0x94,0x8A,0x83,0x8C,0x89,0x7D,
-0x7B,0x85,0x7D,0x7C,0x7A,0x80,0x7D,0x76,0x89,0x9C,0x96,0x85,0x7F,0x71,0x6E,0x6F,0x77,0x7D,0x84,0x85,0x88,0x81,0x75,0x6E,0x86,0x90,
-0x8E,0x8B,0x8C,0x89,0x84,0x85,0x80,0x7F,0x82,0x8D,0x8B,0x85,0x7F,0x8D,0x87,0x83,0x81,0x79,0x72,0x7E,0x80,0x83,0x7E,0x89,0x88,0x84,
-0x7F,0x77,0x91,0x95,0x8C,0x82,0x86,0x84,0x82,0x77,0x7C,0x69,0x66,0x71,0x84,0x7F,0x7C,0x8F,0x99,0x8E,0x81,0x7E,0x6F,0x74,0x79,0x7A,
-0x78,0x80,0x83,0x83,0x7F,0x75,0x6E,0x8E,0x8E,0x7C,0x7A,0x80,0x8C,0x7C,0x74,0x7C,0x71,0x7A,0x80,0x7C,0x74,0x74,0x89,0x83,0x76,0x77,
-0x6F,0x6C,0x7B,0x7F,0x84,0x7F,0x8A,0x7F,0x74,0x72,0x7B,0x91,0x98,0x96,0x93,0x96,0x92,0x8D,0x80,0x8B,0x7A,0x74,0x78,0x7D,0x70,0x78,
-0x88,0x9F,0x89,0x85,0x84,0x75,0x73,0x73,0x73,0x78,0x74,0x80,0x7E,0x77,0x67,0x5D,0x7E,0x80,0x7F,0x83,0x86,0x87,0x7F,0x79,0x87,0x75,
-0x81,0x85,0x82,0x71,0x71,0x85,0x86,0x7D,0x85,0x7B,0x7C,0x81,0x76,0x7B,0x7B,0x82,0x88,0x7B,0x71,0x74,0x87,0x9E,0x94,0x8E,0x8C,0x88,
-0x89,0x7B,0x81,0x66,0x62,0x7C,0x83,0x7B,0x81,0x8B,0xA3,0x83,0x84,0x87,0x7A,0x7E,0x7D,0x7D,0x8B,0x8C,0x99,0x90,0x8B,0x77,0x75,0x8B,
-0x80,0x73,0x78,0x82,0x8A,0x8B,0x82,0x89,0x76,0x7F,0x8C,0x87,0x6E,0x75,0x82,0x7F,0x74,0x7F,0x71,0x71,0x7B,0x6C,0x7E,0x7E,0x7C,0x7F,
-0x76,0x74,0x7B,0x81,0x9A,0x8A,0x8A,0x88,0x86,0x82,0x76,0x7F,0x6E,0x68,0x7A,0x7B,0x76,0x7B,0x84,0x98,0x80,0x80,0x7A,0x6A,0x6C,0x77,
-0x75,0x7F,0x80,0x88,0x87,0x80,0x6D,0x68,0x7C,0x80,0x7D,0x85,0x8F,0x92,0x93,0x87,0x94,0x7F,0x7E,0x89,0x83,0x74,0x79,0x8E,0x8F,0x8A,
-0x98,0x86,0x81,0x81,0x6B,0x77,0x77,0x7E,0x85,0x7E,0x7C,0x81,0x89,0xA6,0x9E,0x9A,0x8A,0x86,0x7C,0x77,0x70,0x67,0x64,0x75,0x7A,0x7B,
-0x7D,0x86,0x96,0x83,0x81,0x7F,0x6E,0x6D,0x74,0x7D,0x81,0x80,0x87,0x84,0x7F,0x75,0x6E,0x80,0x7B,0x70,0x79,0x87,0x8E,0x8A,0x78,0x7E,
-0x70,0x73,0x82,0x7D,0x75,0x71,0x7F,0x88,0x87,0x8C,0x7E,0x7A,0x7C,0x70,0x79,0x76,0x79,0x7B,0x7C,0x82,0x88,0x86,0x98,0x92,0x99,0x94,
-0x90,0x87,0x7F,0x7D,0x79,0x74,0x82,0x7F,0x78,0x77,0x8A,0x98,0x8F,0x83,0x7C,0x71,0x79,0x83,0x8B,0x91,0x80,0x7D,0x7F,0x79,0x71,0x69,
-0x77,0x75,0x76,0x83,0x91,0x95,0x90,0x86,0x8E,0x79,0x7A,0x7A,0x78,0x77,0x74,0x7E,0x8B,0x92,0x92,0x86,0x82,0x7D,0x77,0x74,0x6C,0x76,
-0x78,0x7A,0x7D,0x80,0x7B,0x97,0x97,0x9C,0x93,0x83,0x78,0x74,0x70,0x6F,0x6B,0x75,0x78,0x76,0x7C,0x87,0x96,0x88,0x86,0x7D,0x72,0x74,
-0x7C,0x83,0x8A,0x86,0x8C,0x8C,0x84,0x80,0x72,0x7B,0x74,0x74,0x7A,0x89,0x8E,0x8D,0x85,0x8C,0x78,0x7D,0x7F,0x7E,0x7E,0x79,0x78,0x84,
-0x88,0x88,0x7F,0x7A,0x75,0x6C,0x6D,0x6A,0x77,0x79,0x81,0x88,0x85,0x7D,0x8F,0x8C,0x91,0x8C,0x85,0x78,0x70,0x7B,0x78,0x78,0x79,0x77,
-0x76,0x7C,0x80,0x92,0x83,0x84,0x73,0x68,0x6E,0x81,0x85,0x88,0x81,0x80,0x7D,0x7C,0x78,0x6D,0x70,0x70,0x7C,0x89,0x94,0x92,0x95,0x8C,
-0x97,0x7E,0x7A,0x76,0x79,0x80,0x82,0x83,0x91,0x93,0x95,0x8E,0x86,0x81,0x6C,0x70,0x62,0x6E,0x7A,0x86,0x8C,0x82,0x79,0x96,0x99,0x9F,
-0x8E,0x87,0x75,0x6C,0x75,0x76,0x70,0x6A,0x6D,0x71,0x79,0x7D,0x8F,0x83,0x89,0x7A,0x74,0x7A,0x7E,0x74,0x87,0x8F,0x8B,0x82,0x7E,0x83,
-0x7A,0x70,0x76,0x87,0x81,0x84,0x8A,0x90,0x88,0x92,0x73,0x75,0x76,0x75,0x84,0x8A,0x87,0x8E,0x8D,0x98,0x92,0x83,0x75,0x6F,0x6C,0x6A,
-0x79,0x83,0x88,0x8F,0x89,0x7C,0x95,0x90,0x95,0x8F,0x89,0x7B,0x76,0x7B,0x84,0x7C,0x74,0x79,0x7F,0x79,0x7A,0x8A,0x87,0x88,0x7B,0x72,
-0x7E,0x7C,0x7A,0x8D,0x8B,0x86,0x79,0x6B,0x74,0x66,0x57,0x6E,0x84,0x7A,0x7D,0x8C,0x92,0x86,0x94,0x7A,0x7B,0x71,0x6E,0x7C,0x84,0x7B,
-0x8B,0x8A,0x94,0x8C,0x86,0x77,0x79,0x68,0x64,0x71,0x7B,0x7C,0x82,0x82,0x78,0x94,0x93,0x93,0x8C,0x85,0x7B,0x73,0x73,0x80,0x70,0x6B,
-0x73,0x7B,0x7B,0x7F,0x8A,0x89,0x85,0x82,0x7D,0x82,0x80,0x7F,0x95,0x94,0x8A,0x83,0x7F,0x8B,0x77,0x67,0x86,0x8D,0x79,0x7C,0x88,0x8D,
-0x84,0x83,0x7C,0x74,0x6F,0x70,0x88,0x88,0x7E,0x93,0x94,0x94,0x87,0x7D,0x6D,0x74,0x5C,0x64,0x78,0x81,0x7B,0x87,0x8A,0x80,0x91,0x94,
-0x8F,0x81,0x7B,0x73,0x7B,0x71,0x84,0x78,0x76,0x79,0x7B,0x74,0x72,0x7A,0x88,0x7B,0x7C,0x79,0x7A,0x7B,0x7D,0x8B,0x8F,0x84,0x7B,0x73,
-0x74,0x65,0x63,0x81,0x88,0x7A,0x87,0x94,0x9B,0x92,0x90,0x8E,0x82,0x74,0x7D,0x89,0x83,0x7F,0x94,0x9B,0x96,0x92,0x84,0x7D,0x7B,0x5E,
-0x71,0x7C,0x75,0x76,0x88,0x90,0x84,0x91,0x97,0x93,0x8D,0x80,0x7B,0x83,0x71,0x7D,0x75,0x6A,0x69,0x72,0x6D,0x74,0x75,0x87,0x81,0x87,
-0x7B,0x7D,0x83,0x7F,0x88,0x93,0x82,0x79,0x7B,0x7B,0x70,0x72,0x85,0x8E,0x78,0x7A,0x81,0x8C,0x88,0x7F,0x82,0x6D,0x68,0x77,0x7D,0x7E,
-0x7F,0x99,0xA5,0x94,0x90,0x7F,0x80,0x7B,0x60,0x76,0x81,0x7F,0x7B,0x7F,0x87,0x81,0x8A,0x9A,0x8C,0x84,0x76,0x81,0x84,0x73,0x7E,0x8B,
-0x7A,0x76,0x7B,0x6F,0x74,0x74,0x88,0x85,0x87,0x82,0x84,0x8A,0x7F,0x81,0x97,0x87,0x7E,0x74,0x68,0x6A,0x67,0x7A,0x82,0x79,0x78,0x87,
-0x92,0x89,0x82,0x91,0x80,0x71,0x76,0x7F,0x7E,0x7A,0x8C,0x98,0x8B,0x8B,0x83,0x7B,0x72,0x5E,0x6F,0x77,0x71,0x74,0x7F,0x88,0x80,0x81,
-0x98,0x90,0x82,0x77,0x80,0x87,0x75,0x77,0x81,0x6E,0x6E,0x77,0x73,0x73,0x75,0x8B,0x90,0x86,0x81,0x84,0x90,0x8B,0x8E,0x93,0x87,0x80,
-0x78,0x74,0x7C,0x7A,0x93,0x98,0x84,0x77,0x85,0x94,0x8F,0x7C,0x84,0x7E,0x75,0x78,0x79,0x7A,0x83,0x98,0xA9,0x9A,0x86,0x87,0x84,0x74,
-0x66,0x72,0x7E,0x7B,0x77,0x6F,0x7A,0x7F,0x80,0x96,0x8A,0x76,0x74,0x7B,0x7F,0x6A,0x7B,0x8E,0x7A,0x72,0x72,0x71,0x67,0x6B,0x89,0x8D,
-0x80,0x82,0x85,0x8A,0x7F,0x83,0x8C,0x8A,0x79,0x6D,0x6D,0x6E,0x69,0x83,0x8D,0x88,0x7B,0x85,0x99,0x93,0x7B,0x8A,0x87,0x79,0x7A,0x7E,
-0x7C,0x78,0x86,0x9A,0x91,0x86,0x83,0x81,0x79,0x6F,0x74,0x74,0x76,0x7A,0x75,0x81,0x81,0x7D,0x9C,0x92,0x7C,0x79,0x81,0x88,0x74,0x7F,
-0x7E,0x72,0x6F,0x72,0x6D,0x60,0x66,0x91,0x90,0x7E,0x80,0x8D,0x93,0x8F,0x86,0x91,0x8D,0x7B,0x72,0x73,0x7B,0x7D,0x8F,0x90,0x83,0x71,
-0x7E,0x98,0x93,0x74,0x83,0x84,0x75,0x72,0x71,0x79,0x7B,0x8A,0xA4,0x95,0x88,0x86,0x87,0x82,0x76,0x7F,0x80,0x7E,0x74,0x69,0x76,0x80,
-0x82,0x90,0x8B,0x78,0x6E,0x73,0x79,0x72,0x7F,0x88,0x80,0x76,0x75,0x70,0x64,0x68,0x8B,0x8D,0x83,0x86,0x8E,0x8D,0x8C,0x84,0x90,0x8A,
-0x7C,0x78,0x6F,0x70,0x6B,0x7E,0x8B,0x80,0x74,0x79,0x93,0x89,0x77,0x8B,0x8B,0x7E,0x7B,0x7B,0x7C,0x79,0x7F,0x9F,0x94,0x84,0x7D,0x83,
-0x80,0x6F,0x73,0x75,0x7E,0x80,0x75,0x7C,0x85,0x85,0x90,0x92,0x7D,0x75,0x7D,0x7F,0x79,0x79,0x7F,0x7C,0x77,0x73,0x67,0x67,0x6D,0x8B,
-0x89,0x84,0x84,0x8E,0x91,0x90,0x86,0x90,0x80,0x7C,0x76,0x72,0x80,0x7F,0x89,0x92,0x84,0x7A,0x7E,0x90,0x85,0x78,0x86,0x84,0x78,0x74,
-0x72,0x79,0x7F,0x92,0x9F,0x99,0x82,0x81,0x86,0x84,0x7B,0x7E,0x7B,0x77,0x73,0x68,0x6E,0x7D,0x79,0x8A,0x90,0x7F,0x71,0x76,0x7B,0x7C,
-0x7B,0x8B,0x81,0x7F,0x6C,0x67,0x6B,0x68,0x84,0x92,0x86,0x83,0x87,0x8C,0x8B,0x84,0x81,0x7A,0x7C,0x78,0x6A,0x75,0x72,0x7F,0x8D,0x87,
-0x7C,0x81,0x8B,0x8A,0x83,0x89,0x8D,0x82,0x7C,0x76,0x76,0x7B,0x88,0x95,0x92,0x80,0x86,0x85,0x83,0x7C,0x7C,0x7D,0x7A,0x78,0x6C,0x70,
-0x7F,0x7A,0x90,0x96,0x83,0x77,0x78,0x7C,0x78,0x70,0x7D,0x74,0x76,0x64,0x65,0x67,0x67,0x77,0x88,0x82,0x87,0x86,0x8D,0x91,0x8E,0x80,
-0x86,0x85,0x7D,0x70,0x7F,0x82,0x83,0x8A,0x83,0x7F,0x7E,0x7F,0x88,0x87,0x86,0x83,0x78,0x76,0x72,0x74,0x7F,0x89,0x9B,0x93,0x8B,0x8D,
-0x88,0x8A,0x8B,0x8D,0x8C,0x81,0x7C,0x71,0x75,0x7C,0x7D,0x8E,0x91,0x84,0x76,0x74,0x7A,0x78,0x71,0x82,0x85,0x7E,0x6F,0x6A,0x70,0x71,
-0x7A,0x87,0x81,0x86,0x85,0x88,0x8F,0x87,0x83,0x82,0x7F,0x76,0x69,0x75,0x7F,0x7E,0x81,0x83,0x89,0x7C,0x79,0x87,0x89,0x8B,0x88,0x7D,
-0x7E,0x74,0x75,0x7C,0x82,0x91,0x89,0x80,0x87,0x82,0x7D,0x7D,0x82,0x81,0x7A,0x78,0x73,0x70,0x7C,0x81,0x8E,0x8F,0x86,0x7D,0x73,0x76,
-0x76,0x6C,0x7B,0x81,0x76,0x6D,0x68,0x77,0x72,0x71,0x84,0x8D,0x8F,0x89,0x8B,0x93,0x88,0x8B,0x84,0x7F,0x7F,0x74,0x7B,0x8C,0x8B,0x8C,
-0x86,0x8A,0x86,0x81,0x87,0x8D,0x88,0x7E,0x7D,0x82,0x78,0x7C,0x85,0x88,0x93,0x8C,0x8B,0x8E,0x88,0x88,0x88,0x8A,0x8F,0x7F,0x71,0x6B,
-0x6A,0x76,0x7B,0x85,0x8B,0x81,0x7D,0x78,0x76,0x77,0x70,0x7C,0x7E,0x77,0x69,0x5E,0x6D,0x74,0x73,0x7C,0x84,0x8B,0x7E,0x7B,0x85,0x82,
-0x7E,0x7B,0x7A,0x73,0x62,0x70,0x85,0x81,0x84,0x80,0x86,0x8A,0x7E,0x83,0x8C,0x8F,0x84,0x7F,0x7D,0x7A,0x74,0x77,0x7D,0x89,0x80,0x83,
-0x88,0x83,0x81,0x89,0x85,0x8F,0x83,0x74,0x72,0x6C,0x79,0x80,0x85,0x91,0x8C,0x85,0x7E,0x7A,0x77,0x6D,0x7A,0x7E,0x79,0x71,0x67,0x71,
-0x78,0x6F,0x7B,0x84,0x8E,0x83,0x80,0x8A,0x8C,0x87,0x83,0x84,0x7F,0x71,0x74,0x84,0x82,0x81,0x79,0x80,0x8A,0x80,0x84,0x8E,0x87,0x81,
-0x7E,0x7B,0x7D,0x73,0x7F,0x83,0x8C,0x81,0x8A,0x8A,0x89,0x86,0x8F,0x87,0x9B,0x86,0x6D,0x6F,0x6C,0x77,0x81,0x82,0x88,0x80,0x83,0x7F,
-0x74,0x70,0x70,0x7D,0x7C,0x7D,0x76,0x69,0x6D,0x80,0x72,0x7D,0x82,0x8B,0x81,0x7F,0x85,0x8E,0x8A,0x87,0x82,0x73,0x70,0x79,0x83,0x7C,
-0x82,0x7F,0x84,0x8E,0x86,0x7B,0x86,0x87,0x81,0x7B,0x7D,0x7B,0x69,0x7A,0x86,0x89,0x7E,0x88,0x80,0x7B,0x78,0x8B,0x85,0x91,0x87,0x78,
-0x74,0x6C,0x73,0x80,0x85,0x85,0x81,0x81,0x7E,0x72,0x6C,0x6B,0x7D,0x79,0x7C,0x79,0x71,0x69,0x7E,0x76,0x7D,0x80,0x92,0x8C,0x89,0x8A,
-0x93,0x8D,0x8F,0x8A,0x7F,0x78,0x7D,0x89,0x80,0x85,0x84,0x89,0x8F,0x91,0x83,0x87,0x80,0x86,0x81,0x7F,0x7A,0x77,0x87,0x8B,0x8B,0x84,
-0x8C,0x8A,0x87,0x80,0x8D,0x8B,0x95,0x8C,0x77,0x6C,0x6A,0x71,0x7F,0x7D,0x7E,0x7D,0x85,0x84,0x74,0x6D,0x75,0x7F,0x71,0x73,0x72,0x70,
-0x6C,0x76,0x74,0x7E,0x7E,0x82,0x82,0x82,0x82,0x83,0x83,0x88,0x7B,0x75,0x76,0x78,0x7D,0x7A,0x86,0x80,0x82,0x89,0x91,0x80,0x85,0x86,
-0x8D,0x7D,0x7C,0x74,0x71,0x7C,0x85,0x83,0x7F,0x86,0x80,0x79,0x7E,0x89,0x8C,0x96,0x93,0x85,0x74,0x6B,0x6F,0x80,0x80,0x82,0x81,0x88,
-0x88,0x72,0x6C,0x74,0x80,0x72,0x75,0x7D,0x74,0x70,0x7B,0x7F,0x81,0x79,0x86,0x8C,0x85,0x84,0x87,0x8B,0x94,0x8B,0x80,0x7A,0x7F,0x7D,
-0x72,0x80,0x7C,0x85,0x8A,0x8E,0x83,0x83,0x87,0x8C,0x77,0x78,0x72,0x79,0x7D,0x86,0x84,0x82,0x84,0x85,0x79,0x7D,0x85,0x89,0x94,0x8F,
-0x87,0x77,0x6F,0x74,0x7B,0x75,0x85,0x82,0x86,0x83,0x75,0x6F,0x73,0x7F,0x6E,0x71,0x75,0x77,0x7B,0x7C,0x7D,0x7E,0x75,0x84,0x81,0x83,
-0x86,0x85,0x86,0x90,0x89,0x80,0x7B,0x7F,0x7C,0x79,0x7D,0x7C,0x84,0x8C,0x8F,0x8B,0x83,0x83,0x8B,0x6F,0x6E,0x72,0x74,0x79,0x84,0x7F,
-0x80,0x7C,0x7B,0x73,0x77,0x7B,0x85,0x9A,0x8D,0x88,0x78,0x70,0x75,0x75,0x77,0x86,0x7E,0x83,0x7D,0x79,0x72,0x74,0x7F,0x72,0x75,0x77,
-0x7B,0x83,0x7C,0x81,0x85,0x80,0x8F,0x8D,0x8B,0x8F,0x8C,0x94,0x98,0x92,0x84,0x7C,0x7D,0x81,0x80,0x82,0x83,0x85,0x8D,0x8F,0x8D,0x83,
-0x84,0x88,0x76,0x75,0x7F,0x80,0x87,0x88,0x84,0x88,0x80,0x84,0x78,0x7C,0x7B,0x83,0xA1,0x93,0x8D,0x7B,0x70,0x7A,0x70,0x69,0x7E,0x7C,
-0x82,0x7F,0x7F,0x71,0x75,0x77,0x6A,0x60,0x68,0x73,0x7F,0x78,0x6E,0x77,0x7D,0x80,0x7D,0x7E,0x87,0x85,0x83,0x8E,0x84,0x83,0x81,0x7E,
-0x83,0x79,0x7C,0x80,0x7F,0x8C,0x8B,0x8F,0x87,0x82,0x87,0x6E,0x6A,0x77,0x7D,0x84,0x7D,0x7C,0x88,0x7B,0x7F,0x75,0x7B,0x7A,0x89,0x9F,
-0x98,0x8F,0x80,0x72,0x79,0x73,0x6F,0x87,0x83,0x7E,0x80,0x84,0x7F,0x7A,0x75,0x74,0x68,0x6A,0x77,0x86,0x84,0x78,0x82,0x87,0x81,0x87,
-0x7F,0x84,0x86,0x85,0x93,0x8C,0x88,0x79,0x81,0x88,0x78,0x72,0x79,0x76,0x8A,0x85,0x8B,0x87,0x87,0x90,0x71,0x6D,0x75,0x84,0x88,0x7D,
-0x77,0x89,0x7E,0x82,0x74,0x70,0x77,0x88,0x98,0x97,0x88,0x82,0x7C,0x83,0x71,0x64,0x7E,0x85,0x85,0x84,0x7D,0x81,0x7D,0x79,0x75,0x63,
-0x6B,0x7F,0x8B,0x81,0x70,0x8A,0x85,0x78,0x7D,0x76,0x86,0x93,0x83,0x8E,0x87,0x8D,0x86,0x8D,0x87,0x79,0x76,0x7E,0x7D,0x8F,0x89,0x95,
-0x92,0x80,0x7F,0x69,0x61,0x6B,0x7F,0x81,0x7B,0x78,0x85,0x78,0x7C,0x76,0x70,0x76,0x7F,0x87,0x99,0x8B,0x84,0x7E,0x80,0x77,0x66,0x79,
-0x7B,0x83,0x80,0x7B,0x83,0x80,0x78,0x7F,0x64,0x64,0x79,0x8C,0x87,0x7E,0x88,0x8A,0x88,0x8F,0x7D,0x8C,0x92,0x90,0x99,0x8A,0x82,0x86,
-0x8F,0x87,0x7F,0x73,0x7C,0x8A,0x91,0x84,0x8C,0x95,0x8B,0x89,0x73,0x61,0x72,0x8C,0x8A,0x7F,0x78,0x8C,0x86,0x7C,0x6F,0x6A,0x79,0x89,
-0x8D,0x98,0x8A,0x90,0x8E,0x81,0x6F,0x62,0x77,0x7E,0x85,0x7C,0x7E,0x86,0x83,0x6D,0x6A,0x5E,0x60,0x72,0x7E,0x77,0x77,0x7B,0x85,0x7C,
-0x7B,0x76,0x89,0x8D,0x87,0x8B,0x84,0x7F,0x8E,0x89,0x82,0x81,0x70,0x76,0x83,0x87,0x82,0x84,0x8E,0x7A,0x7D,0x6F,0x5F,0x74,0x83,0x88,
-0x83,0x73,0x7E,0x82,0x7F,0x73,0x73,0x77,0x85,0x93,0x99,0x8B,0x89,0x8B,0x82,0x71,0x67,0x6F,0x7F,0x8A,0x83,0x80,0x82,0x8C,0x79,0x75,
-0x63,0x5E,0x79,0x8E,0x90,0x86,0x77,0x94,0x8A,0x85,0x76,0x85,0x93,0x91,0x8C,0x7F,0x7D,0x89,0x8A,0x7F,0x78,0x6B,0x74,0x83,0x80,0x7B,
-0x7F,0x92,0x8D,0x7A,0x6E,0x66,0x78,0x88,0x87,0x81,0x78,0x83,0x8B,0x79,0x70,0x6F,0x76,0x89,0x89,0x92,0x87,0x8D,0x98,0x7E,0x75,0x73,
-0x76,0x89,0x8A,0x89,0x89,0x8C,0x8D,0x78,0x78,0x68,0x66,0x79,0x83,0x84,0x7C,0x6F,0x8B,0x80,0x77,0x79,0x83,0x8F,0x93,0x8F,0x86,0x86,
-0x8B,0x92,0x89,0x81,0x73,0x77,0x89,0x8B,0x85,0x7E,0x88,0x8F,0x72,0x6A,0x61,0x6D,0x80,0x82,0x84,0x73,0x7A,0x86,0x78,0x78,0x69,0x6F,
-0x85,0x7F,0x88,0x80,0x88,0x9A,0x7E,0x73,0x69,0x6A,0x7E,0x83,0x83,0x7C,0x83,0x8D,0x85,0x78,0x5E,0x61,0x78,0x8A,0x8B,0x7A,0x73,0x90,
-0x8E,0x7C,0x80,0x87,0x98,0x91,0x8C,0x89,0x88,0x91,0x97,0x8C,0x84,0x71,0x81,0x8E,0x83,0x81,0x7D,0x8E,0x95,0x74,0x72,0x6C,0x77,0x87,
-0x8B,0x8F,0x7F,0x81,0x87,0x7B,0x78,0x69,0x71,0x8C,0x88,0x8C,0x88,0x90,0x9A,0x86,0x6F,0x6A,0x6B,0x7B,0x83,0x85,0x7E,0x7E,0x88,0x80,
-0x73,0x5E,0x60,0x6D,0x7C,0x7A,0x6F,0x6B,0x82,0x82,0x76,0x7D,0x77,0x88,0x8B,0x80,0x84,0x82,0x8E,0x97,0x8D,0x7B,0x6A,0x76,0x86,0x7D,
-0x79,0x71,0x82,0x89,0x6F,0x67,0x65,0x6F,0x7E,0x8B,0x89,0x77,0x7F,0x85,0x84,0x84,0x72,0x82,0x8F,0x84,0x85,0x84,0x8E,0x93,0x86,0x71,
-0x6D,0x66,0x79,0x88,0x8A,0x84,0x81,0x90,0x8D,0x75,0x64,0x69,0x79,0x91,0x90,0x88,0x83,0x8F,0x8E,0x82,0x82,0x7D,0x89,0x8C,0x87,0x83,
-0x7B,0x8A,0x91,0x89,0x7B,0x71,0x80,0x83,0x79,0x77,0x72,0x87,0x89,0x78,0x74,0x6C,0x6F,0x81,0x8F,0x8D,0x7D,0x7D,0x84,0x82,0x7C,0x71,
-0x7D,0x8E,0x88,0x85,0x84,0x8D,0x92,0x8C,0x7A,0x74,0x6A,0x81,0x90,0x8A,0x84,0x81,0x92,0x85,0x7B,0x6A,0x6D,0x7F,0x84,0x7C,0x77,0x6F,
-0x7F,0x7E,0x7E,0x7F,0x74,0x81,0x8D,0x89,0x8A,0x87,0x96,0x93,0x89,0x7C,0x78,0x80,0x87,0x85,0x81,0x78,0x86,0x83,0x74,0x6D,0x68,0x6B,
-0x7C,0x86,0x7C,0x78,0x73,0x80,0x7C,0x7C,0x7C,0x7C,0x87,0x86,0x82,0x81,0x87,0x8B,0x84,0x7C,0x71,0x60,0x76,0x88,0x85,0x82,0x7A,0x8E,
-0x80,0x74,0x6B,0x6B,0x7B,0x8A,0x8C,0x82,0x72,0x85,0x83,0x87,0x83,0x75,0x7F,0x8E,0x85,0x80,0x82,0x90,0x94,0x8E,0x88,0x86,0x87,0x88,
-0x85,0x7A,0x76,0x82,0x89,0x7B,0x78,0x71,0x72,0x85,0x90,0x86,0x81,0x77,0x88,0x77,0x7A,0x79,0x78,0x89,0x8C,0x90,0x8C,0x8D,0x95,0x8C,
-0x84,0x77,0x6F,0x81,0x8A,0x82,0x7A,0x77,0x88,0x7A,0x70,0x6A,0x6B,0x6E,0x7A,0x79,0x72,0x69,0x7E,0x7A,0x7E,0x80,0x75,0x77,0x85,0x81,
-0x88,0x87,0x90,0x92,0x87,0x82,0x82,0x7C,0x80,0x81,0x7C,0x70,0x77,0x7D,0x72,0x75,0x6E,0x72,0x7C,0x8A,0x82,0x7D,0x74,0x89,0x82,0x90,
-0x8E,0x84,0x89,0x8D,0x8B,0x83,0x7F,0x87,0x82,0x81,0x75,0x68,0x77,0x85,0x88,0x7F,0x7D,0x8A,0x83,0x71,0x6F,0x6D,0x76,0x8C,0x91,0x89,
-0x7C,0x8D,0x8B,0x89,0x84,0x7A,0x7C,0x87,0x7E,0x81,0x7A,0x83,0x8A,0x83,0x84,0x82,0x7C,0x83,0x83,0x7B,0x6E,0x7A,0x83,0x77,0x7C,0x78,
-0x7B,0x7D,0x88,0x81,0x7D,0x74,0x85,0x7B,0x83,0x7E,0x7C,0x81,0x8B,0x8F,0x88,0x83,0x89,0x86,0x82,0x7E,0x77,0x85,0x86,0x8A,0x80,0x80,
-0x89,0x87,0x72,0x7C,0x75,0x73,0x7B,0x7E,0x76,0x6B,0x79,0x7A,0x7D,0x7E,0x79,0x75,0x7C,0x80,0x8F,0x85,0x89,0x8A,0x89,0x86,0x80,0x76,
-0x81,0x89,0x7B,0x72,0x78,0x82,0x70,0x75,0x76,0x75,0x79,0x81,0x7E,0x73,0x6C,0x7C,0x81,0x88,0x82,0x82,0x87,0x91,0x8A,0x82,0x7B,0x80,
-0x82,0x7F,0x79,0x74,0x7B,0x7E,0x86,0x7A,0x82,0x88,0x88,0x6E,0x7A,0x72,0x77,0x85,0x8B,0x7D,0x77,0x7F,0x82,0x83,0x7D,0x7A,0x7A,0x82,
-0x80,0x8A,0x83,0x8A,0x8A,0x94,0x93,0x90,0x82,0x87,0x8D,0x77,0x6E,0x7B,0x82,0x76,0x80,0x85,0x80,0x78,0x85,0x80,0x7A,0x70,0x7D,0x80,
-0x80,0x7D,0x7F,0x81,0x90,0x8D,0x8D,0x8A,0x8B,0x8A,0x88,0x89,0x84,0x83,0x86,0x8B,0x7A,0x78,0x7C,0x7E,0x67,0x75,0x71,0x72,0x77,0x7D,
-0x6D,0x67,0x6D,0x7C,0x80,0x75,0x79,0x74,0x7D,0x7F,0x90,0x8B,0x89,0x8E,0x9B,0x8F,0x87,0x79,0x81,0x88,0x75,0x71,0x77,0x7B,0x72,0x72,
-0x7B,0x7B,0x72,0x7E,0x7C,0x77,0x6D,0x88,0x93,0x93,0x8A,0x8C,0x90,0x95,0x80,0x80,0x7B,0x79,0x7A,0x80,0x7D,0x7C,0x77,0x7D,0x85,0x7E,
-0x7F,0x80,0x80,0x6D,0x73,0x78,0x7D,0x80,0x8B,0x80,0x84,0x7E,0x88,0x8B,0x7D,0x7E,0x75,0x80,0x7C,0x82,0x81,0x7D,0x81,0x91,0x92,0x85,
-0x78,0x83,0x86,0x77,0x74,0x7A,0x7C,0x77,0x7B,0x87,0x82,0x77,0x7E,0x7B,0x76,0x6A,0x7C,0x8B,0x89,0x7C,0x7F,0x8A,0x8E,0x79,0x84,0x87,
-0x7C,0x7D,0x8A,0x86,0x84,0x78,0x87,0x8D,0x81,0x7B,0x7E,0x84,0x71,0x7B,0x82,0x7D,0x7A,0x7E,0x6D,0x72,0x71,0x77,0x82,0x79,0x72,0x6E,
-0x81,0x81,0x8A,0x8A,0x88,0x8D,0x97,0x93,0x85,0x72,0x7C,0x83,0x7B,0x76,0x7C,0x7D,0x7A,0x77,0x8C,0x85,0x72,0x78,0x75,0x71,0x6E,0x7F,
-0x90,0x8E,0x82,0x8A,0x93,0x92,0x7C,0x80,0x81,0x6E,0x75,0x85,0x81,0x78,0x71,0x82,0x90,0x81,0x7D,0x7A,0x81,0x6C,0x7D,0x87,0x83,0x80,
-0x84,0x80,0x87,0x76,0x82,0x88,0x7B,0x6F,0x6F,0x7F,0x81,0x86,0x8B,0x88,0x90,0xA2,0xA2,0x90,0x7A,0x82,0x8A,0x84,0x7B,0x7D,0x7B,0x7A,
-0x7A,0x8A,0x88,0x7D,0x77,0x76,0x72,0x70,0x74,0x89,0x88,0x7D,0x82,0x90,0x8E,0x7C,0x80,0x8B,0x7D,0x86,0x98,0x94,0x88,0x77,0x89,0x91,
-0x7C,0x78,0x6E,0x74,0x64,0x73,0x7E,0x7D,0x76,0x74,0x71,0x7C,0x67,0x77,0x7E,0x75,0x68,0x73,0x81,0x84,0x84,0x90,0x90,0x8C,0x97,0x9C,
-0x8E,0x75,0x79,0x82,0x7E,0x72,0x77,0x73,0x73,0x72,0x83,0x7D,0x6C,0x6A,0x74,0x77,0x7B,0x7B,0x95,0x99,0x90,0x90,0x92,0x90,0x73,0x7A,
-0x7F,0x6A,0x74,0x81,0x87,0x7C,0x73,0x84,0x91,0x80,0x71,0x6E,0x73,0x6D,0x82,0x87,0x84,0x7B,0x7E,0x83,0x89,0x77,0x82,0x89,0x83,0x71,
-0x74,0x7A,0x81,0x7B,0x85,0x8B,0x86,0x92,0x92,0x8A,0x76,0x7E,0x8B,0x88,0x7D,0x7C,0x73,0x7E,0x79,0x89,0x85,0x73,0x70,0x74,0x79,0x72,
-0x6D,0x84,0x8E,0x8B,0x8D,0x91,0x88,0x6A,0x76,0x87,0x82,0x88,0x8E,0x91,0x81,0x74,0x84,0x92,0x86,0x76,0x75,0x74,0x75,0x85,0x8A,0x88,
-0x78,0x75,0x81,0x84,0x67,0x6B,0x7C,0x7C,0x71,0x78,0x83,0x85,0x7A,0x8C,0x92,0x8A,0x91,0x97,0x8A,0x77,0x74,0x7F,0x82,0x78,0x78,0x76,
-0x80,0x7C,0x8A,0x80,0x6F,0x68,0x73,0x80,0x7A,0x6D,0x81,0x91,0x8D,0x8A,0x8F,0x87,0x71,0x78,0x7E,0x75,0x74,0x83,0x8A,0x7D,0x71,0x8C,
-0x92,0x83,0x6E,0x6D,0x6F,0x7C,0x8B,0x91,0x8B,0x79,0x76,0x88,0x8C,0x75,0x79,0x80,0x81,0x6D,0x6B,0x73,0x79,0x71,0x8E,0x97,0x92,0x8D,
-0x98,0x93,0x7B,0x82,0x8B,0x8F,0x80,0x78,0x75,0x81,0x7C,0x89,0x83,0x79,0x6B,0x6F,0x7C,0x75,0x6D,0x76,0x8E,0x95,0x8D,0x8B,0x80,0x70,
-0x7F,0x8C,0x90,0x8C,0x93,0x9D,0x8C,0x7A,0x8C,0x8F,0x8D,0x78,0x6A,0x65,0x6D,0x77,0x82,0x7B,0x77,0x6F,0x85,0x7E,0x67,0x67,0x73,0x7E,
-0x72,0x72,0x7C,0x7D,0x72,0x92,0x98,0x8F,0x88,0x97,0x91,0x76,0x73,0x7C,0x85,0x7C,0x75,0x7A,0x82,0x77,0x80,0x75,0x6E,0x64,0x6E,0x89,
-0x85,0x77,0x83,0x96,0xA6,0x96,0x91,0x8B,0x72,0x76,0x7E,0x7C,0x78,0x79,0x8C,0x84,0x78,0x8B,0x87,0x83,0x6F,0x67,0x6F,0x79,0x83,0x8B,
-0x82,0x7D,0x73,0x8B,0x8C,0x7E,0x79,0x7D,0x87,0x7B,0x70,0x79,0x77,0x75,0x92,0x96,0x87,0x7A,0x83,0x8D,0x7D,0x85,0x85,0x8A,0x84,0x76,
-0x78,0x83,0x79,0x82,0x78,0x73,0x68,0x6E,0x80,0x7C,0x6B,0x7C,0x8E,0xA0,0x8D,0x86,0x81,0x6E,0x7D,0x91,0x90,0x8D,0x85,0x95,0x88,0x7B,
-0x87,0x89,0x8C,0x7B,0x6A,0x6E,0x77,0x7C,0x89,0x89,0x82,0x79,0x83,0x81,0x65,0x65,0x72,0x83,0x78,0x72,0x7F,0x7A,0x78,0x91,0x96,0x8B,
-0x83,0x83,0x8E,0x79,0x7B,0x7B,0x7D,0x83,0x7C,0x7C,0x86,0x79,0x81,0x76,0x74,0x73,0x77,0x8C,0x88,0x71,0x7B,0x94,0x9F,0x8B,0x89,0x7C,
-0x6B,0x6E,0x82,0x7E,0x7F,0x7B,0x90,0x80,0x7E,0x85,0x82,0x7B,0x75,0x6D,0x79,0x80,0x80,0x8B,0x86,0x81,0x7D,0x7D,0x8F,0x79,0x70,0x78,
-0x83,0x78,0x68,0x70,0x73,0x77,0x98,0x96,0x89,0x83,0x88,0x97,0x8E,0x90,0x8D,0x87,0x86,0x7F,0x81,0x87,0x7E,0x81,0x6F,0x72,0x74,0x70,
-0x81,0x7A,0x6F,0x7B,0x8D,0x95,0x86,0x81,0x7A,0x6F,0x78,0x95,0x91,0x8C,0x87,0x94,0x90,0x88,0x8E,0x88,0x7C,0x76,0x6C,0x6E,0x6C,0x70,
-0x7E,0x80,0x80,0x76,0x6B,0x82,0x6B,0x6A,0x76,0x83,0x79,0x6A,0x71,0x75,0x7B,0x95,0x90,0x8E,0x88,0x7F,0x8C,0x80,0x7C,0x7C,0x79,0x7F,
-0x87,0x7F,0x83,0x79,0x7A,0x69,0x6B,0x74,0x73,0x85,0x83,0x7A,0x8C,0x95,0x95,0x95,0x8C,0x83,0x6E,0x6B,0x84,0x7E,0x7F,0x83,0x8A,0x89,
-0x7A,0x86,0x84,0x73,0x77,0x74,0x7B,0x7A,0x74,0x7F,0x83,0x88,0x7C,0x72,0x8D,0x7C,0x76,0x7D,0x82,0x7B,0x70,0x70,0x7B,0x81,0x96,0x8E,
-0x8E,0x85,0x7E,0x8F,0x89,0x87,0x8C,0x7B,0x7D,0x8F,0x82,0x85,0x83,0x78,0x6B,0x6E,0x74,0x73,0x78,0x7A,0x77,0x8D,0x8E,0x88,0x8B,0x85,
-0x82,0x77,0x77,0x93,0x90,0x89,0x8C,0x93,0x94,0x7C,0x8C,0x80,0x70,0x75,0x72,0x75,0x75,0x71,0x84,0x8C,0x8C,0x7D,0x71,0x7F,0x73,0x72,
-0x80,0x7F,0x7B,0x71,0x74,0x83,0x88,0x8E,0x89,0x89,0x85,0x7E,0x82,0x7D,0x7A,0x86,0x77,0x7E,0x8D,0x81,0x82,0x7E,0x71,0x72,0x73,0x7C,
-0x7C,0x7D,0x81,0x84,0x96,0x8B,0x82,0x85,0x83,0x7C,0x6E,0x6D,0x7D,0x7C,0x81,0x8E,0x8D,0x8B,0x7A,0x87,0x81,0x70,0x76,0x7B,0x7B,0x7F,
-0x72,0x84,0x8B,0x8A,0x7D,0x76,0x80,0x7C,0x76,0x7F,0x78,0x77,0x70,0x70,0x7C,0x7F,0x85,0x8B,0x88,0x8B,0x8E,0x8F,0x8F,0x8B,0x94,0x80,
-0x8B,0x8C,0x84,0x89,0x7D,0x6C,0x6F,0x6B,0x77,0x7B,0x75,0x78,0x7E,0x8A,0x85,0x7F,0x80,0x83,0x83,0x7F,0x7C,0x8F,0x8B,0x8F,0x9B,0x98,
-0x90,0x88,0x87,0x7B,0x6D,0x76,0x78,0x7A,0x77,0x6E,0x7F,0x83,0x80,0x7C,0x70,0x71,0x72,0x76,0x85,0x75,0x75,0x73,0x78,0x80,0x83,0x80,
-0x86,0x81,0x87,0x88,0x82,0x7E,0x7E,0x89,0x7C,0x85,0x88,0x85,0x85,0x7B,0x70,0x77,0x72,0x73,0x76,0x76,0x84,0x8F,0x94,0x8B,0x85,0x88,
-0x85,0x81,0x7C,0x6D,0x7D,0x79,0x87,0x95,0x8B,0x85,0x83,0x7C,0x7F,0x76,0x7C,0x77,0x7B,0x7B,0x7B,0x86,0x84,0x80,0x83,0x78,0x79,0x7A,
-0x7A,0x83,0x72,0x78,0x7C,0x80,0x7D,0x7F,0x7E,0x8A,0x88,0x91,0x90,0x8B,0x85,0x80,0x91,0x88,0x83,0x80,0x82,0x8B,0x80,0x6B,0x75,0x70,
-0x6F,0x76,0x79,0x7D,0x85,0x87,0x85,0x7E,0x87,0x84,0x85,0x80,0x76,0x89,0x8B,0x93,0x9D,0x8E,0x8C,0x8B,0x78,0x76,0x6A,0x72,0x72,0x7B,
-0x7A,0x7B,0x83,0x83,0x84,0x87,0x7A,0x78,0x79,0x7B,0x83,0x72,0x79,0x7F,0x81,0x75,0x81,0x7B,0x85,0x7B,0x86,0x87,0x82,0x7D,0x7B,0x85,
-0x85,0x7F,0x87,0x83,0x89,0x7D,0x6B,0x7B,0x75,0x6F,0x78,0x83,0x86,0x8E,0x8A,0x84,0x7D,0x83,0x7C,0x79,0x72,0x6F,0x76,0x79,0x85,0x95,
-0x86,0x87,0x87,0x75,0x7B,0x75,0x75,0x74,0x7D,0x83,0x84,0x82,0x82,0x7F,0x82,0x77,0x78,0x7B,0x73,0x80,0x72,0x78,0x85,0x82,0x74,0x7C,
-0x7B,0x87,0x86,0x90,0x8D,0x8B,0x8D,0x90,0x96,0x90,0x83,0x87,0x86,0x8E,0x7F,0x6A,0x74,0x70,0x6B,0x75,0x82,0x86,0x80,0x7B,0x7C,0x7A,
-0x87,0x88,0x80,0x7A,0x7D,0x8E,0x8E,0x95,0x99,0x8E,0x90,0x8D,0x77,0x76,0x6F,0x72,0x76,0x7D,0x7E,0x7C,0x76,0x82,0x7C,0x7E,0x79,0x7A,
-0x75,0x71,0x7E,0x7D,0x7D,0x89,0x83,0x74,0x75,0x77,0x7E,0x79,0x81,0x86,0x83,0x8A,0x86,0x83,0x80,0x7D,0x87,0x86,0x89,0x80,0x6C,0x77,
-0x73,0x72,0x76,0x80,0x88,0x85,0x7E,0x80,0x7E,0x86,0x8A,0x79,0x72,0x77,0x81,0x81,0x89,0x8E,0x8D,0x8B,0x8A,0x79,0x76,0x74,0x77,0x7B,
-0x80,0x7F,0x7E,0x76,0x85,0x7E,0x79,0x77,0x7A,0x7B,0x73,0x7E,0x7D,0x79,0x8C,0x81,0x7C,0x75,0x7C,0x86,0x86,0x88,0x8C,0x8A,0x96,0x8F,
-0x84,0x81,0x80,0x81,0x86,0x88,0x82,0x72,0x78,0x76,0x71,0x6F,0x7C,0x83,0x80,0x74,0x7D,0x81,0x89,0x91,0x7E,0x75,0x83,0x8C,0x8F,0x91,
-0x95,0x93,0x8F,0x8D,0x70,0x74,0x6F,0x71,0x7E,0x7E,0x7B,0x7C,0x7D,0x88,0x85,0x81,0x7F,0x80,0x7C,0x75,0x85,0x86,0x7F,0x8E,0x81,0x76,
-0x6B,0x75,0x7A,0x79,0x7A,0x81,0x86,0x8E,0x8A,0x7A,0x7D,0x82,0x87,0x8F,0x89,0x7E,0x77,0x76,0x7D,0x79,0x75,0x82,0x87,0x85,0x76,0x7F,
-0x7C,0x86,0x8A,0x7A,0x6D,0x78,0x75,0x7F,0x85,0x8E,0x90,0x93,0x93,0x71,0x73,0x6F,0x78,0x83,0x80,0x7B,0x81,0x7C,0x85,0x81,0x75,0x71,
-0x7A,0x79,0x77,0x80,0x7C,0x7D,0x8B,0x88,0x75,0x75,0x7E,0x81,0x82,0x83,0x87,0x92,0x93,0x95,0x81,0x84,0x84,0x84,0x8D,0x88,0x7C,0x7B,
-0x76,0x7C,0x6E,0x68,0x77,0x81,0x80,0x70,0x7B,0x7B,0x88,0x8E,0x82,0x72,0x82,0x8A,0x8F,0x91,0x8D,0x8E,0x93,0x8E,0x74,0x74,0x70,0x79,
-0x7E,0x80,0x7A,0x7C,0x77,0x84,0x88,0x7E,0x76,0x7B,0x70,0x7C,0x7F,0x82,0x87,0x8F,0x86,0x6C,0x66,0x70,0x74,0x76,0x79,0x81,0x8E,0x88,
-0x8B,0x74,0x78,0x7C,0x8A,0x90,0x89,0x76,0x71,0x74,0x7E,0x77,0x79,0x7F,0x83,0x7B,0x6E,0x79,0x7A,0x86,0x8B,0x87,0x71,0x7B,0x7C,0x81,
-0x8C,0x8C,0x91,0x9A,0x8D,0x7D,0x6F,0x75,0x7B,0x83,0x88,0x77,0x79,0x75,0x7F,0x80,0x76,0x6F,0x7C,0x77,0x82,0x78,0x7E,0x85,0x8C,0x8A,
-0x7B,0x7C,0x84,0x7F,0x7F,0x85,0x88,0x92,0x92,0x97,0x81,0x7D,0x7B,0x80,0x88,0x89,0x77,0x82,0x7B,0x7F,0x75,0x6F,0x78,0x7B,0x75,0x73,
-0x7C,0x7F,0x89,0x8C,0x89,0x76,0x80,0x87,0x90,0x90,0x8A,0x8B,0x92,0x85,0x84,0x74,0x7B,0x7C,0x7B,0x82,0x74,0x71,0x7A,0x85,0x8C,0x82,
-0x79,0x7E,0x74,0x81,0x7D,0x8B,0x8D,0x8C,0x83,0x73,0x65,0x6C,0x70,0x79,0x82,0x81,0x87,0x8A,0x87,0x75,0x79,0x7F,0x8C,0x8E,0x8D,0x72,
-0x80,0x79,0x7B,0x7F,0x7C,0x83,0x7F,0x6E,0x75,0x78,0x7B,0x87,0x8B,0x88,0x72,0x71,0x71,0x7C,0x84,0x8A,0x92,0x9B,0x86,0x86,0x73,0x77,
-0x77,0x81,0x8A,0x7C,0x72,0x7B,0x7D,0x7C,0x72,0x70,0x7F,0x73,0x7E,0x77,0x83,0x86,0x88,0x86,0x86,0x7A,0x80,0x78,0x7C,0x86,0x84,0x8F,
-0x98,0x8E,0x7B,0x79,0x7C,0x80,0x89,0x91,0x7F,0x85,0x7C,0x7A,0x7B,0x70,0x74,0x6E,0x6F,0x7F,0x7C,0x7D,0x86,0x89,0x8B,0x76,0x7E,0x87,
-0x87,0x87,0x88,0x8A,0x91,0x80,0x84,0x7A,0x7F,0x7B,0x80,0x83,0x78,0x6F,0x80,0x8B,0x87,0x79,0x73,0x7F,0x6C,0x78,0x83,0x8F,0x8E,0x83,
-0x83,0x7D,0x68,0x6D,0x71,0x76,0x81,0x7E,0x90,0x8D,0x7D,0x75,0x79,0x83,0x8A,0x87,0x88,0x7D,0x79,0x78,0x7D,0x83,0x7E,0x7C,0x71,0x6B,
-0x72,0x7B,0x82,0x8A,0x89,0x89,0x75,0x74,0x77,0x7A,0x87,0x93,0x99,0x99,0x80,0x85,0x7A,0x78,0x7A,0x85,0x8D,0x7C,0x69,0x74,0x7E,0x78,
-0x73,0x78,0x83,0x6F,0x70,0x81,0x88,0x85,0x84,0x8E,0x92,0x7E,0x79,0x81,0x7F,0x84,0x87,0x9D,0x9B,0x86,0x7A,0x7A,0x7C,0x7E,0x85,0x91,
-0x83,0x80,0x7E,0x7B,0x7B,0x70,0x72,0x71,0x6F,0x75,0x7D,0x85,0x8B,0x86,0x89,0x7F,0x83,0x84,0x81,0x81,0x88,0x8D,0x95,0x81,0x84,0x7F,
-0x80,0x80,0x81,0x81,0x79,0x76,0x82,0x8E,0x80,0x7A,0x7E,0x84,0x6E,0x74,0x8B,0x94,0x8C,0x7F,0x7E,0x7B,0x70,0x6B,0x75,0x78,0x7B,0x80,
-0x90,0x81,0x76,0x79,0x86,0x87,0x86,0x83,0x8E,0x7D,0x78,0x77,0x7F,0x7F,0x7A,0x79,0x73,0x67,0x6C,0x7E,0x8B,0x8B,0x86,0x88,0x7B,0x72,
-0x6D,0x7E,0x84,0x91,0x99,0x98,0x83,0x80,0x7E,0x80,0x7F,0x84,0x84,0x7B,0x70,0x72,0x83,0x76,0x73,0x78,0x82,0x70,0x6D,0x78,0x88,0x87,
-0x8A,0x8B,0x8B,0x7F,0x7A,0x7F,0x7F,0x7D,0x8A,0xA1,0x8C,0x7D,0x78,0x82,0x7E,0x85,0x8B,0x94,0x86,0x82,0x7B,0x7F,0x6C,0x70,0x7A,0x76,
-0x67,0x6B,0x77,0x8C,0x88,0x81,0x87,0x84,0x80,0x75,0x84,0x7D,0x84,0x96,0x9C,0x84,0x7B,0x7D,0x8B,0x81,0x7D,0x81,0x81,0x80,0x7F,0x87,
-0x7F,0x7C,0x80,0x81,0x6E,0x72,0x7E,0x96,0x8A,0x83,0x7B,0x80,0x79,0x71,0x6A,0x77,0x79,0x7F,0x8F,0x7C,0x76,0x7A,0x84,0x81,0x86,0x8B,
-0x91,0x80,0x7A,0x78,0x88,0x72,0x75,0x7D,0x75,0x67,0x6F,0x75,0x92,0x8B,0x84,0x83,0x7B,0x70,0x6D,0x8E,0x88,0x88,0x99,0x9A,0x88,0x78,
-0x76,0x87,0x83,0x80,0x82,0x79,0x74,0x73,0x7D,0x75,0x73,0x7B,0x82,0x6D,0x6B,0x6C,0x8D,0x93,0x8F,0x86,0x86,0x86,0x80,0x76,0x87,0x7F,
-0x87,0x9C,0x8A,0x77,0x74,0x7B,0x85,0x87,0x91,0x93,0x85,0x80,0x77,0x7D,0x67,0x77,0x82,0x76,0x62,0x6B,0x7F,0x93,0x8B,0x81,0x85,0x83,
-0x7E,0x74,0x85,0x84,0x83,0x99,0x9A,0x86,0x77,0x74,0x89,0x82,0x7D,0x89,0x87,0x82,0x7E,0x7F,0x80,0x79,0x83,0x81,0x70,0x74,0x77,0x8D,
-0x91,0x83,0x7F,0x81,0x80,0x72,0x67,0x7B,0x74,0x80,0x87,0x83,0x79,0x76,0x78,0x8A,0x88,0x90,0x92,0x81,0x7A,0x77,0x7F,0x6E,0x74,0x7E,
-0x78,0x6D,0x6F,0x7A,0x93,0x90,0x83,0x7E,0x77,0x77,0x75,0x86,0x86,0x86,0x97,0x9F,0x83,0x78,0x6E,0x89,0x84,0x80,0x83,0x7D,0x75,0x79,
-0x75,0x79,0x72,0x7D,0x7E,0x6B,0x68,0x6B,0x88,0x9A,0x8B,0x86,0x86,0x89,0x82,0x77,0x86,0x82,0x8C,0x94,0x8E,0x77,0x70,0x87,0x8D,0x8A,
-0x92,0x93,0x84,0x7E,0x76,0x75,0x6F,0x78,0x7E,0x6F,0x69,0x6A,0x74,0x90,0x91,0x81,0x7F,0x7D,0x80,0x75,0x7B,0x88,0x89,0x93,0x9C,0x83,
-0x77,0x6B,0x84,0x83,0x83,0x8E,0x8B,0x80,0x83,0x79,0x7D,0x79,0x84,0x7D,0x6F,0x72,0x72,0x80,0x93,0x8C,0x84,0x80,0x81,0x79,0x67,0x77,
-0x7A,0x7B,0x84,0x87,0x78,0x6D,0x7F,0x8A,0x8D,0x91,0x93,0x81,0x7A,0x77,0x79,0x6F,0x72,0x7D,0x79,0x71,0x71,0x76,0x8F,0x90,0x86,0x78,
-0x72,0x80,0x78,0x77,0x89,0x8F,0x92,0x9D,0x89,0x71,0x6D,0x82,0x87,0x86,0x85,0x83,0x7E,0x7C,0x72,0x78,0x74,0x7C,0x79,0x6A,0x66,0x71,
-0x7B,0x93,0x96,0x89,0x84,0x87,0x84,0x74,0x80,0x85,0x8B,0x8F,0x85,0x7B,0x72,0x7B,0x8C,0x93,0x93,0x93,0x7F,0x7D,0x76,0x75,0x71,0x7B,
-0x7C,0x75,0x6D,0x6E,0x75,0x8B,0x8B,0x85,0x79,0x76,0x80,0x79,0x73,0x8A,0x95,0x93,0x96,0x85,0x6F,0x70,0x7A,0x80,0x91,0x92,0x90,0x89,
-0x83,0x77,0x80,0x7B,0x81,0x78,0x6E,0x6E,0x74,0x80,0x8F,0x9E,0x88,0x7E,0x81,0x7B,0x6B,0x7B,0x77,0x7F,0x81,0x82,0x7B,0x72,0x70,0x89,
-0x8F,0x92,0x91,0x7F,0x78,0x77,0x72,0x6D,0x7D,0x80,0x76,0x72,0x77,0x7A,0x8A,0x8D,0x85,0x75,0x71,0x82,0x7C,0x72,0x89,0x98,0x94,0x93,
-0x89,0x72,0x6D,0x73,0x80,0x90,0x8C,0x8E,0x84,0x79,0x6E,0x78,0x71,0x7D,0x75,0x67,0x65,0x77,0x7C,0x8E,0x9D,0x8C,0x82,0x83,0x85,0x78,
-0x83,0x87,0x95,0x89,0x87,0x80,0x79,0x70,0x8B,0x97,0x97,0x8E,0x82,0x75,0x71,0x6E,0x71,0x88,0x7F,0x73,0x6E,0x78,0x7C,0x82,0x84,0x86,
-0x79,0x73,0x7E,0x7E,0x72,0x85,0x97,0x94,0x8C,0x81,0x74,0x70,0x68,0x7C,0x96,0x94,0x8F,0x8A,0x84,0x79,0x7E,0x7B,0x84,0x74,0x6A,0x6B,
-0x77,0x7A,0x8F,0x99,0x8F,0x81,0x7E,0x7C,0x72,0x75,0x79,0x85,0x81,0x7A,0x77,0x74,0x6E,0x88,0x95,0x9A,0x8E,0x7F,0x75,0x71,0x68,0x73,
-0x88,0x83,0x72,0x72,0x80,0x7D,0x7E,0x89,0x87,0x75,0x76,0x7D,0x81,0x72,0x83,0x95,0x99,0x8C,0x80,0x76,0x72,0x72,0x7C,0x93,0x96,0x88,
-0x7F,0x7E,0x75,0x77,0x75,0x7E,0x6E,0x5D,0x65,0x78,0x78,0x8B,0x95,0x96,0x88,0x83,0x82,0x7A,0x74,0x87,0x93,0x90,0x89,0x80,0x7C,0x77,
-0x89,0x99,0x99,0x91,0x82,0x74,0x74,0x6A,0x79,0x84,0x7B,0x70,0x6D,0x7F,0x7F,0x75,0x7F,0x7E,0x78,0x77,0x80,0x84,0x72,0x81,0x9A,0x9C,
-0x86,0x79,0x74,0x72,0x6A,0x85,0x94,0x9E,0x91,0x88,0x89,0x84,0x7E,0x81,0x7D,0x72,0x63,0x6D,0x7C,0x79,0x86,0x94,0x96,0x8C,0x7F,0x78,
-0x77,0x67,0x7D,0x88,0x8B,0x7D,0x70,0x79,0x79,0x80,0x92,0x92,0x91,0x7E,0x74,0x73,0x6B,0x7C,0x83,0x7D,0x70,0x6F,0x82,0x84,0x7C,0x82,
-0x7F,0x83,0x7D,0x7D,0x81,0x74,0x88,0x98,0x9A,0x88,0x73,0x71,0x76,0x69,0x86,0x93,0x98,0x8A,0x80,0x84,0x7D,0x6D,0x7B,0x79,0x72,0x60,
-0x6F,0x7F,0x7A,0x81,0x92,0x92,0x93,0x80,0x7B,0x78,0x6B,0x89,0x96,0x99,0x8B,0x76,0x82,0x7C,0x80,0x92,0x90,0x8F,0x7C,0x73,0x76,0x6B,
-0x7A,0x82,0x7B,0x73,0x6C,0x7F,0x82,0x71,0x79,0x7A,0x83,0x82,0x7D,0x7E,0x73,0x88,0x98,0x96,0x8A,0x6D,0x6D,0x76,0x6D,0x87,0x91,0x91,
-0x92,0x88,0x8C,0x8A,0x75,0x84,0x77,0x76,0x67,0x74,0x81,0x7D,0x7F,0x93,0x91,0x96,0x7B,0x76,0x73,0x65,0x82,0x8F,0x8B,0x82,0x68,0x79,
-0x7C,0x79,0x8A,0x8C,0x90,0x7E,0x77,0x7B,0x6C,0x7E,0x82,0x7B,0x7D,0x72,0x7E,0x86,0x75,0x7F,0x82,0x88,0x85,0x7A,0x7C,0x79,0x84,0x93,
-0x8F,0x89,0x6C,0x70,0x7B,0x78,0x88,0x90,0x8C,0x91,0x82,0x83,0x7F,0x6B,0x7F,0x74,0x72,0x6B,0x70,0x7C,0x7B,0x7E,0x91,0x8D,0x93,0x80,
-0x79,0x76,0x72,0x89,0x96,0x91,0x82,0x76,0x84,0x87,0x82,0x8B,0x8D,0x8C,0x79,0x7A,0x7E,0x6D,0x7A,0x81,0x7B,0x7D,0x70,0x7B,0x82,0x70,
-0x7A,0x80,0x83,0x86,0x79,0x7C,0x7E,0x86,0x93,0x8E,0x87,0x6E,0x6D,0x81,0x7E,0x83,0x89,0x8E,0x93,0x87,0x89,0x83,0x74,0x82,0x77,0x7A,
-0x78,0x70,0x79,0x75,0x7D,0x8E,0x8C,0x8F,0x83,0x77,0x74,0x71,0x87,0x8B,0x84,0x7B,0x6F,0x7A,0x85,0x7D,0x82,0x85,0x85,0x7E,0x7E,0x7F,
-0x70,0x7A,0x83,0x80,0x7F,0x73,0x7D,0x81,0x71,0x7B,0x86,0x87,0x87,0x7A,0x7F,0x80,0x82,0x8C,0x87,0x85,0x73,0x6F,0x84,0x84,0x81,0x86,
-0x8D,0x8E,0x84,0x83,0x7D,0x6E,0x78,0x75,0x7A,0x79,0x6E,0x79,0x7A,0x84,0x8A,0x89,0x89,0x7F,0x78,0x76,0x78,0x8D,0x8D,0x8C,0x87,0x7D,
-0x82,0x89,0x7F,0x84,0x85,0x83,0x81,0x7F,0x7C,0x73,0x79,0x81,0x82,0x7F,0x77,0x7B,0x7D,0x70,0x79,0x82,0x81,0x84,0x7F,0x80,0x80,0x7F,
-0x88,0x87,0x81,0x76,0x71,0x82,0x7D,0x7F,0x83,0x8A,0x8B,0x89,0x85,0x7F,0x79,0x7E,0x7D,0x80,0x78,0x72,0x78,0x7D,0x83,0x87,0x89,0x87,
-0x81,0x78,0x75,0x7A,0x86,0x85,0x85,0x80,0x7A,0x7A,0x7F,0x78,0x7D,0x81,0x84,0x85,0x80,0x79,0x78,0x7A,0x80,0x81,0x7F,0x7A,0x7D,0x7D,
-0x77,0x7F,0x83,0x83,0x83,0x82,0x7F,0x7F,0x7B,0x80,0x81,0x7F,0x77,0x78,0x80,0x81,0x82,0x86,0x8B,0x88,0x85,0x80,0x79,0x74,0x79,0x7C,
-0x7F,0x75,0x74,0x76,0x7C,0x81,0x87,0x86,0x84,0x80,0x7C,0x7A,0x7E,0x86,0x88,0x8A,0x87,0x83,0x82,0x83,0x7D,0x81,0x83,0x84,0x83,0x81,
-0x79,0x7A,0x79,0x7D,0x80,0x7D,0x76,0x7B,0x7B,0x7B,0x7F,0x80,0x82,0x83,0x85,0x7F,0x80,0x7F,0x80,0x83,0x80,0x79,0x7C,0x7E,0x80,0x82,
-0x82,0x88,0x88,0x86,0x82,0x7C,0x7B,0x80,0x81,0x80,0x77,0x79,0x77,0x7A,0x7D,0x83,0x84,0x84,0x7E,0x7F,0x7C,0x81,0x82,0x84,0x84,0x80,
-0x7E,0x7B,0x7C,0x7A,0x7D,0x82,0x85,0x81,0x82,0x7B,0x7D,0x7B,0x7C,0x7F,0x7B,0x79,0x7E,0x7B,0x7D,0x80,0x7F,0x82,0x83,0x84,0x82,0x80,
-0x7B,0x7A,0x80,0x81,0x7C,0x7F,0x7D,0x83,0x84,0x83,0x86,0x86,0x83,0x7E,0x7B,0x7C,0x7D,0x80,0x7F,0x78,0x7B,0x77,0x7A,0x7E,0x7F,0x80,
-0x81,0x7E,0x83,0x7E,0x81,0x82,0x87,0x89,0x86,0x82,0x82,0x7F,0x80,0x80,0x83,0x84,0x80,0x7F,0x7B,0x7E,0x7B,0x7B,0x7D,0x7A,0x7C,0x80,
-0x7D,0x7E,0x7C,0x7C,0x81,0x83,0x85,0x83,0x7E,0x7B,0x7B,0x81,0x80,0x7D,0x7F,0x7D,0x81,0x82,0x82,0x85,0x84,0x80,0x80,0x7D,0x81,0x81,
-0x82,0x81,0x7C,0x7D,0x79,0x78,0x7C,0x7E,0x82,0x82,0x7F,0x81,0x7F,0x80,0x7F,0x84,0x85,0x80,0x7F,0x7E,0x7A,0x7D,0x7E,0x82,0x83,0x7F,
-0x7F,0x7F,0x80,0x7C,0x7B,0x7D,0x7C,0x7D,0x80,0x7D,0x82,0x7E,0x7C,0x81,0x83,0x84,0x83,0x7D,0x78,0x78,0x7E,0x81,0x7E,0x7F,0x7F,0x82,
-0x83,0x83,0x85,0x84,0x7F,0x80,0x7C,0x80,0x7F,0x80,0x7F,0x7D,0x7D,0x7B,0x7B,0x7C,0x7B,0x81,0x82,0x81,0x81,0x80,0x81,0x7F,0x84,0x88,
-0x83,0x80,0x80,0x7E,0x82,0x82,0x82,0x83,0x7E,0x7E,0x80,0x7F,0x7C,0x7B,0x7B,0x7B,0x7D,0x80,0x7E,0x80,0x7D,0x7E,0x83,0x84,0x84,0x82,
-0x7E,0x7B,0x7C,0x81,0x82,0x7F,0x7F,0x7F,0x80,0x80,0x81,0x83,0x82,0x7E,0x81,0x80,0x83,0x80,0x80,0x81,0x80,0x7D,0x7B,0x79,0x7A,0x7B,
-0x81,0x83,0x80,0x80,0x81,0x82,0x80,0x82,0x86,0x81,0x7C,0x7B,0x7C,0x80,0x80,0x80,0x82,0x7F,0x7F,0x80,0x80,0x7D,0x7B,0x7B,0x7D,0x7F,
-0x80,0x80,0x81,0x7E,0x7E,0x82,0x82,0x83,0x81,0x7F,0x7B,0x7B,0x80,0x82,0x7F,0x7F,0x81,0x83,0x81,0x82,0x83,0x80,0x7E,0x7F,0x81,0x81,
-0x80,0x7F,0x81,0x7F,0x7E,0x7C,0x7B,0x79,0x7A,0x80,0x84,0x80,0x80,0x81,0x82,0x81,0x83,0x87,0x84,0x7E,0x7D,0x80,0x83,0x82,0x81,0x81,
-0x7E,0x7E,0x7F,0x80,0x7C,0x7A,0x7A,0x7D,0x80,0x80,0x7F,0x7F,0x7D,0x7E,0x83,0x83,0x81,0x80,0x80,0x7E,0x7E,0x80,0x82,0x7F,0x7E,0x81,
-0x82,0x80,0x80,0x81,0x7F,0x7E,0x81,0x83,0x82,0x7F,0x80,0x83,0x81,0x7E,0x7B,0x7B,0x7A,0x7C,0x80,0x84,0x80,0x7F,0x80,0x83,0x80,0x81,
-0x83,0x82,0x7C,0x7D,0x7F,0x82,0x81,0x80,0x81,0x80,0x7F,0x7F,0x80,0x7E,0x7B,0x7C,0x7F,0x81,0x81,0x80,0x80,0x7F,0x7F,0x82,0x81,0x80,
-0x7F,0x7E,0x7E,0x7C,0x7F,0x81,0x7E,0x7E,0x81,0x82,0x81,0x81,0x80,0x81,0x7F,0x80,0x81,0x82,0x7F,0x80,0x82,0x81,0x7D,0x7B,0x7B,0x7A,
-0x7D,0x7F,0x84,0x80,0x7F,0x80,0x82,0x81,0x82,0x83,0x83,0x7E,0x7F,0x80,0x84,0x83,0x81,0x80,0x80,0x7E,0x7F,0x7F,0x7E,0x7B,0x7B,0x80,
-0x81,0x80,0x7F,0x7F,0x7F,0x80,0x83,0x82,0x80,0x80,0x81,0x80,0x7E,0x7F,0x81,0x7F,0x7E,0x80,0x81,0x80,0x80,0x7E,0x81,0x80,0x80,0x82,
-0x83,0x7F,0x80,0x82,0x83,0x7D,0x7B,0x7A,0x7B,0x7D,0x81,0x83,0x81,0x7F,0x81,0x82,0x81,0x81,0x81,0x81,0x7D,0x7E,0x80,0x82,0x82,0x80,
-0x80,0x81,0x7F,0x7F,0x7F,0x7F,0x7C,0x7D,0x81,0x82,0x80,0x80,0x80,0x80,0x80,0x81,0x80,0x7F,0x7F,0x80,0x7F,0x7E,0x7F,0x80,0x80,0x80,
-0x81,0x81,0x81,0x80,0x7F,0x82,0x80,0x80,0x81,0x83,0x80,0x80,0x82,0x83,0x7E,0x7B,0x7A,0x7D,0x7E,0x80,0x82,0x81,0x7F,0x81,0x81,0x82,
-0x81,0x81,0x81,0x80,0x80,0x80,0x82,0x84,0x82,0x80,0x80,0x7E,0x7D,0x7D,0x7D,0x7C,0x7C,0x80,0x81,0x7F,0x80,0x7F,0x7F,0x81,0x82,0x80,
-0x7F,0x7F,0x82,0x81,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7E,0x81,0x81,0x80,0x81,0x82,0x80,0x80,0x82,0x84,0x7F,0x7B,0x7B,
-0x7E,0x7F,0x80,0x82,0x82,0x7F,0x81,0x81,0x82,0x80,0x7F,0x80,0x81,0x80,0x80,0x82,0x83,0x82,0x80,0x80,0x7F,0x7E,0x7D,0x7F,0x7E,0x7E,
-0x80,0x82,0x80,0x80,0x80,0x80,0x81,0x80,0x7E,0x7E,0x7F,0x81,0x80,0x7F,0x7E,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x81,0x82,0x7F,
-0x81,0x82,0x82,0x80,0x81,0x82,0x7F,0x7B,0x7C,0x7E,0x7F,0x80,0x81,0x81,0x7F,0x80,0x81,0x82,0x81,0x7F,0x81,0x82,0x81,0x7F,0x82,0x84,
-0x83,0x80,0x7F,0x7E,0x7D,0x7C,0x7F,0x7F,0x7E,0x80,0x82,0x80,0x7F,0x7F,0x80,0x81,0x81,0x80,0x7F,0x81,0x82,0x81,0x81,0x7F,0x80,0x80,
-0x80,0x7F,0x7E,0x7F,0x80,0x80,0x81,0x82,0x80,0x80,0x81,0x81,0x80,0x82,0x82,0x80,0x7C,0x7C,0x7E,0x7F,0x80,0x81,0x80,0x80,0x7F,0x80,
-0x81,0x81,0x7F,0x80,0x82,0x81,0x80,0x80,0x83,0x83,0x80,0x80,0x7E,0x7D,0x7C,0x7F,0x80,0x7F,0x80,0x82,0x81,0x80,0x7F,0x80,0x81,0x80,
-0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x81,0x7F,0x7E,0x7F,0x81,0x81,0x81,0x81,0x80,0x80,0x81,0x82,0x81,0x81,0x81,0x80,0x7E,
-0x7D,0x7E,0x7F,0x80,0x81,0x80,0x80,0x80,0x80,0x81,0x81,0x7F,0x80,0x82,0x82,0x80,0x80,0x83,0x82,0x80,0x7F,0x7E,0x7C,0x7C,0x7F,0x7F,
-0x7E,0x80,0x81,0x80,0x7F,0x7E,0x80,0x82,0x81,0x7F,0x80,0x81,0x81,0x81,0x81,0x80,0x7F,0x7F,0x80,0x7F,0x7D,0x7E,0x81,0x81,0x81,0x81,
-0x81,0x7F,0x80,0x81,0x81,0x81,0x81,0x80,0x7F,0x7D,0x7E,0x80,0x81,0x81,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x81,0x82,0x80,0x80,
-0x82,0x83,0x81,0x80,0x7E,0x7C,0x7C,0x7F,0x80,0x80,0x81,0x82,0x81,0x80,0x7F,0x7F,0x81,0x80,0x7F,0x7F,0x80,0x80,0x81,0x81,0x80,0x7E,
-0x7F,0x80,0x80,0x7D,0x7F,0x81,0x81,0x81,0x81,0x80,0x7F,0x80,0x81,0x81,0x80,0x80,0x80,0x80,0x7E,0x7E,0x80,0x81,0x80,0x80,0x80,0x80,
-0x7F,0x80,0x81,0x81,0x80,0x81,0x82,0x80,0x80,0x81,0x82,0x80,0x7F,0x7E,0x7C,0x7D,0x7F,0x80,0x80,0x81,0x81,0x80,0x80,0x7F,0x7F,0x81,
-0x81,0x80,0x81,0x80,0x80,0x81,0x82,0x81,0x7E,0x7F,0x80,0x7F,0x7D,0x7F,0x81,0x81,0x81,0x82,0x81,0x7F,0x7F,0x81,0x81,0x81,0x80,0x81,
-0x80,0x7F,0x7E,0x7F,0x81,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x81,0x80,0x7F,0x81,0x82,0x81,0x80,0x80,0x82,0x81,0x80,0x7F,0x7D,0x7E,0x7F,
-0x80,0x81,0x81,0x81,0x81,0x80,0x7F,0x7E,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x81,0x81,0x7E,0x7E,0x81,0x80,0x7E,0x7F,0x81,0x81,0x81,
-0x81,0x80,0x7F,0x7F,0x81,0x81,0x80,0x80,0x81,0x80,0x80,0x7E,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x81,0x81,0x7F,0x80,0x82,0x81,
-0x80,0x80,0x82,0x81,0x7F,0x7F,0x7D,0x7E,0x7E,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x81,0x81,0x81,0x80,0x80,0x80,0x81,0x81,
-0x7F,0x7E,0x80,0x7F,0x7E,0x7F,0x81,0x82,0x82,0x81,0x7F,0x7F,0x7F,0x80,0x81,0x80,0x80,0x81,0x81,0x80,0x7F,0x80,0x81,0x80,0x7F,0x7F,
-0x7F,0x7F,0x7E,0x81,0x81,0x7F,0x80,0x82,0x81,0x80,0x80,0x81,0x81,0x80,0x7F,0x7D,0x7E,0x7E,0x7F,0x81,0x81,0x80,0x81,0x80,0x7F,0x7E,
-0x80,0x81,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7E,0x80,0x7F,0x7F,0x7F,0x80,0x81,0x81,0x81,0x7F,0x7F,0x80,0x80,0x81,0x81,0x80,
-0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x81,0x81,0x80,0x81,0x82,0x80,0x80,0x80,0x81,0x80,0x80,0x7F,0x7D,0x7E,
-0x7E,0x80,0x81,0x80,0x7F,0x80,0x80,0x7F,0x7E,0x80,0x81,0x81,0x80,0x80,0x81,0x80,0x80,0x81,0x7F,0x7D,0x7F,0x80,0x7F,0x7F,0x80,0x81,
-0x81,0x81,0x7F,0x7F,0x7F,0x7F,0x81,0x81,0x80,0x80,0x81,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x80,0x80,0x80,0x80,0x81,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x81,0x80,0x81,0x7F,0x7F,0x7F,0x80,0x81,0x81,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x7E,0x7E,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x81,0x80,0x80,0x7F,0x7F,0x7F,0x81,0x80,0x80,0x80,0x81,0x80,0x80,0x7F,0x7F,0x80,0x7F,
-0x7E,0x7F,0x7F,0x7F,0x81,0x81,0x80,0x80,0x81,0x81,0x80,0x80,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x80,0x81,0x81,0x80,0x80,0x80,0x80,0x80,0x80,0x7E,0x7E,0x7F,0x80,0x7F,0x80,0x80,0x81,0x81,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,
-0x80,0x80,0x81,0x81,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x81,0x80,0x80,0x81,0x81,0x80,0x7F,0x80,0x80,0x81,0x80,0x7F,
-0x7E,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x81,0x80,0x80,0x80,0x80,0x80,0x80,0x7E,0x7E,0x7F,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x81,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,
-0x81,0x81,0x80,0x7F,0x80,0x80,0x81,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x81,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x81,0x80,0x80,0x7F,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x81,0x81,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7E,0x7E,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x81,0x81,0x80,0x7F,0x7F,0x81,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x81,0x81,0x81,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,
-0x80,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x81,0x80,0x81,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,
-0x81,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x7F,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7E,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x81,0x81,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,
-0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,
-0x7E,0x7E,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,
-0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7E,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x81,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7E,0x7E,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x81,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x80,0x81,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,
-0x7E,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,
-0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7E,0x7E,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7E,0x7F,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,
-0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7E,0x7E,0x7E,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7E,0x7E,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7E,0x7F,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,
-0x7F,0x7F,0x80,0x7F,0x7F,0x7E,0x7E,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x80,0x80,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7E,0x7E,0x7E,0x7E,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,
-0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x80,0x80,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7E,
-0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,
-0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7E,0x7E,0x7E,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7E,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x81,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7E,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7E,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,
-0x7E,0x7E,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x81,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,
-0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7E,
-0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7E,0x7E,0x7E,0x7F,0x80,0x7F,0x7F,0x80,0x7F,
-0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x81,
-0x81,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7E,0x7E,0x7F,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,
-0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,
-0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x81,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7E,0x7E,0x7F,0x80,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,
-0x7F,0x7F,0x7E,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,
-0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,
-0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,
-0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,
-0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,
-0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,
-0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,
-0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,
-0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,
-0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,
-0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,
-0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,
-0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,
-0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,
-0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,
-0x80,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,
-0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,
-0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x7F,
-0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,
-0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,
-0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,
-0x7F,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,
-0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,
-0x80,0x80,0x7F,0x7F,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x7F,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x7F,0x7F,0x80,0x80,0x7F,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x80,0x80,0x7F,0x7F,0x80,
-0x80,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x7F,0x80,0x7F,0x80,0x80,0x80,0x80,0x80,0x80,0x00
-]
-
-
-import wave
-ofile = wave.open("dada.wav", 'wb')
-ofile.setparams((1,1,8000,1024,'NONE','not compressed'))
-ofile.writeframes(bytes(dada))
-ofile.close()
-
-print (bytes(dada).hex('-'))
-'''
-'''
-'''
-
+# Host side of the FRAM loader (see main.c): F-RAM commands in frames, and
+# the clips of clips.json written to the F-RAM. Use interactively, e.g.
+#   python3 -i host.py [port]
+#   >>> Load("chirp")
+# Without a LaunchPad, give it the pty that ../sim/loaderpty.py prints.
+
+import os, sys
+import fram # the F-RAM over the loader's frames, and the clips
+import cmdframe # frames for the loader's commands (path from fram)
 import serial # for serial port
 
-port = "/dev/ttyACM0"  #for Linux
+port = sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyACM0"  #for Linux
 
 try:
     ser = serial.Serial(port,9600,timeout = 0.100) 
@@ -2320,154 +20,135 @@ except:
 
 ser.reset_input_buffer()
 
+link = cmdframe.Link(ser)
+
 def FCmd ():
     while (True):
-        s = input("Hex byte: ")
+        s = input("Frame commands (hex, OP N payload...): ")
         if s != "":
-            ser.write(bytes.fromhex(s))
-            print ("Sent:", s)
-            data = ser.read(1) # look for a character from serial port
-            if len(data) > 0:  # was there a byte to read?
-                print (hex(ord(data)))
+            b = bytes.fromhex(s)
+            cmds = []
+            while b:
+                cmds.append((b[0], b[2:2+b[1]]))
+                b = b[2+b[1]:]
+            print ("Sent:", cmdframe.encode(cmds).hex())
+            print ("Reply:", link.frame(cmds).hex())
 
 def RDID ():
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('9F'))
-    for i in range(0, 9):
-        ser.write(bytes.fromhex('04'))
-        data = ser.read(1)
-        print (hex(ord(data)), end =" ")
+    for b in bytes.fromhex(FTxfr("9F", 9)):
+        print (hex(b), end =" ")
     print ()
-    ser.write(bytes.fromhex('02'))
-    
+
 def RData (count):
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('03')) # READ
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) # Address
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) #  Ditto
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) #  Ditto
-    for i in range(count):
-        ser.write(bytes.fromhex('04'))
-        data = ser.read(1)
-        print (hex(ord(data)), end =" ")
+    size, addr = Density()
+    for b in bytes.fromhex(FTxfr("03" + addr % 0, count)): # READ from address 0
+        print (hex(b), end =" ")
     print ()
-    ser.write(bytes.fromhex('02'))
-    
-def WData ():
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('06')) # WREN
-    ser.write(bytes.fromhex('02'))
-
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('01')) # WRSR
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) # w/ 00
-    ser.write(bytes.fromhex('02'))
 
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('06')) # WREN
-    ser.write(bytes.fromhex('02'))
+def WData ():
+    size, addr = Density()
+    FTxfr ("06", 0)         # WREN
+    FTxfr ("0100", 0)       # WRSR w/ 00
+    FTxfr ("06", 0)         # WREN
+    FTxfr ("02" + addr % 0 + "DEADBEEF", 0) # WRITE at address 0: Data, etc, etc
 
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('02')) # WRITE
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) # Address
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) #  Ditto
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('00')) #  Ditto
+# One CS_: write the hex string wd, then read rl bytes. See fram.txfr().
+def FTxfr (wd, rl):
+    return (fram.txfr(link, wd, rl))
 
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('DE')) # Data
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('AD')) # Data
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('BE')) # Data
-    ser.write(bytes.fromhex('06'))
-    ser.write(bytes.fromhex('EF')) # Data, etc, etc
+def Stak ():
+    hw = link.run([(fram.STAK, b'', 2)])
+    print ("Stack high water:", hw[0] | hw[1] << 8, "bytes")
 
-    ser.write(bytes.fromhex('02'))
+# (size, address format) from RDID. See fram.density().
+def Density ():
+    return (fram.density(link))
 
 '''
-Each FTxfr is one CS_. 
-'wd' is a hex string - possibly a read preamble.
-'rl' is the number of bytes to return - possibly 0.
+The circular log of ../lib/flog.h, moved over from a sensor node.
+LogDump saves its records to fname, oldest first, and returns how many.
+Reading it all at 9600 baud takes about a second per kilobyte.
 '''
-def FTxfr (wd, rl):
-    wb = bytearray.fromhex(wd)
-    wl = len(wb)
-    for i in range(wl):
-        ser.write(bytes.fromhex('06'))
-        ser.write(bytes.fromhex(wd[(i*2):(i*2+2)]))
-    rd = b''
-    for i in range(rl):
-        ser.write(bytes.fromhex('04'))
-        rd += ser.read(1)
-    ser.write(bytes.fromhex('02'))
-    return (rd.hex())
+FLOG_DATA = 16
+
+def LogDump (fname):
+    size, addr = Density()
+    h = bytes.fromhex(FTxfr("03" + addr % 0, 12))
+    if h[0:2] != b'FL' or h[2] == 0:
+        print ("No log")
+        return 0
+    rec = h[2]
+    head = int.from_bytes(h[4:8], 'little')
+    wraps = int.from_bytes(h[8:12], 'little')
+    cap = (size - FLOG_DATA) // rec * rec
+    # Oldest first: from head to the end if it has wrapped, then up to head
+    spans = [(head, cap - head)] if wraps else []
+    spans.append((0, head))
+    with open(fname, 'wb') as f:
+        for start, n in spans:
+            if n:
+                f.write(bytes.fromhex(FTxfr("03" + addr % (FLOG_DATA + start), n)))
+    n = (cap if wraps else head) // rec
+    print (n, "records of", rec, "bytes to", fname, "(wrapped", wraps, "times)")
+    return n
+
+def LogClear ():
+    size, addr = Density()
+    FTxfr ("06", 0)         # WREN
+    FTxfr ("02" + addr % 0 + "00" * 12, 0)  # WRITE the header: no log
 
 def RDID2 ():
     return(FTxfr ("9F", 9))
 
 def Rdb ():
-    return(FTxfr ("03000000", 4))
+    size, addr = Density()
+    return(FTxfr ("03" + addr % 0, 4))
 
 def Wbf ():
+    size, addr = Density()
     FTxfr ("06", 0)
-    FTxfr ("02000000BABEFACE", 0)
+    FTxfr ("02" + addr % 0 + "BABEFACE", 0)
     
 
+# Clips: see fram.clip()
+def Clips ():
+    return (fram.clips())
+
+def Clip (name):
+    return (fram.clip(name))
+
+def FWrite (addr, data):
+    size, fmt = Density()
+    if addr + len(data) > size:
+        print ("Clip of", len(data), "bytes at", hex(addr), "won't fit in", size)
+        return
+    fram.write (link, addr, data, fmt)
+
+def Load (name, addr=0):
+    data = Clip(name)
+    print (name, len(data), hex(len(data)), "bytes at", hex(addr))
+    FWrite (addr, data)
+
 def Chirp ():
-    import wave
-    ifile = wave.open("chirp_8kHz.wav", 'rb')
-    nframes = ifile.getnframes()
-    chirp = ifile.readframes(nframes)
-    ifile.close()
-    print (nframes, hex(nframes))
-    str = "02000000" + bytes(chirp).hex()
-    FTxfr ("06", 0)
-    FTxfr (str, 0)
+    Load ("chirp")
 
 def MaxMinChirp ():
-    import wave
-    ifile = wave.open("chirp_8kHz.wav", 'rb')
-    nframes = ifile.getnframes()
-    chirp = ifile.readframes(nframes)
-    ifile.close()
+    chirp = Clip("chirp")
+    print (hex(max(chirp)), hex(min(chirp)))
 
-    cmax = 0
-    cmin = 256
-    for i in range (nframes):
-        if (max(cmax, chirp[i])) > cmax:
-            print ("max:", hex(cmax))
-        cmax = max(cmax, chirp[i])
-        if (min(cmin, chirp[i])) < cmin:
-            print ("min:", hex(cmin))
-        cmin = min(cmin, chirp[i])
-    print (hex(cmax), hex(cmin))
-    
 def DumpChirp ():
-    import wave
-    ifile = wave.open("chirp_8kHz.wav", 'rb')
-    nframes = ifile.getnframes()
-    chirp = ifile.readframes(nframes)
-    ifile.close()
-
-    for i in range (nframes):
-        print (hex(chirp[i]), end=",")
-
+    for b in Clip("chirp"):
+        print (hex(b), end=",")
 
 def WelMonika ():
-    import wave
-    ifile = wave.open("welcome.wav", 'rb')
-    nframes = ifile.getnframes()
-    audio = ifile.readframes(nframes)
-    ifile.close()
-    print (nframes, hex(nframes))
-    str = "02000000" + bytes(audio).hex()
-    FTxfr ("06", 0)
-    FTxfr (str, 0)
+    Load ("welcome")
 
+# A clip as a .wav, 8-bit mono
+def ExportWav (name, fname, rate=8000):
+    import wave
+    ofile = wave.open(fname, 'wb')
+    ofile.setnchannels(1)
+    ofile.setsampwidth(1)
+    ofile.setframerate(rate)
+    ofile.writeframes(Clip(name))
+    ofile.close()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+'''
+multi.py - Program the F-RAM of several loaders (see main.c) at once.
+
+Each board gets its own thread and serial port, so a line of boards takes as
+long as one: at 9600 baud the time is all spent waiting on the wire, and each
+port waits on its own. Each board's clip is written, then read back and
+compared, with a progress line for all of them while they run.
+
+  multi.py chirp                         every LaunchPad found gets the chirp
+  multi.py welcome --port /dev/ttyACM0 --port /dev/ttyACM1=dada
+  multi.py clips/audio4.bin --addr 0x1000 --no-verify
+
+LaunchPads are found by their USB ID (TI's 0451:F432 emulator) unless ports
+are given. A clip is a name from clips.json or a file (a .wav's data).
+The ports ../sim/loaderpty.py prints work the same, for trying it out.
+'''
+
+import argparse, sys, threading, time
+import fram # the F-RAM over the loader's frames, and the clips
+import cmdframe # frames for the loader's commands (path from fram)
+
+LAUNCHPAD = (0x0451, 0xF432)                # USB VID, PID of the LaunchPad's emulator
+
+def find ():
+    from serial.tools import list_ports
+    return sorted(p.device for p in list_ports.comports() if (p.vid, p.pid) == LAUNCHPAD)
+
+class Board (threading.Thread):
+    def __init__ (self, port, name, addr, baud, verify):
+        threading.Thread.__init__(self, daemon=True)
+        self.port, self.name, self.addr = port, name, addr
+        self.baud, self.verify = baud, verify
+        self.stage, self.done, self.total = "open", 0, 0
+        self.error, self.secs = None, 0
+
+    def progress (self, n):
+        self.done = n
+
+    def run (self):
+        import serial # for serial port
+        t = time.time()
+        try:
+            data = fram.clip(self.name)
+            self.total = len(data)
+            ser = serial.Serial(self.port, self.baud, timeout=0.100)
+            ser.reset_input_buffer()
+            link = cmdframe.Link(ser)
+            self.stage = "RDID"
+            size, fmt = fram.density(link)
+            if self.addr + len(data) > size:
+                raise ValueError("%d bytes at %#x won't fit in %d" % (len(data), self.addr, size))
+            self.stage, self.done = "write", 0
+            fram.write(link, self.addr, data, fmt, self.progress)
+            if self.verify:
+                self.stage, self.done = "verify", 0
+                back = fram.read(link, self.addr, len(data), fmt, self.progress)
+                if back != data:
+                    i = next(i for i in range(len(data)) if back[i] != data[i])
+                    raise ValueError("verify failed at %#x" % (self.addr + i))
+            ser.close()
+            self.stage = "OK"
+        except Exception as e:              # Reported per board, the rest carry on
+            self.stage, self.error = "FAIL", str(e) or type(e).__name__
+        self.secs = time.time() - t
+
+    def status (self):
+        if self.stage in ("write", "verify") and self.total:
+            return "%s %s %3d%%" % (self.port, self.stage, 100 * self.done // self.total)
+        return "%s %s" % (self.port, self.stage)
+
+def main ():
+    ap = argparse.ArgumentParser(description="Program the F-RAM of several FRAM loaders at once.")
+    ap.add_argument('clip', nargs='?', help="clips.json name or file, for ports given without one")
+    ap.add_argument('--port', action='append', default=[], help="PORT or PORT=CLIP, repeated")
+    ap.add_argument('--addr', type=lambda s: int(s, 0), default=0)
+    ap.add_argument('--baud', type=int, default=9600)
+    ap.add_argument('--no-verify', dest='verify', action='store_false')
+    args = ap.parse_args()
+
+    jobs = [p.partition('=')[::2] for p in args.port] or [(p, "") for p in find()]
+    jobs = [(p, c or args.clip) for p, c in jobs]
+    if not jobs:
+        sys.exit("No LaunchPads found")
+    if not all(c for p, c in jobs):
+        sys.exit("No clip for " + ", ".join(p for p, c in jobs if not c))
+
+    boards = [Board(p, c, args.addr, args.baud, args.verify) for p, c in jobs]
+    t = time.time()
+    for b in boards:
+        b.start()
+    while any(b.is_alive() for b in boards):
+        print ("\r" + "  ".join(b.status() for b in boards), end="", flush=True)
+        time.sleep(0.5)
+    secs = time.time() - t
+    print ("\r" + "  ".join(b.status() for b in boards))
+
+    total = 0
+    for b in boards:
+        if b.error:
+            print ("%s: %s: %s" % (b.port, b.name, b.error))
+        else:
+            print ("%s: %s, %d bytes at %#x in %.1fs" % (b.port, b.name, b.total, b.addr, b.secs))
+            total += b.total
+    print ("%d of %d boards, %d bytes in %.1fs, %.0f bytes/s" %
+           (sum(not b.error for b in boards), len(boards), total, secs, total / secs))
+    sys.exit(1 if any(b.error for b in boards) else 0)
+
+if __name__ == '__main__':
+    main()
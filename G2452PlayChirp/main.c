@@ -18,80 +18,19 @@ To overcome this, this code uses a timer clock of 8Mhz, and interpolates between
 sample. The interpolation basically reduces the wavefile storage requirement by a factor of 4.
 
 This version of the code doesn't use interrupts, for debuging the interpolation.
+
+It plays the chirp twice: as above, then noise-shaped (see ../lib/tdac.h), with a 125kHz
+carrier and second-order error feedback, for comparing the two on a scope or by ear.
 */
 
 #include <msp430.h>
+#include "tdac.h"                           // Timer DAC
 // Debug
 #define LedRED  BIT0                        // P1.1 is Red LED
 
 // Used for ISRs:
 
 
-//================ Timer DAC ==================
-inline void TDAC_Init(void) {
-  // Select TA0.2 to P1.4
-  P1DIR |= BIT4;
-  P1SEL |= BIT4;
-  P1SEL2|= BIT4;
-
-  // TAR to count from 0 to 255, interrupt, and reload automatically
-  TA0CTL = TASSEL_2 + MC_1;                      // SMCLK, UP to CCR0 w/ auto reset
-  TA0CCR0 = 255;                                 // Set PWM period to 256 clock ticks
-  TA0CCTL0 = CCIE;                               // CCR0 interrupt enabled
-
-  // TA0.2 (aka P1.4) is HI until CCR2 is reached, then goes LO.
-  // CCR0's interrupt is used to reload CCR2.
-  TA0CCR2 = 128;                                 // Start audio at midpoint
-  TA0CCTL2 = OUTMOD_7;                           // Set at CCR0, reset at CCR2
-}
-
-inline void TDAC_Play(char * pAudio, unsigned long AudioSize) {
-
-  unsigned long i;
-  unsigned int uAudSam1;
-  unsigned int uAudSam2;
-  unsigned int uAudX4;
-  signed int sAudDiff;
-  unsigned int uNxSam0, uNxSam1, uNxSam2, uNxSam3;
-  
-  uAudSam2 = *(pAudio++);                         // Read initial audio sample as next
-  uAudX4   = (uAudSam2 << 2) + 2;                 // Compute first sample times four, plus rounding bit
-  
-  for (i = AudioSize-1; i != 0; i--) {            // [Need a least two sample for interpolation]
-    uAudSam1 = uAudSam2;                          // Save previous next into current
-    uAudSam2 = *(pAudio++);                       // Read new next sample
-    sAudDiff = uAudSam2 - uAudSam1;               // Compute signed difference
-
-    uNxSam0 = uAudSam1;                           // Sample 0. Same as uAudX4 >> 2.
-    uAudX4 += sAudDiff;                           // Add 1/4 the difference
-    uNxSam1 = uAudX4 >> 2;                        // Sample 1
-    uAudX4 += sAudDiff;                           // Again
-    uNxSam2 = uAudX4 >> 2;                        // Sample 2
-    uAudX4 += sAudDiff;                           // Again
-    uNxSam3 = uAudX4 >> 2;                        // Sample 3
-    uAudX4 += sAudDiff;                           // Add 1/4 the difference
-    // 0
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam0;                            // Load PWM interpolated sample
-    // 1
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam1;                            // Load PWM interpolated sample
-    // 2
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam2;                            // Load PWM interpolated sample
-    // 3
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam3;                            // Load PWM interpolated sample
-  }
-  // Final
-  TA0CCTL0 &= ~CCIFG;                             // Wait for end of current duty cycle
-  while (!(TA0CCTL0 & CCIFG));                    //  no GIE style
-  TA0CCR2 = uAudSam2;                             // Load final sample. Same as uAudX4 >> 2.
-}
 //================ MAIN ==================
 void main(void) {
   // Watchdog timer
@@ -102,10 +41,13 @@ void main(void) {
   BCSCTL1 = CALBC1_16MHZ;
   BCSCTL2 = DIVS_1;
     
-  TDAC_Init();                                   // Init (but don't start) Timer DAC
-
   for (;;) {
-    TDAC_Play((char *) &audio, SizeOfAudio);
+    TDAC_Init();                                 // 8-bit PWM, 31.25kHz
+    TDAC_Play(audio, SizeOfAudio);
+    __delay_cycles(6000000);
+
+    TDAC_InitSD();                               // 6-bit PWM, 125kHz, noise-shaped
+    TDAC_PlaySD(audio, SizeOfAudio, 2);
     __delay_cycles(6000000);
   }
 }
@@ -0,0 +1,63 @@
+//******************************************************************************
+//  Tones and sweeps by DDS (see ../lib/dds.h) on the PWM DAC, TA0.2 (P1.4)
+//
+//  Plays, over and over:
+//    A chirp like G2452PlayChirp's, 400Hz to 2.7kHz exponentially in about 0.5s
+//    The same, linearly
+//    A 440Hz tone for 0.5s
+//  G2452PlayChirp's recorded chirp is 4000 bytes of flash. Here each sweep is
+//  one call, and the engine with its 64-byte quarter-wave table is all the
+//  flash used.
+//******************************************************************************
+#include <msp430.h>
+#include "dds.h"                            // DDS tones and sweeps
+
+#define EVERY   32                          // Samples per sweep step, ~1ms
+
+// Take each sweep step as the ISR asks, in LPM0 in between, until the sweep ends
+static void wait_sweep (void)
+{
+  __disable_interrupt();                    // No wakeup between test and LPM
+  while (DDS_Sweeping()) {
+    if (DDS_StepDue()) {
+      __enable_interrupt();                 // The ISR keeps the PWM going meanwhile
+      DDS_Step();
+    } else
+      __bis_SR_register(LPM0_bits + GIE);
+    __disable_interrupt();
+  }
+  __enable_interrupt();
+}
+
+//================ MAIN ==================
+void main(void) {
+  // Watchdog timer
+  WDTCTL = WDTPW + WDTHOLD;
+
+  // DCO = 16MHz, MCLK = DCO; SMCLK = DCO/2 (8MHz clock)
+  DCOCTL = CALDCO_16MHZ;
+  BCSCTL1 = CALBC1_16MHZ;
+  BCSCTL2 = DIVS_1;
+
+  DDS_Init();                               // PWM at midpoint
+  __enable_interrupt();
+
+  for (;;) {
+    // 2.75 octaves in 0.5s: 5.5 per second, 976 steps per second
+    // 976 * log2(1 + 1/2^8) = 5.5
+    DDS_Sweep(DDS_TW(400), DDS_TW(2700), DDS_EXP, 8, EVERY);
+    wait_sweep();
+    DDS_Stop();
+    __delay_cycles(4000000);
+
+    DDS_Sweep(DDS_TW(400), DDS_TW(2700), DDS_LINEAR, DDS_LIN_RATE(400, 2700, 500, EVERY), EVERY);
+    wait_sweep();
+    DDS_Stop();
+    __delay_cycles(4000000);
+
+    DDS_Tone(DDS_TW(440));
+    __delay_cycles(8000000);
+    DDS_Stop();
+    __delay_cycles(16000000);
+  }
+}
@@ -1,5 +1,7 @@
 #define SizeOfAudio 0x4DA6
 // 19878
+#define ChirpAt     0x10000                 // host.py: Load("chirp", 0x10000)
+#define SizeOfChirp 4000
 
 /*
 The above audio is that of an 8kHz sample of a "chirp" sound, from the chirp_8kHz.wav file.
@@ -15,156 +17,27 @@ To overcome this, this code uses a timer clock of 8Mhz, and interpolates between
 sample. The interpolation basically reduces the wavefile storage requirement by a factor of 4.
 
 This version of the code doesn't use interrupts, for debuging the interpolation.
+
+Between plays the F-RAM sleeps, and is woken (tREC, 450us) before the next.
+
+Each play is a playlist (see ../lib/tdac.h): chirp, audio, chirp, back to back
+with no gap. Load the audio at 0 and the chirp at ChirpAt.
 */
 
 #include <msp430.h>
+#include "fm25v40.h"                        // FM25V40 BoosterPack SPI control
+#include "tdac.h"                           // Timer DAC
 // Debug
 #define LedRED  BIT0                        // P1.1 is Red LED
 
-// Used for ISRs:
-
-
-//================ FM25V40 ==================
-// The "FM25V40 BoosterPack for TI LaunchPad" is wired as follows:
-// Port1
-#define     SCK     BIT5                // P1.5 is SCK
-#define     MISO    BIT6                // P1.6 is MISO (also GRN LED)
-#define     MOSI    BIT7                // P1.7 is MOSI
-// Port2
-#define     CS_     BIT0                // P2.0 is CS_
-#define     WP_     BIT1                // P2.1 is WP_
-#define     HOLD_   BIT2                // P2.2 is HOLD_
-// WP_ and HOLD_ are jumpered to a pullup to VCC
-
-// Host should theoretically:  Wait 1ms; assert CS_; wait 450us; perform dummy-read.
-// The dummy read appears necessary - to wake from FM25V40's Sleep Mode presumably.
-void FM25V40_Init (void)
-{
-  // P1.x:
-  P1SEL |= SCK | MISO | MOSI;           // Let USIP.x control these, including direction, etc.
-  // P2.x:
-  P2OUT |= CS_;                         // Turn off CS_
-  P2DIR |= CS_;                         // And drive it
-
-  /* SPI mode 0  {USICKPH, USICKPL} <= 0b10, SCK inactive LO, capture on next edge, change on next edge */
-//  USICTL1 &= ~USII2C;                 // (default) Select SPI mode
-//  USICKCTL &= ~USICKPL;               // (default) SCK inactive LO
-  USICTL1 |= USICKPH;                   // Capture on 1st edge, change on following
-  /* SPI mode 3 would be {USICKPH, USICKPL} <= 0b01, as F-RAM always captures on rising edge */
-  
-  // P1 bits 7, 6, and 5 enable; Master; and (default) hold in reset
-  USICTL0 |= USIPE7 + USIPE6 + USIPE5 + USIMST + USISWRST; // Port, SPI master
-
-  USICKCTL |= USIDIV_0 | USISSEL_2;     // Div by 1 | SMCLK.
-  
-  USICTL0 &= ~USISWRST;                 // USI released for operation
-}
-
-// Stop. (Deassert CS_)
-void FM25V40_Stop (void)
-{
-  while (!(USICTL1 & USIIFG)) {}        // Wait for idle
-  P2OUT |= CS_;                         // Deassert CS_
-}
-
-// Receive. (Tri-state TDO and shift in 8 bits.)
-char FM25V40_Read (void)
-{
-  while (!(USICTL1 & USIIFG)) {}        // Wait for idle
-  P2OUT &= ~CS_;                        // Assert CS_ (only for initial dummy-read)
-  USICTL0 &= ~USIOE;                    // SDO disable
-  USICNT = 8;                           // Read
-  while (!(USICTL1 & USIIFG)) {}        // Wait
-  return (USISRL);                      // Return 8-bits
-}
-
-// Send. (Assert CS_, drive TDO, and shift out 8 bits.)
-void FM25V40_Wrte (char SndData)
-{
-  while (!(USICTL1 & USIIFG)) {}        // Wait for idle
-  P2OUT &= ~CS_;                        // Assert CS_
-  USICTL0 |= USIOE;                     // SDO enable
-  USISRL = SndData;                     // write data
-  USICNT = 8;                           // Send it
-}
-
-// Set Address.
-void FM25V40_Addr (void)
-{
-  FM25V40_Wrte (0x03);
-  FM25V40_Wrte (0x00);
-  FM25V40_Wrte (0x00);
-  FM25V40_Wrte (0x00);
-}
-
-//================ Timer DAC ==================
-inline void TDAC_Init(void) {
-  // Select TA0.2 to P1.4
-  P1DIR |= BIT4;
-  P1SEL |= BIT4;
-  P1SEL2|= BIT4;
-
-  // TAR to count from 0 to 255, interrupt, and reload automatically
-  TA0CTL = TASSEL_2 + MC_1;                      // SMCLK, UP to CCR0 w/ auto reset
-  TA0CCR0 = 255;                                 // Set PWM period to 256 clock ticks
-  TA0CCTL0 = CCIE;                               // CCR0 interrupt enabled
-
-  // TA0.2 (aka P1.4) is HI until CCR2 is reached, then goes LO.
-  // CCR0's interrupt is used to reload CCR2.
-  TA0CCR2 = 128;                                 // Start audio at midpoint
-  TA0CCTL2 = OUTMOD_7;                           // Set at CCR0, reset at CCR2
-}
+// Clips in the F-RAM, played as one. Could as well be put together at run time.
+static const tdac_clip Play[] = {
+  { ChirpAt, SizeOfChirp },
+  { 0, SizeOfAudio },
+  { ChirpAt, SizeOfChirp }
+};
 
-inline void TDAC_Play(unsigned long AudioSize) {
-
-  unsigned long i;
-  unsigned int uAudSam1;
-  unsigned int uAudSam2;
-  unsigned int uAudX4;
-  signed int sAudDiff;
-  unsigned int uNxSam0, uNxSam1, uNxSam2, uNxSam3;
-  
-
-  uAudSam2 = FM25V40_Read();                      // Read initial audio sample as next
-  uAudX4   = (uAudSam2 << 2) + 2;                 // Compute first sample times four, plus rounding bit
-  
-  for (i = AudioSize-1; i != 0; i--) {            // [Need a least two sample for interpolation]
-    uAudSam1 = uAudSam2;                          // Save previous next into current
-    uAudSam2 = FM25V40_Read();                    // Read new next sample
-    sAudDiff = uAudSam2 - uAudSam1;               // Compute signed difference
-
-    uNxSam0 = uAudSam1;                           // Sample 0. Same as uAudX4 >> 2.
-    uAudX4 += sAudDiff;                           // Add 1/4 the difference
-    uNxSam1 = uAudX4 >> 2;                        // Sample 1
-    uAudX4 += sAudDiff;                           // Again
-    uNxSam2 = uAudX4 >> 2;                        // Sample 2
-    uAudX4 += sAudDiff;                           // Again
-    uNxSam3 = uAudX4 >> 2;                        // Sample 3
-    uAudX4 += sAudDiff;                           // Add 1/4 the difference
-    // 0
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam0;                            // Load PWM interpolated sample
-    // 1
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam1;                            // Load PWM interpolated sample
-    // 2
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam2;                            // Load PWM interpolated sample
-    // 3
-    TA0CCTL0 &= ~CCIFG;                           // Wait for end of current duty cycle
-    while (!(TA0CCTL0 & CCIFG));                  //  no GIE style
-    TA0CCR2 = uNxSam3;                            // Load PWM interpolated sample
-  }
-  // Final
-  TA0CCTL0 &= ~CCIFG;                             // Wait for end of current duty cycle
-  while (!(TA0CCTL0 & CCIFG));                    //  no GIE style
-  TA0CCR2 = uAudSam2;                             // Load final sample. Same as uAudX4 >> 2.
-
-  FM25V40_Stop ();
-}
+// Used for ISRs:
 
 
 //================ MAIN ==================
@@ -179,14 +52,13 @@ void main(void) {
     
   TDAC_Init();                                   // Init Timer-DAC
 
-  FM25V40_Init();                                // Init FM25V40
-  FM25V40_Read();                                // Dummy-Read
-  
-  
+  FM25V40_Init(USIDIV_0);                        // Init FM25V40, SCK = SMCLK. Wakes it, reads RDID.
+
   for (;;) {
-    FM25V40_Addr();
-    TDAC_Play(SizeOfAudio);
+    TDAC_PlayFRAMList(Play, sizeof Play / sizeof Play[0]);
+    FM25V40_Sleep();                             // Until the next play
     __delay_cycles(6000000);
+    FM25V40_Wake();
   }
 }
 
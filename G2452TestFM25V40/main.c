@@ -24,17 +24,7 @@ Recommend to remove P1.6 jumper connection to GRN LED.
 */
 
 #include <msp430.h>
-
-// The "FM25V40 BoosterPack for TI LaunchPad" is wired as follows:
-// Port1
-#define     SCK     BIT5                // P1.5 is SCK
-#define     MISO    BIT6                // P1.6 is MISO (also GRN LED)
-#define     MOSI    BIT7                // P1.7 is MOSI
-// Port2
-#define     CS_     BIT0                // P2.0 is CS_
-#define     WP_     BIT1                // P2.1 is WP_
-#define     HOLD_   BIT2                // P2.2 is HOLD_
-// WP_ and HOLD_ are jumpered to a pullup to VCC
+#include "fm25v40.h"                    // FM25V40 BoosterPack, see ../lib
 
 #define     RDSR    0x05                // Read Status Register
 #define     RDID    0x9F                // Read Device ID
@@ -42,6 +32,7 @@ Recommend to remove P1.6 jumper connection to GRN LED.
 // See results in memory (at 0x0200), instead of the stack:
 unsigned char rdsr;
 unsigned char rdid[9];
+unsigned long size;                     // Bytes, as FM25V40_Init() found by RDID
 
 int main(void)
 {
@@ -65,28 +56,16 @@ int main(void)
 
   /* Begin FM25V40 code */
   // P1.x:
-  P1SEL = SCK | MISO | MOSI;            // Let USIP.x control these pins
   P1OUT = 0xFF;                         // Drive hi. DON't use P1REN for pull-ups!
   P1DIR = 0xFF;                         // Out unless otherwise
   // P2.x:
   P2OUT = 0xFF | CS_;                   // Turn off CS_
   P2DIR = 0xFF;                         // All bits driven
 
-  /* SPI mode 0  {USICKPH, USICKPL} <= 0b10, SCK inactive LO, capture on next edge, change on next edge */
-//  USICTL1 &= ~USII2C;                 // (default) Select SPI mode
-//  USICKCTL &= ~USICKPL;               // (default) SCK inactive LO
-  USICTL1 |= USICKPH;                   // Capture on 1st edge, change on following
-  /* SPI mode 3 would be {USICKPH, USICKPL} <= 0b01, as F-RAM always captures on rising edge */
-  
-  // P1 bits 7, 6, and 5 enable; Master; and (default) hold in reset
-  USICTL0 |= USIPE7 + USIPE6 + USIPE5 + USIMST + USISWRST;
-
-  USICKCTL |= USIDIV_0 | USISSEL_2;     // /1 SMCLK. Anything but SCLK is possible (SPI mode)
-  
-  USICTL0 &= ~USISWRST;                 // USI released for operation
+  size = FM25V40_Init(USIDIV_0);        // /1 SMCLK. USIP.x control SCK, MISO, MOSI
   
 /*
-Method:
+Method (see ../lib/fm25v40.c):
 Assert CS_.
 Read:
   Set USIOE in USICTL0.
@@ -105,38 +84,20 @@ Deassert CS_.
     for (i = 256; i > 0; i--);            // Wait for Tpu (1ms) [256 * ~4us / loop]
     P2OUT &= ~CS_;                        // Assert CS_
     for (i = 128; i > 0; i--);            // Wait for Trec (450us)
-    USICNT = 8;                           // Dummy read
-    while (!(USICTL1 & USIIFG)) {}        // Wait for completion
-    P2OUT |= CS_;                         // Deassert CS_
+    FM25V40_Read();                       // Dummy read
+    FM25V40_Stop();                       // Deassert CS_
 
   for (;;) {   
     // Read chip status
-    P2OUT &= ~CS_;                        // Assert CS_
-    USICTL0 |= USIOE;                     // SDO enable
-    USISRL = RDSR;                        // opcode
-    USICNT = 8;                           // Send it
-    while (!(USICTL1 & USIIFG)) {}        // Wait
-    USICTL0 &= ~USIOE;                    // SDO disable
-
-    USICNT = 8;                           // Read
-    while (!(USICTL1 & USIIFG)) {}        // Wait
-    rdsr = USISRL;                        // 0x40 is expected result
-    P2OUT |= CS_;                         // Deassert CS_
+    FM25V40_Wrte(RDSR);                   // opcode
+    rdsr = FM25V40_Read();                // 0x40 is expected result
+    FM25V40_Stop();                       // Deassert CS_
     
     // Read chip ID
-    P2OUT &= ~CS_;                        // Assert CS_
-    USICTL0 |= USIOE;                     // SDO enable
-    USISRL = RDID;                        // opcode
-    USICNT = 8;                           // Send it
-    while (!(USICTL1 & USIIFG)) {}        // Wait
-    USICTL0 &= ~USIOE;                    // SDO disable
-
-    for (i = 9; i-- > 0; ) {
-        USICNT = 8;                           // Read
-        while (!(USICTL1 & USIIFG)) {}        // Wait
-        rdid[i] = USISRL;                     // Collect data (0x7F7F7F7F7F7FC22640)
-    }
-    P2OUT |= CS_;                         // Deassert CS_
+    FM25V40_Wrte(RDID);                   // opcode
+    for (i = 9; i-- > 0; )
+        rdid[i] = FM25V40_Read();         // Collect data (0x7F7F7F7F7F7FC22640)
+    FM25V40_Stop();                       // Deassert CS_
 
     __no_operation();
     __no_operation();
@@ -8,60 +8,47 @@
 //******************************************************************************
 #include <msp430.h>
 
-const char Sine[32] = {
-  /*
-  // sin(w)*256*(7/16)+128+15 => Range of 31 to 255.
-  // Min of 31 allows enough time for the ISR SMCLK = 8MHz.
-  // Filtered signal may be AC coupled anyway.
-  143, 165, 186, 205, 222, 236, 246, 253,
-  255, 253, 246, 236, 222, 205, 186, 165,
-  143, 121, 100,  81,  64,  50,  40,  33,
-   31,  33,  40,  50,  64,  81, 100, 121
-  */
-  /*
-  // sin(w)*256*(1/4)+128
-  128, 140, 152, 164, 173, 181, 187, 191,
-  192, 191, 187, 181, 173, 164, 152, 140,
-  128, 116, 104,  92,  83,  75,  69,  65,
-   64,  65,  69,  75,  83,  92, 104, 116
-  */
-  /*
-  // sin(w)*256*(7/16)+128
-  // Works at MCLK = 16MHz, SMCLK = 8MHz - Glitches at MCLK = 8MHz, SMCLK = 8MHz
-  // 16 cycles is enough / not enough time for the ISR.
-  128, 150, 171, 190, 207, 221, 231, 238, 
-  240, 238, 231, 221, 207, 190, 171, 150, 
-  128, 106,  85,  66,  49,  35,  25,  18, 
-   16,  18,  25,  35,  49,  66,  85, 106
-  */
-  /*
-  // sin(w)*256*(15/32)+128 - With new improved ISR, ALMOST works at MCLK = 16MHz, SMCLK = 8MHz
-  // Minimum value of 8 didn't work (via Osc.). Changing it to 9 did.
-  128, 151, 174, 195, 213, 228, 239, 246,
-  248, 246, 239, 228, 213, 195, 174, 151
-  128, 105,  82,  61,  43,  28,  17,  10,
-    8,  10,  17,  28,  43,  61,  82, 105,
-  */
-  // sin(w)*256*(15/32)+128 with (i+0.5)/Samples. Works at MCLK = 16MHz, SMCLK = 8MHz
-  140, 163, 185, 204, 221, 234, 243, 247,
-  247, 243, 234, 221, 204, 185, 163, 140,
-  116,  93,  71,  52,  35,  22,  13,   9,
-    9,  13,  22,  35,  52,  71,  93, 116
-  /*
-  // sin(w)*256*(15/32)+128+7 - Runs at 16MHz MCLK, 8MHz SMCLK - looks a little flat on top
-  135, 158, 181, 202, 220, 235, 246, 253,
-  255, 253, 246, 235, 220, 202, 181, 158,
-  135, 112,  89,  68,  50,  35,  24,  17,
-   15,  17,  24,  35,  50,  68,  89, 112
-  */
+#define SAMPLES 32                             // Per period; a multiple of 4
+#define QUARTER (SAMPLES / 4)
+#define OFFSET  128
+
+// A quarter of the period, from slaa804.py, unfolded into Wave[] at startup.
+// What the earlier full-period tables found:
+//   The ISR needs time to load TA0CCR2 before TAR passes it. A minimum of 31
+//    was needed with SMCLK = MCLK = 8MHz; 9 works at MCLK = 16MHz, SMCLK = 8MHz
+//    (8 didn't, via Osc.).
+//   A (i+0.5) phase offset keeps the samples off 0 and the peaks, so the
+//    period is symmetric about each quarter, and peaks are flat pairs.
+// For other lengths or levels: python3 slaa804.py 256 7/16 16, etc.
+const unsigned char Sine[QUARTER] = {
+  // slaa804.py 32 15/32 9: sin(w)*256*(15/32) with (i+0.5)/Samples, quarter wave. Range 9 to 247.
+   12,  35,  57,  76,  93, 106, 115, 119
 };
 
+// Sample i of the period, 0 to SAMPLES-1
+static inline unsigned char SineAt(unsigned char i)
+{
+    unsigned char q = i & (QUARTER - 1);
+
+    if (i & QUARTER)                               // 2nd and 4th quarters: mirrored
+      q = QUARTER - 1 - q;
+    return (i & (2 * QUARTER)) ? OFFSET - Sine[q] : OFFSET + Sine[q];   // 2nd half: negated
+}
+
+// The whole period, mirrored and negated from Sine[]. In RAM, so the ISR is
+// the pointer walk it always was: one register pushed, and TA0CCR2 loaded
+// 16 cycles in, within the minimum duty of 9 ticks (18 cycles). SineAt() in
+// the ISR needs more registers, each push 3 cycles before the load.
+static unsigned char Wave[SAMPLES];
+
 // ISR:
-volatile char * pSine;
-volatile char NexSine;
+volatile unsigned char *pSine;
+volatile unsigned char NexSine;
 
 void main(void)
 {
+    unsigned char i;
+
     // Watchdog timer
     WDTCTL = WDTPW + WDTHOLD;
 
@@ -70,6 +57,9 @@ void main(void)
     BCSCTL1 = CALBC1_16MHZ;
     BCSCTL2= DIVS_1;
     
+    for (i = 0; i < SAMPLES; i++)
+      Wave[i] = SineAt(i);
+
     // Select TA0.2 to P1.4
     P1DIR |= BIT4;
     P1SEL |= BIT4;
@@ -79,28 +69,23 @@ void main(void)
     TA0CCTL0 = CCIE;                               // CCR0 interrupt enabled
     TA0CCTL2 = OUTMOD_7;                           // CCR2 Output Mode reset/set
     TA0CCR0 = 255;                                 // Set PWM period to 256 clock ticks
-    TA0CCR2 = Sine[0];                             // Load 1st sine sample
+    TA0CCR2 = Wave[0];                             // Load 1st sine sample
     TA0CTL = TASSEL_2 + MC_1 + TACLR;              // SMCLK, upmode, clear TAR
 
     // Get set and GO
-    NexSine = Sine[1];                             // Prime the 2nd sample
-    pSine = (char *) &Sine + 2;                    // Get address of next element into pointer
+    NexSine = Wave[1];                             // Prime the 2nd sample
+    pSine = Wave + 2;                              // Next element
     _BIS_SR(LPM0_bits + GIE);                      // Enter LPM0 w/ interrupt
 }
-/*
-    0e07a: b2 40 80 00 76 01         MOV     #0x0080, &0x0176
-    0e080: b2 40 14 02 60 01         MOV     #0x0214, &0x0160
-    0e086: f2 40 96 ff 02 02         MOV.B   #0x0096, &NexSine
-    0e08c: b2 40 02 e0 00 02         MOV     #0xe002, &pSine
-    0e092: 32 d0 18 00               BIS     #0x0018, SR
-    0e096: 30 41                     RET     
-*/
+
 /**
  *** TimerA0 ISR ***
 
  Load TA0CCR2 as quickly as possible, as it may be a very small value.
  Compute the next value over the course of a full PWM period.
  This could/should be done outside the ISR. Doesn't matter here though.
+ Its cycle count, and so the room left before the smallest duty, is in
+ ../G2452Bench. Raise slaa804.py's min if the ISR grows.
 **/
 
 #if defined(__TI_COMPILER_VERSION__)
@@ -112,23 +97,7 @@ __interrupt void TIMER0_A0_ISR(void)
 {
     TA0CCR2 = NexSine;                            // Load value for next duty cycle
     NexSine = *pSine;
-    if (++pSine == ((char *) &Sine + 32)) {
-      pSine = (char *) &Sine;                     // Reset it
+    if (++pSine == Wave + SAMPLES) {
+      pSine = Wave;                               // Reset it
     }
 }
-/*
-TIMER0_A0_ISR:
-    0e098: 0c 12                     PUSH    R12
-    0e09a: 5c 42 02 02               MOV.B   &NexSine, R12
-    0e09e: 82 4c 76 01               MOV     R12,    &0x0176
-    0e0a2: 1c 42 00 02               MOV     &pSine, R12
-    0e0a6: f2 4c 02 02               MOV.B   @R12+,  &NexSine
-    0e0aa: 3c 90 20 e0               CMP     #__FRAME_END__, R12
-    0e0ae: 04 24                     JZ      0xe0b8
-    0e0b0: 82 4c 00 02               MOV     R12,    &pSine
-    0e0b4: 3c 41                     POP     R12
-    0e0b6: 00 13                     RETI    
-    0e0b8: b2 40 00 e0 00 02         MOV     #Sine,  &pSine
-    0e0be: 3c 41                     POP     R12
-    0e0c0: 00 13                     RETI    
-*/
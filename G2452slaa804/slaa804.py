@@ -1,13 +1,36 @@
+# Quarter-wave sine table for the 8-bit PWM DAC ISRs (main.c, ../lib/dds.c).
+#   python3 slaa804.py [samples [amplitude [min]]]
+#     samples:   per full period, a multiple of 4 (default 32)
+#     amplitude: of PRECISION, e.g. 15/32 (the default) or 7/16
+#     min:       least duty, in timer ticks, the ISR has time to load (default 9)
+#
+# Sample i of the period is sin(2*PI*(i+0.5)/samples). With the half-sample
+# offset no sample lands on 0 or a peak, so the period is symmetric about each
+# quarter: the ISR mirrors the quarter for the 2nd and 4th quarters and
+# negates it for the 2nd half, from samples/4 entries. Entries are the
+# magnitude above OFFSET, clamped so OFFSET - entry >= min and OFFSET + entry
+# fits in PRECISION.
 import math
+import sys
+from fractions import Fraction
 
 PI = 3.14159265
-SAMPLES = 32
 PRECISION = 256
-AMPLITUDE = PRECISION*15/32
-#OFFSET=PRECISION/2+7
-OFFSET=PRECISION/2
+OFFSET = PRECISION // 2
 
-for i in range(0, int(SAMPLES)):
-    print (round(math.sin(2*PI*((i+0.5)/SAMPLES))*AMPLITUDE+OFFSET), end=", ")
+args = sys.argv[1:]
+SAMPLES = int(args[0]) if len(args) > 0 else 32
+AMPLITUDE = PRECISION * Fraction(args[1] if len(args) > 1 else '15/32')
+MIN = int(args[2]) if len(args) > 2 else 9
 
-           
+if SAMPLES % 4:
+    sys.exit("samples must be a multiple of 4")
+
+top = min(OFFSET - MIN, PRECISION - 1 - OFFSET)
+quarter = [min(round(math.sin(2*PI*((i+0.5)/SAMPLES))*AMPLITUDE), top) for i in range(SAMPLES // 4)]
+
+print("  // slaa804.py %d %s %d: sin(w)*%d*(%s) with (i+0.5)/Samples, quarter wave. Range %d to %d."
+      % (SAMPLES, Fraction(AMPLITUDE / PRECISION), MIN, PRECISION, Fraction(AMPLITUDE / PRECISION),
+         OFFSET - max(quarter), OFFSET + max(quarter)))
+for i in range(0, len(quarter), 16):
+    print("  " + ", ".join("%3d" % q for q in quarter[i:i+16]) + ("," if i + 16 < len(quarter) else ""))
@@ -9,31 +9,89 @@
 
 FROM: https://bennthomsen.wordpress.com/engineering-toolbox/ti-msp430-launchpad/msp430g2553-hardware-uart/
 
+ KEH: Reworked so neither ISR ever waits.
+ The RX ISR only queues the received byte and wakes main. Main parses the
+ commands and queues the replies, which the TX ISR sends as the UART is ready.
+ The original sent ~40 bytes of reply from inside the RX ISR, busy-waiting on
+ UCA0TXIFG, so any command arriving meanwhile overran UCA0RXBUF.
+ Commands now arrive at full baud without loss, as long as the replies keep up
+ on average: each 1-byte command costs ~21 bytes of reply, so a host should
+ wait for them. A full TX queue makes main wait (never an ISR), while RX keeps
+ queueing. An RX queue overflow is counted in rx_lost.
+
+ KEH: Also takes command frames (see ../lib/cmdframe.h), which start with '~'
+ (0x7E), so a host script can batch commands, one reply per frame:
+  0x01 1 leds: Set P1.0 (RED) and P1.6 (GRN) to those bits of leds
+  0x02 N data: Echo data back in the reply
+  0x03 0:      Reply rx_lost, low byte first
+  0x04 0:      Reply the stack high-water mark in bytes (see ../lib/stack.h), low byte first
+ Any other byte is a one-character command as before.
 
  */
-  
+
 #include "msp430.h"
+#include "cmdframe.h"
+#include "stack.h"
 void UARTSendArray(char *TxArray, char ArrayLength);
-  
+
+#define RX_SIZE 16 // Power of 2, at most 256
+#define TX_SIZE 64 // Power of 2, at most 256
+
+static char rx_buf[RX_SIZE];
+static volatile unsigned char rx_head, rx_tail; // ISR puts at head, main takes from tail
+static char tx_buf[TX_SIZE];
+static volatile unsigned char tx_head, tx_tail; // Main puts at head, ISR sends from tail
+unsigned int rx_lost; // Commands dropped, RX queue full
+
 static  char data;
-  
+
+// Frame commands
+static void cmd_led(const unsigned char *arg, unsigned char n){
+ if (n)
+  P1OUT = (P1OUT & ~(BIT0 + BIT6)) | (arg[0] & (BIT0 + BIT6));
+}
+
+static void cmd_echo(const unsigned char *arg, unsigned char n){
+ while(n--)
+  frame_reply(*arg++);
+}
+
+static void cmd_lost(const unsigned char *arg, unsigned char n){
+ frame_reply(rx_lost);
+ frame_reply(rx_lost >> 8);
+}
+
+static void cmd_stack(const unsigned char *arg, unsigned char n){
+ unsigned int hw = stack_high_water();
+ frame_reply(hw);
+ frame_reply(hw >> 8);
+}
+
+const cmd_fn cmd_table[] = { 0, cmd_led, cmd_echo, cmd_lost, cmd_stack };
+const unsigned char cmd_count = sizeof cmd_table / sizeof cmd_table[0];
+
+void frame_tx(unsigned char c){
+ UARTSendArray((char *)&c, 1);
+}
+
 void main(void)
-  
+
 {
  WDTCTL = WDTPW + WDTHOLD; // Stop WDT
-  
+ stack_paint(); // Before interrupts are enabled
+
  P1DIR |= BIT0 + BIT6; // Set the LEDs on P1.0, P1.6 as outputs
  P1OUT = BIT0; // Set P1.0
-  
+
  BCSCTL1 = CALBC1_1MHZ; // Set DCO to 1MHz
  DCOCTL = CALDCO_1MHZ; // Set DCO to 1MHz
- 
+
  /* Compiler warnings */
  P2DIR = 0xFF;
  P2OUT = 0x00;
  P3DIR = 0xFF;
  P3OUT = 0x00;
-  
+
 /* Configure hardware UART */
  P1SEL = BIT1 + BIT2 ; // P1.1 = RXD, P1.2=TXD
  P1SEL2 = BIT1 + BIT2 ; // P1.1 = RXD, P1.2=TXD
@@ -43,11 +101,65 @@ void main(void)
  UCA0MCTL = UCBRS0; // Modulation UCBRSx = 1
  UCA0CTL1 &= ~UCSWRST; // Initialize USCI state machine
  IE2 |= UCA0RXIE; // Enable USCI_A0 RX interrupt
-  
-__bis_SR_register(LPM0_bits + GIE); // Enter LPM0, interrupts enabled
+
+for(;;){
+ __disable_interrupt(); // No RX between the test and LPM0
+ while(rx_head == rx_tail){
+  __bis_SR_register(LPM0_bits + GIE); // Enter LPM0, interrupts enabled, until RX
+  __disable_interrupt();
+ }
+ __enable_interrupt();
+
+ data = rx_buf[rx_tail]; // Take the oldest command
+ rx_tail = (rx_tail + 1) & (RX_SIZE - 1);
+
+ switch(frame_rx(data)){
+  case FRAME_OK:
+  frame_run(); // Run the frame's commands and reply
+  continue;
+  case FRAME_OUT:
+  break; // A one-character command
+  default:
+  continue; // Part of a frame, or a bad one (already answered)
+  }
+
+ UARTSendArray("Received command: ", 18);
+ UARTSendArray(&data, 1);
+ UARTSendArray("\n\r", 2);
+
+ switch(data){
+  case 'R':
+  {
+  P1OUT |= BIT0;
+  }
+  break;
+  case 'r':
+  {
+  P1OUT &= ~BIT0;
+  }
+  break;
+  case 'G':
+  {
+  P1OUT |= BIT6;
+  }
+  break;
+  case 'g':
+  {
+  P1OUT &= ~BIT6;
+  }
+  break;
+  default:
+  {
+  UARTSendArray("Unknown Command: ", 17);
+  UARTSendArray(&data, 1);
+  UARTSendArray("\n\r", 2);
+  }
+  break;
+  }
+ }
 }
-  
-// Echo back RXed character, confirm TX buffer is ready first
+
+// Queue RXed character and wake main. Nothing else, so nothing is missed.
 
 #if defined(__TI_COMPILER_VERSION__)
 #pragma vector=USCIAB0RX_VECTOR
@@ -56,51 +168,45 @@ __interrupt void USCI0RX_ISR(void)
   void __attribute__ ((interrupt(USCIAB0RX_VECTOR))) uci0rx_isr(void)
 #endif
 {
-data = UCA0RXBUF;
-UARTSendArray("Received command: ", 18); 
-UARTSendArray(&data, 1);
-UARTSendArray("\n\r", 2);
-  
-switch(data){
- case 'R':
- {
- P1OUT |= BIT0;
- }
- break;
- case 'r':
- {
- P1OUT &= ~BIT0;
- }
- break;
- case 'G':
- {
- P1OUT |= BIT6;
- }
- break;
- case 'g':
- {
- P1OUT &= ~BIT6;
- }
- break;
- default:
- {
- UARTSendArray("Unknown Command: ", 17);
- UARTSendArray(&data, 1);
- UARTSendArray("\n\r", 2);
- }
- break;
+unsigned char h = (rx_head + 1) & (RX_SIZE - 1);
+char c = UCA0RXBUF; // Reading clears UCA0RXIFG
+if (h == rx_tail) { // Full: drop it
+ rx_lost++;
+ return;
  }
+rx_buf[rx_head] = c;
+rx_head = h;
+__bic_SR_register_on_exit(LPM0_bits); // Wake main to parse it
+}
+
+// Send the next queued character. Disable when empty; UARTSendArray re-enables.
+
+#if defined(__TI_COMPILER_VERSION__)
+#pragma vector=USCIAB0TX_VECTOR
+__interrupt void USCI0TX_ISR(void)
+#else
+  void __attribute__ ((interrupt(USCIAB0TX_VECTOR))) uci0tx_isr(void)
+#endif
+{
+UCA0TXBUF = tx_buf[tx_tail];
+tx_tail = (tx_tail + 1) & (TX_SIZE - 1);
+if (tx_tail == tx_head)
+ IE2 &= ~UCA0TXIE;
 }
-  
+
 void UARTSendArray(char *TxArray,  char ArrayLength){
- // Send number of bytes Specified in ArrayLength in the array at using the hardware UART 0
+ // Queue number of bytes Specified in ArrayLength in the array for the hardware UART 0
  // Example usage: UARTSendArray("Hello", 5);
  // int data[2]={1023, 235};
  // UARTSendArray(data, 4); // Note because the UART transmits bytes it is necessary to send two bytes for each integer hence the data length is twice the array length
-  
+ // Must not be called from an ISR: waits (with GIE) if the queue is full.
+
 while(ArrayLength--){ // Loop until StringLength == 0 and post decrement
- while(!(IFG2 & UCA0TXIFG)); // Wait for TX buffer to be ready for new data
- UCA0TXBUF = *TxArray; //Write the character at the location specified py the pointer
+ unsigned char h = (tx_head + 1) & (TX_SIZE - 1);
+ while(h == tx_tail); // Wait for the TX ISR to make room
+ tx_buf[tx_head] = *TxArray; //Queue the character at the location specified py the pointer
+ tx_head = h;
+ IE2 |= UCA0TXIE; // TXIFG is set while idle, so this starts it
  TxArray++; //Increment the TxString pointer to point to the next character
  }
 }
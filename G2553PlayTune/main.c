@@ -0,0 +1,64 @@
+//******************************************************************************
+//  Tunes from a table of notes (see ../lib/tune.h), TA0.1 (P1.2)
+//
+//  "PWM at 440 Hz.c" with a sequencer: the same 8MHz square wave, its period
+//  now from a table. A piezo or small speaker (through a resistor) on P1.2.
+//
+//  Plays, over and over:
+//    An alert, three rising beeps
+//    The opening of Ode to Joy
+//  The CPU runs only at the note boundaries, in Timer1_A's ISR; between them
+//  and in the gaps main sleeps in LPM0.
+//******************************************************************************
+#include <msp430.h>
+#include "tune.h"                           // Tunes by the timers
+
+#define SMCLK_HZ        8000000UL
+#define NOTE(hz, ms)    { TUNE_PERIOD(SMCLK_HZ, hz), ms }
+#define REST(ms)        { TUNE_REST, ms }
+
+static const tune_note Alert[] = {
+  NOTE(880, 80), REST(40), NOTE(1175, 80), REST(40), NOTE(1760, 160)
+};
+
+#define Q   300                             // Quarter note, ms
+static const tune_note Ode[] = {
+  NOTE(330, Q), NOTE(330, Q), NOTE(349, Q), NOTE(392, Q),
+  NOTE(392, Q), NOTE(349, Q), NOTE(330, Q), NOTE(294, Q),
+  NOTE(262, Q), NOTE(262, Q), NOTE(294, Q), NOTE(330, Q),
+  NOTE(330, Q * 3 / 2), NOTE(294, Q / 2), NOTE(294, Q * 2)
+};
+
+static const tune_note Pause[] = { REST(1000) };
+
+// Play notes and wait for them in LPM0
+static void play (const tune_note *notes, unsigned char n)
+{
+  __disable_interrupt();                    // No wakeup between test and LPM
+  TUNE_Play(notes, n);
+  while (TUNE_Playing()) {
+    __bis_SR_register(LPM0_bits + GIE);
+    __disable_interrupt();
+  }
+  __enable_interrupt();
+}
+
+//================ MAIN ==================
+void main(void) {
+  // Watchdog timer
+  WDTCTL = WDTPW + WDTHOLD;
+
+  // DCO = 8MHz, MCLK = SMCLK = DCO
+  BCSCTL1 = CALBC1_8MHZ;
+  DCOCTL = CALDCO_8MHZ;
+
+  TUNE_Init(SMCLK_HZ);                      // VLO measured, P1.2 low
+
+  for (;;) {
+    play(Alert, sizeof Alert / sizeof Alert[0]);
+    play(Pause, 1);
+    play(Ode, sizeof Ode / sizeof Ode[0]);
+    play(Pause, 1);
+    play(Pause, 1);
+  }
+}
@@ -44,6 +44,10 @@
  * for hardware UART used here!!
  * This may not work on all revisions of the board?
 
+ * KEH: The VLO (4 to 20kHz) is measured against the calibrated DCO at
+ * startup, and the blink and sample periods computed from it, so the sample
+ * rate no longer depends on the VLO being 12kHz. Build with lib/vlo.c.
+
 
 */
 
@@ -63,6 +67,16 @@
  ******************************************************************************/
   
 #include  "msp430.h"
+#include  "lib/vlo.h"
+
+// FM25V40 BoosterPack log (see lib/flog.h): each ADC10MEM sample is also
+// appended to F-RAM, 2 bytes, for upload later through G2452FRAMloader.
+// Remove the GRN LED jumper: P1.6 is MISO.
+#define     FRAM_LOG              0         // 1: log to F-RAM as well
+#if FRAM_LOG
+#include  "lib/fm25v40.h"
+#include  "lib/flog.h"
+#endif
 
 #define     LED1                  BIT0
 #define     LED2                  BIT6
@@ -72,11 +86,15 @@
 #define     TXD                   BIT2                      // TXD on P1.2
 #define     RXD                   BIT1                      // RXD on P1.1
 
+#define     BLINK_MS              200       // Was 1200 at a nominal 6kHz ACLK
+#define     SAMPLE_MS             400       // Was 2400
+
 #define     PreAppMode            0
 #define     RunningMode           1
 
 unsigned int TXByte;
 volatile unsigned int Mode;   
+unsigned int aclk_hz;                       // Measured, see PreApplicationMode()
   
 void InitializeButton(void);
 void PreApplicationMode(void); 
@@ -123,6 +141,11 @@ void main(void)
   /* if we were going to receive, we would also:
      IE2 |= UCA0RXIE; // Enable USCI_A0 RX interrupt
   */
+
+#if FRAM_LOG
+  FM25V40_Init(USIDIV_0);                   // SCK = SMCLK = 1MHz. After P1SEL above.
+  FLOG_Open(sizeof(unsigned int));          // Carry on from the last reset, if it's ours
+#endif
   
   /* Main Application Loop */
   while(1)
@@ -146,12 +169,19 @@ void main(void)
     while (! (IFG2 & UCA0TXIFG)); // wait for TX buffer to be ready for new data
     UCA0TXBUF = TXByte;
 
+#if FRAM_LOG
+    {
+      unsigned int rec = tempMeasured;
+      FLOG_Append(&rec);
+    }
+#endif
+
     P1OUT ^= LED1;  // toggle the light every time we make a measurement.
         
     // set up timer to wake us in a while:
-    TACCR0 = 2400;                             //  period
+    TACCR0 = ACLK_PERIOD(aclk_hz, SAMPLE_MS); //  period
     TACTL = TASSEL_1 | MC_1;                  // TACLK = ACLK, Up mode.  
-    TACCR1 = 2400; // interrupt at end
+    TACCR1 = TACCR0; // interrupt at end
     TACCTL1 = CCIE;                // TACCTL0 
 
     // go to sleep, wait till timer expires to do another measurement.
@@ -174,6 +204,7 @@ void PreApplicationMode(void)
 
   BCSCTL1 |= DIVA_1;             // ACLK is half the speed of the source (VLO)
   BCSCTL3 |= LFXT1S_2;           // ACLK = VLO
+  aclk_hz = aclk_measure(1000000); // Against SMCLK = DCO = 1MHz calibrated
   
   /* here we're setting up a timer to fire an interrupt periodically. 
      When the timer 1 hits its limit, the interrupt will toggle the lights 
@@ -181,10 +212,10 @@ void PreApplicationMode(void)
      We're using ACLK as the timer source, since it lets us go into LPM3
      (where SMCLK and MCLK are turned off). */
 
-  TACCR0 = 1200;                 //  period
+  TACCR0 = ACLK_PERIOD(aclk_hz, BLINK_MS); //  period
   TACTL = TASSEL_1 | MC_1;       // TACLK = ACLK, Up mode.  
   TACCTL1 = CCIE + OUTMOD_3;     // TACCTL1 Capture Compare
-  TACCR1 = 600;                  // duty cycle
+  TACCR1 = TACCR0 / 2;           // duty cycle
   __bis_SR_register(LPM3_bits + GIE);   // LPM3 with interrupts enabled
   // in LPM3, MCLCK and SMCLK are off, but ACLK is on.
 }
@@ -0,0 +1,94 @@
+# Common build for the per-folder Makefiles.
+#
+# A folder Makefile sets DEVICE and OBJECTS, then includes this. Everything is
+# compiled with -flto and linked with --gc-sections against lib/, built per
+# device into lib/$(DEVICE)/libdrivers.a, so driver calls can be inlined into
+# the folder's code and unused drivers cost nothing.
+#
+# Each build ends with tools/size.py: flash, RAM and worst-case stack against
+# the part's (or the folder's FLASH_BUDGET and RAM_BUDGET, in bytes), failing
+# if over. make size-report lists them per function and data object. The
+# objects are fat (code as well as LTO bytecode) only so that -fstack-usage
+# writes each function's frame to a .su file, for size.py to check against.
+
+TOP := $(dir $(lastword $(MAKEFILE_LIST)))
+
+INSTALL_DIR=$(HOME)/ti/msp430-gcc
+GCC_DIR = $(INSTALL_DIR)/bin
+SUPPORT_FILE_DIRECTORY = $(INSTALL_DIR)/include
+
+CC      = $(GCC_DIR)/msp430-elf-gcc
+AR      = $(GCC_DIR)/msp430-elf-gcc-ar
+GDB     = mspdebug rf2500
+
+MAP     = main.map
+LIBDIR  = $(TOP)lib
+LIBOUT  = $(LIBDIR)/$(DEVICE)
+LIBOBJ  = $(patsubst $(LIBDIR)/%.c,$(LIBOUT)/%.o,$(wildcard $(LIBDIR)/*.c))
+
+CFLAGS = -I $(SUPPORT_FILE_DIRECTORY) -I $(LIBDIR) -mmcu=$(DEVICE) -O3 -Wall -Wno-main -g \
+         -flto -ffunction-sections -fdata-sections -ffat-lto-objects -fstack-usage
+LFLAGS = -L $(SUPPORT_FILE_DIRECTORY) -Wl,-Map,$(MAP),--gc-sections 
+
+all: $(DEVICE).out size
+
+$(DEVICE).out: $(OBJECTS) $(LIBOUT)/libdrivers.a
+	$(CC) $(CFLAGS) $(LFLAGS) $(OBJECTS) -L $(LIBOUT) -ldrivers -o $@
+
+$(OBJECTS): $(wildcard $(LIBDIR)/*.h)
+
+$(LIBOUT)/libdrivers.a: $(LIBOBJ)
+	$(AR) rcs $@ $^
+
+$(LIBOUT)/%.o: $(LIBDIR)/%.c $(wildcard $(LIBDIR)/*.h)
+	@mkdir -p $(LIBOUT)
+	$(CC) $(CFLAGS) -c $< -o $@
+
+SIZE = python3 $(TOP)tools/size.py $(DEVICE).out $(MAP) $(wildcard *.su $(LIBOUT)/*.su) \
+       $(if $(FLASH_BUDGET),--flash $(FLASH_BUDGET)) $(if $(RAM_BUDGET),--ram $(RAM_BUDGET))
+
+size: $(DEVICE).out
+	@$(SIZE)
+
+size-report: $(DEVICE).out
+	@$(SIZE) -v
+
+asm:
+	$(CC) $(CFLAGS) -fno-lto -fverbose-asm -masm-hex -S main.c
+
+asm2:
+	$(CC) $(CFLAGS) -fno-lto -masm-hex -c -g -Wa,-a,-ad main.c > main.lst
+
+clean: 
+	$(RM) $(OBJECTS)
+	$(RM) $(MAP)
+	$(RM) *.out
+	$(RM) *.s
+	$(RM) *.lst
+	$(RM) *.su
+	$(RM) -r $(LIBOUT) $(SIMOUT)
+
+debug: all
+	$(GDB) "prog $(DEVICE).out"
+
+# Host build against the peripheral models in sim/ (see sim/msp430.h):
+#   make sim && ./sim.out
+SIMCC   = gcc
+SIMDIR  = $(TOP)sim
+SIMOUT  = $(LIBDIR)/$(DEVICE)-sim
+SIMOBJ  = $(patsubst $(LIBDIR)/%.c,$(SIMOUT)/%.o,$(wildcard $(LIBDIR)/*.c))
+SIMFLAGS = -I $(SIMDIR) -I $(LIBDIR) -D__$(DEVICE)__ -O2 -Wall -Wno-main -g
+
+sim: sim.out
+
+sim.out: $(OBJECTS:.o=.c) $(SIMDIR)/sim.c $(SIMDIR)/msp430.h $(SIMOUT)/libsim.a
+	$(SIMCC) $(SIMFLAGS) $(OBJECTS:.o=.c) $(SIMDIR)/sim.c -L $(SIMOUT) -lsim -o $@
+
+$(SIMOUT)/libsim.a: $(SIMOBJ)
+	ar rcs $@ $^
+
+$(SIMOUT)/%.o: $(LIBDIR)/%.c $(wildcard $(LIBDIR)/*.h) $(SIMDIR)/msp430.h
+	@mkdir -p $(SIMOUT)
+	$(SIMCC) $(SIMFLAGS) -c $< -o $@
+
+.PHONY: all asm asm2 clean debug sim size size-report
@@ -0,0 +1,104 @@
+//******************************************************************************
+//  Command frames. See cmdframe.h.
+//
+//  Receiving is a byte at a time, so it can be called straight from a main
+//  loop fed by a one-byte UART buffer (as G2452FRAMloader is). Little work is
+//  done per byte; the commands run after the checksum byte.
+//******************************************************************************
+#include "cmdframe.h"
+
+enum { hunt, len, body, chk, skip };
+
+static unsigned char frame[FRAME_MAX];
+static unsigned char reply[REPLY_MAX];
+static unsigned char state, flen, fpos, fsum;
+static unsigned char rlen, rstatus;
+
+// Send the reply: SOF LEN STATUS data... CHK
+static void frame_send(void)
+{
+  unsigned char i, sum;
+
+  frame_tx(FRAME_SOF);
+  frame_tx(rlen + 1);
+  frame_tx(rstatus);
+  sum = rlen + 1 + rstatus;
+  for (i = 0; i < rlen; i++) {
+    frame_tx(reply[i]);
+    sum += reply[i];
+  }
+  frame_tx(-sum);
+}
+
+unsigned char frame_rx(unsigned char c)
+{
+  switch (state) {
+  case hunt:
+    if (c != FRAME_SOF)
+      return FRAME_OUT;                     // Not ours
+    state = len;
+    return FRAME_MORE;
+  case len:
+    flen = c;
+    fsum = c;
+    fpos = 0;
+    if (c > FRAME_MAX) {                    // Can't hold it: skip it, no reply,
+      state = skip;                         //  as the host is still sending
+      return FRAME_MORE;
+    }
+    state = c ? body : chk;
+    return FRAME_MORE;
+  case body:
+    frame[fpos++] = c;
+    fsum += c;
+    if (fpos == flen)
+      state = chk;
+    return FRAME_MORE;
+  case skip:
+    if (fpos++ < flen)                      // LEN bytes, then CHK
+      return FRAME_MORE;
+    state = hunt;
+    return FRAME_BAD;
+  case chk:
+    state = hunt;
+    if ((unsigned char)(fsum + c) == 0)
+      return FRAME_OK;
+    break;
+  }
+  state = hunt;                             // Bad sum: hunt for the next SOF
+  rlen = 0;
+  rstatus = STATUS_SUM;
+  frame_send();
+  return FRAME_BAD;
+}
+
+void frame_reply(unsigned char c)
+{
+  if (rlen < REPLY_MAX)
+    reply[rlen++] = c;
+  else
+    rstatus = STATUS_FULL;
+}
+
+void frame_run(void)
+{
+  unsigned char i = 0, op, n;
+
+  rlen = 0;
+  rstatus = STATUS_OK;
+  while (i < flen) {
+    op = frame[i];
+    n = (i + 1 < flen) ? frame[i + 1] : 0xFF;
+    if (n > flen - i - 2) {                 // Also catches a lone OP
+      rstatus = STATUS_LEN;
+      break;
+    }
+    if (op >= cmd_count || !cmd_table[op]) {
+      rstatus = STATUS_OP;
+      break;
+    }
+    cmd_table[op](&frame[i + 2], n);
+    i += n + 2;
+  }
+  frame_send();
+}
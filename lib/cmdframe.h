@@ -0,0 +1,54 @@
+//******************************************************************************
+//  Command frames
+//
+//  A compact host <-> LaunchPad protocol. One frame carries several commands,
+//  so a host pays one round trip per frame rather than per byte:
+//
+//    frame   := SOF LEN command... CHK             (LEN = bytes of commands)
+//    command := OP N payload[N]
+//    reply   := SOF LEN STATUS data... CHK         (LEN = 1 + bytes of data)
+//
+//  CHK makes the 8-bit sum of LEN through CHK zero. The commands run only
+//  once the whole frame has arrived and checked out, in order, and each may
+//  append data to the one reply. Commands are looked up in the application's
+//  cmd_table[], indexed by OP. A byte outside any frame is handed back to the
+//  application, which may keep single-character commands alongside frames.
+//
+//  A frame with LEN over FRAME_MAX is skipped, its LEN bytes and CHK, with no
+//  reply: one sent at once would cross the rest of the frame, and overrun a
+//  one-byte receive buffer (G2452FRAMloader). The host times out instead.
+//
+//  The application provides cmd_table[], cmd_count and frame_tx().
+//  Host side: cmdframe.py.
+//******************************************************************************
+#ifndef CMDFRAME_H
+#define CMDFRAME_H
+
+#define FRAME_SOF       0x7E
+#define FRAME_MAX       64                  // Bytes of commands per frame
+#define REPLY_MAX       64                  // Bytes of reply data per frame
+
+// frame_rx() results
+#define FRAME_MORE      0                   // Byte taken, frame incomplete
+#define FRAME_OK        1                   // Frame complete: call frame_run()
+#define FRAME_BAD       2                   // Bad checksum: reply sent. Too long: skipped, none
+#define FRAME_OUT       3                   // Byte is not part of a frame
+
+// Reply STATUS
+#define STATUS_OK       0x00
+#define STATUS_SUM      0x01                // Frame checksum bad, nothing run
+#define STATUS_OP       0x02                // Unknown OP, this and later commands not run
+#define STATUS_LEN      0x03                // Command runs past the frame, not run
+#define STATUS_FULL     0x04                // Reply data overflowed REPLY_MAX, truncated
+
+typedef void (*cmd_fn)(const unsigned char *arg, unsigned char n);
+
+extern const cmd_fn cmd_table[];            // By OP, 0 for none
+extern const unsigned char cmd_count;       // Entries in cmd_table[]
+extern void frame_tx(unsigned char c);      // Send one byte to the host
+
+unsigned char frame_rx(unsigned char c);    // Feed one received byte
+void frame_run(void);                       // Run the frame's commands, send reply
+void frame_reply(unsigned char c);          // Append to the reply (from a cmd_fn)
+
+#endif
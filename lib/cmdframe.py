@@ -0,0 +1,85 @@
+'''
+cmdframe.py - Host side of the command frames in cmdframe.h.
+
+  frame   := SOF LEN command... CHK        command := OP N payload[N]
+  reply   := SOF LEN STATUS data... CHK
+
+A Link sends a list of commands, packed into as few frames as fit, and waits
+for one reply per frame rather than one per byte. Each command is a tuple
+(op, payload, nreply): nreply is how many reply bytes it will produce, so a
+frame's replies also fit.
+
+Example:
+  link = Link(ser)
+  link.run([(0x06, b'\\x9F', 0), (0x04, b'\\x09', 9), (0x02, b'', 0)])
+'''
+
+import time
+
+SOF = 0x7E
+FRAME_MAX = 64                              # Bytes of commands per frame
+REPLY_MAX = 64                              # Bytes of reply data per frame
+
+STATUS = {0x01: "frame checksum", 0x02: "unknown op",
+          0x03: "command runs past frame", 0x04: "reply overflow"}
+
+
+class FrameError(Exception):
+    pass
+
+
+def encode(cmds):
+    '''One frame holding cmds, a list of (op, payload).'''
+    body = b''.join(bytes((op, len(p))) + bytes(p) for op, p in cmds)
+    if len(body) > FRAME_MAX:
+        raise ValueError("frame too long")
+    head = bytes((len(body),)) + body
+    return bytes((SOF,)) + head + bytes(((-sum(head)) & 0xFF,))
+
+
+class Link:
+    def __init__(self, ser, timeout=1.0):
+        self.ser = ser
+        self.timeout = timeout
+
+    def read(self, n):
+        data = b''
+        end = time.time() + self.timeout
+        while len(data) < n and time.time() < end:
+            data += self.ser.read(n - len(data))
+        if len(data) < n:
+            raise FrameError("reply timed out")
+        return data
+
+    def frame(self, cmds):
+        '''Send one frame, return its reply data.'''
+        self.ser.write(encode(cmds))
+        while self.read(1)[0] != SOF:       # Skip anything else the target said
+            pass
+        n = self.read(1)[0]
+        rest = self.read(n + 1)
+        if (n + sum(rest)) & 0xFF:
+            raise FrameError("reply checksum")
+        if rest[0]:
+            raise FrameError(STATUS.get(rest[0], "status %#x" % rest[0]))
+        return rest[1:-1]
+
+    def run(self, cmds):
+        '''Send (op, payload, nreply) commands, as few frames as fit.
+        Return all the reply data.'''
+        out = b''
+        batch = []
+        size = rlen = 0
+        for op, p, nr in cmds:
+            if 2 + len(p) > FRAME_MAX or nr > REPLY_MAX:
+                raise ValueError("command too long for a frame")
+            if batch and (size + 2 + len(p) > FRAME_MAX or rlen + nr > REPLY_MAX):
+                out += self.frame(batch)
+                batch = []
+                size = rlen = 0
+            batch.append((op, p))
+            size += 2 + len(p)
+            rlen += nr
+        if batch:
+            out += self.frame(batch)
+        return out
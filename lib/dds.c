@@ -0,0 +1,144 @@
+//******************************************************************************
+//  DDS. See dds.h.
+//
+//  The ISR loads the sample computed last time into CCR2 first, as
+//  G2452slaa804's does, then computes the next one: a 16-bit add and a table
+//  lookup, so few registers to push before that load. It has to land within
+//  the table's minimum of 16 ticks (32 MCLK cycles), or that period is full
+//  duty. The sweep step's 32-bit arithmetic and variable shift would need
+//  several more, so the ISR only asks for it, and main takes it (DDS_Step).
+//
+//  The tuning word is kept 16.16 so slow sweeps still move: only its top
+//  16 bits, Step, are added to the phase.
+//******************************************************************************
+#include <msp430.h>
+#include "dds.h"
+
+// A quarter of the period, mirrored and negated by DDSSample(): 64 bytes for 256 points.
+static const unsigned char Wave[64] = {
+  // slaa804.py 256 7/16 16: sin(w)*256*(7/16) with (i+0.5)/Samples, quarter wave. Range 16 to 240.
+    1,   4,   7,  10,  12,  15,  18,  21,  23,  26,  29,  31,  34,  36,  39,  42,
+   44,  47,  49,  52,  54,  56,  59,  61,  63,  66,  68,  70,  72,  74,  76,  78,
+   80,  82,  84,  86,  87,  89,  91,  92,  94,  95,  97,  98,  99, 101, 102, 103,
+  104, 105, 106, 107, 108, 108, 109, 110, 110, 111, 111, 111, 112, 112, 112, 112
+};
+
+// Sample of phase p, 0 to 255
+static inline unsigned char DDSSample (unsigned char p)
+{
+  unsigned char q = p & 63;
+
+  if (p & 64)                                    // 2nd and 4th quarters: mirrored
+    q = 63 - q;
+  return (p & 128) ? 128 - Wave[q] : 128 + Wave[q];   // 2nd half: negated
+}
+
+static unsigned long Tw;                            // Tuning word, 16.16
+static volatile unsigned int Step;                  // Its top 16 bits, for the ISR
+static volatile unsigned int Phase;
+static volatile unsigned char NexSam = 128;         // Loaded at the next period
+static unsigned long SweepTo;                       // Final tuning word, 16.16
+static unsigned char SweepMode;
+static unsigned int SweepRate;
+static unsigned int SweepEvery, SweepCount;         // Samples per step, and left
+static volatile unsigned char Sweeping;
+static volatile unsigned char StepDue;              // Set by the ISR, taken by DDS_Step
+
+void DDS_Init (void)
+{
+  // Select TA0.2 to P1.4
+  P1DIR |= BIT4;
+  P1SEL |= BIT4;
+  P1SEL2|= BIT4;
+
+  TA0CTL = TASSEL_2 + MC_1;                      // SMCLK, UP to CCR0 w/ auto reset
+  TA0CCR0 = 255;                                 // Set PWM period to 256 clock ticks
+  TA0CCR2 = 128;                                 // Midpoint
+  TA0CCTL2 = OUTMOD_7;                           // Set at CCR0, reset at CCR2
+}
+
+void DDS_Tone (unsigned int tw)
+{
+  TA0CCTL0 &= ~CCIE;
+  Sweeping = 0;
+  Tw = (unsigned long)tw << 16;
+  Step = tw;
+  TA0CCTL0 = CCIE;                               // CCR0 interrupt enabled
+}
+
+void DDS_Sweep (unsigned int from, unsigned int to, unsigned char mode,
+                unsigned int rate, unsigned int every)
+{
+  TA0CCTL0 &= ~CCIE;
+  Tw = (unsigned long)from << 16;
+  Step = from;
+  SweepTo = (unsigned long)to << 16;
+  SweepMode = mode;
+  SweepRate = rate;
+  SweepEvery = SweepCount = every ? every : 1;
+  StepDue = 0;
+  Sweeping = 1;
+  TA0CCTL0 = CCIE;
+}
+
+unsigned char DDS_Sweeping (void)
+{
+  return Sweeping;
+}
+
+unsigned char DDS_StepDue (void)
+{
+  return StepDue;
+}
+
+void DDS_Stop (void)
+{
+  TA0CCTL0 &= ~CCIE;
+  Sweeping = 0;
+  NexSam = 128;
+  TA0CCR2 = 128;
+}
+
+// Move Tw one step toward SweepTo, if the ISR has asked. At SweepTo, the
+// sweep is done and the final tone holds. Step is one word, so the ISR
+// never sees half of it: this runs with interrupts enabled.
+void DDS_Step (void)
+{
+  unsigned long tw = Tw;
+  unsigned long d;
+
+  if (!StepDue)
+    return;
+  StepDue = 0;
+  if (SweepMode == DDS_EXP) {
+    d = tw >> SweepRate;
+    if (!d)
+      d = 1;
+  } else
+    d = (unsigned long)SweepRate << 8;
+
+  if (tw < SweepTo ? SweepTo - tw <= d : tw - SweepTo <= d) {
+    tw = SweepTo;
+    Sweeping = 0;                                // Hold the final tone
+  } else
+    tw = tw < SweepTo ? tw + d : tw - d;
+  Tw = tw;
+  Step = (unsigned int)(tw >> 16);
+}
+
+#if defined(__TI_COMPILER_VERSION__)
+#pragma vector=TIMER0_A0_VECTOR
+__interrupt void DDS_ISR(void)
+#else
+  void __attribute__ ((interrupt(TIMER0_A0_VECTOR))) DDS_ISR (void)
+#endif
+{
+  TA0CCR2 = NexSam;                              // Load value for next duty cycle
+  Phase += Step;
+  NexSam = DDSSample(Phase >> 8);                // Top 8 bits
+  if (Sweeping && !--SweepCount) {
+    SweepCount = SweepEvery;
+    StepDue = 1;
+    __bic_SR_register_on_exit(LPM0_bits);       // Step due: wake main for DDS_Step
+  }
+}
@@ -0,0 +1,48 @@
+//******************************************************************************
+//  DDS: direct digital synthesis of tones and sweeps on the PWM DAC, TA0.2 (P1.4)
+//
+//  The PWM runs as in tdac.h: SMCLK = 8MHz, 256 ticks per period, so one sample
+//  every 32us (DDS_FS). Each period the CCR0 ISR adds the tuning word to a
+//  16-bit phase accumulator and looks the top 8 bits up in a 256-point sine,
+//  stored as its first quarter (64 bytes).
+//  The tone is then tw * DDS_FS / 65536 Hz, in steps of 0.48Hz, up to Nyquist,
+//  rather than locked to SMCLK/256/32 as with G2452slaa804's 32-entry table.
+//
+//  A sweep moves the tuning word from one value to another, one step every
+//  'every' samples:
+//    DDS_LINEAR: by rate/256 of a tuning word unit per step (see DDS_LIN_RATE)
+//    DDS_EXP:    by 1/2^rate of itself per step, so by octaves per second:
+//                DDS_FS / every * log2(1 + 1/2^rate)
+//  The ISR wakes the CPU from LPM0 when a step is due, and main takes it with
+//  DDS_Step(), interrupts enabled, so the ISR stays a lookup (see dds.c).
+//  At the end it holds the final tone.
+//  A chirp is a few words of parameters instead of a recording.
+//
+//  Set MCLK = 16MHz and SMCLK = 8MHz first, and enable interrupts.
+//******************************************************************************
+#ifndef DDS_H
+#define DDS_H
+
+#define DDS_FS          31250UL                     // Samples per second
+
+// Tuning word for hz
+#define DDS_TW(hz)      ((unsigned int)(((hz) * 65536UL + DDS_FS / 2) / DDS_FS))
+
+// DDS_LINEAR rate to sweep from hz1 to hz2 in ms milliseconds, a step every 'every' samples
+#define DDS_LIN_RATE(hz1, hz2, ms, every) \
+  ((unsigned int)((((hz2) > (hz1) ? DDS_TW(hz2) - DDS_TW(hz1) : DDS_TW(hz1) - DDS_TW(hz2)) * 256UL) \
+                  / ((ms) * DDS_FS / 1000 / (every))))
+
+#define DDS_LINEAR      0
+#define DDS_EXP         1
+
+void DDS_Init (void);                               // PWM at midpoint, no tone
+void DDS_Tone (unsigned int tw);                    // Play tuning word tw
+void DDS_Sweep (unsigned int from, unsigned int to, unsigned char mode,
+                unsigned int rate, unsigned int every);
+unsigned char DDS_Sweeping (void);                  // Not yet at 'to'?
+unsigned char DDS_StepDue (void);                   // Has the ISR asked for a step?
+void DDS_Step (void);                               // Take it, if so, from main
+void DDS_Stop (void);                               // Back to midpoint, ISR off
+
+#endif
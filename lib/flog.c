@@ -0,0 +1,100 @@
+//******************************************************************************
+//  FRAM log. See flog.h.
+//
+//  head and wraps are kept in RAM as well, so an append reads nothing back.
+//  Records never straddle the end: the data area is cut to a whole number.
+//******************************************************************************
+#include <msp430.h>
+#include "fm25v40.h"
+#include "flog.h"
+
+static unsigned char Rec;
+static unsigned long Cap;                   // Bytes of records, a multiple of Rec
+static unsigned long Head, Wraps;
+
+static unsigned long FLOG_Get (void)        // 32-bit, little-endian
+{
+  unsigned long v = 0;
+  unsigned char i;
+
+  for (i = 0; i < 32; i += 8)
+    v |= (unsigned long)(unsigned char)FM25V40_Read() << i;
+  return v;
+}
+
+static void FLOG_Put (unsigned long v)
+{
+  unsigned char i;
+
+  for (i = 4; i != 0; i--, v >>= 8)
+    FM25V40_Wrte(v);
+}
+
+// head and wraps to the header
+static void FLOG_Head (void)
+{
+  FM25V40_WAddr(4);
+  FLOG_Put(Head);
+  FLOG_Put(Wraps);
+  FM25V40_Stop();
+}
+
+unsigned char FLOG_Open (unsigned char rec)
+{
+  unsigned char m0, m1, r;
+
+  Rec = rec;
+  Cap = FM25V40_Size();
+  if (Cap <= FLOG_DATA) {                   // No part
+    Cap = 0;
+    return 0;
+  }
+  Cap = (Cap - FLOG_DATA) / rec * rec;
+
+  FM25V40_Addr(0);
+  m0 = FM25V40_Read();
+  m1 = FM25V40_Read();
+  r = FM25V40_Read();
+  FM25V40_Read();
+  Head = FLOG_Get();
+  Wraps = FLOG_Get();
+  FM25V40_Stop();
+
+  if (m0 == 'F' && m1 == 'L' && r == rec && Head < Cap && Head % rec == 0)
+    return 1;
+  FLOG_Clear();                             // None, or of other records
+  return 0;
+}
+
+void FLOG_Append (const void *record)
+{
+  const unsigned char *p = record;
+  unsigned char n = Rec;
+
+  if (!Cap)
+    return;
+  FM25V40_WAddr(FLOG_DATA + Head);
+  while (n--)
+    FM25V40_Wrte(*p++);
+  FM25V40_Stop();
+
+  Head += Rec;
+  if (Head == Cap) {
+    Head = 0;
+    Wraps++;
+  }
+  FLOG_Head();
+}
+
+void FLOG_Clear (void)
+{
+  Head = Wraps = 0;
+  FM25V40_WAddr(0);
+  FM25V40_Wrte('F');
+  FM25V40_Wrte('L');
+  FM25V40_Wrte(Rec);
+  FM25V40_Wrte(0);
+  FLOG_Put(Head);
+  FLOG_Put(Wraps);
+  FM25V40_Stop();
+}
@@ -0,0 +1,33 @@
+//******************************************************************************
+//  FRAM log: fixed-size records appended to the FM25V40 as a circular log
+//
+//  A small header at address 0, then records from FLOG_DATA to the end of the
+//  part, oldest overwritten once it's full:
+//    0   'F' 'L'     magic
+//    2   rec         record size, 1 to 255 bytes
+//    3   0           reserved
+//    4   head        next record's offset from FLOG_DATA, 32-bit little-endian
+//    8   wraps       times head has gone back to 0, 32-bit little-endian
+//  Once wrapped, the oldest record is the one at head.
+//
+//  F-RAM writes each byte in place at bus speed, with no erase and no page, so
+//  an append is two short WRITEs: the record, then head and wraps. A record
+//  only counts once the second is done, so a reset between them loses it and
+//  no more. At 10^14 writes per byte the header needs no wear levelling.
+//
+//  G2452FRAMloader reads the log back: host.py's LogDump() saves the records,
+//  oldest first, in one burst. LogClear() empties it.
+//
+//  Set the FM25V40 up first, with FM25V40_Init(): the log fills the part it
+//  found by RDID, whatever its density. With no part found, appends do nothing.
+//******************************************************************************
+#ifndef FLOG_H
+#define FLOG_H
+
+#define FLOG_DATA       16                  // First record's address
+
+unsigned char FLOG_Open (unsigned char rec);// Resume a log of rec byte records (1), or start one (0)
+void FLOG_Append (const void *record);      // rec bytes
+void FLOG_Clear (void);                     // Empty: head and wraps 0
+
+#endif
@@ -0,0 +1,205 @@
+//******************************************************************************
+//  FM25V40 F-RAM. See fm25v40.h.
+//
+//  FM25V40_Port() is the interface's own setup, USI or USCI_B0; the rest is
+//  shared. RDID is 0x7F continuation bytes, 0xC2 (Cypress, was Ramtron), then
+//  family (3 bits, 001 F-RAM) and density d (5 bits): 8K bytes << d.
+//******************************************************************************
+#include <msp430.h>
+#include "fm25v40.h"
+
+#if defined(__MSP430_HAS_USI__)             // G2452: USI, P1.6 and P1.7 swapped
+
+static void FM25V40_Port (unsigned char div)
+{
+  // P1.x:
+  P1SEL |= SCK | MISO | MOSI;           // Let USIP.x control these, including direction, etc.
+  // P2.x:
+  P2OUT |= CS_;                         // Turn off CS_
+  P2DIR |= CS_;                         // And drive it
+
+  /* SPI mode 0  {USICKPH, USICKPL} <= 0b10, SCK inactive LO, capture on next edge, change on next edge */
+//  USICTL1 &= ~USII2C;                 // (default) Select SPI mode
+//  USICKCTL &= ~USICKPL;               // (default) SCK inactive LO
+  USICTL1 |= USICKPH;                   // Capture on 1st edge, change on following
+  /* SPI mode 3 would be {USICKPH, USICKPL} <= 0b01, as F-RAM always captures on rising edge */
+  
+  // P1 bits 7, 6, and 5 enable; Master; and (default) hold in reset
+  USICTL0 |= USIPE7 + USIPE6 + USIPE5 + USIMST + USISWRST; // Port, SPI master
+
+  USICKCTL |= div | USISSEL_2;          // Div | SMCLK.
+  
+  USICTL0 &= ~USISWRST;                 // USI released for operation
+}
+
+// Stop. (Deassert CS_)
+void FM25V40_Stop (void)
+{
+  while (!(USICTL1 & USIIFG)) {}        // Wait for idle
+  P2OUT |= CS_;                         // Deassert CS_
+}
+
+// Receive. (Tri-state TDO and shift in 8 bits.)
+char FM25V40_Read (void)
+{
+  while (!(USICTL1 & USIIFG)) {}        // Wait for idle
+  P2OUT &= ~CS_;                        // Assert CS_ (only for initial dummy-read)
+  USICTL0 &= ~USIOE;                    // SDO disable
+  USICNT = 8;                           // Read
+  while (!(USICTL1 & USIIFG)) {}        // Wait
+  return (USISRL);                      // Return 8-bits
+}
+
+// Send. (Assert CS_, drive TDO, and shift out 8 bits.)
+void FM25V40_Wrte (char SndData)
+{
+  while (!(USICTL1 & USIIFG)) {}        // Wait for idle
+  P2OUT &= ~CS_;                        // Assert CS_
+  USICTL0 |= USIOE;                     // SDO enable
+  USISRL = SndData;                     // write data
+  USICNT = 8;                           // Send it
+}
+
+#elif defined(__MSP430_HAS_USCI__)          // G2553: USCI_B0, as the BoosterPack is wired
+
+static void FM25V40_Port (unsigned char div)
+{
+  // P2.x:
+  P2OUT |= CS_;                         // Turn off CS_
+  P2DIR |= CS_;                         // And drive it
+
+  UCB0CTL1 = UCSWRST + UCSSEL_2;        // Hold in reset, SMCLK
+  /* SPI mode 0: UCCKPH captures on the first edge, UCCKPL = 0 SCK inactive LO */
+  UCB0CTL0 = UCCKPH + UCMSB + UCMST + UCSYNC; // 3-pin SPI master, MSB first
+  UCB0BR0 = 1 << (div >> 5);            // USIDIV_x: SMCLK / 2^x, as the USI
+  UCB0BR1 = 0;
+  // P1.x: USCI_B0 controls these, including direction
+  P1SEL |= SCK | MISO | MOSI;
+  P1SEL2 |= SCK | MISO | MOSI;
+  UCB0CTL1 &= ~UCSWRST;                 // USCI released for operation
+}
+
+// Stop. (Deassert CS_)
+void FM25V40_Stop (void)
+{
+  while (UCB0STAT & UCBUSY) {}          // Wait for idle
+  P2OUT |= CS_;                         // Deassert CS_
+}
+
+// Receive. (Shift out 0xFF and 8 bits in.)
+char FM25V40_Read (void)
+{
+  while (UCB0STAT & UCBUSY) {}          // Wait for idle: writes' RX is junk
+  P2OUT &= ~CS_;                        // Assert CS_ (only for initial dummy-read)
+  IFG2 &= ~UCB0RXIFG;
+  UCB0TXBUF = 0xFF;                     // Read
+  while (!(IFG2 & UCB0RXIFG)) {}        // Wait
+  return (UCB0RXBUF);                   // Return 8-bits
+}
+
+// Send. (Assert CS_ and shift out 8 bits.)
+void FM25V40_Wrte (char SndData)
+{
+  while (!(IFG2 & UCB0TXIFG)) {}        // Wait for room: TXBUF is double buffered
+  P2OUT &= ~CS_;                        // Assert CS_
+  UCB0TXBUF = SndData;                  // Send it
+}
+
+#endif
+
+#if defined(__MSP430_HAS_USI__) || defined(__MSP430_HAS_USCI__)
+
+static unsigned long Size;              // Bytes, 0 if RDID didn't match
+static unsigned char Wide = 1;          // 3 address bytes, else 2
+
+unsigned long FM25V40_Init (unsigned char div)
+{
+  unsigned char i, b, d;
+
+  FM25V40_Port (div);
+  FM25V40_Wake ();                      // In case it was left asleep
+
+  FM25V40_Wrte (FM25V40_RDID);
+  for (i = 0; (b = FM25V40_Read ()) == 0x7F && i < 6; i++) {}  // Continuation
+  d = FM25V40_Read ();                  // Family, density
+  FM25V40_Read ();                      // Sub, revision
+  FM25V40_Stop ();
+
+  Size = 0;
+  if (i == 6 && b == 0xC2 && (d >> 5) == 1 && (d & 0x1F) >= 1 && (d & 0x1F) <= 8)
+    Size = 0x2000UL << (d & 0x1F);
+  Wide = Size == 0 || Size > 0x10000;   // Unknown: as the FM25V40
+  return Size;
+}
+
+unsigned long FM25V40_Size (void)
+{
+  return Size;
+}
+
+// Opcode and the part's 2 or 3 address bytes
+static void FM25V40_Op (unsigned char op, unsigned long addr)
+{
+  FM25V40_Wrte (op);
+  if (Wide)
+    FM25V40_Wrte (addr >> 16);
+  FM25V40_Wrte (addr >> 8);
+  FM25V40_Wrte (addr);
+}
+
+// Set Address. (READ opcode and address, data follows.)
+void FM25V40_Addr (unsigned long addr)
+{
+  FM25V40_Op (FM25V40_READ, addr);
+}
+
+// Set Fast Address. (FSTRD opcode, address and a dummy byte, data follows.)
+void FM25V40_Fast (unsigned long addr)
+{
+  FM25V40_Op (FM25V40_FSTRD, addr);
+  FM25V40_Wrte (0);                     // Dummy
+}
+
+// Set Write Address. (WREN, then WRITE opcode and address, data follows.)
+// F-RAM writes each byte as it arrives: no erase, no page buffer.
+void FM25V40_WAddr (unsigned long addr)
+{
+  FM25V40_Wrte (FM25V40_WREN);          // Latched by CS_ going high
+  FM25V40_Stop ();
+  FM25V40_Op (FM25V40_WRITE, addr);
+}
+
+void FM25V40_Sleep (void)
+{
+  FM25V40_Wrte (FM25V40_SLEEP);
+  FM25V40_Stop ();                      // Sleeps on CS_ going high
+}
+
+// CS_ going low wakes it; the dummy read is discarded, then tREC.
+void FM25V40_Wake (void)
+{
+  FM25V40_Read ();
+  FM25V40_Stop ();
+  __delay_cycles (FM25V40_TREC);
+}
+
+unsigned char FM25V40_Status (void)
+{
+  unsigned char sr;
+
+  FM25V40_Wrte (FM25V40_RDSR);
+  sr = FM25V40_Read ();
+  FM25V40_Stop ();
+  return sr;
+}
+
+void FM25V40_Protect (unsigned char bp)
+{
+  FM25V40_Wrte (FM25V40_WREN);
+  FM25V40_Stop ();
+  FM25V40_Wrte (FM25V40_WRSR);
+  FM25V40_Wrte (bp & FM25V40_BP_ALL);   // WPEN 0: WP_ is pulled up anyway
+  FM25V40_Stop ();
+}
+
+#endif
@@ -0,0 +1,78 @@
+//******************************************************************************
+//  FM25V40 BoosterPack F-RAM, in SPI mode 0 over the G2452's USI or the G2553's USCI_B0
+//
+//  The 2452 has USI but not USCI, so P1.6 and P1.7 are reversed relative to
+//  the BoosterPack's USCI_B0 wiring. Remove the GRN LED jumper and place it
+//  between TDI and TDO on the BoosterPack (3-wire SPI, USIOE switches SDO).
+//  (See G2452TestFM25V40.)
+//  The 2553 matches the wiring: just remove the GRN LED jumper, which loads MISO.
+//
+//  Host should theoretically:  Wait 1ms; assert CS_; wait 450us; perform dummy-read.
+//  The dummy read appears necessary - to wake from FM25V40's Sleep Mode presumably.
+//  FM25V40_Init() does that, then reads RDID (0x7F7F7F7F7F7FC22640 for the
+//  FM25V40) for the density. Parts of 64K bytes or less (FM25V01, 02, 05) take
+//  2 address bytes, larger ones 3, and FM25V40_Addr() etc. send what the part
+//  takes. An ID it doesn't know is treated as an FM25V40 with size 0.
+//
+//  Between uses, FM25V40_Sleep() drops it to a few uA from standby's ~100uA.
+//  FM25V40_Wake() before the next access costs tREC, up to 450us.
+//******************************************************************************
+#ifndef FM25V40_H
+#define FM25V40_H
+
+// The "FM25V40 BoosterPack for TI LaunchPad" is wired as follows:
+// Port1
+#define     SCK     BIT5                // P1.5 is SCK
+#define     MISO    BIT6                // P1.6 is MISO (also GRN LED)
+#define     MOSI    BIT7                // P1.7 is MOSI
+// Port2
+#define     CS_     BIT0                // P2.0 is CS_
+#define     WP_     BIT1                // P2.1 is WP_
+#define     HOLD_   BIT2                // P2.2 is HOLD_
+// WP_ and HOLD_ are jumpered to a pullup to VCC
+
+// Opcodes
+#define     FM25V40_WREN    0x06        // Set write enable latch
+#define     FM25V40_WRDI    0x04        // Reset write enable latch
+#define     FM25V40_RDSR    0x05        // Read status register
+#define     FM25V40_WRSR    0x01        // Write status register
+#define     FM25V40_READ    0x03
+#define     FM25V40_FSTRD   0x0B        // Fast read: a dummy byte after the address
+#define     FM25V40_WRITE   0x02
+#define     FM25V40_SLEEP   0xB9
+#define     FM25V40_RDID    0x9F
+
+// Status register block protect (BP1, BP0), for FM25V40_Protect()
+#define     FM25V40_BP_NONE     0x00
+#define     FM25V40_BP_QUARTER  0x04    // Upper quarter
+#define     FM25V40_BP_HALF     0x08    // Upper half
+#define     FM25V40_BP_ALL      0x0C
+
+#define     FM25V40_TREC    7200        // MCLK cycles: tREC 450us at 16MHz
+
+// The G2553's headers have no USI: the same divisors for it
+#ifndef USIDIV_0
+#define     USIDIV_0    0x00
+#define     USIDIV_1    0x20
+#define     USIDIV_2    0x40
+#define     USIDIV_3    0x60
+#define     USIDIV_4    0x80
+#define     USIDIV_5    0xA0
+#define     USIDIV_6    0xC0
+#define     USIDIV_7    0xE0
+#endif
+
+unsigned long FM25V40_Init (unsigned char div);  // SCK = SMCLK / div, USIDIV_0..USIDIV_7. Bytes, by RDID
+unsigned long FM25V40_Size (void);      // As FM25V40_Init() found, 0 if unknown
+void FM25V40_Stop (void);               // Deassert CS_
+char FM25V40_Read (void);               // Shift in 8 bits (asserts CS_)
+void FM25V40_Wrte (char SndData);       // Assert CS_ and shift out 8 bits
+void FM25V40_Addr (unsigned long addr); // Start a READ at addr
+void FM25V40_WAddr (unsigned long addr);// Start a WRITE at addr (sends WREN first)
+void FM25V40_Fast (unsigned long addr); // Start a FSTRD at addr
+void FM25V40_Sleep (void);              // Sleep mode
+void FM25V40_Wake (void);               // Out of sleep mode, tREC waited
+unsigned char FM25V40_Status (void);    // RDSR
+void FM25V40_Protect (unsigned char bp);// FM25V40_BP_x, by WRSR
+
+#endif
@@ -0,0 +1,46 @@
+//******************************************************************************
+//  Stack high-water mark. See stack.h.
+//
+//  The linker script provides end (the first free byte after .bss/.noinit)
+//  and __stack (the top of RAM, where SP starts).
+//******************************************************************************
+#include <msp430.h>
+#include "stack.h"
+
+#if defined(__MSP430__)
+extern unsigned char end, __stack;
+
+static unsigned char *lowest(void)          // Lowest byte the stack has touched
+{
+  unsigned char *p = &end;
+
+  while (p < &__stack && *p == STACK_PAINT)
+    p++;
+  return p;
+}
+
+void stack_paint(void)
+{
+  unsigned char *p = &end;
+  unsigned char *sp;
+
+  __asm__ __volatile__ ("mov r1, %0" : "=r" (sp));
+  while (p < sp)
+    *p++ = STACK_PAINT;
+}
+
+unsigned int stack_high_water(void)
+{
+  return &__stack - lowest();
+}
+
+unsigned int stack_free(void)
+{
+  return lowest() - &end;
+}
+
+#else
+void stack_paint(void) {}
+unsigned int stack_high_water(void) { return 0; }
+unsigned int stack_free(void) { return 0; }
+#endif
@@ -0,0 +1,26 @@
+//******************************************************************************
+//  Stack high-water mark
+//
+//  With 256 or 512 bytes of RAM, a stack that grows into .bss corrupts it
+//  silently. stack_paint() fills the free RAM, from the end of .bss/.noinit
+//  up to the stack pointer, with STACK_PAINT. stack_high_water() then finds
+//  the lowest byte no longer painted: the deepest the stack has been, main
+//  and every ISR together, since painting.
+//
+//  Call stack_paint() first thing in main, before enabling interrupts.
+//  A pushed byte that happens to equal STACK_PAINT at the very bottom reads
+//  as unused, so the result may be short by a byte or so.
+//
+//  tools/size.py gives the static worst case; this is what actually happened.
+//  Host builds (sim/) have no such RAM, and report 0.
+//******************************************************************************
+#ifndef STACK_H
+#define STACK_H
+
+#define STACK_PAINT     0xA5
+
+void stack_paint(void);                     // Paint the free RAM below SP
+unsigned int stack_high_water(void);        // Deepest stack so far, bytes
+unsigned int stack_free(void);              // Never-used RAM left, bytes
+
+#endif
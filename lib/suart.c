@@ -0,0 +1,111 @@
+//******************************************************************************
+//  Timer_A software UART. See suart.h.
+//******************************************************************************
+#include <msp430.h>
+#include "suart.h"
+
+#define LedRED  BIT0                        // P1.0 is Red LED (overrun)
+
+volatile unsigned char RXData;
+static volatile unsigned char RXTempData;
+static volatile unsigned char RXBitCnt;
+volatile unsigned char RXUARTDataValid;
+volatile unsigned char TXData;
+static volatile unsigned char TXBitCnt;
+
+// BEWARE: Both TX and RX require interrupts
+// Initializes UART. Sets to receive characters.
+void UART_Init (void)
+{
+  // Initialize Timer
+  TACTL = TASSEL_2 + MC_2;                  // SMCLK, continuous mode
+  TACCTL1 = OUT;                            // OUTMOD = 0, TXD <= '1' for initial idle state only
+
+  // Initialize Ports - after setting OUTMOD and OUT
+  P1SEL |= TXD + RXD;                       // Select TimerA0
+  P1DIR |= TXD;                             // TXD is Output
+
+  // Prime to receive first byte
+  RXUARTDataValid = 0;                      // No char yet received (overrun detection)
+  RXBitCnt = 8;                             // Load Bit counter
+  TACCTL0 = SCS + OUTMOD0 + CM1 + CAP + CCIE;// Sync, Neg Edge, Cap
+}
+
+// Transmit character from TXData Buffer
+void TX_UART (void)
+{
+  while ( TACCTL1 & CCIE );                 // Wait for previous TX completion (no overrun possible)
+  TXBitCnt = 10;                            // Load Bit counter, 8 data + Start + Stop
+  TACCR1 = TAR +14;                         // Current state of TA counter
+                                            // + 14 TA clock cycles till first bit (after next statment)
+  TACCTL1 =  OUTMOD2 + OUTMOD0 + CCIE;      // Reset on Interrupt. E.I. TXD <= '0' (Start Bit)
+}                                           // => CCIE doubles as 'active' flag
+
+// =============================================================================
+// Timer0 A0 interrupt service routine - UART RX
+#if defined(__TI_COMPILER_VERSION__)
+  #pragma vector=TIMER0_A0_VECTOR
+  __interrupt void Timer_A0_ISR (void)
+#else
+  void __attribute__ ((interrupt(TIMER0_A0_VECTOR))) TIMER_A0_ISR (void)
+#endif
+{
+  TACCR0 += Bitime;                         // Add Offset to CCR0
+
+  if ( TACCTL0 & CAP ) {                    // Capture mode = start bit edge
+    TACCTL0 &= ~CAP;                        // Switch from capture to compare mode
+    TACCR0 += Bitime50;
+  }
+  else {
+    RXTempData = RXTempData >> 1;
+    if (TACCTL0 & SCCI)                     // Get bit waiting in receive latch
+      RXTempData |= 0x80;
+    RXBitCnt --;
+    if ( RXBitCnt == 0)	{                   // All bits RXed?
+      RXData = RXTempData;                  // Overwrite previous
+      if (RXUARTDataValid)                  // Overrun?
+	while (1)                           // Another byte received before the last one taken
+	  P1OUT |= LedRED;                  // Signal ERROR
+      
+      RXUARTDataValid = 1;                  // RXData is valid and not yet unloaded
+      RXBitCnt = 8;                         // Re-Load Bit counter for next RX char
+      TACCTL0 = SCS + OUTMOD0 + CM1 + CAP + CCIE; // Sync, Neg Edge, Cap
+                                            // wait for next falling RX edge
+                                            // which is the next start bit
+      __bic_SR_register_on_exit(LPM4_bits); // Clear all LPM bits from SR on stack
+    }
+  }
+}
+
+// =============================================================================
+// Timer0 A1 interrupt service routine - UART TX
+// ??? "Last bit is a bit shorter to give time for CPU processing."
+// ??? "For full speed echo TX should be a bit faster than RX to avoid overruns."
+#if defined(__TI_COMPILER_VERSION__)
+  #pragma vector=TIMER0_A1_VECTOR
+  __interrupt void Timer_A1_ISR (void)
+#else
+  void __attribute__ ((interrupt(TIMER0_A1_VECTOR))) TIMER_A1_ISR (void)
+#endif
+{
+  switch (__even_in_range(TAIV, 10))        // Use calculated jump table branching, and clear highest
+  {
+    case 2 :                                // TACCR1 CCIFG - UART TXD
+      if (TXBitCnt == 0)                    // All bits TXed?
+	TACCTL1 &= ~CCIE;                   //  Yes: disable interrupt, signal completion
+      else {
+	TXBitCnt --;
+	TACCTL1 &= ~ OUTMOD2;               // (Assume) SET, TX <= '1' on next interrupt
+	if (TXBitCnt == 0) {                // Stop bit next?
+	  TACCR1 += Bitime80;               // Yes, and SET was correct
+	}
+	else {
+	  TACCR1 += Bitime99;               // Add Offset to CCR0
+	  if (!(TXData & 0x01))
+	    TACCTL1 |= OUTMOD2;             // Correct to RESET, TX <= '0' on next interrupt
+	}	    
+	TXData = TXData >> 1;
+      }
+      break;
+  }
+}
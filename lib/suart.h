@@ -0,0 +1,34 @@
+//******************************************************************************
+//  Timer_A software UART (from G2452TimerBasedUART)
+//
+//  Full duplex, 9600 baud with SMCLK = 16MHz. CCR0 receives on P1.1 and
+//  CCR1 transmits on P1.2, using the output modes and SCCI latch, so bit
+//  timing doesn't depend on ISR latency.
+//  Uses both TIMER0_A0 and TIMER0_A1 vectors.
+//
+//  Receiving keeps one byte: RXData is valid while RXUARTDataValid is set,
+//  and a byte arriving before it is cleared locks up with the RED LED on.
+//
+// IMPORTANT:
+//   LaunchPad jumpers are in HW-UART mode. Strange but true!
+//******************************************************************************
+#ifndef SUART_H
+#define SUART_H
+
+#define RXD       BIT1                      // RXD on P1.1 [HW-UART JUMPER SETTINGS]
+#define TXD       BIT2                      // TXD on P1.2 [HW-UART JUMPER SETTINGS]
+
+//   Conditions for 9600 Baud SW UART, SMCLK = 16MHz
+#define Bitime50 833                        // ~50% bit length
+#define Bitime80 1333                       // ~ 80% bit length
+#define Bitime99 1650                       // ~ 99% bit length
+#define Bitime   1666                       // 16MHz / 9600 Baud = 1667
+
+extern volatile unsigned char RXData;
+extern volatile unsigned char RXUARTDataValid;
+extern volatile unsigned char TXData;
+
+void UART_Init (void);                      // Start Timer_A, ready to RX
+void TX_UART (void);                        // Send TXData
+
+#endif
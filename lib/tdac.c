@@ -0,0 +1,215 @@
+//******************************************************************************
+//  Timer DAC. See tdac.h.
+//
+//  The 4x interpolation is shared by both players, which differ only in where
+//  the next sample comes from. With -flto it is all inlined into the caller,
+//  FM25V40_Read() included. Likewise the 16x interpolation and error
+//  feedback of the noise-shaped players, where order is a constant by then.
+//******************************************************************************
+#include <msp430.h>
+#include "tdac.h"
+#include "fm25v40.h"
+
+void TDAC_Init (void)
+{
+  // Select TA0.2 to P1.4
+  P1DIR |= BIT4;
+  P1SEL |= BIT4;
+  P1SEL2|= BIT4;
+
+  // TAR to count from 0 to 255, interrupt, and reload automatically
+  TA0CTL = TASSEL_2 + MC_1;                      // SMCLK, UP to CCR0 w/ auto reset
+  TA0CCR0 = 255;                                 // Set PWM period to 256 clock ticks
+  TA0CCTL0 = CCIE;                               // CCR0 interrupt enabled
+
+  // TA0.2 (aka P1.4) is HI until CCR2 is reached, then goes LO.
+  // CCR0's interrupt is used to reload CCR2.
+  TA0CCR2 = 128;                                 // Start audio at midpoint
+  TA0CCTL2 = OUTMOD_7;                           // Set at CCR0, reset at CCR2
+}
+
+// Load the next PWM sample at the end of the current duty cycle
+static inline void TDAC_Next (unsigned int uSam)
+{
+  TA0CCTL0 &= ~CCIFG;                            // Wait for end of current duty cycle
+  while (!(TA0CCTL0 & CCIFG));                   //  no GIE style
+  TA0CCR2 = uSam;                                // Load PWM interpolated sample
+}
+
+// Play uAudSam1 and three samples interpolated toward uAudSam2.
+// *puAudX4 is the running sample times four, plus rounding bit.
+static inline void TDAC_Four (unsigned int uAudSam1, unsigned int uAudSam2, unsigned int *puAudX4)
+{
+  signed int sAudDiff;
+  unsigned int uAudX4 = *puAudX4;
+  unsigned int uNxSam1, uNxSam2, uNxSam3;
+
+  sAudDiff = uAudSam2 - uAudSam1;                // Compute signed difference
+
+  // Compute samples first. Samples stay in registers.
+  uAudX4 += sAudDiff;                            // Add 1/4 the difference
+  uNxSam1 = uAudX4 >> 2;                         // Sample 1
+  uAudX4 += sAudDiff;                            // Again
+  uNxSam2 = uAudX4 >> 2;                         // Sample 2
+  uAudX4 += sAudDiff;                            // Again
+  uNxSam3 = uAudX4 >> 2;                         // Sample 3
+  uAudX4 += sAudDiff;                            // Add 1/4 the difference
+  *puAudX4 = uAudX4;
+
+  TDAC_Next(uAudSam1);                           // Sample 0. Same as uAudX4 >> 2.
+  TDAC_Next(uNxSam1);
+  TDAC_Next(uNxSam2);
+  TDAC_Next(uNxSam3);
+}
+
+void TDAC_Play (const char *pAudio, unsigned long AudioSize)
+{
+  unsigned long i;
+  unsigned int uAudSam1;
+  unsigned int uAudSam2;
+  unsigned int uAudX4;
+
+  uAudSam2 = (unsigned char) *(pAudio++);        // Read initial audio sample as next
+  uAudX4   = (uAudSam2 << 2) + 2;                // Compute first sample times four, plus rounding bit
+  
+  for (i = AudioSize-1; i != 0; i--) {           // [Need a least two sample for interpolation]
+    uAudSam1 = uAudSam2;                         // Save previous next into current
+    uAudSam2 = (unsigned char) *(pAudio++);      // Read new next sample
+    TDAC_Four(uAudSam1, uAudSam2, &uAudX4);
+  }
+  TDAC_Next(uAudSam2);                           // Load final sample. Same as uAudX4 >> 2.
+}
+
+//================ Noise-shaped ==================
+void TDAC_InitSD (void)
+{
+  TDAC_Init();
+  TA0CCR0 = TDAC_SD_PERIOD - 1;                  // 64 ticks: 125kHz at 8MHz
+  TA0CCR2 = TDAC_SD_PERIOD / 2;                  // Start audio at midpoint
+}
+
+// Play uAudSam1 and fifteen samples interpolated toward uAudSam2, 12 bits
+// (sample times 16), each quantized to 6 bits. sErr[] holds the last two
+// quantization errors, fed back as e1 (1st order) or 2*e1 - e2 (2nd order).
+static inline void TDAC_Sixteen (unsigned int uAudSam1, unsigned int uAudSam2, signed int *sErr, unsigned char order)
+{
+  signed int sAudDiff = uAudSam2 - uAudSam1;
+  unsigned int uAudX16 = uAudSam1 << 4;
+  signed int e1 = sErr[0], e2 = sErr[1];
+  signed int v, y;
+  unsigned char i;
+
+  for (i = 16; i != 0; i--) {
+    v = uAudX16 + (order == 2 ? 2 * e1 - e2 : e1);
+    if (v < 1 << 6)                              // Clamp at the rails, a duty of 1 to 63,
+      v = 1 << 6;                                //  so the error stays 0 to 63
+    else if (v > (TDAC_SD_PERIOD << 6) - 1)
+      v = (TDAC_SD_PERIOD << 6) - 1;
+    y = v >> 6;                                  // Top 6 bits
+    e2 = e1;
+    e1 = v & 63;                                 // The 6 bits dropped, carried forward
+    uAudX16 += sAudDiff;
+    TDAC_Next(y);
+  }
+  sErr[0] = e1;
+  sErr[1] = e2;
+}
+
+void TDAC_PlaySD (const char *pAudio, unsigned long AudioSize, unsigned char order)
+{
+  unsigned long i;
+  unsigned int uAudSam1;
+  unsigned int uAudSam2;
+  signed int sErr[2] = { 0, 0 };
+
+  uAudSam2 = (unsigned char) *(pAudio++);        // Read initial audio sample as next
+
+  for (i = AudioSize-1; i != 0; i--) {           // [Need a least two sample for interpolation]
+    uAudSam1 = uAudSam2;                         // Save previous next into current
+    uAudSam2 = (unsigned char) *(pAudio++);      // Read new next sample
+    TDAC_Sixteen(uAudSam1, uAudSam2, sErr, order);
+  }
+  TDAC_Next(uAudSam2 >> 2);                      // Load final sample
+}
+
+#ifdef __MSP430_HAS_USI__                   // FM25V40 driver needs USI
+
+// Start a read with FM25V40_Addr() first. CS_ is deasserted at the end.
+void TDAC_PlayFRAM (unsigned long AudioSize)
+{
+  unsigned long i;
+  unsigned int uAudSam1;
+  unsigned int uAudSam2;
+  unsigned int uAudX4;
+
+  uAudSam2 = (unsigned char) FM25V40_Read();     // Read initial audio sample as next
+  uAudX4   = (uAudSam2 << 2) + 2;                // Compute first sample times four, plus rounding bit
+  
+  for (i = AudioSize-1; i != 0; i--) {           // [Need a least two sample for interpolation]
+    uAudSam1 = uAudSam2;                         // Save previous next into current
+    uAudSam2 = (unsigned char) FM25V40_Read();   // Read new next sample
+    TDAC_Four(uAudSam1, uAudSam2, &uAudX4);
+  }
+  TDAC_Next(uAudSam2);                           // Load final sample. Same as uAudX4 >> 2.
+
+  FM25V40_Stop ();
+}
+
+// Each clip follows the last without a break: its READ starts where the next
+// sample would have been read. The first clip needs at least one sample.
+void TDAC_PlayFRAMList (const tdac_clip *pClip, unsigned char n)
+{
+  unsigned long i;
+  unsigned int uAudSam1;
+  unsigned int uAudSam2;
+  unsigned int uAudX4;
+
+  if (n == 0)
+    return;
+  FM25V40_Addr(pClip->addr);
+  uAudSam2 = (unsigned char) FM25V40_Read();     // Read initial audio sample as next
+  uAudX4   = (uAudSam2 << 2) + 2;                // Compute first sample times four, plus rounding bit
+
+  i = pClip->size - 1;
+  for (;;) {
+    if (i == 0) {                                // This clip's samples all read
+      if (--n == 0)
+        break;
+      pClip++;
+      FM25V40_Stop();                            // Re-address, in the last sample's period
+      FM25V40_Addr(pClip->addr);
+      i = pClip->size;                           // Its first sample is read next
+      continue;
+    }
+    uAudSam1 = uAudSam2;                         // Save previous next into current
+    uAudSam2 = (unsigned char) FM25V40_Read();   // Read new next sample
+    TDAC_Four(uAudSam1, uAudSam2, &uAudX4);
+    i--;
+  }
+  TDAC_Next(uAudSam2);                           // Load final sample. Same as uAudX4 >> 2.
+
+  FM25V40_Stop ();
+}
+
+// Start a read with FM25V40_Addr() first. CS_ is deasserted at the end.
+// A byte is read between two PWM periods, so SCK should be SMCLK (USIDIV_0).
+void TDAC_PlayFRAMSD (unsigned long AudioSize, unsigned char order)
+{
+  unsigned long i;
+  unsigned int uAudSam1;
+  unsigned int uAudSam2;
+  signed int sErr[2] = { 0, 0 };
+
+  uAudSam2 = (unsigned char) FM25V40_Read();     // Read initial audio sample as next
+
+  for (i = AudioSize-1; i != 0; i--) {           // [Need a least two sample for interpolation]
+    uAudSam1 = uAudSam2;                         // Save previous next into current
+    uAudSam2 = (unsigned char) FM25V40_Read();   // Read new next sample
+    TDAC_Sixteen(uAudSam1, uAudSam2, sErr, order);
+  }
+  TDAC_Next(uAudSam2 >> 2);                      // Load final sample
+
+  FM25V40_Stop ();
+}
+
+#endif
@@ -0,0 +1,59 @@
+//******************************************************************************
+//  Timer DAC: 8-bit PWM audio on TA0.2 (P1.4)
+//
+//  An 8-bit DAC (8-bit samples, using PWM, and a timer count of 256 per sample), requires a 
+//  minimum timer clock rate of:
+//   f = 8kHz * 256 = 2MHz
+//
+//  However, this indirectly generates an 8kHz artifact in the PWM audio result. An
+//  audio filter set to play speech, up to 4kHz, doesn't reduce the 8kHz artifact enough.
+//
+//  To overcome this, with SMCLK = 8MHz, TDAC_Play interpolates three samples between
+//  every two stored. The interpolation reduces the wavefile storage requirement by a
+//  factor of 4.
+//
+//  No interrupts: each PWM period is waited for by polling CCR0's CCIFG.
+//
+//  Noise-shaped mode (TDAC_InitSD, TDAC_PlaySD...): the PWM period is cut to
+//  TDAC_SD_PERIOD (64) ticks, a 125kHz carrier, and each stored sample
+//  spans 16 periods, interpolated to 12 bits. Each period's duty keeps the
+//  top 6 bits, and the 6 dropped are carried into the next period by error
+//  feedback, first order (noise rising 6dB/octave) or second (12dB/octave).
+//  The quantization noise is pushed up toward the carrier, far above the
+//  audio band. There it is filtered with the carrier, which is now 16 times
+//  the sample rate rather than 4. About 11 (first order) or 13 (second order)
+//  bits are effective below 4kHz, at the same SMCLK and sample rate.
+//  Keep the audio off the rails, e.g. 0x20 to 0xE0: the duty is polled in,
+//  so it must outlast the wait loop (a few ticks), and the error feedback is
+//  clamped at the rails.
+//
+//  Playlists (TDAC_PlayFRAMList): clips anywhere in the F-RAM, played back to
+//  back as one. At each join the F-RAM is re-addressed between two PWM
+//  periods, where a sample is normally read, and the interpolation runs on
+//  from the last sample of one clip to the first of the next, so there is no
+//  gap and no step back to the midpoint. A prompt can be put together from
+//  words at run time. The re-address must fit in one PWM period (512 cycles
+//  at MCLK = 16MHz, see ../G2452Bench); there is no noise-shaped version, as
+//  its 128-cycle period is too short for one.
+//******************************************************************************
+#ifndef TDAC_H
+#define TDAC_H
+
+void TDAC_Init (void);                              // Start PWM at midpoint
+void TDAC_Play (const char *pAudio, unsigned long AudioSize);  // From memory
+void TDAC_PlayFRAM (unsigned long AudioSize);       // From FM25V40_Read(), see fm25v40.h
+
+typedef struct {                                    // A clip in the F-RAM
+  unsigned long addr;                               // First sample
+  unsigned long size;                               // Samples
+} tdac_clip;
+
+void TDAC_PlayFRAMList (const tdac_clip *pClip, unsigned char n);  // n clips, gapless
+
+#define TDAC_SD_PERIOD  64                          // Ticks per PWM period, noise-shaped
+
+void TDAC_InitSD (void);                            // Start PWM at midpoint, 64 ticks
+void TDAC_PlaySD (const char *pAudio, unsigned long AudioSize, unsigned char order);  // order 1 or 2
+void TDAC_PlayFRAMSD (unsigned long AudioSize, unsigned char order);
+
+#endif
@@ -0,0 +1,86 @@
+//******************************************************************************
+//  Tunes. See tune.h.
+//
+//  Timer0_A is stopped and cleared before each new period is loaded, so a
+//  shorter period can't find TAR already past it and count on to 0xFFFF.
+//  The ISR's ms to ACLK conversion is a 32-bit multiply and divide, a few
+//  hundred cycles once per note.
+//******************************************************************************
+#include <msp430.h>
+#include "tune.h"
+#include "vlo.h"
+
+#ifdef __MSP430_HAS_T1A3__                  // Timer1_A: not on the G2452
+
+static unsigned int Aclk;                   // Measured ACLK, Hz
+static const tune_note *Next;
+static unsigned char Left;                  // Notes after the one playing
+
+void TUNE_Init (unsigned long smclk_hz)
+{
+  // TA0.1 to P1.2, low until a note plays
+  P1OUT &= ~BIT2;
+  P1DIR |= BIT2;
+  P1SEL |= BIT2;
+  TA0CCTL1 = OUTMOD_0;                      // Output is OUT = 0
+
+  BCSCTL3 |= LFXT1S_2;                      // ACLK = VLO
+  Aclk = aclk_measure(smclk_hz);            // Leaves Timer0_A stopped
+}
+
+// Pitch and duration of note n
+static inline void TUNE_Note (const tune_note *n)
+{
+  TA0CTL = TASSEL_2 + TACLR;                // Stopped
+  if (n->period != TUNE_REST) {
+    TA0CCR0 = n->period - 1;                // Period
+    TA0CCR1 = n->period >> 1;               // Square wave
+    TA0CCTL1 = OUTMOD_7;                    // Set at CCR0, reset at CCR1
+    TA0CTL = TASSEL_2 + MC_1;               // SMCLK, up to CCR0
+  } else
+    TA0CCTL1 = OUTMOD_0;                    // Silent
+  TA1CCR0 = ACLK_PERIOD(Aclk, n->ms);
+}
+
+void TUNE_Play (const tune_note *notes, unsigned char n)
+{
+  TUNE_Stop();
+  if (!n)
+    return;
+  Next = notes + 1;
+  Left = n - 1;
+  TUNE_Note(notes);
+  TA1CTL = TASSEL_1 + MC_1 + TACLR;         // ACLK, up to CCR0
+  TA1CCTL0 = CCIE;                          // Note boundaries
+}
+
+unsigned char TUNE_Playing (void)
+{
+  return (TA1CCTL0 & CCIE) != 0;
+}
+
+void TUNE_Stop (void)
+{
+  TA1CTL = TACLR;                           // Stopped, MC_0
+  TA1CCTL0 = 0;
+  TA0CTL = TACLR;
+  TA0CCTL1 = OUTMOD_0;
+}
+
+#if defined(__TI_COMPILER_VERSION__)
+#pragma vector=TIMER1_A0_VECTOR
+__interrupt void TUNE_ISR(void)
+#else
+  void __attribute__ ((interrupt(TIMER1_A0_VECTOR))) TUNE_ISR (void)
+#endif
+{
+  if (Left) {
+    Left--;
+    TUNE_Note(Next++);
+  } else {
+    TUNE_Stop();
+    __bic_SR_register_on_exit(LPM0_bits);   // Tune done: wake main
+  }
+}
+
+#endif
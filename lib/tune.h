@@ -0,0 +1,36 @@
+//******************************************************************************
+//  Tunes: a table of notes played by the timers alone, TA0.1 (P1.2)
+//
+//  As "PWM at 440 Hz.c", the pitch is a square wave from Timer0_A in up mode:
+//  CCR0 the period, TA0.1 reset/set at half of it. Timer1_A, on ACLK = VLO,
+//  times the note, and its CCR0 interrupt is the only code that runs while a
+//  tune plays: once per note, to load the next period and duration. The CPU
+//  sleeps in LPM0 (SMCLK clocks the pitch) in between, and is woken from it
+//  when the last note ends.
+//
+//  A note is { period, ms }: period in SMCLK ticks (TUNE_PERIOD), 0 for a rest.
+//  ms is timed against the VLO, measured by TUNE_Init(), so it is good to the
+//  DCO's calibration rather than the VLO's 4 to 20kHz spread. A note is at most
+//  65536 ACLK periods, about 5s at 12kHz.
+//
+//  Needs Timer1_A (G2553). Set SMCLK to a calibrated DCO and call TUNE_Init()
+//  before anything else uses Timer0_A, then enable interrupts.
+//******************************************************************************
+#ifndef TUNE_H
+#define TUNE_H
+
+// TA0CCR0 period for a note of hz, SMCLK at smclk
+#define TUNE_PERIOD(smclk, hz)  ((unsigned int)(((smclk) + (hz) / 2) / (hz)))
+#define TUNE_REST               0
+
+typedef struct {
+  unsigned int period;                      // SMCLK ticks, or TUNE_REST
+  unsigned int ms;                          // Duration
+} tune_note;
+
+void TUNE_Init (unsigned long smclk_hz);    // VLO measured, P1.2 low
+void TUNE_Play (const tune_note *notes, unsigned char n);
+unsigned char TUNE_Playing (void);          // Notes still to play?
+void TUNE_Stop (void);                      // Timers stopped, P1.2 low
+
+#endif
@@ -0,0 +1,29 @@
+//******************************************************************************
+//  VLO calibration. See vlo.h.
+//
+//  Each ACLK period is the 16-bit difference of two captures, so SMCLK may be
+//  up to 65535 times ACLK (16MHz with ACLK down to 245Hz).
+//******************************************************************************
+#include <msp430.h>
+#include "vlo.h"
+
+unsigned int aclk_measure(unsigned long smclk_hz)
+{
+  unsigned long sum = 0;
+  unsigned int last = 0;
+  unsigned char i;
+
+  TACTL = TASSEL_2 + MC_2 + TACLR;          // SMCLK, continuous mode
+  TACCTL0 = CM_1 + CCIS_1 + CAP;            // Capture rising edge of ACLK (CCI0B)
+  for (i = 0; i <= ACLK_PERIODS; i++) {     // One more edge than periods
+    TACCTL0 &= ~CCIFG;
+    while (!(TACCTL0 & CCIFG)) {}           // Wait for ACLK edge
+    if (i)
+      sum += (TACCR0 - last) & 0xFFFF;     // Wraps correctly, 16-bit int or not
+    last = TACCR0;
+  }
+  TACCTL0 = 0;
+  TACTL = TACLR;                            // Stop, MC_0
+
+  return (smclk_hz * ACLK_PERIODS + sum / 2) / sum;
+}
@@ -0,0 +1,23 @@
+//******************************************************************************
+//  VLO calibration
+//
+//  The VLO is typically 12kHz, but only guaranteed 4 to 20kHz, and drifts
+//  with temperature and Vcc. aclk_measure() times ACLK against SMCLK, which
+//  must be a calibrated DCO (e.g. CALBC1_1MHZ / CALDCO_1MHZ), so periods for
+//  timers clocked from ACLK can be computed instead of assumed.
+//
+//  Select the VLO and set DIVA before measuring: the result is ACLK, after
+//  the divider. Timer_A is used (CCR0 capturing ACLK on CCI0B) and left
+//  stopped, so call it before setting the timer up.
+//******************************************************************************
+#ifndef VLO_H
+#define VLO_H
+
+#define ACLK_PERIODS    8                   // ACLK periods timed per measurement
+
+// TACCR0 for an up mode period of ms milliseconds, ACLK at hz
+#define ACLK_PERIOD(hz, ms)     ((unsigned int)(((unsigned long)(hz) * (ms) + 500) / 1000) - 1)
+
+unsigned int aclk_measure(unsigned long smclk_hz);  // ACLK in Hz
+
+#endif
@@ -1,5 +1,6 @@
 #include <msp430.h>
 #include <stdint.h>
+#include <stdarg.h>
 
 const unsigned RXD = BIT1;
 const unsigned TXD = BIT2;
@@ -8,9 +9,38 @@ const unsigned SW2 = BIT3;
 const unsigned long smclk_freq = 16000000;      // SMCLK frequency in hertz
 const unsigned long bps = 9600;                 // Async serial bit rate
 
+// TX ring buffer, drained by the USCI TX interrupt. GIE must be set.
+#define TX_SIZE     32                          // Power of 2, at most 256
+#define TX_BLOCK    0                           // Full: wait for room
+#define TX_DROP     1                           // Full: discard the char
+#define TX_COUNT    2                           // Full: discard and count in tx_lost
+#define TX_FULL     TX_BLOCK                    // Policy when the buffer is full
+
+static char tx_buf[TX_SIZE];
+static volatile unsigned char tx_head, tx_tail; // Put at head, send from tail
+unsigned tx_lost;                               // Chars discarded (TX_COUNT)
+
 
 // Output char to UART
-static inline void putc(const unsigned c) { while(UCA0STAT & UCBUSY); UCA0TXBUF = c; }
+void putc(const unsigned c)
+{
+    const unsigned char h = (tx_head + 1) & (TX_SIZE - 1);
+    if(h == tx_tail) {                          // Full?
+#if TX_FULL == TX_BLOCK
+        while(h == tx_tail);                    // ISR makes room
+#else
+#if TX_FULL == TX_COUNT
+        ++tx_lost;
+#endif
+        return;
+#endif
+    }
+    tx_buf[tx_head] = c; tx_head = h;
+    IE2 |= UCA0TXIE;                            // TXIFG is set while idle, so this starts it
+}
+
+// Wait until all output has left, eg before LPM3+ or reconfiguring clocks
+void tx_flush(void) { while(tx_head != tx_tail); while(UCA0STAT & UCBUSY); }
 
 // Output string to UART
 void puts(const char *s) { while(*s) putc(*s++); }
@@ -21,19 +51,43 @@ void crlf(void) { puts("\r\n"); }
 // Output binary array to UART
 void putb(const uint8_t *b, unsigned n) { do putc(*b++); while(--n); }
 
-// Print unsigned int
-void print_u(unsigned x)
+// Print x / 10**scale to dp (<= scale) decimals. Extra digits are cut, not rounded.
+// Binary to BCD is bcd = bcd * 2 + bit, MSB first, with DADD doing the * 2: one
+// pass per significant bit rather than up to 9 subtractions per digit. After
+// doubling the low digit is even, so the bit is simply OR-ed in. hi carries
+// digits 9 and 8 when lo (digits 7..0) was >= 50000000 before doubling.
+void print_fixed(uint32_t x, const unsigned scale, const unsigned dp)
 {
-    static const unsigned dd[] = { 10000, 1000, 100, 10, 1 };
-    const unsigned *dp = dd; unsigned d;
-    if(x) { while(x < *dp) ++dp;
-        do { d = *dp++; char c = '0'; while(x >= d) ++c, x -= d; putc(c); } while(!(d & 1));
-    } else putc('0');
+    uint32_t lo = 0; unsigned hi = 0, n = 32, p = 10, d; char lead = 1;
+    if(!(x >> 16)) x <<= 16, n = 16;            // 16-bit values: half the passes
+    while(n && !(x & 0x80000000)) x <<= 1, --n; // Skip leading zeros
+    while(n--) {
+        hi = __bcd_add_short(hi, hi) | (lo >= 0x50000000);
+        lo = __bcd_add_long(lo, lo) | (x >> 31); x <<= 1;
+    }
+    hi = (hi << 8) | (unsigned)(lo >> 24);      // hi: digits 9..6, lo: 5..0 at the top
+    lo <<= 8;
+    do {
+        d = hi >> 12; hi = (hi << 4) | (unsigned)(lo >> 28); lo <<= 4;
+        if(p == scale) putc('.');
+        if(d || p <= scale + 1) lead = 0;       // Units digit and on always print
+        if(!lead) putc('0' + d);
+    } while(--p > scale - dp);
 }
 
+// Print unsigned int
+void print_u(unsigned x) { print_fixed(x, 0, 0); }
+
+// Print unsigned long
+void print_ul(uint32_t x) { print_fixed(x, 0, 0); }
+
 // Print signed int
 void print_i(const int x) { if(x < 0) putc('-'); print_u((x < 0) ? -x : x); }
 
+// Print signed x / 10**scale
+void print_fixed_i(const int32_t x, const unsigned scale, const unsigned dp)
+{ if(x < 0) putc('-'); print_fixed((x < 0) ? -x : x, scale, dp); }
+
 // Print hex nibble
 static inline void puth(const unsigned x) { putc("0123456789ABCDEF"[x & 15]); }
 
@@ -43,6 +97,45 @@ void print_hb(const unsigned x) { puth(x >> 4); puth(x); }
 // Print hex word
 void print_hw(const unsigned x) { print_hb(x >> 8); print_hb(x); }
 
+// printf subset, into the TX buffer: %u %d %x %s %c %%. An l (%lu) takes a
+// 32-bit argument. %.N (N = 0..9) prints fixed point, the argument being the
+// value times 10**N: %.1d of -123 prints -12.3. %x is always 4 (%lx 8) digits.
+// Not named printf, which gcc would feel free to rewrite into puts() calls.
+void uprintf(const char *f, ...)
+{
+    va_list a; va_start(a, f);
+    char c; unsigned dp, l; int32_t x;
+    while((c = *f++)) {
+        if(c != '%') { putc(c); continue; }
+        dp = (*f == '.') ? (f += 2, f[-1] - '0') : 0;
+        l = (*f == 'l') ? (++f, 1) : 0;
+        switch(c = *f++) {
+        case 'd': x = l ? va_arg(a, int32_t) : va_arg(a, int); print_fixed_i(x, dp, dp); break;
+        case 'u': print_fixed(l ? va_arg(a, uint32_t) : va_arg(a, unsigned), dp, dp); break;
+        case 'x': if(l) { x = va_arg(a, uint32_t); print_hw(x >> 16); print_hw(x); }
+                  else print_hw(va_arg(a, unsigned)); break;
+        case 's': puts(va_arg(a, const char *)); break;
+        case 'c': putc(va_arg(a, int)); break;
+        default: putc(c);                       // %% and anything unknown
+        }
+    }
+    va_end(a);
+}
+
+// The same, with the format parsed at compile time: each item is the call it
+// stands for, so nothing is stored or parsed at run time. Items are evaluated
+// left to right (comma operator), and any other void call may be mixed in.
+//   PRINT(F_S("T = "), F_DF(t, 1), F_S(" C\r\n"));
+#define PRINT(...)  ((void)(__VA_ARGS__))
+#define F_S(s)      puts(s)                     // %s
+#define F_C(c)      putc(c)                     // %c
+#define F_U(x)      print_u(x)                  // %u
+#define F_D(x)      print_i(x)                  // %d
+#define F_X(x)      print_hw(x)                 // %x
+#define F_UL(x)     print_ul(x)                 // %lu
+#define F_UF(x, n)  print_fixed((x), (n), (n))  // %.Nu
+#define F_DF(x, n)  print_fixed_i((x), (n), (n)) // %.Nd
+
 void main(void)
 {
     WDTCTL = WDTPW + WDTHOLD;                   // No watchdog reset
@@ -62,6 +155,7 @@ void main(void)
     UCA0BR0 = (brd >> 4) & 0xFF;                // Low byte of whole divisor
     UCA0MCTL = ((brd << 4) & 0xF0) | UCOS16;    // Fractional divisor, oversampling mode
     UCA0CTL1 = UCSSEL_2;                        // Use SMCLK for bit rate generator, release reset
+    __enable_interrupt();                       // TX is interrupt driven
 
     while (1) {                                 //
         int n = 1;                              //
@@ -71,7 +165,21 @@ void main(void)
         for(n = -5; n <= 5;) print_i(n++), putc(' '); crlf();
         n = 0xDEAD; print_hw(n); putc(' ');     //
         n += 0xE042; print_hw(n); crlf();       //
+        print_ul(3735928559UL); putc(' ');      // 0xDEADBEEF
+        print_fixed(2735, 1, 1); crlf();        // 273.5
+        uprintf("%d %u %x %s %.1d %lu\r\n", -1, 2, 0xBEEF, "four", -55, 3735928559UL);
+        PRINT(F_D(-1), F_C(' '), F_U(2), F_C(' '), F_X(0xBEEF), F_S(" four "),
+              F_DF(-55, 1), F_C(' '), F_UL(3735928559UL), F_S("\r\n"));
         crlf();                                 //
     }                                           //
  }                                              //
  
+
+// Send the next buffered char. Disable when empty; putc re-enables.
+#pragma vector = USCIAB0TX_VECTOR
+__interrupt void USCI0TX_ISR(void)
+{
+    UCA0TXBUF = tx_buf[tx_tail];
+    tx_tail = (tx_tail + 1) & (TX_SIZE - 1);
+    if(tx_tail == tx_head) IE2 &= ~UCA0TXIE;
+}
@@ -0,0 +1,225 @@
+'''
+serial-logger.py - High-rate serial logger for the MSP430 sensor firmwares.
+
+Reads the serial port in large chunks on a background thread and appends the
+raw bytes, unaltered, to a binary log file. A fixed 64-byte header describes
+how the bytes are to be interpreted, so the log can be memory-mapped later
+(see load()) without any parsing at capture time.
+
+A live plot (optional, needs numpy and matplotlib) shows a decimated view of
+the stream: one min/max pair per block of samples, so hours of data at full
+UART rate still draw quickly.
+
+Record formats are Python struct strings, one value per record:
+  P319 Temp Sensor.c   ">H"   (ADC10MEM, high byte first)
+  CMeter.c             "<I"   with --sync 43 ('C' followed by 32-bit count),
+                              built with TEXT_OUTPUT 0 (it prints text by default)
+  Raw bytes            "B"    (default)
+
+Examples:
+  python3 serial-logger.py temp.log --fmt ">H"
+  python3 serial-logger.py cmeter.log --fmt "<I" --sync 43 --baud 9600 --plot   (TEXT_OUTPUT 0)
+  python3 serial-logger.py --dump temp.log
+
+needs: python3, pyserial; numpy and matplotlib for --plot and load()
+'''
+
+import argparse
+import queue
+import struct
+import sys
+import threading
+import time
+
+MAGIC = b'MSPLOG1\0'
+HEADER = struct.Struct('<8s16s8sIId16x')   # magic, fmt, sync, sync length, baud, start time
+assert HEADER.size == 64
+
+CHUNK = 4096                                # Bytes per read, at least. Timeout returns fewer.
+
+
+def write_header(f, fmt, sync, baud):
+    f.write(HEADER.pack(MAGIC, fmt.encode(), sync, len(sync), baud, time.time()))
+
+
+def read_header(f):
+    magic, fmt, sync, nsync, baud, start = HEADER.unpack(f.read(HEADER.size))
+    if magic != MAGIC:
+        raise ValueError("not a serial-logger file")
+    return fmt.rstrip(b'\0').decode(), sync[:nsync], baud, start
+
+
+def load(path):
+    '''Return the records of a log as a numpy array.
+
+    Unsynchronized logs are memory-mapped directly. Synchronized logs are
+    memory-mapped as bytes, and only the records found behind a sync prefix
+    are copied out.'''
+    import numpy as np
+    with open(path, 'rb') as f:
+        fmt, sync, baud, start = read_header(f)
+    dtype = np.dtype(struct_to_dtype(fmt))
+    raw = np.memmap(path, dtype=np.uint8, mode='r', offset=HEADER.size)
+    if not sync:
+        n = len(raw) // dtype.itemsize
+        return np.ndarray((n,), dtype, raw[:n * dtype.itemsize])
+    return np.frombuffer(Framer(fmt, sync).feed(bytes(raw)), dtype)
+
+
+def struct_to_dtype(fmt):
+    order = {'<': '<', '>': '>', '!': '>', '=': '=', '@': '='}.get(fmt[0], '=')
+    code = fmt.lstrip('<>!=@')
+    return order + {'B': 'u1', 'b': 'i1', 'H': 'u2', 'h': 'i2', 'I': 'u4', 'i': 'i4'}[code]
+
+
+class Framer:
+    '''Splits a byte stream into records, optionally behind a sync prefix.
+
+    Returns the payload bytes of complete records. A partial record is kept
+    for the next call, so chunk boundaries don't matter.'''
+
+    def __init__(self, fmt, sync=b''):
+        self.size = struct.calcsize(fmt)
+        self.sync = sync
+        self.pend = b''
+
+    def feed(self, data):
+        buf = self.pend + data
+        if not self.sync:
+            n = len(buf) - len(buf) % self.size
+            self.pend = buf[n:]
+            return buf[:n]
+        out = bytearray()
+        step = len(self.sync) + self.size
+        i = 0
+        while True:
+            i = buf.find(self.sync, i)
+            if i < 0:                       # Keep a possible partial sync
+                self.pend = buf[-(len(self.sync) - 1):] if len(self.sync) > 1 else b''
+                break
+            if i + step > len(buf):         # Record not yet complete
+                self.pend = buf[i:]
+                break
+            out += buf[i + len(self.sync):i + step]
+            i += step
+        return bytes(out)
+
+
+class Capture(threading.Thread):
+    '''Background reader. Writes every byte to the log and hands chunks to
+    the plotter, dropping them (never the log data) if the plotter lags.'''
+
+    def __init__(self, ser, log, tap=None):
+        super().__init__(daemon=True)
+        self.ser = ser
+        self.log = log
+        self.tap = tap
+        self.count = 0
+        self.running = True
+
+    def run(self):
+        while self.running:
+            data = self.ser.read(max(self.ser.in_waiting, CHUNK))   # Returns early on timeout
+            if not data:
+                continue
+            self.log.write(data)
+            self.count += len(data)
+            if self.tap is not None:
+                try:
+                    self.tap.put_nowait(data)
+                except queue.Full:
+                    pass
+        self.log.flush()
+
+
+def plot(tap, fmt, sync, decimate, window):
+    import numpy as np
+    import matplotlib.pyplot as plt
+
+    framer = Framer(fmt, sync)
+    dtype = np.dtype(struct_to_dtype(fmt))
+    pend = np.zeros(0, dtype)
+    hi = []
+    lo = []
+
+    plt.ion()
+    fig, ax = plt.subplots()
+    lhi, = ax.plot([], [], lw=0.8)
+    llo, = ax.plot([], [], lw=0.8)
+    ax.set_xlabel("samples / %d" % decimate)
+    while plt.fignum_exists(fig.number):
+        try:
+            while True:
+                pend = np.concatenate((pend, np.frombuffer(framer.feed(tap.get_nowait()), dtype)))
+        except queue.Empty:
+            pass
+        n = len(pend) - len(pend) % decimate
+        if n:                               # Min/max per block keeps the envelope
+            blocks = pend[:n].reshape(-1, decimate)
+            hi.extend(blocks.max(axis=1))
+            lo.extend(blocks.min(axis=1))
+            del hi[:-window], lo[:-window]
+            pend = pend[n:]
+            x = np.arange(len(hi))
+            lhi.set_data(x, hi)
+            llo.set_data(x, lo)
+            ax.relim()
+            ax.autoscale_view()
+        plt.pause(0.1)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Log an MSP430 serial stream to a binary file.")
+    ap.add_argument('log', help="output (or --dump input) file")
+    ap.add_argument('--port', default="/dev/ttyACM0")
+    ap.add_argument('--baud', type=int, default=9600)
+    ap.add_argument('--fmt', default="B", help="struct format of one record")
+    ap.add_argument('--sync', default="", help="hex bytes preceding each record")
+    ap.add_argument('--plot', action='store_true', help="live decimated plot")
+    ap.add_argument('--decimate', type=int, default=64, help="samples per plotted point")
+    ap.add_argument('--window', type=int, default=2000, help="plotted points kept")
+    ap.add_argument('--dump', action='store_true', help="print the records of an existing log")
+    args = ap.parse_args()
+
+    if args.dump:
+        with open(args.log, 'rb') as f:
+            fmt, sync, baud, start = read_header(f)
+        print("# fmt", fmt, "sync", sync.hex(), "baud", baud, "start", time.ctime(start))
+        for v in load(args.log):
+            print(v)
+        return
+
+    import serial # for serial port
+    try:
+        ser = serial.Serial(args.port, args.baud, timeout=0.100)
+    except serial.SerialException:
+        print("Opening serial port", args.port, "failed")
+        sys.exit(1)
+    ser.reset_input_buffer()
+
+    sync = bytes.fromhex(args.sync)
+    struct.calcsize(args.fmt)               # Fail early on a bad format
+    log = open(args.log, 'wb')
+    write_header(log, args.fmt, sync, args.baud)
+    tap = queue.Queue(maxsize=256) if args.plot else None
+    cap = Capture(ser, log, tap)
+    cap.start()
+
+    t0 = time.time()
+    try:
+        if args.plot:
+            plot(tap, args.fmt, sync, args.decimate, args.window)
+        else:
+            while True:
+                time.sleep(1)
+                print("\r%d bytes, %.0f B/s" % (cap.count, cap.count / (time.time() - t0)), end="")
+    except KeyboardInterrupt:
+        pass
+    cap.running = False
+    cap.join()
+    log.close()
+    print()
+
+
+if __name__ == '__main__':
+    main()
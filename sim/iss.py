@@ -0,0 +1,413 @@
+#!/usr/bin/env python3
+# MSP430 instruction set simulator, for exact cycle counts (see ../G2452Bench).
+#
+# Runs an msp430-elf-gcc ELF for the G2xx (MSP430 CPU, not CPUX) from reset.
+# Cycles are those of the family user's guide (slau144, Format I and II
+# tables, 6 to take an interrupt, 5 for RETI, 2 per jump), with MCLK = SMCLK.
+#
+# Peripherals are only what the hot routines wait on:
+#   Timer0_A3  up/continuous/up-down, compare CCIFG and TAIFG, TAIV, ID and
+#              DIVS dividers; interrupts TIMER0_A0 and TIMER0_A1. No capture,
+#              but setting CCIFG from software interrupts as on the part.
+#   USI        USICNT starts a transfer, USIIFG sets (bits << USIDIV) later.
+# Everything else below 0x200 is plain memory. Info memory holds calibration
+# values, so the usual "CALBC1_16MHZ == 0xFF" checks pass.
+#
+# Usage: iss.py file.out [cycles]   prints where it stopped and ISR counts.
+import struct
+import sys
+
+C, Z, N, GIE, CPUOFF, SCG0, V = 0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0040, 0x0100
+
+# Cycles by source class, for a destination register, PC, or memory
+F1 = {'R': (1, 2, 4), '@': (2, 2, 5), '@+': (2, 3, 5), '#': (2, 3, 5), 'X': (3, 3, 6)}
+# Cycles by operand class, for RRC/RRA/SWPB/SXT, PUSH, CALL
+F2 = {'R': (1, 3, 4), '@': (3, 4, 4), '@+': (3, 4, 5), '#': (None, 4, 5), 'X': (4, 5, 5)}
+
+VECTORS = {0xFFF2: 'TIMER0_A0', 0xFFF0: 'TIMER0_A1', 0xFFE8: 'USI'}
+
+TA0CTL, TA0R, TA0IV = 0x160, 0x170, 0x12E
+TA0CCTL = (0x162, 0x164, 0x166)
+TA0CCR = (0x172, 0x174, 0x176)
+USICTL0, USICTL1, USICKCTL, USICNT = 0x78, 0x79, 0x7A, 0x7B
+BCSCTL2 = 0x58
+CAL = (0x10F8, bytes((0x95, 0x8F, 0x9E, 0x8E, 0x92, 0x8D, 0x56, 0x86)))
+
+
+class Halt(Exception):
+    pass
+
+
+class MSP430:
+    def __init__(self):
+        self.mem = bytearray(b'\xff' * 0x10000)     # Erased flash
+        self.mem[0:0x400] = bytes(0x400)            # Peripherals and RAM
+        self.mem[CAL[0]:CAL[0] + len(CAL[1])] = CAL[1]
+        self.mem[USICTL0] = 0x01                    # PUC: USISWRST
+        self.mem[USICTL1] = 0x01                    #      USIIFG
+        self.r = [0] * 16
+        self.cycles = 0
+        self.symbols = {}
+        self.watch = {}                             # addr -> fn(value, start, end)
+        self.events = []
+        self.isr_stack = []                         # (vector, start cycles, SP)
+        self.isr = {}                               # vector -> [count, min, max, total]
+        self.isr_cycles = 0                         # Total in ISRs
+        self.ta_div = 0
+        self.ta_down = False
+        self.usi_left = 0
+
+    # ---- Loading
+    def load(self, path):
+        f = open(path, 'rb').read()
+        if f[:4] != b'\x7fELF' or f[4] != 1 or f[5] != 1:
+            raise ValueError(path + ': not a 32-bit little-endian ELF')
+        entry, phoff, shoff = struct.unpack_from('<III', f, 24)
+        phentsize, phnum, shentsize, shnum = struct.unpack_from('<HHHH', f, 42)
+        for i in range(phnum):
+            p_type, p_off, _, p_paddr, p_filesz = struct.unpack_from('<IIIII', f, phoff + i * phentsize)
+            if p_type == 1 and p_filesz:
+                self.mem[p_paddr:p_paddr + p_filesz] = f[p_off:p_off + p_filesz]
+        secs = [struct.unpack_from('<IIIIIIIIII', f, shoff + i * shentsize) for i in range(shnum)]
+        for s in secs:
+            if s[1] == 2:                           # SHT_SYMTAB
+                strtab = secs[s[6]]
+                for o in range(s[4], s[4] + s[5], 16):
+                    name, value = struct.unpack_from('<II', f, o)
+                    end = f.index(b'\0', strtab[4] + name)
+                    if name:
+                        self.symbols[f[strtab[4] + name:end].decode()] = value
+        self.reset()
+
+    def reset(self):
+        self.r = [0] * 16
+        self.r[0] = self.peek16(0xFFFE)
+
+    # ---- Memory, with the peripheral side effects
+    def peek16(self, a):
+        a &= 0xFFFE
+        return self.mem[a] | self.mem[a + 1] << 8
+
+    def poke16(self, a, v):
+        a &= 0xFFFE
+        self.mem[a] = v & 0xFF
+        self.mem[a + 1] = v >> 8 & 0xFF
+
+    def read(self, a, bw):
+        a &= 0xFFFF
+        if a == TA0IV:
+            self.poke16(TA0IV, self.ta_iv())
+        if bw:
+            return self.mem[a]
+        return self.peek16(a)
+
+    def write(self, a, v, bw):
+        a &= 0xFFFF
+        if bw:
+            self.mem[a] = v & 0xFF
+        else:
+            a &= 0xFFFE
+            self.poke16(a, v)
+        if a in self.watch:
+            self.events.append((a, v))
+        if a == TA0CTL and self.mem[TA0CTL] & 0x04:    # TACLR
+            self.mem[TA0CTL] &= ~0x04
+            self.poke16(TA0R, 0)
+            self.ta_div = 0
+            self.ta_down = False
+        if a == USICNT and v & 0x1F and not self.mem[USICTL0] & 0x01:
+            self.mem[USICTL1] &= ~0x01                  # USIIFG
+            self.usi_left = (v & 0x1F) << (self.mem[USICKCTL] >> 5)
+
+    # ---- Peripherals
+    def ta_iv(self):
+        for i, iv in ((1, 2), (2, 4)):
+            c = self.peek16(TA0CCTL[i])
+            if (c & 0x11) == 0x11:                     # CCIE and CCIFG
+                self.poke16(TA0CCTL[i], c & ~1)
+                return iv
+        ctl = self.peek16(TA0CTL)
+        if (ctl & 3) == 3:                              # TAIE and TAIFG
+            self.poke16(TA0CTL, ctl & ~1)
+            return 10
+        return 0
+
+    def ta_tick(self):
+        ctl = self.peek16(TA0CTL)
+        mc = ctl >> 4 & 3
+        if not mc:
+            return
+        self.ta_div += 1
+        if self.ta_div < 1 << (ctl >> 6 & 3):
+            return
+        self.ta_div = 0
+        r, ccr0 = self.peek16(TA0R), self.peek16(TA0CCR[0])
+        if mc == 1:
+            if r >= ccr0:
+                r, ctl = 0, ctl | 1
+            else:
+                r += 1
+        elif mc == 2:
+            r = (r + 1) & 0xFFFF
+            if not r:
+                ctl |= 1
+        elif not self.ta_down:
+            if r >= ccr0:
+                self.ta_down, r = True, r - 1
+            else:
+                r += 1
+        else:
+            r -= 1
+            if not r:
+                self.ta_down, ctl = False, ctl | 1
+        self.poke16(TA0CTL, ctl)
+        self.poke16(TA0R, r)
+        for i in range(3):
+            c = self.peek16(TA0CCTL[i])
+            if not c & 0x100 and r == self.peek16(TA0CCR[i]):
+                self.poke16(TA0CCTL[i], c | 1)
+
+    def tick(self, n):
+        ta = self.peek16(TA0CTL)
+        clocked = ta & 0x30 and (ta & 0x300) == 0x200   # Running, on SMCLK
+        div = 1 << (self.mem[BCSCTL2] >> 1 & 3)
+        for _ in range(n):
+            self.cycles += 1
+            if self.cycles % div:
+                continue
+            if clocked:
+                self.ta_tick()
+            if self.usi_left:
+                self.usi_left -= 1
+                if not self.usi_left:
+                    self.mem[USICNT] &= ~0x1F
+                    self.mem[USICTL1] |= 0x01
+
+    def pending(self):
+        if (self.peek16(TA0CCTL[0]) & 0x11) == 0x11:
+            return 0xFFF2
+        if any((self.peek16(TA0CCTL[i]) & 0x11) == 0x11 for i in (1, 2)) \
+                or (self.peek16(TA0CTL) & 3) == 3:
+            return 0xFFF0
+        if (self.mem[USICTL1] & 0x11) == 0x11:          # USIIE and USIIFG
+            return 0xFFE8
+        return None
+
+    def can_wake(self):
+        ta = self.peek16(TA0CTL)
+        if self.usi_left:
+            return True
+        if ta & 0x30 and (ta & 0x300) == 0x200:
+            return any(self.peek16(c) & 0x10 for c in TA0CCTL) or ta & 2
+        return False
+
+    def interrupt(self):
+        v = self.pending()
+        if v is None:
+            return False
+        if v == 0xFFF2:
+            self.poke16(TA0CCTL[0], self.peek16(TA0CCTL[0]) & ~1)
+        start = self.cycles
+        self.push(self.r[0])
+        self.push(self.r[2])
+        self.r[2] &= SCG0
+        self.r[0] = self.peek16(v)
+        self.isr_stack.append((v, start, self.r[1]))
+        self.tick(6)
+        return True
+
+    # ---- CPU
+    def push(self, v, bw=0):
+        self.r[1] = (self.r[1] - 2) & 0xFFFF
+        self.write(self.r[1], v, bw)
+
+    def pop(self):
+        v = self.peek16(self.r[1])
+        self.r[1] = (self.r[1] + 2) & 0xFFFF
+        return v
+
+    def fetch(self):
+        v = self.peek16(self.r[0])
+        self.r[0] = (self.r[0] + 2) & 0xFFFF
+        return v
+
+    def src(self, reg, As, bw):
+        """(class, address or None, value) of a source operand."""
+        if reg == 3:
+            return 'R', None, (0, 1, 2, 0xFFFF)[As] & (0xFF if bw else 0xFFFF)
+        if reg == 2 and As >= 2:
+            return 'R', None, (4, 8)[As - 2]
+        if As == 0:
+            v = self.r[reg]
+            return 'R', None, v & 0xFF if bw else v
+        if As == 1:
+            base = self.r[0]
+            x = self.fetch()
+            a = (x if reg == 2 else base + x if reg == 0 else self.r[reg] + x) & 0xFFFF
+            return 'X', a, self.read(a, bw)
+        a = self.r[reg]
+        if As == 3:
+            self.r[reg] = (a + (1 if bw and reg > 1 else 2)) & 0xFFFF
+            return ('#' if reg == 0 else '@+'), a, self.read(a, bw)
+        return '@', a, self.read(a, bw)
+
+    def dst(self, reg, Ad):
+        """Address of a destination operand, None for a register."""
+        if not Ad:
+            return None
+        base = self.r[0]
+        x = self.fetch()
+        return (x if reg == 2 else base + x if reg == 0 else self.r[reg] + x) & 0xFFFF
+
+    def setflags(self, r, msb, c, v):
+        sr = self.r[2] & ~(C | Z | N | V)
+        sr |= (C if c else 0) | (Z if not r else 0) | (N if r & msb else 0) | (V if v else 0)
+        self.r[2] = sr
+
+    def store(self, reg, a, v, bw):
+        if a is None:
+            if reg != 3:
+                self.r[reg] = v & (0xFF if bw else 0xFFFF)
+        else:
+            self.write(a, v, bw)
+
+    def step(self):
+        start = self.cycles
+        pc = self.r[0]
+        w = self.fetch()
+        op = w >> 12
+        if op == 0:
+            raise Halt('CPUX or invalid instruction %04x at %04x' % (w, pc))
+        if op == 1:
+            n = self.format2(w, pc)
+        elif op < 4:
+            n = 2
+            sr = self.r[2]
+            ge = bool(sr & N) == bool(sr & V)
+            if (not sr & Z, sr & Z, not sr & C, sr & C, sr & N, ge, not ge, True)[w >> 10 & 7]:
+                off = w & 0x3FF
+                if off & 0x200:
+                    off -= 0x400
+                self.r[0] = (self.r[0] + 2 * off) & 0xFFFF
+        else:
+            n = self.format1(w)
+        self.tick(n)
+        for a, v in self.events:
+            self.watch[a](v, start, self.cycles)
+        self.events = []
+
+    def format1(self, w):
+        op, sreg, Ad, bw, As, dreg = w >> 12, w >> 8 & 15, w >> 7 & 1, w >> 6 & 1, w >> 4 & 3, w & 15
+        mask, msb = (0xFF, 0x80) if bw else (0xFFFF, 0x8000)
+        cls, _, s = self.src(sreg, As, bw)
+        a = self.dst(dreg, Ad)
+        n = F1[cls][2 if Ad else 1 if dreg == 0 else 0]
+        if op == 4:                                     # MOV
+            self.store(dreg, a, s, bw)
+            return n
+        d = self.read(a, bw) if Ad else self.r[dreg] & mask
+        c = self.r[2] & C
+        if op in (5, 6, 7, 8, 9):                       # ADD ADDC SUBC SUB CMP
+            if op >= 7:
+                s = ~s & mask
+            carry = (0, c, c, 1, 1)[op - 5]
+            r = d + s + carry
+            self.setflags(r & mask, msb, r > mask, (d ^ r) & (s ^ r) & msb)
+            r &= mask
+            if op == 9:
+                return n
+        elif op == 10:                                  # DADD
+            r, cy = 0, c
+            for i in range(0, 8 if bw else 16, 4):
+                dd = (s >> i & 15) + (d >> i & 15) + cy
+                cy = dd > 9
+                r |= (dd - 10 if cy else dd) << i
+            self.setflags(r, msb, cy, 0)
+        elif op == 11:                                  # BIT
+            r = s & d
+            self.setflags(r, msb, r, 0)
+            return n
+        elif op == 12:                                  # BIC
+            r = d & ~s & mask
+        elif op == 13:                                  # BIS
+            r = d | s
+        elif op == 14:                                  # XOR
+            r = d ^ s
+            self.setflags(r, msb, r, s & d & msb)
+        else:                                           # AND
+            r = d & s
+            self.setflags(r, msb, r, 0)
+        self.store(dreg, a, r, bw)
+        return n
+
+    def format2(self, w, pc):
+        op, bw, As, reg = w >> 7 & 7, w >> 6 & 1, w >> 4 & 3, w & 15
+        mask, msb = (0xFF, 0x80) if bw else (0xFFFF, 0x8000)
+        if op == 6:                                     # RETI
+            self.r[2] = self.pop()
+            self.r[0] = self.pop()
+            if self.isr_stack and self.r[1] >= self.isr_stack[-1][2] + 4:
+                v, start, _ = self.isr_stack.pop()
+                n = self.cycles + 5 - start
+                s = self.isr.setdefault(v, [0, n, n, 0])
+                s[0] += 1
+                s[1], s[2], s[3] = min(s[1], n), max(s[2], n), s[3] + n
+                if not self.isr_stack:
+                    self.isr_cycles += n
+            return 5
+        if op == 7:
+            raise Halt('invalid instruction %04x at %04x' % (w, pc))
+        cls, a, s = self.src(reg, As, bw)
+        n = F2[cls][0 if op < 4 else op - 3]
+        if op == 4:                                     # PUSH
+            self.push(s, bw)
+        elif op == 5:                                   # CALL
+            self.push(self.r[0])
+            self.r[0] = s
+        else:
+            c = self.r[2] & C
+            if op == 0:                                 # RRC
+                r = s >> 1 | (msb if c else 0)
+                self.setflags(r, msb, s & 1, 0)
+            elif op == 1:                               # SWPB
+                r = (s >> 8 | s << 8) & 0xFFFF
+            elif op == 2:                               # RRA
+                r = s >> 1 | s & msb
+                self.setflags(r, msb, s & 1, 0)
+            else:                                       # SXT
+                r = (s & 0xFF) | (0xFF00 if s & 0x80 else 0)
+                self.setflags(r, 0x8000, r, 0)
+            if a is None:
+                self.store(reg, None, r, bw)
+            else:
+                self.write(a, r, bw)
+        return n
+
+    def run(self, limit):
+        """Run until limit cycles, or until the CPU is off for good."""
+        while self.cycles < limit:
+            if self.r[2] & GIE and self.interrupt():
+                continue
+            if self.r[2] & CPUOFF:
+                if not self.r[2] & GIE or not self.can_wake():
+                    raise Halt('CPU off with nothing to wake it')
+                self.tick(1)
+                continue
+            self.step()
+
+
+def main():
+    m = MSP430()
+    m.load(sys.argv[1])
+    try:
+        m.run(int(sys.argv[2]) if len(sys.argv) > 2 else 1000000)
+        print('stopped at %d cycles' % m.cycles)
+    except Halt as e:
+        print('%s, at %d cycles, PC %04x' % (e, m.cycles, m.r[0]))
+    for v, (count, lo, hi, total) in sorted(m.isr.items()):
+        print('%-10s %6d calls  cycles min %d max %d mean %.1f'
+              % (VECTORS.get(v, '%04x' % v), count, lo, hi, total / count))
+
+
+if __name__ == '__main__':
+    main()
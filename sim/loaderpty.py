@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+# G2452FRAMloader and its FM25V40 on a pseudo-terminal, for host.py without
+# a LaunchPad.
+#
+# Speaks the loader's command frames (../lib/cmdframe.h, ops 0x02 Stop,
+# 0x04 Read, 0x06 Wrte, 0x08 Stak) to an F-RAM modelled as sim/sim.c's:
+# WREN/WRDI, RDSR/WRSR with block protection, READ/FSTRD/WRITE with 2 or
+# 3 address bytes by density, RDID, SNR and SLEEP.
+#
+# Time is the target's, paced to the wall clock: each byte takes 10 bit times
+# on the line each way, an SPI byte takes 8 SCK periods, and a reply goes out
+# a byte at a time after its frame's commands have run. Like the software
+# UART, there is one byte of receive buffer: a byte that arrives while
+# another is still waiting for the main loop (e.g. sent while a reply is going
+# out) locks it up, RED LED on, and nothing more is answered until a restart.
+#
+# Usage: loaderpty.py [--baud 9600] [--kb 512] [--spi-hz 125000] [--image f]
+#   prints the pty to open, e.g. "python3 -i host.py /dev/pts/5".
+# --image loads the F-RAM from a file, and writes it back on exit.
+import argparse
+import os
+import select
+import signal
+import sys
+import time
+import tty
+
+SOF, FRAME_MAX, REPLY_MAX = 0x7E, 64, 64
+STATUS_OK, STATUS_SUM, STATUS_OP, STATUS_LEN, STATUS_FULL = 0, 1, 2, 3, 4
+STACK_HW = 0                                # Stak reply: 0, as stack.c's host build
+
+RX_COST = 4e-6                              # Main loop per received byte, s
+CMD_COST = 2e-6                             # Per command run
+
+
+class FM25V40:
+    '''The F-RAM, one SPI byte at a time. Status bit 6 reads 1, WEL is bit 1.'''
+
+    def __init__(self, kb=512):
+        d = 1
+        while d < 6 and (16 << (d - 1)) < kb:
+            d += 1
+        self.size = 0x2000 << d             # Density code d: 8K bytes << d
+        self.id = bytes((0x7F,) * 6 + (0xC2, 0x20 | d, 0x40))
+        self.mem = bytearray(self.size)
+        self.sr = 0x40
+        self.sleep = False
+        self.cs = False
+        self.st = None
+        self.dirty = False
+
+    def protected(self, a):
+        bp = (self.sr >> 2) & 3
+        return (bp == 1 and a >= self.size // 4 * 3 or
+                bp == 2 and a >= self.size // 2 or bp == 3)
+
+    def select(self):
+        if self.cs:
+            return
+        self.cs = True
+        self.wel_used = False
+        self.st = 'op'
+        if self.sleep:                      # CS_ low wakes it: this access is lost
+            self.sleep = False
+            self.st = None
+
+    def deselect(self):
+        if self.cs and self.wel_used:
+            self.sr &= ~0x02                # WRITE and WRSR clear WEL when done
+        self.cs = False
+        self.st = None
+
+    def xfer(self, mosi):
+        self.select()
+        miso = 0xFF
+        st = self.st
+        if st == 'op':
+            self.op, self.n, self.addr = mosi, 0, 0
+            self.st = {0x05: 'rdsr', 0x01: 'wrsr', 0x03: 'addr', 0x0B: 'addr',
+                       0x02: 'addr', 0x9F: 'rdid', 0xC3: 'snr'}.get(mosi)
+            if mosi == 0x06:                # WREN
+                self.sr |= 0x02
+            elif mosi == 0x04:              # WRDI
+                self.sr &= ~0x02
+            elif mosi == 0xB9:              # SLEEP, from CS_ high
+                self.sleep = True
+        elif st == 'addr':
+            self.addr = (self.addr << 8) | mosi
+            self.n += 1
+            if self.n == (3 if self.size > 0x10000 else 2):
+                self.addr &= self.size - 1
+                self.st = {0x02: 'write', 0x0B: 'dummy'}.get(self.op, 'read')
+        elif st == 'dummy':
+            self.st = 'read'
+        elif st == 'read':
+            miso = self.mem[self.addr]
+            self.addr = (self.addr + 1) & (self.size - 1)
+        elif st == 'write':
+            if self.sr & 0x02 and not self.protected(self.addr):
+                self.mem[self.addr] = mosi
+                self.dirty = self.wel_used = True
+            self.addr = (self.addr + 1) & (self.size - 1)
+        elif st == 'rdsr':
+            miso = self.sr
+        elif st == 'wrsr':
+            if self.sr & 0x02:
+                self.sr = (self.sr & 0x43) | (mosi & 0x8C)
+                self.wel_used = True
+            self.st = None
+        elif st == 'rdid':
+            miso = self.id[self.n] if self.n < 9 else 0xFF
+            self.n += 1
+        elif st == 'snr':
+            miso = 0x00
+        return miso
+
+
+class Loader:
+    '''main.c's frame handling and timing. feed() takes each byte as it
+    arrives, in target seconds; due replies are collected by out().'''
+
+    def __init__(self, fram, baud, spi_hz):
+        self.fram = fram
+        self.bt = 10.0 / baud               # Start, 8 data, stop
+        self.spi = 8.0 / spi_hz
+        self.state = 'hunt'
+        self.free = 0.0                     # Main loop back in LPM0
+        self.taken = 0.0                    # RXData last unloaded
+        self.pending = []                   # (time on the line, byte)
+        self.locked = None
+        self.frames = 0
+
+    def feed(self, t, c):
+        if self.locked is not None:
+            return
+        if t < self.taken:                  # Last byte not yet unloaded: overrun
+            self.locked = t
+            self.pending = [p for p in self.pending if p[0] <= t]
+            print("loaderpty: overrun at %.3fs, locked up (RED LED)" % t, file=sys.stderr)
+            return
+        t = max(t, self.free)
+        self.taken = t
+        self.free = t + RX_COST
+        if self.rx(c):
+            self.run()
+
+    def rx(self, c):                        # frame_rx(): True when a frame is good
+        if self.state == 'hunt':
+            if c == SOF:
+                self.state = 'len'
+            return False                    # Bytes outside a frame are ignored
+        if self.state == 'len':
+            self.flen, self.fsum, self.body = c, c, b''
+            if c > FRAME_MAX:               # Too long: skip LEN bytes and CHK, no reply
+                self.skip = c + 1
+                self.state = 'skip'
+            else:
+                self.state = 'body' if c else 'chk'
+            return False
+        if self.state == 'skip':
+            self.skip -= 1
+            if not self.skip:
+                self.state = 'hunt'
+            return False
+        if self.state == 'body':
+            self.body += bytes((c,))
+            self.fsum += c
+            if len(self.body) == self.flen:
+                self.state = 'chk'
+            return False
+        self.state = 'hunt'
+        if (self.fsum + c) & 0xFF == 0:
+            return True
+        self.send(STATUS_SUM, b'')
+        return False
+
+    def run(self):                          # frame_run()
+        b, i, status, reply = self.body, 0, STATUS_OK, bytearray()
+        self.frames += 1
+        while i < len(b):
+            op = b[i]
+            n = b[i + 1] if i + 1 < len(b) else 0xFF
+            if n > len(b) - i - 2:
+                status = STATUS_LEN
+                break
+            arg = b[i + 2:i + 2 + n]
+            self.free += CMD_COST
+            if op == 0x02:                  # Stop
+                self.fram.deselect()
+            elif op == 0x04:                # Read
+                for _ in range(arg[0] if n else 1):
+                    reply.append(self.fram.xfer(0xFF))
+                    self.free += self.spi
+            elif op == 0x06:                # Wrte
+                for c in arg:
+                    self.fram.xfer(c)
+                    self.free += self.spi
+            elif op == 0x08:                # Stak
+                reply += bytes((STACK_HW & 0xFF, STACK_HW >> 8))
+            else:
+                status = STATUS_OP
+                break
+            i += n + 2
+        if len(reply) > REPLY_MAX:
+            reply, status = reply[:REPLY_MAX], STATUS_FULL
+        self.send(status, bytes(reply))
+
+    def send(self, status, data):           # frame_send(): each frame_tx waits for the last
+        body = bytes((len(data) + 1, status)) + data
+        out = bytes((SOF,)) + body + bytes(((-sum(body)) & 0xFF,))
+        for k, c in enumerate(out):
+            self.pending.append((self.free + (k + 1) * self.bt, c))
+        self.free += (len(out) - 1) * self.bt
+
+    def out(self, t):
+        due = bytes(c for w, c in self.pending if w <= t)
+        self.pending = [p for p in self.pending if p[0] > t]
+        return due
+
+    def next(self):
+        return min((w for w, c in self.pending), default=None)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="G2452FRAMloader and FM25V40 on a pty.")
+    ap.add_argument('--baud', type=int, default=9600)
+    ap.add_argument('--kb', type=int, default=512, help="F-RAM density, 16 to 512")
+    ap.add_argument('--spi-hz', type=float, default=125000, help="SCK, SMCLK / 128 as main.c")
+    ap.add_argument('--image', help="F-RAM image file, loaded and saved on exit")
+    args = ap.parse_args()
+
+    fram = FM25V40(args.kb)
+    if args.image and os.path.exists(args.image):
+        with open(args.image, 'rb') as f:
+            data = f.read(fram.size)
+        fram.mem[:len(data)] = data
+    loader = Loader(fram, args.baud, args.spi_hz)
+
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    print(os.ttyname(slave), flush=True)
+
+    def done(*_):
+        if args.image and fram.dirty:
+            with open(args.image, 'wb') as f:
+                f.write(fram.mem)
+        print("loaderpty: %d frames" % loader.frames, file=sys.stderr)
+        sys.exit(0)
+    signal.signal(signal.SIGTERM, done)
+    signal.signal(signal.SIGINT, done)
+
+    t0 = time.monotonic()
+    line = 0.0                              # Host to target line busy until
+    while True:
+        now = time.monotonic() - t0
+        out = loader.out(now)
+        if out:
+            os.write(master, out)
+        nxt = loader.next()
+        r, _, _ = select.select([master], [], [], None if nxt is None else max(0, nxt - now))
+        if r:
+            try:
+                data = os.read(master, 4096)
+            except OSError:                 # No host has it open
+                time.sleep(0.05)
+                continue
+            now = time.monotonic() - t0
+            for c in data:
+                line = max(line, now) + loader.bt
+                loader.feed(line, c)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,342 @@
+//******************************************************************************
+//  Host simulation: msp430.h stand-in
+//
+//  Built by "make sim" (see common.mk) in place of the toolchain's msp430.h,
+//  so a folder's main.c and lib/ compile with the host gcc and run against the
+//  peripheral models in sim.c.
+//
+//  Every register access goes through sim_io(), which first advances
+//  simulated time, runs the models and takes any pending interrupt. So the
+//  drivers' polling loops (USIIFG, CCIFG, UCA0TXIFG...) make progress, and an
+//  ISR runs between two register accesses, as it would between instructions.
+//  Each access is charged SIM_IO_CYCLES of MCLK; code that touches no register
+//  is free. Cycle counts are therefore a coarse model, good for comparisons.
+//
+//  Bit names and addresses are the G2xx family's. Interrupt vectors are sim
+//  numbers: interrupt(v) places the ISR in section sim_isr_<v>, which sim.c
+//  finds by its __start_ symbol.
+//
+//  int is 32 bits on the host: code relying on 16-bit wraparound must mask.
+//******************************************************************************
+#ifndef SIM_MSP430_H
+#define SIM_MSP430_H
+
+#include <stdint.h>
+
+#if defined(__MSP430G2452__)
+#define __MSP430_HAS_USI__
+#elif defined(__MSP430G2553__)
+#define __MSP430_HAS_USCI__
+#define __MSP430_HAS_T1A3__
+#endif
+
+// Register access
+void *sim_io (unsigned addr);               // Advance time, then &register
+#define SIM_R8(a)       (*(volatile uint8_t *)sim_io(a))
+#define SIM_R16(a)      (*(volatile uint16_t *)sim_io(a))
+
+// Intrinsics
+void sim_bis_sr (unsigned bits);
+void sim_bic_sr (unsigned bits);
+void sim_bic_sr_on_exit (unsigned bits);
+void sim_delay (unsigned long cycles);
+unsigned sim_bcd_add (unsigned long a, unsigned long b, int digits);
+
+#define __bis_SR_register(x)            sim_bis_sr(x)
+#define __bic_SR_register(x)            sim_bic_sr(x)
+#define __bic_SR_register_on_exit(x)    sim_bic_sr_on_exit(x)
+#define _BIS_SR(x)                      sim_bis_sr(x)
+#define _BIC_SR(x)                      sim_bic_sr(x)
+#define _BIC_SR_IRQ(x)                  sim_bic_sr_on_exit(x)
+#define __enable_interrupt()            sim_bis_sr(GIE)
+#define __disable_interrupt()           sim_bic_sr(GIE)
+#define __low_power_mode_0()            sim_bis_sr(LPM0_bits + GIE)
+#define __low_power_mode_3()            sim_bis_sr(LPM3_bits + GIE)
+#define __low_power_mode_off_on_exit()  sim_bic_sr_on_exit(LPM4_bits)
+#define __delay_cycles(x)               sim_delay(x)
+#define __no_operation()                sim_delay(1)
+#define __even_in_range(x, y)           (x)
+#define __get_SP_register()             0
+#define __bcd_add_short(a, b)           ((uint16_t)sim_bcd_add(a, b, 4))
+#define __bcd_add_long(a, b)            ((uint32_t)sim_bcd_add(a, b, 8))
+
+#define SIM_STR2(v)     #v
+#define SIM_STR(v)      SIM_STR2(v)
+#define __interrupt
+#define interrupt(v)    used, section("sim_isr_" SIM_STR(v))
+
+// Status register
+#define GIE             0x0008
+#define CPUOFF          0x0010
+#define OSCOFF          0x0020
+#define SCG0            0x0040
+#define SCG1            0x0080
+#define LPM0_bits       (CPUOFF)
+#define LPM1_bits       (SCG0 + CPUOFF)
+#define LPM2_bits       (SCG1 + CPUOFF)
+#define LPM3_bits       (SCG1 + SCG0 + CPUOFF)
+#define LPM4_bits       (SCG1 + SCG0 + OSCOFF + CPUOFF)
+#define LPM0            sim_bis_sr(LPM0_bits)
+#define LPM3            sim_bis_sr(LPM3_bits)
+
+// Vectors (sim numbering)
+#define PORT1_VECTOR            2
+#define PORT2_VECTOR            3
+#define USI_VECTOR              4
+#define ADC10_VECTOR            5
+#define USCIAB0TX_VECTOR        6
+#define USCIAB0RX_VECTOR        7
+#define TIMER0_A1_VECTOR        8
+#define TIMER0_A0_VECTOR        9
+#define WDT_VECTOR              10
+#define COMPARATORA_VECTOR      11
+#define TIMER1_A1_VECTOR        12
+#define TIMER1_A0_VECTOR        13
+#define NMI_VECTOR              14
+
+#define BIT0            0x0001
+#define BIT1            0x0002
+#define BIT2            0x0004
+#define BIT3            0x0008
+#define BIT4            0x0010
+#define BIT5            0x0020
+#define BIT6            0x0040
+#define BIT7            0x0080
+#define BIT8            0x0100
+#define BIT9            0x0200
+#define BITA            0x0400
+#define BITB            0x0800
+#define BITC            0x1000
+#define BITD            0x2000
+#define BITE            0x4000
+#define BITF            0x8000
+
+// Special function
+#define IE1             SIM_R8(0x0000)
+#define IFG1            SIM_R8(0x0002)
+#define IE2             SIM_R8(0x0001)
+#define IFG2            SIM_R8(0x0003)
+#define WDTIE           0x01
+#define WDTIFG          0x01
+#define UCA0RXIE        0x01
+#define UCA0TXIE        0x02
+#define UCA0RXIFG       0x01
+#define UCA0TXIFG       0x02
+#define UCB0RXIFG       0x04
+#define UCB0TXIFG       0x08
+
+// Watchdog (not modelled)
+#define WDTCTL          SIM_R16(0x0120)
+#define WDTPW           0x5A00
+#define WDTHOLD         0x0080
+#define WDTTMSEL        0x0010
+#define WDTCNTCL        0x0008
+#define WDTSSEL         0x0004
+#define WDT_ADLY_250    (WDTPW + WDTTMSEL + WDTCNTCL + WDTSSEL)
+
+// Ports
+#define P1IN            SIM_R8(0x0020)
+#define P1OUT           SIM_R8(0x0021)
+#define P1DIR           SIM_R8(0x0022)
+#define P1IFG           SIM_R8(0x0023)
+#define P1IES           SIM_R8(0x0024)
+#define P1IE            SIM_R8(0x0025)
+#define P1SEL           SIM_R8(0x0026)
+#define P1REN           SIM_R8(0x0027)
+#define P1SEL2          SIM_R8(0x0041)
+#define P2IN            SIM_R8(0x0028)
+#define P2OUT           SIM_R8(0x0029)
+#define P2DIR           SIM_R8(0x002A)
+#define P2IFG           SIM_R8(0x002B)
+#define P2IES           SIM_R8(0x002C)
+#define P2IE            SIM_R8(0x002D)
+#define P2SEL           SIM_R8(0x002E)
+#define P2REN           SIM_R8(0x002F)
+#define P2SEL2          SIM_R8(0x0042)
+#define P3IN            SIM_R8(0x0018)
+#define P3OUT           SIM_R8(0x0019)
+#define P3DIR           SIM_R8(0x001A)
+#define P3SEL           SIM_R8(0x001B)
+#define P3REN           SIM_R8(0x0010)
+#define P3SEL2          SIM_R8(0x0043)
+
+// Basic clock
+#define DCOCTL          SIM_R8(0x0056)
+#define BCSCTL1         SIM_R8(0x0057)
+#define BCSCTL2         SIM_R8(0x0058)
+#define BCSCTL3         SIM_R8(0x0053)
+#define DIVA_0          0x00
+#define DIVA_1          0x10
+#define DIVA_2          0x20
+#define DIVA_3          0x30
+#define DIVS_0          0x00
+#define DIVS_1          0x02
+#define DIVS_2          0x04
+#define DIVS_3          0x06
+#define LFXT1S_0        0x00
+#define LFXT1S_2        0x20
+#define LFXT1S_3        0x30
+
+extern const uint8_t sim_cal[8];            // Info memory calibration
+#define CALDCO_16MHZ    sim_cal[0]
+#define CALBC1_16MHZ    sim_cal[1]
+#define CALDCO_12MHZ    sim_cal[2]
+#define CALBC1_12MHZ    sim_cal[3]
+#define CALDCO_8MHZ     sim_cal[4]
+#define CALBC1_8MHZ     sim_cal[5]
+#define CALDCO_1MHZ     sim_cal[6]
+#define CALBC1_1MHZ     sim_cal[7]
+
+// Timer0_A3
+#define TA0IV           SIM_R16(0x012E)
+#define TA0CTL          SIM_R16(0x0160)
+#define TA0CCTL0        SIM_R16(0x0162)
+#define TA0CCTL1        SIM_R16(0x0164)
+#define TA0CCTL2        SIM_R16(0x0166)
+#define TA0R            SIM_R16(0x0170)
+#define TA0CCR0         SIM_R16(0x0172)
+#define TA0CCR1         SIM_R16(0x0174)
+#define TA0CCR2         SIM_R16(0x0176)
+#define TAIV            TA0IV
+#define TACTL           TA0CTL
+#define TACCTL0         TA0CCTL0
+#define TACCTL1         TA0CCTL1
+#define TACCTL2         TA0CCTL2
+#define TAR             TA0R
+#define TACCR0          TA0CCR0
+#define TACCR1          TA0CCR1
+#define TACCR2          TA0CCR2
+
+// Timer1_A3 (G2553; counts and interrupts only, see sim.c)
+#define TA1IV           SIM_R16(0x011E)
+#define TA1CTL          SIM_R16(0x0180)
+#define TA1CCTL0        SIM_R16(0x0182)
+#define TA1CCTL1        SIM_R16(0x0184)
+#define TA1CCTL2        SIM_R16(0x0186)
+#define TA1R            SIM_R16(0x0190)
+#define TA1CCR0         SIM_R16(0x0192)
+#define TA1CCR1         SIM_R16(0x0194)
+#define TA1CCR2         SIM_R16(0x0196)
+
+#define TASSEL_0        0x0000
+#define TASSEL_1        0x0100
+#define TASSEL_2        0x0200
+#define ID_0            0x0000
+#define ID_1            0x0040
+#define ID_2            0x0080
+#define ID_3            0x00C0
+#define MC_0            0x0000
+#define MC_1            0x0010
+#define MC_2            0x0020
+#define MC_3            0x0030
+#define TACLR           0x0004
+#define TAIE            0x0002
+#define TAIFG           0x0001
+
+#define CM_0            0x0000
+#define CM_1            0x4000
+#define CM_2            0x8000
+#define CM_3            0xC000
+#define CM0             0x4000
+#define CM1             0x8000
+#define CCIS_0          0x0000
+#define CCIS_1          0x1000
+#define CCIS_2          0x2000
+#define CCIS_3          0x3000
+#define SCS             0x0800
+#define SCCI            0x0400
+#define CAP             0x0100
+#define OUTMOD_0        0x0000
+#define OUTMOD_1        0x0020
+#define OUTMOD_2        0x0040
+#define OUTMOD_3        0x0060
+#define OUTMOD_4        0x0080
+#define OUTMOD_5        0x00A0
+#define OUTMOD_6        0x00C0
+#define OUTMOD_7        0x00E0
+#define OUTMOD0         0x0020
+#define OUTMOD1         0x0040
+#define OUTMOD2         0x0080
+#define CCIE            0x0010
+#define CCI             0x0008
+#define OUT             0x0004
+#define COV             0x0002
+#define CCIFG           0x0001
+
+// USI (G2452)
+#define USICTL0         SIM_R8(0x0078)
+#define USICTL1         SIM_R8(0x0079)
+#define USICKCTL        SIM_R8(0x007A)
+#define USICNT          SIM_R8(0x007B)
+#define USISRL          SIM_R8(0x007C)
+#define USISRH          SIM_R8(0x007D)
+#define USIPE7          0x80
+#define USIPE6          0x40
+#define USIPE5          0x20
+#define USILSB          0x10
+#define USIMST          0x08
+#define USIGE           0x04
+#define USIOE           0x02
+#define USISWRST        0x01
+#define USICKPH         0x80
+#define USII2C          0x40
+#define USIIE           0x10
+#define USIIFG          0x01
+#define USIDIV_0        0x00
+#define USIDIV_1        0x20
+#define USIDIV_2        0x40
+#define USIDIV_3        0x60
+#define USIDIV_4        0x80
+#define USIDIV_5        0xA0
+#define USIDIV_6        0xC0
+#define USIDIV_7        0xE0
+#define USISSEL_0       0x00
+#define USISSEL_1       0x04
+#define USISSEL_2       0x08
+#define USICKPL         0x02
+
+// USCI_A0 UART (G2553)
+#define UCA0CTL0        SIM_R8(0x0060)
+#define UCA0CTL1        SIM_R8(0x0061)
+#define UCA0BR0         SIM_R8(0x0062)
+#define UCA0BR1         SIM_R8(0x0063)
+#define UCA0MCTL        SIM_R8(0x0064)
+#define UCA0STAT        SIM_R8(0x0065)
+#define UCA0RXBUF       SIM_R8(0x0066)
+#define UCA0TXBUF       SIM_R8(0x0067)
+#define UCSSEL_1        0x40
+#define UCSSEL_2        0x80
+#define UCSWRST         0x01
+#define UCBRS0          0x02
+
+// USCI_B0 SPI (G2553)
+#define UCB0CTL0        SIM_R8(0x0068)
+#define UCB0CTL1        SIM_R8(0x0069)
+#define UCB0BR0         SIM_R8(0x006A)
+#define UCB0BR1         SIM_R8(0x006B)
+#define UCB0STAT        SIM_R8(0x006D)
+#define UCB0RXBUF       SIM_R8(0x006E)
+#define UCB0TXBUF       SIM_R8(0x006F)
+#define UCCKPH          0x80
+#define UCMSB           0x20
+#define UCMST           0x08
+#define UCSYNC          0x01
+#define UCBUSY          0x01
+
+// ADC10
+#define ADC10AE0        SIM_R8(0x004A)
+#define ADC10CTL0       SIM_R16(0x01B0)
+#define ADC10CTL1       SIM_R16(0x01B2)
+#define ADC10MEM        SIM_R16(0x01B4)
+#define SREF_1          0x2000
+#define ADC10SHT_3      0x1800
+#define REFON           0x0020
+#define ADC10ON         0x0010
+#define ADC10IE         0x0008
+#define ADC10IFG        0x0004
+#define ENC             0x0002
+#define ADC10SC         0x0001
+#define INCH_10         0xA000
+#define ADC10DIV_3      0x0060
+
+#endif
@@ -0,0 +1,913 @@
+//******************************************************************************
+//  Host simulation: peripheral models. See msp430.h.
+//
+//  Modelled, enough for the folder programs and lib/:
+//    Basic clock     DCO from the CALBC1_xMHZ values, DIVS, VLO with DIVA
+//    Timer0_A3       up/continuous/up-down, compare with output units and
+//                    SCCI, capture on CCI0A (RXD), CCIxB (ACLK), TAIV
+//    Timer1_A3       up/continuous, compare flags, interrupts and TA1IV only
+//    USI             SPI master, to an FM25V40 model on P2.0 CS_
+//    USCI_A0         UART, 1 byte TXBUF + shift register, RXBUF
+//    USCI_B0         SPI master, to the FM25V40 model as the USI
+//    ADC10           single conversions of SIM_ADC
+//    Software UART   TA0.1 on P1.2 decoded at SIM_BAUD while CCR1 drives it as
+//                    one; RXD driven from stdin
+//
+//  Environment:
+//    SIM_SECONDS     simulated run time, default 5 (0: no limit)
+//    SIM_BAUD        host UART rate, default 9600
+//    SIM_VLO         VLO Hz, default 12000
+//    SIM_ADC         ADC10MEM result, default 0x2A0
+//    SIM_FRAM        FM25V40 image file, loaded at start and saved at exit
+//    SIM_FRAM_KB     F-RAM density, 16 to 512 (FM25V01 to FM25V40), default 512
+//    SIM_PWM         file for the TA0.2 duty, one byte per PWM period
+//
+//  UART bytes received from the target go to stdout, and bytes read from
+//  stdin are sent to it, once it listens (RXD capture or UCA0RXIE armed).
+//  It runs until SIM_SECONDS, or until it sleeps with nothing left to wake
+//  it (at the end of stdin). A summary goes to stderr at exit.
+//******************************************************************************
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "msp430.h"
+
+#define SIM_IO_CYCLES   4                   // MCLK per register access
+#define SIM_ISR_CYCLES  11                  // Interrupt entry and RETI
+
+// Registers live at their G2xx addresses
+static uint16_t io_w[0x100];
+#define IO8(a)          (((uint8_t *)io_w)[a])
+#define IO16(a)         (io_w[(a) >> 1])
+
+// Addresses of the modelled registers
+enum {
+  A_IE2 = 0x01, A_IFG2 = 0x03, A_P1IN = 0x20, A_P1OUT = 0x21, A_P1DIR = 0x22,
+  A_P1SEL = 0x26, A_P1SEL2 = 0x41, A_P2OUT = 0x29, A_P2DIR = 0x2A,
+  A_BCSCTL3 = 0x53, A_DCOCTL = 0x56, A_BCSCTL1 = 0x57, A_BCSCTL2 = 0x58,
+  A_UCA0CTL1 = 0x61, A_UCA0BR0 = 0x62, A_UCA0BR1 = 0x63, A_UCA0STAT = 0x65,
+  A_UCA0RXBUF = 0x66, A_UCA0TXBUF = 0x67, A_UCB0CTL1 = 0x69, A_UCB0BR0 = 0x6A,
+  A_UCB0BR1 = 0x6B, A_UCB0STAT = 0x6D, A_UCB0RXBUF = 0x6E, A_UCB0TXBUF = 0x6F,
+  A_USICTL0 = 0x78, A_USICTL1 = 0x79, A_USICKCTL = 0x7A, A_USICNT = 0x7B,
+  A_USISRL = 0x7C, A_TA0IV = 0x12E, A_TA0CTL = 0x160, A_TA0CCTL0 = 0x162,
+  A_TA0R = 0x170, A_TA0CCR0 = 0x172, A_TA1IV = 0x11E, A_TA1CTL = 0x180,
+  A_TA1CCTL0 = 0x182, A_TA1R = 0x190, A_TA1CCR0 = 0x192,
+  A_ADC10CTL0 = 0x1B0, A_ADC10MEM = 0x1B4,
+  A_NONE = 0xFFFF
+};
+#define CCTL(i)         IO16(A_TA0CCTL0 + 2 * (i))
+#define CCR(i)          IO16(A_TA0CCR0 + 2 * (i))
+#define CCTL1(i)        IO16(A_TA1CCTL0 + 2 * (i))
+#define CCR1(i)         IO16(A_TA1CCR0 + 2 * (i))
+
+// Calibration: DCO, BC1 pairs for 16, 12, 8 and 1MHz. RSEL picks the rate.
+const uint8_t sim_cal[8] = { 0x95, 0x8F, 0x9E, 0x8E, 0x92, 0x8D, 0x56, 0x86 };
+
+// Interrupt vectors, from the sections interrupt(v) puts ISRs in
+#define SIM_ISR(n)      extern void __start_sim_isr_##n (void) __attribute__((weak));
+SIM_ISR(2) SIM_ISR(3) SIM_ISR(4) SIM_ISR(5) SIM_ISR(6) SIM_ISR(7) SIM_ISR(8)
+SIM_ISR(9) SIM_ISR(10) SIM_ISR(11) SIM_ISR(12) SIM_ISR(13) SIM_ISR(14)
+static void (*const isr[16])(void) = {
+  [2] = __start_sim_isr_2, [3] = __start_sim_isr_3, [4] = __start_sim_isr_4,
+  [5] = __start_sim_isr_5, [6] = __start_sim_isr_6, [7] = __start_sim_isr_7,
+  [8] = __start_sim_isr_8, [9] = __start_sim_isr_9, [10] = __start_sim_isr_10,
+  [11] = __start_sim_isr_11, [12] = __start_sim_isr_12, [13] = __start_sim_isr_13,
+  [14] = __start_sim_isr_14,
+};
+
+// CPU
+static unsigned sr, sr_saved;               // Status register, and on ISR entry
+static int in_isr;
+static unsigned last = A_NONE;              // Register accessed, effects pending
+static uint64_t cycles;                     // MCLK
+static double seconds, limit;
+static volatile sig_atomic_t in_sim;        // Depth in sim code: no stall ticks
+static unsigned long isrs;                  // Interrupts taken
+static unsigned long mclk_hz;
+
+// Clocks
+static unsigned long aclk_hz, aclk_acc;
+static unsigned smclk_cnt;
+
+// Timer0_A
+static unsigned ta_div, ta_down;
+static int ta_out[3];                       // Output unit signals
+static int cci_prev[3];
+
+// Timer1_A
+static unsigned ta1_div;
+
+// Lines and UARTs
+static unsigned baud;
+static int rxd = 1;                         // Host -> target line (P1.1)
+static unsigned rx_frame, rx_bits;          // Bits left, LSB next
+static uint8_t rx_byte;
+static unsigned long rx_bit_cycles, rx_cnt;
+static int input_eof;
+static int txd_prev = 1, txd_bit = -1;      // Soft UART decoder
+static unsigned long txd_cnt;
+static unsigned txd_byte;
+static unsigned long tx_bytes, rx_bytes, tx_errors;
+static int uca_txbuf_full, uca_shift_busy;  // USCI_A0
+static uint8_t uca_txbuf, uca_shift;
+static unsigned long uca_cnt;
+static int ucb_txbuf_full, ucb_shift_busy;  // USCI_B0
+static uint8_t ucb_txbuf, ucb_shift;
+static unsigned long ucb_cnt;
+
+// USI and ADC10
+static unsigned long usi_cnt, adc_cnt;
+
+// Recorders
+static FILE *pwm;
+static double pwm_rate;
+static unsigned long pwm_samples;
+
+static void out_byte(uint8_t c)
+{
+  if (write(1, &c, 1) != 1)
+    exit(0);                                // Host went away
+  tx_bytes++;
+}
+
+//================ FM25V40 ==================
+#define FRAM_SIZE       0x80000             // Largest: FM25V40
+static uint8_t fram[FRAM_SIZE];
+static uint32_t fram_size = FRAM_SIZE;      // SIM_FRAM_KB
+static uint8_t fram_id[9] = { 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xC2, 0x26, 0x40 };
+static int fram_sleep;
+static const char *fram_path;
+static int fram_dirty;
+static enum { F_IDLE, F_OP, F_ADDR, F_DUMMY, F_READ, F_WRITE, F_RDSR, F_WRSR, F_RDID, F_SNR, F_DONE } fst;
+static uint8_t fop, fsr = 0x40;             // Status: bit 6 reads 1, WEL bit 1
+static uint32_t faddr;
+static int fcnt, fwel_used;
+
+static int fram_protected(uint32_t a)
+{
+  switch ((fsr >> 2) & 3) {
+  case 1: return a >= fram_size / 4 * 3;    // Upper quarter
+  case 2: return a >= fram_size / 2;        // Upper half
+  case 3: return 1;
+  }
+  return 0;
+}
+
+static void fram_select(void)
+{
+  fst = F_OP;
+  fwel_used = 0;
+  if (fram_sleep) {                         // CS_ low wakes it: this access is lost
+    fram_sleep = 0;
+    fst = F_IDLE;
+  }
+}
+
+static void fram_deselect(void)
+{
+  if (fwel_used)
+    fsr &= ~0x02;                           // WRITE and WRSR clear WEL when done
+  fst = F_IDLE;
+}
+
+static uint8_t fram_xfer(uint8_t mosi)
+{
+  uint8_t miso = 0xFF;
+
+  switch (fst) {
+  case F_IDLE:
+  case F_DONE:
+    break;
+  case F_OP:
+    fop = mosi;
+    fcnt = 0;
+    faddr = 0;
+    switch (fop) {
+    case 0x06: fsr |= 0x02; fst = F_DONE; break;            // WREN
+    case 0x04: fsr &= ~0x02; fst = F_DONE; break;           // WRDI
+    case 0x05: fst = F_RDSR; break;                         // RDSR
+    case 0x01: fst = F_WRSR; break;                         // WRSR
+    case 0x03: case 0x0B: case 0x02: fst = F_ADDR; break;   // READ FSTRD WRITE
+    case 0x9F: fst = F_RDID; break;                         // RDID
+    case 0xC3: fst = F_SNR; break;                          // SNR
+    case 0xB9: fram_sleep = 1; fst = F_DONE; break;         // SLEEP, from CS_ high
+    default:   fst = F_DONE; break;                         // Unknown
+    }
+    break;
+  case F_ADDR:
+    faddr = (faddr << 8) | mosi;
+    if (++fcnt == (fram_size > 0x10000 ? 3 : 2)) {
+      faddr &= fram_size - 1;
+      fst = fop == 0x02 ? F_WRITE : fop == 0x0B ? F_DUMMY : F_READ;
+    }
+    break;
+  case F_DUMMY:
+    fst = F_READ;
+    break;
+  case F_READ:
+    miso = fram[faddr];
+    faddr = (faddr + 1) & (fram_size - 1);
+    break;
+  case F_WRITE:
+    if ((fsr & 0x02) && !fram_protected(faddr)) {
+      fram[faddr] = mosi;
+      fram_dirty = 1;
+      fwel_used = 1;
+    }
+    faddr = (faddr + 1) & (fram_size - 1);
+    break;
+  case F_RDSR:
+    miso = fsr;
+    break;
+  case F_WRSR:
+    if (fsr & 0x02) {
+      fsr = (fsr & 0x43) | (mosi & 0x8C);
+      fwel_used = 1;
+    }
+    fst = F_DONE;
+    break;
+  case F_RDID:
+    miso = fcnt < 9 ? fram_id[fcnt++] : 0xFF;
+    break;
+  case F_SNR:
+    miso = 0x00;
+    break;
+  }
+  return miso;
+}
+
+static int cs_asserted(void)
+{
+  return (IO8(A_P2DIR) & BIT0) && !(IO8(A_P2OUT) & BIT0);
+}
+
+//================ Exit ==================
+static void sim_exit(void)
+{
+  if (fram_path && fram_dirty) {
+    FILE *f = fopen(fram_path, "wb");
+    if (f) {
+      fwrite(fram, 1, fram_size, f);
+      fclose(f);
+    }
+  }
+  if (pwm) {
+    fclose(pwm);
+    if (pwm_samples)
+      fprintf(stderr, "sim: %lu PWM samples at %.0f Hz\n", pwm_samples, pwm_rate);
+  }
+  fprintf(stderr, "sim: %.6f s, %llu cycles, UART %lu bytes out (%lu bad), %lu in\n",
+          seconds, (unsigned long long)cycles, tx_bytes, tx_errors, rx_bytes);
+}
+
+static void halt(const char *why)
+{
+  fprintf(stderr, "sim: %s\n", why);
+  exit(0);
+}
+
+static void step(unsigned long n);
+
+// A loop polling only RAM (a flag an ISR sets) touches no register, so would
+// never see time pass. If 1ms of host CPU went by without any, run the
+// models until the next interrupt (or 1ms simulated) has been taken.
+static void stall(int sig)
+{
+  static uint64_t seen;
+  unsigned long n = isrs;
+  uint64_t end = cycles + mclk_hz / 1000;
+
+  (void)sig;
+  if (!in_sim && cycles == seen) {
+    in_sim++;
+    while (isrs == n && cycles < end)
+      step(1);
+    in_sim--;
+  }
+  seen = cycles;
+}
+
+__attribute__((constructor)) static void sim_init(void)
+{
+  const char *s;
+
+  limit = (s = getenv("SIM_SECONDS")) ? atof(s) : 5.0;
+  baud = (s = getenv("SIM_BAUD")) ? atoi(s) : 9600;
+  aclk_hz = (s = getenv("SIM_VLO")) ? atol(s) : 12000;
+  IO16(A_ADC10MEM) = (s = getenv("SIM_ADC")) ? strtol(s, 0, 0) : 0x2A0;
+  if ((s = getenv("SIM_FRAM_KB"))) {
+    unsigned d = 1;
+    while (d < 6 && (16u << (d - 1)) < (unsigned)atoi(s))
+      d++;
+    fram_size = 0x2000UL << d;              // Density code d: 8K bytes << d
+    fram_id[7] = 0x20 | d;
+  }
+  if ((fram_path = getenv("SIM_FRAM"))) {
+    FILE *f = fopen(fram_path, "rb");
+    if (f) {
+      if (fread(fram, 1, fram_size, f) == 0)
+        fram_dirty = 1;
+      fclose(f);
+    }
+  }
+  if ((s = getenv("SIM_PWM")))
+    pwm = fopen(s, "wb");
+
+  // PUC values
+  IO8(A_BCSCTL1) = 0x87;                    // DCO ~1.1MHz
+  IO8(A_DCOCTL) = 0x60;
+  IO8(A_USICTL0) = USISWRST;
+  IO8(A_USICTL1) = USIIFG;
+  IO8(A_UCA0CTL1) = UCSWRST;
+  IO8(A_UCB0CTL1) = UCSWRST;
+  IO8(A_IFG2) = UCA0TXIFG | UCB0TXIFG;
+  IO8(A_P2OUT) = 0xFF;
+  ta_out[0] = ta_out[1] = ta_out[2] = 0;
+  fcntl(0, F_SETFL, fcntl(0, F_GETFL) | O_NONBLOCK);
+  atexit(sim_exit);
+
+  struct itimerval t = { { 0, 1000 }, { 0, 1000 } };
+  signal(SIGVTALRM, stall);
+  setitimer(ITIMER_VIRTUAL, &t, 0);
+}
+
+//================ Clocks ==================
+static unsigned long dco_hz(void)
+{
+  switch (IO8(A_BCSCTL1) & 0x0F) {          // RSEL of the calibrations
+  case 0x0F: return 16000000;
+  case 0x0E: return 12000000;
+  case 0x0D: return 8000000;
+  case 0x06: return 1000000;
+  }
+  return 1100000;                           // PUC default
+}
+
+static unsigned smclk_div(void)
+{
+  return 1 << ((IO8(A_BCSCTL2) >> 1) & 3);
+}
+
+static unsigned long aclk_now(void)         // 0 if ACLK is not running
+{
+  if ((IO8(A_BCSCTL3) & 0x30) != LFXT1S_2 || (sr & OSCOFF))
+    return 0;                               // No crystal on the LaunchPad
+  return aclk_hz >> ((IO8(A_BCSCTL1) >> 4) & 3);
+}
+
+//================ Timer0_A ==================
+static int cci(int i)
+{
+  switch ((CCTL(i) >> 12) & 3) {
+  case 0: return i == 0 ? rxd : 1;          // CCI0A = P1.1
+  case 1: return i == 1 ? 0 : aclk_acc < mclk_hz / 2;  // CCIxB = ACLK
+  case 2: return 0;
+  }
+  return 1;
+}
+
+static void out_unit(int i, int at_ccr0)
+{
+  int mode = (CCTL(i) >> 5) & 7;
+
+  if (at_ccr0) {                            // The TACCR0 half of modes 2, 3, 6, 7
+    if (mode == 2 || mode == 3) ta_out[i] = 0;
+    if (mode == 6 || mode == 7) ta_out[i] = 1;
+    return;
+  }
+  switch (mode) {
+  case 1: case 3: ta_out[i] = 1; break;
+  case 5: case 7: ta_out[i] = 0; break;
+  case 2: case 4: case 6: ta_out[i] ^= 1; break;
+  }
+}
+
+static void compare(int i)
+{
+  uint16_t c = CCTL(i);
+
+  c = (c & ~SCCI) | (cci(i) ? SCCI : 0) | CCIFG;
+  CCTL(i) = c;
+  out_unit(i, 0);
+  if (i == 0) {
+    out_unit(1, 1);
+    out_unit(2, 1);
+    if (pwm && ((CCTL(2) >> 5) & 7) == 7) { // TA0.2 duty for this period
+      unsigned long d = (unsigned long)CCR(2) * 256 / ((unsigned long)CCR(0) + 1);
+      fputc(d > 255 ? 255 : d, pwm);
+      pwm_samples++;
+      pwm_rate = (double)mclk_hz / smclk_div() / (1 << ((IO16(A_TA0CTL) >> 6) & 3)) / (CCR(0) + 1);
+    }
+  }
+}
+
+static void ta_tick(void)
+{
+  uint16_t ctl = IO16(A_TA0CTL), r = IO16(A_TA0R), ccr0 = CCR(0);
+  int i;
+
+  if (++ta_div < (1u << ((ctl >> 6) & 3)))
+    return;
+  ta_div = 0;
+  switch (ctl & MC_3) {
+  case MC_1:
+    if (r >= ccr0) { r = 0; ctl |= TAIFG; } else r++;
+    break;
+  case MC_2:
+    if (++r == 0) ctl |= TAIFG;
+    break;
+  case MC_3:
+    if (!ta_down) { if (r >= ccr0) { ta_down = 1; r--; } else r++; }
+    else if (r == 0) { ta_down = 0; r++; }
+    else if (--r == 0) ctl |= TAIFG;
+    break;
+  }
+  IO16(A_TA0CTL) = ctl;
+  IO16(A_TA0R) = r;
+  for (i = 0; i < 3; i++)
+    if (!(CCTL(i) & CAP) && r == CCR(i))
+      compare(i);
+}
+
+static void ta_capture(void)
+{
+  int i;
+
+  for (i = 0; i < 3; i++) {
+    uint16_t c = CCTL(i);
+    int in = cci(i), prev = cci_prev[i];
+
+    cci_prev[i] = in;
+    c = (c & ~CCI) | (in ? CCI : 0);
+    if ((c & CAP) && in != prev
+        && (((c & CM_1) && in) || ((c & CM_2) && !in))) {
+      if (c & CCIFG)
+        c |= COV;
+      c |= CCIFG;
+      CCR(i) = IO16(A_TA0R);
+    }
+    if (!(c & CAP) && ((c >> 5) & 7) == 0)  // Mode 0: output is OUT
+      ta_out[i] = !!(c & OUT);
+    CCTL(i) = c;
+  }
+}
+
+// Read side effect: highest pending TAIV source, cleared
+static uint16_t ta_iv(void)
+{
+  if ((CCTL(1) & (CCIE | CCIFG)) == (CCIE | CCIFG)) { CCTL(1) &= ~CCIFG; return 2; }
+  if ((CCTL(2) & (CCIE | CCIFG)) == (CCIE | CCIFG)) { CCTL(2) &= ~CCIFG; return 4; }
+  if ((IO16(A_TA0CTL) & (TAIE | TAIFG)) == (TAIE | TAIFG)) { IO16(A_TA0CTL) &= ~TAIFG; return 10; }
+  return 0;
+}
+
+//================ Timer1_A ==================
+// No outputs or capture: it only times, as for lib/tune.c
+static void ta1_tick(void)
+{
+  uint16_t ctl = IO16(A_TA1CTL), r = IO16(A_TA1R);
+  int i;
+
+  if (++ta1_div < (1u << ((ctl >> 6) & 3)))
+    return;
+  ta1_div = 0;
+  switch (ctl & MC_3) {
+  case MC_1:
+    if (r >= CCR1(0)) { r = 0; ctl |= TAIFG; } else r++;
+    break;
+  case MC_2:
+    if (++r == 0) ctl |= TAIFG;
+    break;
+  }
+  IO16(A_TA1CTL) = ctl;
+  IO16(A_TA1R) = r;
+  for (i = 0; i < 3; i++)
+    if (!(CCTL1(i) & CAP) && r == CCR1(i))
+      CCTL1(i) |= CCIFG;
+}
+
+static uint16_t ta1_iv(void)
+{
+  if ((CCTL1(1) & (CCIE | CCIFG)) == (CCIE | CCIFG)) { CCTL1(1) &= ~CCIFG; return 2; }
+  if ((CCTL1(2) & (CCIE | CCIFG)) == (CCIE | CCIFG)) { CCTL1(2) &= ~CCIFG; return 4; }
+  if ((IO16(A_TA1CTL) & (TAIE | TAIFG)) == (TAIE | TAIFG)) { IO16(A_TA1CTL) &= ~TAIFG; return 10; }
+  return 0;
+}
+
+static int ta1_runs(void)
+{
+  uint16_t ctl = IO16(A_TA1CTL);
+
+  return (ctl & MC_3) && (((ctl & TASSEL_2) && !(sr & SCG1)) || ((ctl & TASSEL_1) && aclk_now()));
+}
+
+//================ UART lines ==================
+static int input_byte(void)                 // -1: none yet
+{
+  uint8_t c;
+  ssize_t n;
+
+  if (input_eof)
+    return -1;
+  n = read(0, &c, 1);
+  if (n == 1)
+    return c;
+  if (n == 0)
+    input_eof = 1;
+  return -1;
+}
+
+static int waits_for_input(void)           // RXD capture or USCI RX armed
+{
+  return (CCTL(0) & (CAP | CCIE)) == (CAP | CCIE) || (IO8(A_IE2) & UCA0RXIE);
+}
+
+static void rx_line(void)                   // Host -> target, 8N1 at baud
+{
+  if (rx_cnt && --rx_cnt)
+    return;
+  rx_bit_cycles = mclk_hz / baud;
+  if (rx_bits) {
+    rxd = rx_frame & 1;
+    rx_frame >>= 1;
+    if (--rx_bits == 0 && (IO8(A_P1SEL) & IO8(A_P1SEL2) & BIT1) && !(IO8(A_UCA0CTL1) & UCSWRST)) {
+      if (IO8(A_IFG2) & UCA0RXIFG)
+        IO8(A_UCA0STAT) |= 0x20;            // UCOE
+      IO8(A_UCA0RXBUF) = rx_byte;
+      IO8(A_IFG2) |= UCA0RXIFG;
+    }
+    rx_cnt = rx_bit_cycles;
+    return;
+  }
+  rxd = 1;
+  int c = waits_for_input() ? input_byte() : -1;  // Held until it listens
+  if (c >= 0) {
+    rx_byte = c;
+    rx_frame = 0x200 | (c << 1);            // Start, data LSB first, stop
+    rx_bits = 10;
+    rx_bytes++;
+    rx_cnt = 1;                             // Start bit next cycle
+  }
+  else
+    rx_cnt = rx_bit_cycles;                 // Poll again a bit later
+}
+
+static void tx_line(void)                   // Target TA0.1 -> host, decoded
+{
+  int lvl, mode;
+
+  if (!(IO8(A_P1SEL) & BIT2) || (IO8(A_P1SEL2) & BIT2)) {
+    txd_prev = 1;                           // GPIO or USCI: not decoded here
+    txd_bit = -1;
+    return;
+  }
+  lvl = ta_out[1];
+  if (txd_bit < 0) {
+    // A start bit only from the UART's use of CCR1: set or reset (OUTMOD_1,
+    // OUTMOD_5) at each CCIE compare. A PWM or tone on the pin isn't text.
+    mode = (CCTL(1) >> 5) & 7;
+    if (txd_prev && !lvl && (CCTL(1) & CCIE) && (mode == 1 || mode == 5)) {
+      txd_bit = 0;
+      txd_cnt = mclk_hz / baud * 3 / 2;     // Middle of bit 0
+      txd_byte = 0;
+    }
+  }
+  else if (--txd_cnt == 0) {
+    if (txd_bit < 8) {
+      txd_byte |= lvl << txd_bit++;
+      txd_cnt = mclk_hz / baud;
+    }
+    else {
+      if (!lvl)
+        tx_errors++;                        // No stop bit
+      out_byte(txd_byte);
+      txd_bit = -1;
+    }
+  }
+  txd_prev = lvl;
+}
+
+static void uca_load(void)                  // TXBUF to shift register
+{
+  uca_shift = uca_txbuf;
+  uca_shift_busy = 1;
+  uca_txbuf_full = 0;
+  uca_cnt = 10UL * ((IO8(A_UCA0BR1) << 8 | IO8(A_UCA0BR0)) + 1) * smclk_div();
+  IO8(A_IFG2) |= UCA0TXIFG;
+}
+
+static void uca_tick(void)
+{
+  if (uca_shift_busy && --uca_cnt == 0) {
+    out_byte(uca_shift);
+    uca_shift_busy = 0;
+    if (uca_txbuf_full)
+      uca_load();
+  }
+}
+
+//================ USCI_B0 ==================
+static void ucb_load(void)                  // TXBUF to shift register
+{
+  unsigned br = IO8(A_UCB0BR1) << 8 | IO8(A_UCB0BR0);
+
+  ucb_shift = ucb_txbuf;
+  ucb_shift_busy = 1;
+  ucb_txbuf_full = 0;
+  ucb_cnt = 8UL * (br ? br : 1) * smclk_div();
+  IO8(A_UCB0STAT) |= UCBUSY;
+  IO8(A_IFG2) |= UCB0TXIFG;
+}
+
+static void ucb_tick(void)
+{
+  if (ucb_shift_busy && --ucb_cnt == 0) {
+    int pins = (IO8(A_P1SEL) & IO8(A_P1SEL2) & (BIT5 | BIT6 | BIT7)) == (BIT5 | BIT6 | BIT7);
+
+    IO8(A_UCB0RXBUF) = pins && cs_asserted() ? fram_xfer(ucb_shift) : 0xFF;
+    IO8(A_IFG2) |= UCB0RXIFG;
+    ucb_shift_busy = 0;
+    IO8(A_UCB0STAT) &= ~UCBUSY;
+    if (ucb_txbuf_full)
+      ucb_load();
+  }
+}
+
+//================ USI ==================
+static void usi_done(void)
+{
+  unsigned n = IO8(A_USICNT) & 0x1F;
+  uint8_t mosi = (IO8(A_USICTL0) & USIOE) ? IO8(A_USISRL) : 0xFF;
+
+  IO8(A_USISRL) = n >= 8 && cs_asserted() ? fram_xfer(mosi) : 0xFF;
+  IO8(A_USICNT) &= ~0x1F;
+  IO8(A_USICTL1) |= USIIFG;
+}
+
+//================ Access side effects ==================
+static void post(void)
+{
+  unsigned a = last;
+  static int cs_prev;
+
+  last = A_NONE;
+  switch (a) {
+  case A_TA0CTL:
+    if (IO16(A_TA0CTL) & TACLR) {
+      IO16(A_TA0CTL) &= ~TACLR;
+      IO16(A_TA0R) = 0;
+      ta_div = ta_down = 0;
+    }
+    break;
+  case A_TA1CTL:
+    if (IO16(A_TA1CTL) & TACLR) {
+      IO16(A_TA1CTL) &= ~TACLR;
+      IO16(A_TA1R) = 0;
+      ta1_div = 0;
+    }
+    break;
+  case A_USICNT:
+    if ((IO8(A_USICNT) & 0x1F) && !(IO8(A_USICTL0) & USISWRST)) {
+      IO8(A_USICTL1) &= ~USIIFG;
+      usi_cnt = (unsigned long)(IO8(A_USICNT) & 0x1F)
+                * (1 << (IO8(A_USICKCTL) >> 5)) * smclk_div();
+    }
+    break;
+  case A_P2OUT:
+  case A_P2DIR:
+    if (cs_asserted() != cs_prev) {
+      cs_prev = cs_asserted();
+      cs_prev ? fram_select() : fram_deselect();
+    }
+    break;
+  case A_UCA0TXBUF:
+    uca_txbuf = IO8(A_UCA0TXBUF);
+    uca_txbuf_full = 1;
+    IO8(A_IFG2) &= ~UCA0TXIFG;
+    if (!uca_shift_busy)
+      uca_load();
+    break;
+  case A_UCA0RXBUF:
+    IO8(A_IFG2) &= ~UCA0RXIFG;
+    break;
+  case A_UCB0TXBUF:
+    if (IO8(A_UCB0CTL1) & UCSWRST)
+      break;
+    ucb_txbuf = IO8(A_UCB0TXBUF);
+    ucb_txbuf_full = 1;
+    IO8(A_IFG2) &= ~UCB0TXIFG;
+    if (!ucb_shift_busy)
+      ucb_load();
+    break;
+  case A_UCB0RXBUF:
+    IO8(A_IFG2) &= ~UCB0RXIFG;
+    break;
+  case A_ADC10CTL0:
+    if ((IO16(A_ADC10CTL0) & (ENC | ADC10SC)) == (ENC | ADC10SC)) {
+      IO16(A_ADC10CTL0) &= ~ADC10SC;
+      adc_cnt = mclk_hz / 16000 + 1;        // ~60us at ADC10OSC / 4, 64 SHT
+    }
+    break;
+  }
+}
+
+//================ Interrupts ==================
+static int pending(void)                    // Highest priority vector, or 0
+{
+  if ((CCTL1(0) & (CCIE | CCIFG)) == (CCIE | CCIFG))
+    return TIMER1_A0_VECTOR;
+  if ((CCTL1(1) & (CCIE | CCIFG)) == (CCIE | CCIFG)
+      || (CCTL1(2) & (CCIE | CCIFG)) == (CCIE | CCIFG)
+      || (IO16(A_TA1CTL) & (TAIE | TAIFG)) == (TAIE | TAIFG))
+    return TIMER1_A1_VECTOR;
+  if ((CCTL(0) & (CCIE | CCIFG)) == (CCIE | CCIFG))
+    return TIMER0_A0_VECTOR;
+  if ((CCTL(1) & (CCIE | CCIFG)) == (CCIE | CCIFG)
+      || (CCTL(2) & (CCIE | CCIFG)) == (CCIE | CCIFG)
+      || (IO16(A_TA0CTL) & (TAIE | TAIFG)) == (TAIE | TAIFG))
+    return TIMER0_A1_VECTOR;
+  if (IO8(A_IE2) & IO8(A_IFG2) & UCA0RXIFG)
+    return USCIAB0RX_VECTOR;
+  if (IO8(A_IE2) & IO8(A_IFG2) & UCA0TXIFG)
+    return USCIAB0TX_VECTOR;
+  if ((IO16(A_ADC10CTL0) & (ADC10IE | ADC10IFG)) == (ADC10IE | ADC10IFG))
+    return ADC10_VECTOR;
+  return 0;
+}
+
+static void interrupt_check(void)
+{
+  int v;
+
+  if (!(sr & GIE) || in_isr || !(v = pending()))
+    return;
+  if (!isr[v]) {
+    fprintf(stderr, "sim: interrupt %d has no ISR\n", v);
+    exit(1);
+  }
+  if (v == TIMER0_A0_VECTOR)
+    CCTL(0) &= ~CCIFG;                      // Single source flags clear on entry
+  if (v == TIMER1_A0_VECTOR)
+    CCTL1(0) &= ~CCIFG;
+  if (v == ADC10_VECTOR)
+    IO16(A_ADC10CTL0) &= ~ADC10IFG;
+  sr_saved = sr;
+  sr = 0;
+  in_isr = 1;
+  isrs++;
+  step(SIM_ISR_CYCLES);
+  isr[v]();
+  post();
+  sr = sr_saved;
+  in_isr = 0;
+}
+
+//================ Time ==================
+static void step(unsigned long n)
+{
+  while (n--) {
+    mclk_hz = dco_hz();
+    cycles++;
+    seconds += 1.0 / mclk_hz;
+
+    if (!(sr & SCG1) && ++smclk_cnt >= smclk_div()) {
+      smclk_cnt = 0;
+      if ((IO16(A_TA0CTL) & (TASSEL_1 | TASSEL_2)) == TASSEL_2)
+        ta_tick();
+      if ((IO16(A_TA1CTL) & (TASSEL_1 | TASSEL_2)) == TASSEL_2)
+        ta1_tick();
+      if (usi_cnt && --usi_cnt == 0)
+        usi_done();
+      uca_tick();
+      ucb_tick();
+    }
+    if ((aclk_acc += aclk_now()) >= mclk_hz) {
+      aclk_acc -= mclk_hz;
+      if ((IO16(A_TA0CTL) & (TASSEL_1 | TASSEL_2)) == TASSEL_1)
+        ta_tick();
+      if ((IO16(A_TA1CTL) & (TASSEL_1 | TASSEL_2)) == TASSEL_1)
+        ta1_tick();
+    }
+    if (adc_cnt && --adc_cnt == 0)
+      IO16(A_ADC10CTL0) |= ADC10IFG;
+
+    rx_line();
+    IO8(A_P1IN) = (IO8(A_P1IN) & ~BIT1) | (rxd ? BIT1 : 0);
+    ta_capture();
+    tx_line();
+    interrupt_check();
+  }
+  if (limit > 0 && seconds >= limit)
+    halt("time limit (SIM_SECONDS)");
+}
+
+// Could anything wake the CPU without more input?
+static int can_wake(void)
+{
+  uint16_t ctl = IO16(A_TA0CTL);
+  int i, ta_runs;
+
+  if (usi_cnt || adc_cnt || uca_shift_busy || ucb_shift_busy || rx_bits || txd_bit >= 0)
+    return 1;
+  ta_runs = (ctl & MC_3) && (((ctl & TASSEL_2) && !(sr & SCG1)) || ((ctl & TASSEL_1) && aclk_now()));
+  if (ta_runs && (ctl & TAIE))
+    return 1;
+  if (ta1_runs() && ((IO16(A_TA1CTL) & TAIE) || ((CCTL1(0) | CCTL1(1) | CCTL1(2)) & CCIE)))
+    return 1;
+  for (i = 0; i < 3; i++) {
+    uint16_t c = CCTL(i);
+    if (!(c & CCIE))
+      continue;
+    if (!(c & CAP) && ta_runs)
+      return 1;
+    if ((c & CAP) && ((c >> 12) & 3) == 1 && aclk_now())
+      return 1;
+  }
+  return (IO8(A_IE2) & IO8(A_IFG2) & UCA0TXIFG) != 0;
+}
+
+//================ Intrinsics ==================
+void *sim_io(unsigned a)
+{
+  in_sim++;
+  post();
+  step(SIM_IO_CYCLES);
+  if (a == A_TA0IV)
+    IO16(A_TA0IV) = ta_iv();
+  if (a == A_TA1IV)
+    IO16(A_TA1IV) = ta1_iv();
+  last = a;
+  in_sim--;
+  return &IO8(a);
+}
+
+void sim_bis_sr(unsigned bits)
+{
+  unsigned long idle = 0;
+
+  in_sim++;
+  post();
+  if (in_isr) {
+    sr |= bits & GIE;                       // No LPM inside an ISR here
+    in_sim--;
+    return;
+  }
+  sr |= bits;
+  interrupt_check();
+  while (sr & CPUOFF) {                     // Low power mode: until an ISR ends it
+    step(1);
+    if (++idle < 4096)
+      continue;
+    idle = 0;
+    if (can_wake())
+      continue;
+    if (!waits_for_input() || input_eof)
+      halt("asleep with nothing to wake it");
+    struct pollfd p = { 0, POLLIN, 0 };     // Only input can: wait for the host
+    poll(&p, 1, -1);
+  }
+  in_sim--;
+}
+
+void sim_bic_sr(unsigned bits)
+{
+  in_sim++;
+  post();
+  sr &= ~bits;
+  in_sim--;
+}
+
+void sim_bic_sr_on_exit(unsigned bits)
+{
+  if (in_isr)
+    sr_saved &= ~bits;
+}
+
+void sim_delay(unsigned long n)
+{
+  in_sim++;
+  post();
+  step(n);
+  in_sim--;
+}
+
+unsigned sim_bcd_add(unsigned long a, unsigned long b, int digits)
+{
+  unsigned long r = 0;
+  int i, carry = 0;
+
+  for (i = 0; i < digits; i++) {
+    int d = (a & 15) + (b & 15) + carry;
+    carry = d > 9;
+    if (carry)
+      d -= 10;
+    r |= (unsigned long)d << (4 * i);
+    a >>= 4;
+    b >>= 4;
+  }
+  return r;
+}
@@ -0,0 +1,351 @@
+#!/usr/bin/env python3
+# Flash, RAM and stack report for a folder's build, checked against budgets.
+#
+#   size.py MSP430G2452.out main.map [*.su...] [--flash N] [--ram N] [-v]
+#
+# Regions come from the map's Memory Configuration, so the budgets default to
+# the part's flash and RAM. Sizes per function and data object come from the
+# ELF symbols, and stack depths from its code: each function's frame (PUSH,
+# SUB #n,SP) along its branches, plus the deepest of its callees, and never
+# less than -fstack-usage says. Indirect calls may reach any function whose
+# address is stored in data (a command table, say).
+#
+# Worst case is main plus the ISRs that can be on the stack at once, each
+# plus 4 for the interrupt's PC and SR. ISRs start with GIE clear, so that is
+# one ISR, unless some set GIE: those may all nest, with one more on top.
+# Functions reachable from more than one of main and the ISRs are listed, as
+# they must be re-entrant.
+#
+# RAM used is .data + .bss + worst-case stack. Exit status 1 if over budget.
+import re
+import struct
+import sys
+
+SHF_ALLOC, SHT_NOBITS, STT_OBJECT, STT_FUNC = 2, 8, 1, 2
+
+
+class Elf:
+    def __init__(self, path):
+        f = self.f = open(path, 'rb').read()
+        if f[:4] != b'\x7fELF' or f[4] != 1 or f[5] != 1:
+            raise SystemExit(path + ': not a 32-bit little-endian ELF')
+        shoff, = struct.unpack_from('<I', f, 32)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', f, 46)
+        raw = [struct.unpack_from('<IIIIIIIIII', f, shoff + i * shentsize) for i in range(shnum)]
+        strs = raw[shstrndx][4]
+        self.sections = []                          # name, type, flags, addr, offset, size
+        for s in raw:
+            name = f[strs + s[0]:f.index(b'\0', strs + s[0])].decode()
+            self.sections.append((name, s[1], s[2], s[3], s[4], s[5]))
+        self.symbols = []                           # name, value, size, type
+        for s in raw:
+            if s[1] != 2:                           # SHT_SYMTAB
+                continue
+            strtab = raw[s[6]][4]
+            for o in range(s[4], s[4] + s[5], 16):
+                name, value, size, info, _, shndx = struct.unpack_from('<IIIBBH', f, o)
+                if name and shndx:
+                    n = f[strtab + name:f.index(b'\0', strtab + name)].decode()
+                    self.symbols.append((n, value, size, info & 15))
+
+    def word(self, addr):
+        for name, typ, flags, a, off, size in self.sections:
+            if flags & SHF_ALLOC and typ != SHT_NOBITS and a <= addr < a + size - 1:
+                return struct.unpack_from('<H', self.f, off + addr - a)[0]
+        return None
+
+
+def regions(path):
+    """Memory Configuration of a GNU ld map: name -> (origin, length)."""
+    r = {}
+    lines = open(path).read().split('\n')
+    try:
+        i = lines.index('Memory Configuration')
+    except ValueError:
+        raise SystemExit(path + ': no Memory Configuration')
+    for line in lines[i + 3:]:
+        m = re.match(r'(\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)', line)
+        if not m:
+            break
+        r[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16))
+    return r
+
+
+# ---- Stack, from the code
+
+def decode(elf, pc):
+    """Length, and what matters to the stack, of the instruction at pc."""
+    w = elf.word(pc)
+    if w is None:
+        return 2, ('end',)
+
+    def ext(reg, mode):                             # Extension word for a source?
+        return (mode == 1 and reg != 3) or (mode == 3 and reg == 0)
+
+    op = w >> 12
+    if op == 1:                                     # Format II
+        fn, As, reg = w >> 7 & 7, w >> 4 & 3, w & 15
+        n = 2 + 2 * ext(reg, As)
+        if fn == 6:
+            return 2, ('ret',)
+        if fn == 4:
+            return n, ('sp', 2)
+        if fn == 5:
+            if reg == 0 and As == 3:
+                return n, ('call', elf.word(pc + 2))
+            return n, ('icall',)
+        return n, ()
+    if op in (2, 3):                                # Jumps
+        off = w & 0x3FF
+        off -= 0x400 if off & 0x200 else 0
+        target = pc + 2 + 2 * off
+        return 2, ('jmp', target) if w >> 10 & 7 == 7 else ('jcc', target)
+    if op >= 4:                                     # Format I
+        src, Ad, As, dst = w >> 8 & 15, w >> 7 & 1, w >> 4 & 3, w & 15
+        n = 2 + 2 * ext(src, As) + 2 * Ad
+        imm = None
+        if src == 3:
+            imm = (0, 1, 2, 0xFFFF)[As]
+        elif src == 2 and As >= 2:
+            imm = (4, 8)[As - 2]
+        elif src == 0 and As == 3:
+            imm = elf.word(pc + 2)
+        if dst == 1 and not Ad and imm is not None and op in (5, 8):   # ADD, SUB #n,SP
+            d = imm if imm < 0x8000 else imm - 0x10000
+            return n, ('sp', d if op == 8 else -d)
+        if op == 4 and src == 1 and As == 3 and not Ad:                 # POP (MOV @SP+,Rn)
+            return n, ('pc', ) if dst == 0 else ('sp', -2)
+        if dst == 1 and not Ad and op in (4, 5, 8):                      # SP from a register
+            return n, ('dyn',)
+        if dst == 2 and not Ad and op in (4, 13) and imm is not None and imm & 8:
+            return n, ('gie',)                                           # MOV, BIS #GIE,SR
+        if dst == 0 and not Ad:                                          # BR
+            if op == 4 and imm is not None and src == 0:
+                return n, ('tail', imm)
+            return n, ('ibr',)
+        return n, ()
+    return 2, ('end',)
+
+
+class Stack:
+    def __init__(self, elf, su=()):
+        self.elf = elf
+        self.funcs = {}                             # address -> (name, size)
+        for name, value, size, typ in elf.symbols:
+            if typ == STT_FUNC and size:
+                self.funcs.setdefault(value, (name, size))
+        # Address taken: the targets of indirect calls
+        self.taken = set()
+        for name, typ, flags, a, off, size in elf.sections:
+            if flags & SHF_ALLOC and typ != SHT_NOBITS and name != '.text' and a < 0xFFE0:
+                for o in range(0, size - 1, 2):
+                    v = struct.unpack_from('<H', elf.f, off + o)[0]
+                    if v in self.funcs:
+                        self.taken.add(v)
+        # -fstack-usage: the compiler's frame sizes, a floor under our own
+        self.su = {}
+        self.dynamic = set()
+        for path in su:
+            for line in open(path):
+                f = line.rstrip('\n').split('\t')
+                if len(f) == 3:
+                    fn = f[0].split(':')[-1]
+                    self.su[fn] = max(self.su.get(fn, 0), int(f[1]))
+                    if f[2] != 'static' and f[2] != 'bounded':
+                        self.dynamic.add(fn)
+        self.memo = {}
+        self.calls = {}                             # address -> callee addresses
+        self.gie = set()                            # Functions that set GIE, or call one that does
+        self.notes = set()
+
+    def frame(self, addr):
+        """Deepest stack in the function at addr, excluding its return address."""
+        if addr in self.memo:
+            return self.memo[addr]
+        name, size = self.funcs.get(addr, ('%04x' % addr, 0x10000))
+        base = name.split('.')[0]
+        self.memo[addr] = 0                         # Recursion: counted once
+        calls = self.calls[addr] = set()
+        depth = {addr: 0}
+        work = [addr]
+        worst = self.su.get(base, 0)
+        if base in self.dynamic:
+            self.notes.add('%s: dynamic frame (-fstack-usage), not bounded' % name)
+
+        def call(t, d):
+            calls.add(t)
+            f = self.frame(t)
+            if t in self.gie:
+                self.gie.add(addr)
+            return d + f
+
+        while work:
+            pc = work.pop()
+            d = depth[pc]
+            n, what = decode(self.elf, pc)
+            nxt = [pc + n]
+            kind = what[0] if what else None
+            if kind == 'sp':
+                d += what[1]
+            elif kind == 'call':
+                worst = max(worst, call(what[1], d + 2))
+            elif kind == 'icall':
+                self.notes.add('%s: indirect call, via address-taken functions' % name)
+                worst = max([worst] + [call(t, d + 2) for t in self.taken if t != addr])
+            elif kind == 'tail':
+                nxt = [what[1]]                     # A jump, or a tail call below
+            elif kind == 'ibr':
+                self.notes.add('%s: indirect branch, not followed' % name)
+                nxt = []
+            elif kind == 'dyn':
+                self.notes.add('%s: SP set from a register, not bounded' % name)
+            elif kind == 'gie':
+                self.gie.add(addr)
+            elif kind in ('ret', 'pc', 'end'):
+                nxt = []
+            elif kind == 'jmp':
+                nxt = [what[1]]
+            elif kind == 'jcc':
+                nxt.append(what[1])
+            worst = max(worst, d)
+            for t in nxt:
+                if not addr <= t < addr + size:     # Jump out: a tail call
+                    if t in self.funcs:
+                        worst = max(worst, call(t, d))
+                elif t not in depth:
+                    depth[t] = d
+                    work.append(t)
+        self.memo[addr] = worst
+        return worst
+
+    def reach(self, addr):
+        """Every function addr may call, addr included."""
+        seen = {addr}
+        work = [addr]
+        while work:
+            for t in self.calls.get(work.pop(), ()):
+                if t not in seen:
+                    seen.add(t)
+                    work.append(t)
+        return seen
+
+    def worst(self, main, isrs):
+        """Worst-case stack: main, then the deepest chain of ISRs that GIE allows.
+
+        An ISR that sets GIE (itself or in a callee) may be interrupted by any
+        other ISR, so every such ISR may be on the stack at once, with one more
+        that doesn't on top. isrs is a list of (address, name). Returns the
+        total and a description."""
+        depth = 2 + self.frame(main) if main is not None else 0
+        for a, n in isrs:
+            self.frame(a)                           # Finds those that set GIE
+        chain = [(4 + self.frame(a), n) for a, n in isrs if a in self.gie]
+        rest = [(4 + self.frame(a), n) for a, n in isrs if a not in self.gie]
+        if rest:
+            chain.append(max(rest))
+        for a, n in isrs:
+            if a in self.gie:
+                self.notes.add('%s: sets GIE, so other ISRs nest on it; itself too if its flag '
+                               'is set again before it returns (counted once)' % n)
+        total = depth + sum(d for d, n in chain)
+        return total, 'main %d' % depth + ''.join(' + %s %d' % (n, d) for d, n in chain)
+
+    def shared(self, main, isrs):
+        """Functions reachable from more than one context that may interrupt another."""
+        ctx = [('main', main)] if main is not None else []
+        ctx += [(n, a) for a, n in isrs]
+        reach = [(n, self.reach(a)) for n, a in ctx]
+        out = []
+        for f in sorted(self.funcs):
+            users = [n for n, r in reach if f in r]
+            if len(users) > 1:
+                out.append((self.funcs[f][0], users))
+        return out
+
+
+def report(elf_path, map_path, su=(), flash_budget=None, ram_budget=None, verbose=False):
+    elf = Elf(elf_path)
+    reg = regions(map_path)
+    rom = reg.get('ROM')
+    ram = reg.get('RAM')
+    if not rom or not ram:
+        raise SystemExit(map_path + ': no ROM or RAM region')
+
+    def within(a, r):
+        return r[0] <= a < r[0] + r[1]
+
+    flash = data = bss = 0
+    for name, typ, flags, a, off, size in elf.sections:
+        if not flags & SHF_ALLOC or not size:
+            continue
+        if within(a, rom):
+            flash += size
+        elif within(a, ram):
+            if typ == SHT_NOBITS:
+                bss += size
+            else:
+                data += size
+                flash += size                       # Its initial values
+    st = Stack(elf, su)
+    main = {n: v for n, v, s, t in elf.symbols if t == STT_FUNC}.get('main')
+    vectors = {}
+    for v in range(0xFFE0, 0xFFFE, 2):
+        a = elf.word(v)
+        if a is not None and a in st.funcs and a != elf.word(0xFFFE):
+            vectors.setdefault(a, []).append(v)
+    isrs = [(a, st.funcs[a][0]) for a in sorted(vectors)]
+    stack, chain = st.worst(main, isrs)
+
+    flash_budget = flash_budget or rom[1]
+    ram_budget = ram_budget or ram[1]
+    used = data + bss + stack
+    print('%s: flash %d of %d (%d%%), RAM %d of %d (%d%%): data %d, bss %d, stack %d'
+          % (elf_path, flash, flash_budget, 100 * flash // flash_budget,
+             used, ram_budget, 100 * used // ram_budget, data, bss, stack))
+    print('  stack:', chain)
+
+    if verbose:
+        funcs = sorted(((s, n, a) for a, (n, s) in st.funcs.items()), reverse=True)
+        print('  %-32s %6s %6s' % ('function', 'flash', 'stack'))
+        for s, n, a in funcs:
+            print('  %-32s %6d %6d' % (n, s, st.frame(a)))
+        objs = sorted(((s, n, v) for n, v, s, t in elf.symbols if t == STT_OBJECT and s), reverse=True)
+        print('  %-32s %6s %6s' % ('object', 'flash', 'RAM'))
+        for s, n, v in objs:
+            print('  %-32s %6s %6s' % (n, s if within(v, rom) else '', s if within(v, ram) else ''))
+        for a, n in isrs:
+            print('  vector %s: %s, stack %d%s' % (' '.join('%04x' % v for v in vectors[a]), n,
+                  4 + st.frame(a), ', sets GIE' if a in st.gie else ''))
+    for n in sorted(st.notes):
+        print('  note:', n)
+    for n, users in st.shared(main, isrs):
+        print('  note: %s: called from %s, must be re-entrant' % (n, ' and '.join(users)))
+
+    ok = True
+    if flash > flash_budget:
+        print('%s: flash over budget by %d' % (elf_path, flash - flash_budget))
+        ok = False
+    if used > ram_budget:
+        print('%s: RAM over budget by %d' % (elf_path, used - ram_budget))
+        ok = False
+    return ok
+
+
+def main():
+    args = sys.argv[1:]
+    opts = {'--flash': None, '--ram': None}
+    verbose = '-v' in args
+    args = [a for a in args if a != '-v']
+    for o in opts:
+        if o in args:
+            i = args.index(o)
+            opts[o] = int(args[i + 1], 0)
+            del args[i:i + 2]
+    if len(args) < 2:
+        raise SystemExit('usage: size.py file.out file.map [file.su...] [--flash N] [--ram N] [-v]')
+    if not report(args[0], args[1], args[2:], opts['--flash'], opts['--ram'], verbose):
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()